@@ -25,6 +25,8 @@
 #   font converter plugins
 #  MAGNUM_PLUGINS_IMAGECONVERTER[|_DEBUG|_RELEASE]_DIR - Directory with dynamic
 #   image converter plugins
+#  MAGNUM_PLUGINS_MESHCONVERTER[|_DEBUG|_RELEASE]_DIR - Directory with dynamic
+#   mesh converter plugins
 #  MAGNUM_PLUGINS_IMPORTER[|_DEBUG|_RELEASE]_DIR  - Directory with dynamic
 #   importer plugins
 #  MAGNUM_PLUGINS_AUDIOIMPORTER[|_DEBUG|_RELEASE]_DIR - Directory with dynamic
@@ -42,8 +44,11 @@
 #  Shapes           - Shapes library
 #  Text             - Text library
 #  TextureTools     - TextureTools library
+#  DdsImageConverter - DDS image converter plugin
 #  MagnumFont       - Magnum bitmap font plugin
 #  MagnumFontConverter - Magnum bitmap font converter plugin
+#  MeshCacheConverter - Mesh cache converter plugin
+#  MeshCacheImporter - Mesh cache importer plugin
 #  ObjImporter      - OBJ importer plugin
 #  TgaImageConverter - TGA image converter plugin
 #  TgaImporter      - TGA importer plugin
@@ -97,6 +102,8 @@
 #  MAGNUM_TARGET_DESKTOP_GLES   - Defined if compiled with OpenGL ES
 #   emulation on desktop OpenGL
 #  MAGNUM_TARGET_WEBGL          - Defined if compiled for WebGL
+#  MAGNUM_TARGET_SIMD           - Defined if compiled with SIMD-accelerated
+#   math
 #
 # Additionally these variables are defined for internal usage:
 #  MAGNUM_INCLUDE_DIR           - Root include dir (w/o dependencies)
@@ -116,6 +123,8 @@
 #   plugin installation directory
 #  MAGNUM_PLUGINS_IMAGECONVERTER_[DEBUG|RELEASE]_INSTALL_DIR - Image converter
 #   plugin installation directory
+#  MAGNUM_PLUGINS_MESHCONVERTER_[DEBUG|RELEASE]_INSTALL_DIR - Mesh converter
+#   plugin installation directory
 #  MAGNUM_PLUGINS_IMPORTER_[DEBUG|RELEASE]_INSTALL_DIR  - Importer plugin
 #   installation directory
 #  MAGNUM_PLUGINS_AUDIOIMPORTER_[DEBUG|RELEASE]_INSTALL_DIR - Audio importer
@@ -197,7 +206,8 @@ set(_magnumFlags
     TARGET_GLES2
     TARGET_GLES3
     TARGET_DESKTOP_GLES
-    TARGET_WEBGL)
+    TARGET_WEBGL
+    TARGET_SIMD)
 foreach(_magnumFlag ${_magnumFlags})
     string(FIND "${_magnumConfigure}" "#define MAGNUM_${_magnumFlag}" _magnum_${_magnumFlag})
     if(NOT _magnum_${_magnumFlag} EQUAL -1)
@@ -222,6 +232,10 @@ elseif(MAGNUM_TARGET_GLES3)
     find_package(OpenGLES3 REQUIRED)
     set(MAGNUM_LIBRARIES ${MAGNUM_LIBRARIES} ${OPENGLES3_LIBRARY})
 endif()
+if(NOT CORRADE_TARGET_EMSCRIPTEN)
+    find_package(Threads REQUIRED)
+    set(MAGNUM_LIBRARIES ${MAGNUM_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
+endif()
 
 # Emscripten needs special flag to use WebGL 2
 if(CORRADE_TARGET_EMSCRIPTEN AND NOT MAGNUM_TARGET_GLES2 AND NOT CMAKE_EXE_LINKER_FLAGS MATCHES "USE_WEBGL2")
@@ -240,6 +254,8 @@ foreach(component ${Magnum_FIND_COMPONENTS})
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TextureTools)
     elseif(component STREQUAL DebugTools)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools Primitives SceneGraph Shaders Shapes)
+    elseif(component STREQUAL DdsImageConverter)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TextureTools)
     elseif(component STREQUAL MagnumFont)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TgaImporter) # and below
     elseif(component STREQUAL MagnumFontConverter)
@@ -298,6 +314,11 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     elseif(${component} MATCHES ".+FontConverter$")
         set(_MAGNUM_${_COMPONENT}_IS_PLUGIN 1)
         set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX fontconverters)
+
+    # MeshConverter plugin specific name suffixes
+    elseif(${component} STREQUAL MeshCacheConverter)
+        set(_MAGNUM_${_COMPONENT}_IS_PLUGIN 1)
+        set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX meshconverters)
     endif()
 
     # Set plugin defaults, find the plugin
@@ -586,6 +607,8 @@ set(MAGNUM_PLUGINS_FONTCONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTAL
 set(MAGNUM_PLUGINS_FONTCONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/fontconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/imageconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/imageconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_IMPORTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/audioimporters)
@@ -607,6 +630,8 @@ mark_as_advanced(FORCE
     MAGNUM_PLUGINS_FONTCONVERTER_RELEASE_INSTALL_DIR
     MAGNUM_PLUGINS_IMAGECONVERTER_DEBUG_INSTALL_DIR
     MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_INSTALL_DIR
+    MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_INSTALL_DIR
+    MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_INSTALL_DIR
     MAGNUM_PLUGINS_IMPORTER_DEBUG_INSTALL_DIR
     MAGNUM_PLUGINS_IMPORTER_RELEASE_INSTALL_DIR
     MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_INSTALL_DIR
@@ -633,6 +658,9 @@ set(MAGNUM_PLUGINS_FONTCONVERTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/fontc
 set(MAGNUM_PLUGINS_IMAGECONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/imageconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/imageconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/imageconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_IMPORTER_DIR ${MAGNUM_PLUGINS_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/importers)
@@ -101,6 +101,13 @@ UnsignedInt Attribute<Math::Vector<3, Float>>::size(GLint components, DataType d
             CORRADE_INTERNAL_ASSERT(components == 3);
             return 4;
         #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        case DataType::UnsignedInt2101010Rev:
+        case DataType::Int2101010Rev:
+            CORRADE_INTERNAL_ASSERT(components == 3);
+            return 4;
+        #endif
     }
 
     CORRADE_ASSERT_UNREACHABLE();
@@ -297,6 +304,10 @@ Debug operator<<(Debug debug, Attribute<Math::Vector<3, Float>>::DataType value)
         _c(Double)
         _c(UnsignedInt10f11f11fRev)
         #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(UnsignedInt2101010Rev)
+        _c(Int2101010Rev)
+        #endif
         #undef _c
     }
 
@@ -198,8 +198,9 @@ template<UnsignedInt location, class T> class Attribute {
 
             #ifndef MAGNUM_TARGET_GLES2
             /**
-             * Unsigned 2.10.10.10 packed integer. Only for four-component
-             * float vector attribute type.
+             * Unsigned 2.10.10.10 packed integer. Only for three- and
+             * four-component float vector attribute type. For three-component
+             * vectors the two-bit W part is ignored.
              * @todo How about (incompatible) @es_extension{OES,vertex_type_10_10_10_2}?
              * @requires_gl33 Extension @extension{ARB,vertex_type_2_10_10_10_rev}
              * @requires_gles30 Packed attributes are not available in OpenGL
@@ -210,8 +211,9 @@ template<UnsignedInt location, class T> class Attribute {
             UnsignedInt2101010Rev = GL_UNSIGNED_INT_2_10_10_10_REV,
 
             /**
-             * Signed 2.10.10.10 packed integer. Only for four-component float
-             * vector attribute type.
+             * Signed 2.10.10.10 packed integer. Only for three- and
+             * four-component float vector attribute type. For three-component
+             * vectors the two-bit W part is ignored.
              * @requires_gl33 Extension @extension{ARB,vertex_type_2_10_10_10_rev}
              * @requires_gles30 Packed attributes are not available in OpenGL
              *      ES 2.0.
@@ -486,6 +488,11 @@ template<> struct Attribute<Math::Vector<3, Float>>: SizedAttribute<1, 3> {
         Double = GL_DOUBLE,
         UnsignedInt10f11f11fRev = GL_UNSIGNED_INT_10F_11F_11F_REV
         #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        ,
+        UnsignedInt2101010Rev = GL_UNSIGNED_INT_2_10_10_10_REV,
+        Int2101010Rev = GL_INT_2_10_10_10_REV
+        #endif
     };
     constexpr static DataType DefaultDataType = DataType::Float;
 
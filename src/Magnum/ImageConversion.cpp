@@ -0,0 +1,831 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageConversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Implementation/Simd.h"
+
+namespace Magnum { namespace ImageConversion {
+
+namespace {
+
+/* Don't bother spawning threads for less data than this */
+constexpr std::size_t MinParallelRangeSize = 64*1024;
+
+/* Components of half floats converted to 8-bit are unpacked to floats in
+   chunks of this size */
+constexpr std::size_t ChunkSize = 256;
+
+void swapRedBlue3(const UnsignedByte* in, UnsignedByte* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSSE3)
+    /* Five pixels in each 16-byte block, the last byte is kept as-is so the
+       in-place operation doesn't corrupt the next pixel. A block is
+       processed only if all its 16 bytes are inside the data. */
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    for(; count >= 6; count -= 5, in += 15, out += 15)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), shuffle));
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; count >= 16; count -= 16, in += 48, out += 48) {
+        uint8x16x3_t pixels = vld3q_u8(in);
+        const uint8x16_t b = pixels.val[0];
+        pixels.val[0] = pixels.val[2];
+        pixels.val[2] = b;
+        vst3q_u8(out, pixels);
+    }
+    #endif
+
+    for(; count; --count, in += 3, out += 3) {
+        const UnsignedByte b = in[0];
+        out[0] = in[2];
+        out[1] = in[1];
+        out[2] = b;
+    }
+}
+
+void swapRedBlue4(const UnsignedByte* in, UnsignedByte* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for(; count >= 4; count -= 4, in += 16, out += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), shuffle));
+    #elif defined(MAGNUM_MATH_SSE2)
+    /* Without byte shuffle the swap is done with shifts on little-endian
+       32-bit pixels */
+    const __m128i greenAlpha = _mm_set1_epi32(0xff00ff00);
+    const __m128i blue = _mm_set1_epi32(0x000000ff);
+    for(; count >= 4; count -= 4, in += 16, out += 16) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_or_si128(
+            _mm_and_si128(pixels, greenAlpha), _mm_or_si128(
+                _mm_slli_epi32(_mm_and_si128(pixels, blue), 16),
+                _mm_and_si128(_mm_srli_epi32(pixels, 16), blue))));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; count >= 16; count -= 16, in += 64, out += 64) {
+        uint8x16x4_t pixels = vld4q_u8(in);
+        const uint8x16_t b = pixels.val[0];
+        pixels.val[0] = pixels.val[2];
+        pixels.val[2] = b;
+        vst4q_u8(out, pixels);
+    }
+    #endif
+
+    for(; count; --count, in += 4, out += 4) {
+        const UnsignedByte b = in[0];
+        out[0] = in[2];
+        out[1] = in[1];
+        out[2] = b;
+        out[3] = in[3];
+    }
+}
+
+/* Processed from the end so the output can overwrite the input */
+void rgbToRgbaImpl(const UnsignedByte* const in, UnsignedByte* const out, std::size_t count, const UnsignedByte alpha) {
+    #if defined(MAGNUM_MATH_SSSE3)
+    /* The 16-byte load of last four pixels would read past the input, so
+       the last two pixels are done separately */
+    std::size_t end = count;
+    for(; end && end + 2 > count; --end) {
+        const UnsignedByte* const i = in + (end - 1)*3;
+        UnsignedByte* const o = out + (end - 1)*4;
+        const UnsignedByte r = i[0], g = i[1], b = i[2];
+        o[0] = r; o[1] = g; o[2] = b; o[3] = alpha;
+    }
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alphas = _mm_set1_epi32(Int(UnsignedInt(alpha) << 24));
+    for(; end >= 4; end -= 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + (end - 4)*4), _mm_or_si128(alphas,
+            _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + (end - 4)*3)), shuffle)));
+    count = end;
+    #elif defined(MAGNUM_MATH_NEON)
+    std::size_t end = count;
+    for(; end % 16; --end) {
+        const UnsignedByte* const i = in + (end - 1)*3;
+        UnsignedByte* const o = out + (end - 1)*4;
+        const UnsignedByte r = i[0], g = i[1], b = i[2];
+        o[0] = r; o[1] = g; o[2] = b; o[3] = alpha;
+    }
+    for(; end; end -= 16) {
+        const uint8x16x3_t rgb = vld3q_u8(in + (end - 16)*3);
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = vdupq_n_u8(alpha);
+        vst4q_u8(out + (end - 16)*4, rgba);
+    }
+    count = 0;
+    #endif
+
+    for(; count; --count) {
+        const UnsignedByte* const i = in + (count - 1)*3;
+        UnsignedByte* const o = out + (count - 1)*4;
+        const UnsignedByte r = i[0], g = i[1], b = i[2];
+        o[0] = r; o[1] = g; o[2] = b; o[3] = alpha;
+    }
+}
+
+void rgbaToRgbImpl(const UnsignedByte* in, UnsignedByte* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSSE3)
+    /* Each store writes four garbage bytes after the twelve output bytes,
+       these get overwritten by the next block. A block is processed only if
+       the garbage is still inside the output. */
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    for(; count >= 6; count -= 4, in += 16, out += 12)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), shuffle));
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; count >= 16; count -= 16, in += 64, out += 48) {
+        const uint8x16x4_t rgba = vld4q_u8(in);
+        uint8x16x3_t rgb;
+        rgb.val[0] = rgba.val[0];
+        rgb.val[1] = rgba.val[1];
+        rgb.val[2] = rgba.val[2];
+        vst3q_u8(out, rgb);
+    }
+    #endif
+
+    for(; count; --count, in += 4, out += 3) {
+        out[0] = in[0];
+        out[1] = in[1];
+        out[2] = in[2];
+    }
+}
+
+void normalizeImpl(const UnsignedByte* in, Float* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(1.0f/255.0f);
+    for(; count >= 16; count -= 16, in += 16, out += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(out + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(out + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(out + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(out + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; count >= 8; count -= 8, in += 8, out += 8) {
+        const uint16x8_t shorts = vmovl_u8(vld1_u8(in));
+        vst1q_f32(out + 0, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(shorts))), 1.0f/255.0f));
+        vst1q_f32(out + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(shorts))), 1.0f/255.0f));
+    }
+    #endif
+
+    for(; count; --count, ++in, ++out)
+        *out = *in*(1.0f/255.0f);
+}
+
+void denormalizeImpl(const Float* in, UnsignedByte* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSE2)
+    /* The max() returns the second operand for NaN, so it's clamped to zero
+       as well */
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for(; count >= 16; count -= 16, in += 16, out += 16) {
+        __m128i v[4];
+        for(std::size_t i = 0; i != 4; ++i)
+            v[i] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i*4), zero), one), scale), half));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(
+            _mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3])));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for(; count >= 8; count -= 8, in += 8, out += 8) {
+        const uint32x4_t lo = vcvtq_u32_f32(vmlaq_n_f32(vdupq_n_f32(0.5f), vminq_f32(vmaxq_f32(vld1q_f32(in + 0), zero), one), 255.0f));
+        const uint32x4_t hi = vcvtq_u32_f32(vmlaq_n_f32(vdupq_n_f32(0.5f), vminq_f32(vmaxq_f32(vld1q_f32(in + 4), zero), one), 255.0f));
+        vst1_u8(out, vmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi))));
+    }
+    #endif
+
+    for(; count; --count, ++in, ++out) {
+        const Float value = *in > 0.0f ? (*in < 1.0f ? *in : 1.0f) : 0.0f;
+        *out = UnsignedByte(value*255.0f + 0.5f);
+    }
+}
+
+Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+/* Linear value for each sRGB-encoded byte */
+struct SrgbToLinearTable {
+    SrgbToLinearTable() {
+        for(std::size_t i = 0; i != 256; ++i) {
+            linear[i] = srgbToLinear(i/255.0f);
+            linearHalf[i] = Math::Half{linear[i]};
+            half[i] = Math::Half{i/255.0f};
+        }
+    }
+
+    Float linear[256];
+    Math::Half linearHalf[256];
+    Math::Half half[256];
+};
+
+const SrgbToLinearTable& srgbToLinearTable() {
+    static const SrgbToLinearTable table;
+    return table;
+}
+
+/* Linear values in the middle between two consecutive sRGB-encoded bytes,
+   count of values smaller than given value is the rounded sRGB value. To
+   avoid searching all of them, values in [2^-13, 1) are split into buckets
+   by exponent and top 8 mantissa bits. Relative distance of two consecutive
+   thresholds is always larger than 1/256, so each bucket contains at most
+   one threshold and the bucket start together with a single comparison
+   gives the result. Smaller values (and NaN) are zero, larger are 255. */
+constexpr UnsignedInt LinearToSrgbMinBits = (127 - 13) << 23;
+constexpr UnsignedInt LinearToSrgbBucketShift = 23 - 8;
+
+struct LinearToSrgbTable {
+    LinearToSrgbTable() {
+        for(std::size_t i = 0; i != 255; ++i)
+            thresholds[i] = srgbToLinear((i + 0.5f)/255.0f);
+        thresholds[255] = 2.0f;
+
+        for(UnsignedInt i = 0; i != 13 << 8; ++i) {
+            const UnsignedInt bits = LinearToSrgbMinBits + (i << LinearToSrgbBucketShift);
+            Float start;
+            std::memcpy(&start, &bits, 4);
+            buckets[i] = UnsignedByte(std::lower_bound(thresholds, thresholds + 255, start) - thresholds);
+        }
+    }
+
+    Float thresholds[256];
+    UnsignedByte buckets[13 << 8];
+};
+
+const LinearToSrgbTable& linearToSrgbTable() {
+    static const LinearToSrgbTable table;
+    return table;
+}
+
+inline UnsignedByte linearToSrgb(const LinearToSrgbTable& table, const Float value) {
+    if(!(value >= 1.0f/8192.0f)) return 0;
+    if(value >= 1.0f) return 255;
+
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    const UnsignedByte result = table.buckets[(bits - LinearToSrgbMinBits) >> LinearToSrgbBucketShift];
+    return result + (value > table.thresholds[result] ? 1 : 0);
+}
+
+/* Alpha is index of a channel which is only normalized, index larger than
+   channel count means there's no alpha */
+void srgbToLinearImpl(const UnsignedByte* in, Float* out, const std::size_t count, const std::size_t channelCount, const std::size_t alpha) {
+    const Float* const table = srgbToLinearTable().linear;
+    for(std::size_t i = 0; i != count; ++i) for(std::size_t c = 0; c != channelCount; ++c, ++in, ++out)
+        *out = c == alpha ? *in*(1.0f/255.0f) : table[*in];
+}
+
+void srgbToLinearImpl(const UnsignedByte* in, Math::Half* out, const std::size_t count, const std::size_t channelCount, const std::size_t alpha) {
+    const SrgbToLinearTable& table = srgbToLinearTable();
+    for(std::size_t i = 0; i != count; ++i) for(std::size_t c = 0; c != channelCount; ++c, ++in, ++out)
+        *out = c == alpha ? table.half[*in] : table.linearHalf[*in];
+}
+
+void linearToSrgbImpl(const Float* in, UnsignedByte* out, const std::size_t count, const std::size_t channelCount, const std::size_t alpha) {
+    const LinearToSrgbTable& table = linearToSrgbTable();
+    for(std::size_t i = 0; i != count; ++i) for(std::size_t c = 0; c != channelCount; ++c, ++in, ++out) {
+        if(c == alpha) denormalizeImpl(in, out, 1);
+        else *out = linearToSrgb(table, *in);
+    }
+}
+
+void premultiplyAlphaImpl(const UnsignedByte* in, UnsignedByte* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSE2)
+    /* Alpha is multiplied by 255, which keeps it unchanged after the division
+       by 255 */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i colorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    const __m128i alphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+    const __m128i rounding = _mm_set1_epi16(128);
+    for(; count >= 4; count -= 4, in += 16, out += 16) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        __m128i halves[]{_mm_unpacklo_epi8(pixels, zero), _mm_unpackhi_epi8(pixels, zero)};
+        for(__m128i& half: halves) {
+            const __m128i alphas = _mm_or_si128(alphaOne, _mm_and_si128(colorMask,
+                _mm_shufflehi_epi16(_mm_shufflelo_epi16(half, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3))));
+            /* (x + 128 + ((x + 128) >> 8)) >> 8 is x/255 rounded to
+               nearest for x up to 255*255 */
+            const __m128i x = _mm_add_epi16(_mm_mullo_epi16(half, alphas), rounding);
+            half = _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(halves[0], halves[1]));
+    }
+    #endif
+
+    for(; count; --count, in += 4, out += 4) {
+        const UnsignedInt alpha = in[3];
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt x = in[i]*alpha + 128;
+            out[i] = UnsignedByte((x + (x >> 8)) >> 8);
+        }
+        out[3] = UnsignedByte(alpha);
+    }
+}
+
+void premultiplyAlphaImpl(const Float* in, Float* out, std::size_t count) {
+    #if defined(MAGNUM_MATH_SSE2)
+    const __m128 alphaOne = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+    const __m128 colorMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    for(; count; --count, in += 4, out += 4) {
+        const __m128 pixel = _mm_loadu_ps(in);
+        const __m128 alphas = _mm_or_ps(alphaOne, _mm_and_ps(colorMask, _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(out, _mm_mul_ps(pixel, alphas));
+    }
+    #endif
+
+    for(; count; --count, in += 4, out += 4) {
+        const Float alpha = in[3];
+        out[0] = in[0]*alpha;
+        out[1] = in[1]*alpha;
+        out[2] = in[2]*alpha;
+        out[3] = alpha;
+    }
+}
+
+/* Unpremultiplied value for each alpha and color value, to avoid integer
+   division for each component */
+struct UnpremultiplyTable {
+    UnpremultiplyTable() {
+        std::memset(values, 0, 256);
+        for(UnsignedInt alpha = 1; alpha != 256; ++alpha) for(UnsignedInt value = 0; value != 256; ++value)
+            values[alpha*256 + value] = UnsignedByte(std::min((value*255u + alpha/2)/alpha, 255u));
+    }
+
+    UnsignedByte values[256*256];
+};
+
+const UnpremultiplyTable& unpremultiplyTable() {
+    static const UnpremultiplyTable table;
+    return table;
+}
+
+void unpremultiplyAlphaImpl(const UnsignedByte* in, UnsignedByte* out, std::size_t count) {
+    const UnsignedByte* const table = unpremultiplyTable().values;
+    for(; count; --count, in += 4, out += 4) {
+        const UnsignedByte alpha = in[3];
+        const UnsignedByte* const values = table + alpha*256;
+        out[0] = values[in[0]];
+        out[1] = values[in[1]];
+        out[2] = values[in[2]];
+        out[3] = alpha;
+    }
+}
+
+void unpremultiplyAlphaImpl(const Float* in, Float* out, std::size_t count) {
+    for(; count; --count, in += 4, out += 4) {
+        const Float alpha = in[3];
+        const Float scale = alpha != 0.0f ? 1.0f/alpha : 0.0f;
+        out[0] = in[0]*scale;
+        out[1] = in[1]*scale;
+        out[2] = in[2]*scale;
+        out[3] = alpha;
+    }
+}
+
+void normalizeHalfImpl(const UnsignedByte* in, Math::Half* out, std::size_t count) {
+    const Math::Half* const table = srgbToLinearTable().half;
+    for(; count; --count, ++in, ++out) *out = table[*in];
+}
+
+/* Channel layout of a color format, alpha is index of the alpha channel or
+   a value larger than any index if there's no alpha */
+struct Layout {
+    std::size_t channelCount;
+    bool swapped;
+    std::size_t alpha;
+};
+
+constexpr std::size_t NoAlpha = ~std::size_t{};
+
+bool isSwizzlable(const ColorFormat format) {
+    return format == ColorFormat::RGB || format == ColorFormat::RGBA
+        #ifndef MAGNUM_TARGET_GLES
+        || format == ColorFormat::BGR
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        || format == ColorFormat::BGRA
+        #endif
+        ;
+}
+
+Layout layout(const ColorFormat format) {
+    switch(format) {
+        case ColorFormat::RGB: return {3, false, NoAlpha};
+        case ColorFormat::RGBA: return {4, false, 3};
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGR: return {3, true, NoAlpha};
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        case ColorFormat::BGRA: return {4, true, 3};
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::LuminanceAlpha: return {2, false, 1};
+        #endif
+        default: return {AbstractImage::pixelSize(format, ColorType::UnsignedByte), false, NoAlpha};
+    }
+}
+
+std::size_t componentSize(const ColorType type) {
+    switch(type) {
+        case ColorType::UnsignedByte: return 1;
+        case ColorType::HalfFloat: return 2;
+        case ColorType::Float: return 4;
+        default: return 0;
+    }
+}
+
+/* Generic channel conversion for all component types, the output can be the
+   same as input if it doesn't have more channels */
+template<class T> void convertChannels(const T* in, T* out, std::size_t count, const Layout& from, const Layout& to, const T alpha) {
+    for(; count; --count, in += from.channelCount, out += to.channelCount) {
+        const T r = in[from.swapped ? 2 : 0];
+        const T g = in[1];
+        const T b = in[from.swapped ? 0 : 2];
+        out[to.swapped ? 2 : 0] = r;
+        out[1] = g;
+        out[to.swapped ? 0 : 2] = b;
+        if(to.channelCount == 4) out[3] = from.channelCount == 4 ? in[3] : alpha;
+    }
+}
+
+template<> void convertChannels<UnsignedByte>(const UnsignedByte* in, UnsignedByte* out, std::size_t count, const Layout& from, const Layout& to, UnsignedByte) {
+    if(from.channelCount == 3 && to.channelCount == 4) {
+        rgbToRgbaImpl(in, out, count, 255);
+        if(from.swapped != to.swapped) swapRedBlue4(out, out, count);
+    } else if(from.channelCount == 4 && to.channelCount == 3) {
+        rgbaToRgbImpl(in, out, count);
+        if(from.swapped != to.swapped) swapRedBlue3(out, out, count);
+    } else if(from.channelCount == 3) swapRedBlue3(in, out, count);
+    else swapRedBlue4(in, out, count);
+}
+
+void convertChannels(const char* in, char* out, const std::size_t count, const Layout& from, const Layout& to, const ColorType type) {
+    switch(type) {
+        case ColorType::UnsignedByte:
+            convertChannels<UnsignedByte>(reinterpret_cast<const UnsignedByte*>(in), reinterpret_cast<UnsignedByte*>(out), count, from, to, 255);
+            break;
+        case ColorType::HalfFloat:
+            convertChannels<UnsignedShort>(reinterpret_cast<const UnsignedShort*>(in), reinterpret_cast<UnsignedShort*>(out), count, from, to, Math::Half{1.0f}.data());
+            break;
+        case ColorType::Float:
+            convertChannels<Float>(reinterpret_cast<const Float*>(in), reinterpret_cast<Float*>(out), count, from, to, 1.0f);
+            break;
+        default: CORRADE_ASSERT_UNREACHABLE();
+    }
+}
+
+void floatToUnsignedByte(const Float* in, UnsignedByte* out, const std::size_t count, const Layout& layout, const bool srgb) {
+    if(srgb) linearToSrgbImpl(in, out, count, layout.channelCount, layout.alpha);
+    else denormalizeImpl(in, out, count*layout.channelCount);
+}
+
+/* Converts count pixels of given layout between component types, the
+   scratch memory is used for half-float to 8-bit conversion. The output can
+   be the same as input if the components don't get larger. */
+void convertType(const char* const in, const ColorType from, char* const out, const ColorType to, const std::size_t count, const Layout& layout, const bool srgb, Float* const scratch) {
+    const std::size_t componentCount = count*layout.channelCount;
+
+    if(from == ColorType::UnsignedByte && to == ColorType::Float) {
+        const auto input = reinterpret_cast<const UnsignedByte*>(in);
+        const auto output = reinterpret_cast<Float*>(out);
+        if(srgb) srgbToLinearImpl(input, output, count, layout.channelCount, layout.alpha);
+        else normalizeImpl(input, output, componentCount);
+
+    } else if(from == ColorType::UnsignedByte && to == ColorType::HalfFloat) {
+        const auto input = reinterpret_cast<const UnsignedByte*>(in);
+        const auto output = reinterpret_cast<Math::Half*>(out);
+        if(srgb) srgbToLinearImpl(input, output, count, layout.channelCount, layout.alpha);
+        else normalizeHalfImpl(input, output, componentCount);
+
+    } else if(from == ColorType::Float && to == ColorType::UnsignedByte) {
+        floatToUnsignedByte(reinterpret_cast<const Float*>(in), reinterpret_cast<UnsignedByte*>(out), count, layout, srgb);
+
+    } else if(from == ColorType::HalfFloat && to == ColorType::UnsignedByte) {
+        const std::size_t chunkPixelCount = ChunkSize/layout.channelCount;
+        for(std::size_t i = 0; i < count; i += chunkPixelCount) {
+            const std::size_t pixelCount = std::min(chunkPixelCount, count - i);
+            const std::size_t offset = i*layout.channelCount;
+            Math::Batch::unpackHalf({reinterpret_cast<const Math::Half*>(in) + offset, pixelCount*layout.channelCount}, {scratch, pixelCount*layout.channelCount});
+            floatToUnsignedByte(scratch, reinterpret_cast<UnsignedByte*>(out) + offset, pixelCount, layout, srgb);
+        }
+
+    } else if(from == ColorType::Float && to == ColorType::HalfFloat) {
+        Math::Batch::packHalf({reinterpret_cast<const Float*>(in), componentCount}, {reinterpret_cast<Math::Half*>(out), componentCount});
+
+    } else if(from == ColorType::HalfFloat && to == ColorType::Float) {
+        Math::Batch::unpackHalf({reinterpret_cast<const Math::Half*>(in), componentCount}, {reinterpret_cast<Float*>(out), componentCount});
+
+    } else {
+        CORRADE_INTERNAL_ASSERT(from == to);
+        if(in != out) std::memcpy(out, in, componentCount*componentSize(from));
+    }
+}
+
+/* Rows are aligned to four bytes */
+inline std::size_t rowStride(const std::size_t width, const std::size_t pixelSize) {
+    return ((width*pixelSize + 3)/4)*4;
+}
+
+template<UnsignedInt dimensions> std::size_t rowCount(const Math::Vector<dimensions, Int>& size) {
+    std::size_t count = 1;
+    for(UnsignedInt i = 1; i != dimensions; ++i) count *= size[i];
+    return count;
+}
+
+/* Converts rows of an image in parallel. The output can be the same memory
+   as the input if the output pixels aren't larger and both strides are the
+   same. */
+void convertRows(const char* const input, const ColorFormat inputFormat, const ColorType inputType, char* const output, const ColorFormat format, const ColorType type, const std::size_t width, const std::size_t rows, const std::size_t inStride, const std::size_t outStride, const ConversionFlags flags, const std::size_t threadCount) {
+    const Layout from = layout(inputFormat);
+    const Layout to = layout(format);
+    const bool convertsChannels = inputFormat != format;
+    const bool convertsType = inputType != type;
+    const bool srgb = !!(flags & ConversionFlag::Srgb);
+
+    Implementation::parallelFor(rows, threadCount, Implementation::minRangeSize(MinParallelRangeSize, outStride), [&](const std::size_t begin, const std::size_t end) {
+        /* Channels are converted first, in the original component type */
+        std::vector<char> channels;
+        if(convertsChannels && convertsType)
+            channels.resize(width*to.channelCount*componentSize(inputType));
+        std::vector<Float> scratch;
+        if(inputType == ColorType::HalfFloat && type == ColorType::UnsignedByte)
+            scratch.resize(ChunkSize);
+
+        for(std::size_t i = begin; i != end; ++i) {
+            const char* in = input + i*inStride;
+            char* const out = output + i*outStride;
+
+            if(convertsChannels) {
+                char* const channelsOut = convertsType ? channels.data() : out;
+                convertChannels(in, channelsOut, width, from, to, inputType);
+                in = channelsOut;
+            }
+
+            if(convertsType || !convertsChannels)
+                convertType(in, inputType, out, type, width, to, srgb, scratch.data());
+        }
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> convertImpl(const ImageReference<dimensions>& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    CORRADE_ASSERT(componentSize(image.type()) && componentSize(type),
+        "ImageConversion::convert(): unsupported conversion from" << image.type() << "to" << type, (Image<dimensions>{format, type}));
+    CORRADE_ASSERT(image.format() == format || (isSwizzlable(image.format()) && isSwizzlable(format)),
+        "ImageConversion::convert(): unsupported conversion from" << image.format() << "to" << format, (Image<dimensions>{format, type}));
+
+    const std::size_t width = image.size()[0];
+    const std::size_t rows = width ? rowCount<dimensions>(image.size()) : 0;
+    const std::size_t outStride = rowStride(width, AbstractImage::pixelSize(format, type));
+    char* const data = new char[outStride*rows];
+
+    convertRows(image.data(), image.format(), image.type(), data, format, type, width, rows, rowStride(width, image.pixelSize()), outStride, flags, threadCount);
+
+    return Image<dimensions>{format, type, image.size(), data};
+}
+
+template<UnsignedInt dimensions> void convertInPlaceImpl(Image<dimensions>& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    CORRADE_ASSERT(componentSize(image.type()) && componentSize(type),
+        "ImageConversion::convertInPlace(): unsupported conversion from" << image.type() << "to" << type, );
+    CORRADE_ASSERT(image.format() == format || (isSwizzlable(image.format()) && isSwizzlable(format)),
+        "ImageConversion::convertInPlace(): unsupported conversion from" << image.format() << "to" << format, );
+    const std::size_t pixelSize = AbstractImage::pixelSize(format, type);
+    CORRADE_ASSERT(pixelSize <= image.pixelSize(),
+        "ImageConversion::convertInPlace(): can't convert" << image.format() << image.type() << "to larger" << format << type, );
+
+    const std::size_t width = image.size()[0];
+    const std::size_t rows = width ? rowCount<dimensions>(image.size()) : 0;
+    const std::size_t inStride = rowStride(width, image.pixelSize());
+    const std::size_t outStride = rowStride(width, pixelSize);
+    const ColorFormat inputFormat = image.format();
+    const ColorType inputType = image.type();
+    const VectorTypeFor<dimensions, Int> size = image.size();
+    char* const data = image.release();
+
+    /* Each row is converted in place in parallel, then the rows are moved
+       closer together on a single thread if the stride got smaller. Rows
+       are moved in order, so a row is never overwritten before it's moved. */
+    convertRows(data, inputFormat, inputType, data, format, type, width, rows, inStride, inStride, flags, threadCount);
+    if(outStride != inStride) for(std::size_t i = 1; i < rows; ++i)
+        std::memmove(data + i*outStride, data + i*inStride, outStride);
+
+    /* The memory isn't shrunk, the unused end is freed with the image */
+    image.setData(format, type, size, data);
+}
+
+template<UnsignedInt dimensions> void premultiplyAlphaImpl(Image<dimensions>& image, const std::size_t threadCount, const bool inverse, const char* const messagePrefix) {
+    CORRADE_ASSERT(layout(image.format()).alpha == 3 && (image.type() == ColorType::UnsignedByte || image.type() == ColorType::Float),
+        messagePrefix << "unsupported image format" << image.format() << "and type" << image.type(), );
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    #endif
+
+    const std::size_t width = image.size()[0];
+    const std::size_t rows = width ? rowCount<dimensions>(image.size()) : 0;
+    const std::size_t stride = rowStride(width, image.pixelSize());
+    char* const data = image.data();
+    const bool isFloat = image.type() == ColorType::Float;
+
+    Implementation::parallelFor(rows, threadCount, Implementation::minRangeSize(MinParallelRangeSize, stride), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            char* const row = data + i*stride;
+            if(isFloat) {
+                Float* const pixels = reinterpret_cast<Float*>(row);
+                if(inverse) unpremultiplyAlphaImpl(pixels, pixels, width);
+                else premultiplyAlphaImpl(pixels, pixels, width);
+            } else {
+                UnsignedByte* const pixels = reinterpret_cast<UnsignedByte*>(row);
+                if(inverse) unpremultiplyAlphaImpl(pixels, pixels, width);
+                else premultiplyAlphaImpl(pixels, pixels, width);
+            }
+        }
+    });
+}
+
+}
+
+void swapRedBlue(const Containers::ArrayView<const Math::Vector3<UnsignedByte>> in, const Containers::ArrayView<Math::Vector3<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::swapRedBlue(): expected arrays of the same size", );
+    swapRedBlue3(in.data()->data(), out.data()->data(), in.size());
+}
+
+void swapRedBlue(const Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, const Containers::ArrayView<Math::Vector4<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::swapRedBlue(): expected arrays of the same size", );
+    swapRedBlue4(in.data()->data(), out.data()->data(), in.size());
+}
+
+void rgbToRgba(const Containers::ArrayView<const Math::Vector3<UnsignedByte>> in, const Containers::ArrayView<Math::Vector4<UnsignedByte>> out, const UnsignedByte alpha) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::rgbToRgba(): expected arrays of the same size", );
+    rgbToRgbaImpl(in.data()->data(), out.data()->data(), in.size(), alpha);
+}
+
+void rgbaToRgb(const Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, const Containers::ArrayView<Math::Vector3<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::rgbaToRgb(): expected arrays of the same size", );
+    rgbaToRgbImpl(in.data()->data(), out.data()->data(), in.size());
+}
+
+void normalize(const Containers::ArrayView<const UnsignedByte> in, const Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::normalize(): expected arrays of the same size", );
+    normalizeImpl(in.data(), out.data(), in.size());
+}
+
+void normalize(const Containers::ArrayView<const UnsignedByte> in, const Containers::ArrayView<Math::Half> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::normalize(): expected arrays of the same size", );
+    normalizeHalfImpl(in.data(), out.data(), in.size());
+}
+
+void denormalize(const Containers::ArrayView<const Float> in, const Containers::ArrayView<UnsignedByte> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::denormalize(): expected arrays of the same size", );
+    denormalizeImpl(in.data(), out.data(), in.size());
+}
+
+void denormalize(const Containers::ArrayView<const Math::Half> in, const Containers::ArrayView<UnsignedByte> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::denormalize(): expected arrays of the same size", );
+    Float scratch[ChunkSize];
+    for(std::size_t i = 0; i < in.size(); i += ChunkSize) {
+        const std::size_t count = std::min(ChunkSize, in.size() - i);
+        Math::Batch::unpackHalf({in.data() + i, count}, {scratch, count});
+        denormalizeImpl(scratch, out.data() + i, count);
+    }
+}
+
+void srgbToLinear(const Containers::ArrayView<const UnsignedByte> in, const Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::srgbToLinear(): expected arrays of the same size", );
+    srgbToLinearImpl(in.data(), out.data(), in.size(), 1, NoAlpha);
+}
+
+void srgbToLinear(const Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, const Containers::ArrayView<Math::Vector4<Float>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::srgbToLinear(): expected arrays of the same size", );
+    srgbToLinearImpl(in.data()->data(), out.data()->data(), in.size(), 4, 3);
+}
+
+void linearToSrgb(const Containers::ArrayView<const Float> in, const Containers::ArrayView<UnsignedByte> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::linearToSrgb(): expected arrays of the same size", );
+    linearToSrgbImpl(in.data(), out.data(), in.size(), 1, NoAlpha);
+}
+
+void linearToSrgb(const Containers::ArrayView<const Math::Vector4<Float>> in, const Containers::ArrayView<Math::Vector4<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::linearToSrgb(): expected arrays of the same size", );
+    linearToSrgbImpl(in.data()->data(), out.data()->data(), in.size(), 4, 3);
+}
+
+void premultiplyAlpha(const Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, const Containers::ArrayView<Math::Vector4<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::premultiplyAlpha(): expected arrays of the same size", );
+    premultiplyAlphaImpl(in.data()->data(), out.data()->data(), in.size());
+}
+
+void premultiplyAlpha(const Containers::ArrayView<const Math::Vector4<Float>> in, const Containers::ArrayView<Math::Vector4<Float>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::premultiplyAlpha(): expected arrays of the same size", );
+    premultiplyAlphaImpl(in.data()->data(), out.data()->data(), in.size());
+}
+
+void unpremultiplyAlpha(const Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, const Containers::ArrayView<Math::Vector4<UnsignedByte>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::unpremultiplyAlpha(): expected arrays of the same size", );
+    unpremultiplyAlphaImpl(in.data()->data(), out.data()->data(), in.size());
+}
+
+void unpremultiplyAlpha(const Containers::ArrayView<const Math::Vector4<Float>> in, const Containers::ArrayView<Math::Vector4<Float>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "ImageConversion::unpremultiplyAlpha(): expected arrays of the same size", );
+    unpremultiplyAlphaImpl(in.data()->data(), out.data()->data(), in.size());
+}
+
+Image1D convert(const ImageReference1D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    return convertImpl<1>(image, format, type, flags, threadCount);
+}
+
+Image2D convert(const ImageReference2D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    return convertImpl<2>(image, format, type, flags, threadCount);
+}
+
+Image3D convert(const ImageReference3D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    return convertImpl<3>(image, format, type, flags, threadCount);
+}
+
+void convertInPlace(Image1D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    convertInPlaceImpl<1>(image, format, type, flags, threadCount);
+}
+
+void convertInPlace(Image2D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    convertInPlaceImpl<2>(image, format, type, flags, threadCount);
+}
+
+void convertInPlace(Image3D& image, const ColorFormat format, const ColorType type, const ConversionFlags flags, const std::size_t threadCount) {
+    convertInPlaceImpl<3>(image, format, type, flags, threadCount);
+}
+
+void premultiplyAlpha(Image1D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<1>(image, threadCount, false, "ImageConversion::premultiplyAlpha():");
+}
+
+void premultiplyAlpha(Image2D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<2>(image, threadCount, false, "ImageConversion::premultiplyAlpha():");
+}
+
+void premultiplyAlpha(Image3D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<3>(image, threadCount, false, "ImageConversion::premultiplyAlpha():");
+}
+
+void unpremultiplyAlpha(Image1D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<1>(image, threadCount, true, "ImageConversion::unpremultiplyAlpha():");
+}
+
+void unpremultiplyAlpha(Image2D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<2>(image, threadCount, true, "ImageConversion::unpremultiplyAlpha():");
+}
+
+void unpremultiplyAlpha(Image3D& image, const std::size_t threadCount) {
+    premultiplyAlphaImpl<3>(image, threadCount, true, "ImageConversion::unpremultiplyAlpha():");
+}
+
+}}
@@ -0,0 +1,299 @@
+#ifndef Magnum_ImageConversion_h
+#define Magnum_ImageConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::ImageConversion
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Pixel format conversion
+
+Conversion between channel layouts, component types and color spaces of pixel
+data. The functions come in two flavors:
+
+-   Array functions operate on tightly packed arrays of components or
+    pixels. Unless stated otherwise, the output can be the same memory as the
+    input, in which case the conversion is done in-place. All arrays are
+    expected to have the same item count.
+-   Image functions operate on whole @ref Image and @ref ImageReference
+    instances, taking the four-byte row alignment into account, and process
+    the rows in parallel.
+
+If the library is built with @ref MAGNUM_TARGET_SIMD, channel swizzling and
+conversion between @ref Magnum::UnsignedByte "UnsignedByte" and
+@ref Magnum::Float "Float" components use SSE2 (SSSE3 where it helps) on x86
+and NEON on ARM if the compiler targets given instruction set. Half-float
+conversion goes through @ref Math::Batch::packHalf() and
+@ref Math::Batch::unpackHalf(), conversion of 8-bit data from and to sRGB is
+table-based and gives exactly rounded results.
+
+Example of converting a BGR image loaded from a file to linear RGBA floats:
+@code
+Image2D image = ...;
+Image2D linear = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float,
+    ImageConversion::ConversionFlag::Srgb);
+@endcode
+*/
+namespace ImageConversion {
+
+/**
+@brief Conversion flag
+
+@see @ref ConversionFlags, @ref convert()
+*/
+enum class ConversionFlag: UnsignedByte {
+    /**
+     * @ref ColorType::UnsignedByte data are sRGB-encoded. When converting
+     * them to or from @ref ColorType::Float or @ref ColorType::HalfFloat,
+     * color channels are converted from or to linear space, alpha channel
+     * is converted without any change. Has no effect on other conversions.
+     */
+    Srgb = 1 << 0
+};
+
+/**
+@brief Conversion flags
+
+@see @ref convert()
+*/
+typedef Containers::EnumSet<ConversionFlag> ConversionFlags;
+
+CORRADE_ENUMSET_OPERATORS(ConversionFlags)
+
+/**
+@brief Swap red and blue channel
+
+Converts RGB to BGR and vice versa.
+*/
+MAGNUM_EXPORT void swapRedBlue(Containers::ArrayView<const Math::Vector3<UnsignedByte>> in, Containers::ArrayView<Math::Vector3<UnsignedByte>> out);
+
+/**
+@overload
+
+Converts RGBA to BGRA and vice versa.
+*/
+MAGNUM_EXPORT void swapRedBlue(Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, Containers::ArrayView<Math::Vector4<UnsignedByte>> out);
+
+/**
+@brief Add alpha channel
+@param in       Input RGB pixels
+@param out      Output RGBA pixels
+@param alpha    Alpha value
+
+The conversion can be done in-place if both arrays begin at the same address
+and the memory is large enough for the output.
+*/
+MAGNUM_EXPORT void rgbToRgba(Containers::ArrayView<const Math::Vector3<UnsignedByte>> in, Containers::ArrayView<Math::Vector4<UnsignedByte>> out, UnsignedByte alpha = 255);
+
+/**
+@brief Remove alpha channel
+
+The conversion can be done in-place if both arrays begin at the same address.
+*/
+MAGNUM_EXPORT void rgbaToRgb(Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, Containers::ArrayView<Math::Vector3<UnsignedByte>> out);
+
+/**
+@brief Convert normalized unsigned byte components to floats
+
+Maps the range @f$ [0, 255] @f$ to @f$ [0.0, 1.0] @f$. Can't be done
+in-place.
+*/
+MAGNUM_EXPORT void normalize(Containers::ArrayView<const UnsignedByte> in, Containers::ArrayView<Float> out);
+
+/**
+@overload
+
+Can't be done in-place.
+*/
+MAGNUM_EXPORT void normalize(Containers::ArrayView<const UnsignedByte> in, Containers::ArrayView<Math::Half> out);
+
+/**
+@brief Convert floats to normalized unsigned byte components
+
+Maps the range @f$ [0.0, 1.0] @f$ to @f$ [0, 255] @f$ with rounding to
+nearest, values outside of the range (and NaN) are clamped. Can't be done
+in-place.
+*/
+MAGNUM_EXPORT void denormalize(Containers::ArrayView<const Float> in, Containers::ArrayView<UnsignedByte> out);
+
+/**
+@overload
+
+Can't be done in-place.
+*/
+MAGNUM_EXPORT void denormalize(Containers::ArrayView<const Math::Half> in, Containers::ArrayView<UnsignedByte> out);
+
+/**
+@brief Convert sRGB components to linear floats
+
+All components are treated as color. Can't be done in-place.
+@see @ref linearToSrgb()
+*/
+MAGNUM_EXPORT void srgbToLinear(Containers::ArrayView<const UnsignedByte> in, Containers::ArrayView<Float> out);
+
+/**
+@overload
+
+Alpha channel is only normalized. Can't be done in-place.
+*/
+MAGNUM_EXPORT void srgbToLinear(Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, Containers::ArrayView<Math::Vector4<Float>> out);
+
+/**
+@brief Convert linear float components to sRGB
+
+All components are treated as color. Values outside of the
+@f$ [0.0, 1.0] @f$ range are clamped, the result is rounded to nearest. Can't
+be done in-place.
+@see @ref srgbToLinear()
+*/
+MAGNUM_EXPORT void linearToSrgb(Containers::ArrayView<const Float> in, Containers::ArrayView<UnsignedByte> out);
+
+/**
+@overload
+
+Alpha channel is only denormalized. Can't be done in-place.
+*/
+MAGNUM_EXPORT void linearToSrgb(Containers::ArrayView<const Math::Vector4<Float>> in, Containers::ArrayView<Math::Vector4<UnsignedByte>> out);
+
+/**
+@brief Premultiply color channels with alpha
+
+The result is rounded to nearest.
+@see @ref unpremultiplyAlpha()
+*/
+MAGNUM_EXPORT void premultiplyAlpha(Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, Containers::ArrayView<Math::Vector4<UnsignedByte>> out);
+
+/** @overload */
+MAGNUM_EXPORT void premultiplyAlpha(Containers::ArrayView<const Math::Vector4<Float>> in, Containers::ArrayView<Math::Vector4<Float>> out);
+
+/**
+@brief Divide color channels by alpha
+
+Inverse to @ref premultiplyAlpha(). Color of fully transparent pixels is set
+to zero, the result is rounded to nearest and clamped.
+*/
+MAGNUM_EXPORT void unpremultiplyAlpha(Containers::ArrayView<const Math::Vector4<UnsignedByte>> in, Containers::ArrayView<Math::Vector4<UnsignedByte>> out);
+
+/** @overload */
+MAGNUM_EXPORT void unpremultiplyAlpha(Containers::ArrayView<const Math::Vector4<Float>> in, Containers::ArrayView<Math::Vector4<Float>> out);
+
+/**
+@brief Convert image to another format and type
+@param image        Image to convert
+@param format       Format of the result
+@param type         Type of the result
+@param flags        Conversion flags
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Supports @ref ColorType::UnsignedByte, @ref ColorType::HalfFloat and
+@ref ColorType::Float types. The format can be changed between
+@ref ColorFormat::RGB, @ref ColorFormat::RGBA, @ref ColorFormat::BGR and
+@ref ColorFormat::BGRA, an alpha channel is added as fully opaque. Other
+formats can be only converted to another type. Rows of the image are
+processed in parallel on @p threadCount threads, small images are converted
+on the calling thread.
+@see @ref convertInPlace()
+*/
+MAGNUM_EXPORT Image1D convert(const ImageReference1D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT Image2D convert(const ImageReference2D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT Image3D convert(const ImageReference3D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/**
+@brief Convert image to another format and type in-place
+@param image        Image to convert
+@param format       Format of the result
+@param type         Type of the result
+@param flags        Conversion flags
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Same as @ref convert(const ImageReference2D&, ColorFormat, ColorType, ConversionFlags, std::size_t),
+but reuses the image memory instead of allocating a new one. Expects that the
+resulting pixel size is not larger than the original, which allows swizzles,
+removing the alpha channel and conversion to smaller component types, such as
+@ref ColorType::Float to @ref ColorType::HalfFloat or
+@ref ColorType::UnsignedByte. The image memory is not shrunk.
+*/
+MAGNUM_EXPORT void convertInPlace(Image1D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void convertInPlace(Image2D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void convertInPlace(Image3D& image, ColorFormat format, ColorType type, ConversionFlags flags = {}, std::size_t threadCount = 0);
+
+/**
+@brief Premultiply image color channels with alpha in-place
+@param image        Image to convert
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Expects @ref ColorFormat::RGBA or @ref ColorFormat::BGRA image with
+@ref ColorType::UnsignedByte or @ref ColorType::Float type.
+@see @ref premultiplyAlpha(Containers::ArrayView<const Math::Vector4<UnsignedByte>>, Containers::ArrayView<Math::Vector4<UnsignedByte>>)
+*/
+MAGNUM_EXPORT void premultiplyAlpha(Image1D& image, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void premultiplyAlpha(Image2D& image, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void premultiplyAlpha(Image3D& image, std::size_t threadCount = 0);
+
+/**
+@brief Divide image color channels by alpha in-place
+@param image        Image to convert
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Expects @ref ColorFormat::RGBA or @ref ColorFormat::BGRA image with
+@ref ColorType::UnsignedByte or @ref ColorType::Float type.
+@see @ref unpremultiplyAlpha(Containers::ArrayView<const Math::Vector4<UnsignedByte>>, Containers::ArrayView<Math::Vector4<UnsignedByte>>)
+*/
+MAGNUM_EXPORT void unpremultiplyAlpha(Image1D& image, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void unpremultiplyAlpha(Image2D& image, std::size_t threadCount = 0);
+
+/** @overload */
+MAGNUM_EXPORT void unpremultiplyAlpha(Image3D& image, std::size_t threadCount = 0);
+
+}}
+
+#endif
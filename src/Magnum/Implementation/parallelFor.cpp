@@ -0,0 +1,60 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "parallelFor.h"
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/configure.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+void parallelFor(const std::size_t count, std::size_t threadCount, const std::size_t minRangeSize, const std::function<void(std::size_t, std::size_t)>& fn) {
+    if(!count) return;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::min(threadCount, std::max(count/std::max(minRangeSize, std::size_t(1)), std::size_t(1)));
+
+    const std::size_t rangeSize = (count + threadCount - 1)/threadCount;
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for(std::size_t begin = 0; begin + rangeSize < count; begin += rangeSize)
+        threads.emplace_back(fn, begin, begin + rangeSize);
+    fn(threads.size()*rangeSize, count);
+
+    for(std::thread& thread: threads) thread.join();
+    #else
+    static_cast<void>(threadCount);
+    static_cast<void>(minRangeSize);
+    fn(0, count);
+    #endif
+}
+
+}}
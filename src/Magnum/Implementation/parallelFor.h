@@ -0,0 +1,50 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <functional>
+
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Splits [0, count) into at most threadCount consecutive ranges no smaller
+   than minRangeSize and calls fn on each of them in a separate thread, the
+   last range is processed on the calling thread. Thread count 0 means
+   hardware concurrency. On Emscripten everything is processed on the calling
+   thread. */
+MAGNUM_EXPORT void parallelFor(std::size_t count, std::size_t threadCount, std::size_t minRangeSize, const std::function<void(std::size_t, std::size_t)>& fn);
+
+/* Minimal range size for parallelFor() over items of given size, so each
+   range has at least given total size */
+inline std::size_t minRangeSize(const std::size_t totalSize, const std::size_t itemSize) {
+    return itemSize ? totalSize/itemSize : totalSize;
+}
+
+}}
+
+#endif
@@ -138,6 +138,24 @@ which you might want to be aware of. Implies also @ref MAGNUM_TARGET_GLES and
 */
 #define MAGNUM_TARGET_WEBGL
 #undef MAGNUM_TARGET_WEBGL
+
+/**
+@brief SIMD-accelerated math
+
+Defined if the engine is built with SSE2/AVX code paths for performance-critical
+operations on four-component @ref Math types, such as @ref Math::dot(),
+multiplication and inversion of @ref Math::Matrix4 "Matrix4" and
+@ref Math::Quaternion "Quaternion" multiplication. The code paths are used only
+for @ref Magnum::Float "Float" types, otherwise the generic scalar
+implementation is used. Inline code in headers uses only SSE2 and only on
+x86-64, where it is always available, so files compiled with different flags
+can be safely linked together. Code compiled as part of the libraries
+additionally uses SSSE3, AVX or NEON if the libraries are built with given
+instruction set enabled (e.g. with `-mavx`).
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_TARGET_SIMD
+#undef MAGNUM_TARGET_SIMD
 #endif
 
 /** @{ @name Basic type definitions
@@ -179,6 +197,13 @@ typedef std::uint64_t UnsignedLong;
 typedef std::int64_t Long;
 #endif
 
+/**
+@brief Half (16bit)
+
+Storage-only type, see @ref Math::Half for more information.
+*/
+typedef Math::Half Half;
+
 /** @brief Float (32bit) */
 typedef float Float;
 
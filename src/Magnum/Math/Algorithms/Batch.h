@@ -0,0 +1,358 @@
+#ifndef Magnum_Math_Algorithms_Batch_h
+#define Magnum_Math_Algorithms_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Algorithms::Batch
+ */
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Algorithms/EigenSymmetric.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Four values processed at once. The batched algorithms are written in terms
+   of this type so the same code is used for both the SIMD and scalar path.
+   Data are in blocks of four matrices transposed to structure-of-arrays
+   layout, i.e. each matrix element is four consecutive values. */
+template<class T> struct BatchLanes {
+    static BatchLanes load(const T* data) {
+        return {{data[0], data[1], data[2], data[3]}};
+    }
+
+    static BatchLanes broadcast(T value) {
+        return {{value, value, value, value}};
+    }
+
+    void store(T* data) const {
+        for(std::size_t i = 0; i != 4; ++i) data[i] = value[i];
+    }
+
+    BatchLanes operator+(const BatchLanes& other) const {
+        return {{value[0] + other.value[0], value[1] + other.value[1], value[2] + other.value[2], value[3] + other.value[3]}};
+    }
+
+    BatchLanes operator-(const BatchLanes& other) const {
+        return {{value[0] - other.value[0], value[1] - other.value[1], value[2] - other.value[2], value[3] - other.value[3]}};
+    }
+
+    BatchLanes operator*(const BatchLanes& other) const {
+        return {{value[0]*other.value[0], value[1]*other.value[1], value[2]*other.value[2], value[3]*other.value[3]}};
+    }
+
+    BatchLanes operator/(const BatchLanes& other) const {
+        return {{value[0]/other.value[0], value[1]/other.value[1], value[2]/other.value[2], value[3]/other.value[3]}};
+    }
+
+    BatchLanes sqrt() const {
+        return {{std::sqrt(value[0]), std::sqrt(value[1]), std::sqrt(value[2]), std::sqrt(value[3])}};
+    }
+
+    T value[4];
+};
+
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> struct BatchLanes<Float> {
+    static BatchLanes load(const Float* data) { return {_mm_load_ps(data)}; }
+    static BatchLanes broadcast(Float value) { return {_mm_set1_ps(value)}; }
+    void store(Float* data) const { _mm_store_ps(data, value); }
+
+    BatchLanes operator+(const BatchLanes& other) const { return {_mm_add_ps(value, other.value)}; }
+    BatchLanes operator-(const BatchLanes& other) const { return {_mm_sub_ps(value, other.value)}; }
+    BatchLanes operator*(const BatchLanes& other) const { return {_mm_mul_ps(value, other.value)}; }
+    BatchLanes operator/(const BatchLanes& other) const { return {_mm_div_ps(value, other.value)}; }
+    BatchLanes sqrt() const { return {_mm_sqrt_ps(value)}; }
+
+    __m128 value;
+};
+#endif
+
+/* Gauss-Jordan elimination on a block of four transposed systems, same as
+   gaussJordanInPlaceTransposed(). Pivot search and row swapping is done for
+   each system separately, the elimination itself for all at once. Singular
+   systems are marked in @p singular and their pivot replaced with one so the
+   remaining systems are not affected. */
+template<std::size_t size, std::size_t rows, class T> void gaussJordanLanes(T(&a)[size][size][4], T(&t)[size][rows][4], bool(&singular)[4]) {
+    typedef BatchLanes<T> Lanes;
+
+    for(std::size_t row = 0; row != size; ++row) {
+        for(std::size_t lane = 0; lane != 4; ++lane) {
+            /* Find max pivot */
+            std::size_t rowMax = row;
+            for(std::size_t row2 = row+1; row2 != size; ++row2)
+                if(std::abs(a[row2][row][lane]) > std::abs(a[rowMax][row][lane]))
+                    rowMax = row2;
+
+            /* Swap the rows */
+            if(rowMax != row) {
+                using std::swap;
+                for(std::size_t i = 0; i != size; ++i)
+                    swap(a[row][i][lane], a[rowMax][i][lane]);
+                for(std::size_t i = 0; i != rows; ++i)
+                    swap(t[row][i][lane], t[rowMax][i][lane]);
+            }
+
+            if(TypeTraits<T>::equals(a[row][row][lane], T(0))) {
+                singular[lane] = true;
+                a[row][row][lane] = T(1);
+            }
+        }
+
+        /* Eliminate column. Elements left of the diagonal are not used
+           afterwards, so they're not updated. */
+        const Lanes pivot = Lanes::load(a[row][row]);
+        for(std::size_t row2 = row+1; row2 != size; ++row2) {
+            const Lanes c = Lanes::load(a[row2][row])/pivot;
+
+            for(std::size_t i = row+1; i != size; ++i)
+                (Lanes::load(a[row2][i]) - Lanes::load(a[row][i])*c).store(a[row2][i]);
+            for(std::size_t i = 0; i != rows; ++i)
+                (Lanes::load(t[row2][i]) - Lanes::load(t[row][i])*c).store(t[row2][i]);
+        }
+    }
+
+    /* Backsubstitute */
+    for(std::size_t row = size; row != 0; --row) {
+        const Lanes c = Lanes::broadcast(T(1))/Lanes::load(a[row-1][row-1]);
+
+        for(std::size_t row2 = 0; row2 != row-1; ++row2) {
+            const Lanes f = Lanes::load(a[row2][row-1])*c;
+            for(std::size_t i = 0; i != rows; ++i)
+                (Lanes::load(t[row2][i]) - Lanes::load(t[row-1][i])*f).store(t[row2][i]);
+        }
+
+        /* Normalize the row */
+        for(std::size_t i = 0; i != rows; ++i)
+            (Lanes::load(t[row-1][i])*c).store(t[row-1][i]);
+    }
+}
+
+}
+
+/**
+@brief Batched matrix algorithms
+
+Variants of functions in @ref Algorithms operating on whole arrays of
+matrices at once, useful for example in physics or mesh processing code
+where large amounts of small systems need to be solved. Gauss-Jordan
+elimination and Gram-Schmidt orthonormalization process four matrices at a
+time transposed to structure-of-arrays layout, in which case the operations
+are done using SIMD instructions if @ref MAGNUM_TARGET_SIMD is enabled. The
+closed-form eigendecomposition and SVD doesn't iterate, so it's considerably
+faster than @ref svd() even when done for each matrix separately.
+
+Similarly to @ref Math::Batch, arrays are passed as
+@ref Corrade::Containers::ArrayView "Containers::ArrayView", output can be the
+same array as input and all arrays are expected to have the same size.
+Template parameters are not deduced from the views, thus they need to be
+specified explicitly:
+@code
+std::vector<Matrix<4, Float>> matrices;
+std::vector<Matrix<4, Float>> inverted(matrices.size());
+Math::Algorithms::Batch::gaussJordanInverted<4, Float>(
+    {matrices.data(), matrices.size()}, {inverted.data(), inverted.size()});
+@endcode
+*/
+namespace Batch {
+
+/**
+@brief Batched Gauss-Jordan matrix inversion
+@param[in]  in      Matrices to invert
+@param[out] out     Inverted matrices
+@return True if all matrices are regular, false if any of them is singular.
+    In that case the output for the singular matrices is undefined.
+
+Equivalent to calling @ref Algorithms::gaussJordanInverted() on each item,
+except that singular matrices are not treated as an error.
+*/
+template<std::size_t size, class T> bool gaussJordanInverted(typename Math::Implementation::BatchInput<Matrix<size, T>>::Type in, typename Math::Implementation::BatchOutput<Matrix<size, T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Algorithms::Batch::gaussJordanInverted(): expected arrays of the same size", false);
+
+    bool regular = true;
+    for(std::size_t offset = 0; offset < in.size(); offset += 4) {
+        const std::size_t count = std::min(in.size() - offset, std::size_t(4));
+        alignas(16) T a[size][size][4];
+        alignas(16) T t[size][size][4];
+        bool singular[4]{};
+
+        /* Remaining lanes of the last block are filled with identities */
+        for(std::size_t lane = 0; lane != 4; ++lane) {
+            const Matrix<size, T> matrix = lane < count ? in[offset + lane] : Matrix<size, T>{};
+            for(std::size_t col = 0; col != size; ++col) for(std::size_t row = 0; row != size; ++row) {
+                a[col][row][lane] = matrix[col][row];
+                t[col][row][lane] = col == row ? T(1) : T(0);
+            }
+        }
+
+        Implementation::gaussJordanLanes(a, t, singular);
+
+        for(std::size_t lane = 0; lane != count; ++lane) {
+            regular = regular && !singular[lane];
+            for(std::size_t col = 0; col != size; ++col) for(std::size_t row = 0; row != size; ++row)
+                out[offset + lane][col][row] = t[col][row][lane];
+        }
+    }
+
+    return regular;
+}
+
+/**
+@brief Batched solving of linear systems using Gauss-Jordan elimination
+@param[in]  a       Left sides of the systems
+@param[in]  b       Right sides of the systems
+@param[out] out     Solutions
+@return True if all matrices in @p a are regular, false if any of them is
+    singular. In that case the output for the singular systems is undefined.
+
+Solves @f$ \boldsymbol{A} \boldsymbol{x} = \boldsymbol{b} @f$ for each item,
+for example normal equations in least-squares fitting. Equivalent to calling
+@ref gaussJordanInPlace() on each item.
+*/
+template<std::size_t size, class T> bool gaussJordanSolve(typename Math::Implementation::BatchInput<Matrix<size, T>>::Type a, typename Math::Implementation::BatchInput<Vector<size, T>>::Type b, typename Math::Implementation::BatchOutput<Vector<size, T>>::Type out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::Algorithms::Batch::gaussJordanSolve(): expected arrays of the same size", false);
+
+    bool regular = true;
+    for(std::size_t offset = 0; offset < a.size(); offset += 4) {
+        const std::size_t count = std::min(a.size() - offset, std::size_t(4));
+        alignas(16) T at[size][size][4];
+        alignas(16) T t[size][1][4];
+        bool singular[4]{};
+
+        /* The elimination works on transposed matrices, so the transposition
+           is done while converting to the SoA layout. Remaining lanes of the
+           last block are filled with identities. */
+        for(std::size_t lane = 0; lane != 4; ++lane) {
+            const Matrix<size, T> matrix = lane < count ? a[offset + lane] : Matrix<size, T>{};
+            for(std::size_t col = 0; col != size; ++col) {
+                for(std::size_t row = 0; row != size; ++row)
+                    at[row][col][lane] = matrix[col][row];
+                t[col][0][lane] = lane < count ? b[offset + lane][col] : T(0);
+            }
+        }
+
+        Implementation::gaussJordanLanes(at, t, singular);
+
+        for(std::size_t lane = 0; lane != count; ++lane) {
+            regular = regular && !singular[lane];
+            for(std::size_t row = 0; row != size; ++row)
+                out[offset + lane][row] = t[row][0][lane];
+        }
+    }
+
+    return regular;
+}
+
+/**
+@brief Batched in-place Gram-Schmidt matrix orthonormalization
+@param[in,out] matrices Matrices to perform orthonormalization on
+
+Equivalent to calling @ref gramSchmidtOrthonormalizeInPlace() on each item.
+*/
+template<std::size_t cols, std::size_t rows, class T> void gramSchmidtOrthonormalizeInPlace(typename Math::Implementation::BatchOutput<RectangularMatrix<cols, rows, T>>::Type matrices) {
+    static_assert(cols <= rows, "Unsupported matrix aspect ratio");
+    typedef Implementation::BatchLanes<T> Lanes;
+
+    for(std::size_t offset = 0; offset < matrices.size(); offset += 4) {
+        const std::size_t count = std::min(matrices.size() - offset, std::size_t(4));
+        alignas(16) T m[cols][rows][4];
+
+        /* Remaining lanes of the last block are filled with unit vectors */
+        for(std::size_t lane = 0; lane != 4; ++lane)
+            for(std::size_t col = 0; col != cols; ++col) for(std::size_t row = 0; row != rows; ++row)
+                m[col][row][lane] = lane < count ? matrices[offset + lane][col][row] : (col == row ? T(1) : T(0));
+
+        for(std::size_t i = 0; i != cols; ++i) {
+            Lanes length = Lanes::broadcast(T(0));
+            for(std::size_t row = 0; row != rows; ++row)
+                length = length + Lanes::load(m[i][row])*Lanes::load(m[i][row]);
+            const Lanes lengthInverted = Lanes::broadcast(T(1))/length.sqrt();
+            for(std::size_t row = 0; row != rows; ++row)
+                (Lanes::load(m[i][row])*lengthInverted).store(m[i][row]);
+
+            for(std::size_t j = i+1; j != cols; ++j) {
+                Lanes dot = Lanes::broadcast(T(0));
+                for(std::size_t row = 0; row != rows; ++row)
+                    dot = dot + Lanes::load(m[j][row])*Lanes::load(m[i][row]);
+                for(std::size_t row = 0; row != rows; ++row)
+                    (Lanes::load(m[j][row]) - Lanes::load(m[i][row])*dot).store(m[j][row]);
+            }
+        }
+
+        for(std::size_t lane = 0; lane != count; ++lane)
+            for(std::size_t col = 0; col != cols; ++col) for(std::size_t row = 0; row != rows; ++row)
+                matrices[offset + lane][col][row] = m[col][row][lane];
+    }
+}
+
+/**
+@brief Batched closed-form eigendecomposition of symmetric 3x3 matrices
+@param[in]  matrices        Symmetric matrices
+@param[out] eigenvalues     Eigenvalues in descending order
+@param[out] eigenvectors    Corresponding eigenvectors as matrix columns
+
+Equivalent to calling @ref Algorithms::eigenSymmetric() on each item. Unlike
+@ref gaussJordanInverted() or @ref gramSchmidtOrthonormalizeInPlace(), this is
+only a convenience wrapper without any speedup --- the items are not processed
+in SIMD lanes, as the closed-form solution branches on degenerate cases
+differently for each matrix.
+*/
+template<class T> void eigenSymmetric(typename Math::Implementation::BatchInput<Matrix<3, T>>::Type matrices, typename Math::Implementation::BatchOutput<Vector<3, T>>::Type eigenvalues, typename Math::Implementation::BatchOutput<Matrix<3, T>>::Type eigenvectors) {
+    CORRADE_ASSERT(matrices.size() == eigenvalues.size() && matrices.size() == eigenvectors.size(),
+        "Math::Algorithms::Batch::eigenSymmetric(): expected arrays of the same size", );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        std::tie(eigenvalues[i], eigenvectors[i]) = Algorithms::eigenSymmetric(matrices[i]);
+}
+
+/**
+@brief Batched closed-form Singular Value Decomposition of 3x3 matrices
+@param[in]  matrices    Matrices to decompose
+@param[out] u           Left singular vectors
+@param[out] w           Singular values in descending order
+@param[out] v           Right singular vectors
+
+Equivalent to calling @ref Algorithms::svdClosedForm() on each item. Like
+@ref eigenSymmetric(), this is only a convenience wrapper and the items are
+not processed in SIMD lanes.
+*/
+template<class T> void svdClosedForm(typename Math::Implementation::BatchInput<Matrix<3, T>>::Type matrices, typename Math::Implementation::BatchOutput<Matrix<3, T>>::Type u, typename Math::Implementation::BatchOutput<Vector<3, T>>::Type w, typename Math::Implementation::BatchOutput<Matrix<3, T>>::Type v) {
+    CORRADE_ASSERT(matrices.size() == u.size() && matrices.size() == w.size() && matrices.size() == v.size(),
+        "Math::Algorithms::Batch::svdClosedForm(): expected arrays of the same size", );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        std::tie(u[i], w[i], v[i]) = Algorithms::svdClosedForm(matrices[i]);
+}
+
+}
+
+}}}
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef Magnum_Math_Algorithms_EigenSymmetric_h
+#define Magnum_Math_Algorithms_EigenSymmetric_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::eigenSymmetric()
+ */
+
+#include <utility>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Unit eigenvector for an eigenvalue of multiplicity one, being the
+   largest cross product of rows of A - λI */
+template<class T> Vector3<T> eigenvectorSimple(const Matrix<3, T>& a, T eigenvalue) {
+    const Vector3<T> r0{a[0][0] - eigenvalue, a[1][0], a[2][0]};
+    const Vector3<T> r1{a[0][1], a[1][1] - eigenvalue, a[2][1]};
+    const Vector3<T> r2{a[0][2], a[1][2], a[2][2] - eigenvalue};
+    const Vector3<T> c01 = Math::cross(r0, r1);
+    const Vector3<T> c02 = Math::cross(r0, r2);
+    const Vector3<T> c12 = Math::cross(r1, r2);
+    const T d01 = c01.dot();
+    const T d02 = c02.dot();
+    const T d12 = c12.dot();
+
+    if(d01 >= d02 && d01 >= d12) return d01 > T(0) ? c01/std::sqrt(d01) : Vector3<T>::xAxis();
+    if(d02 >= d12) return c02/std::sqrt(d02);
+    return c12/std::sqrt(d12);
+}
+
+/* Arbitrary unit vector orthogonal to given unit vector */
+template<class T> Vector3<T> orthogonalVector(const Vector3<T>& w) {
+    if(std::abs(w.x()) > std::abs(w.y()))
+        return Vector3<T>{-w.z(), T(0), w.x()}/std::sqrt(w.x()*w.x() + w.z()*w.z());
+    return Vector3<T>{T(0), w.z(), -w.y()}/std::sqrt(w.y()*w.y() + w.z()*w.z());
+}
+
+/* Unit eigenvector for the middle eigenvalue that is orthogonal to already
+   known unit eigenvector @p w, solved as a 2x2 problem in the plane
+   orthogonal to it. Works also for repeated eigenvalues. */
+template<class T> Vector3<T> eigenvectorOrthogonal(const Matrix<3, T>& a, const Vector3<T>& w, T eigenvalue) {
+    const Vector3<T> u = orthogonalVector(w);
+    const Vector3<T> v = Math::cross(w, u);
+
+    const Vector3<T> au = Vector3<T>{a*u} - eigenvalue*u;
+    const Vector3<T> av = Vector3<T>{a*v} - eigenvalue*v;
+    T m00 = Math::dot(u, au);
+    T m01 = Math::dot(u, av);
+    T m11 = Math::dot(v, av);
+    const T absM00 = std::abs(m00);
+    const T absM01 = std::abs(m01);
+    const T absM11 = std::abs(m11);
+
+    if(absM00 >= absM11) {
+        if(std::max(absM00, absM01) == T(0)) return u;
+        if(absM00 >= absM01) {
+            m01 /= m00;
+            m00 = T(1)/std::sqrt(T(1) + m01*m01);
+            m01 *= m00;
+        } else {
+            m00 /= m01;
+            m01 = T(1)/std::sqrt(T(1) + m00*m00);
+            m00 *= m01;
+        }
+        return m01*u - m00*v;
+    }
+
+    if(std::max(absM11, absM01) == T(0)) return u;
+    if(absM11 >= absM01) {
+        m01 /= m11;
+        m11 = T(1)/std::sqrt(T(1) + m01*m01);
+        m01 *= m11;
+    } else {
+        m11 /= m01;
+        m01 = T(1)/std::sqrt(T(1) + m11*m11);
+        m11 *= m01;
+    }
+    return m11*u - m01*v;
+}
+
+}
+
+/**
+@brief Closed-form eigendecomposition of symmetric 3x3 matrix
+@param matrix   Symmetric matrix
+@return Eigenvalues in descending order and matrix with corresponding unit
+    eigenvectors as columns
+
+Unlike iterative methods such as @ref svd() this needs a fixed number of
+operations and no branching on convergence, which makes it suitable for
+processing large amounts of small matrices, for example covariance matrices
+when fitting oriented bounding boxes. Eigenvalues are calculated
+trigonometrically from the characteristic polynomial, eigenvectors using
+cross products of rows of @f$ \boldsymbol{A} - \lambda \boldsymbol{I} @f$,
+with the eigenvector of the middle eigenvalue solved in the plane orthogonal
+to the first one, so repeated eigenvalues are handled as well. The resulting
+eigenvector matrix is a rotation, i.e. is orthogonal with determinant
+@f$ 1 @f$:
+@f[
+    \boldsymbol{A} = \boldsymbol{V} \Lambda \boldsymbol{V}^T
+@f]
+
+Only the upper triangle of @p matrix is used. The matrix is scaled internally
+to avoid overflow, but as with all closed-form solutions, relative precision
+of eigenvalues much smaller than the largest one is limited. See
+@ref svdClosedForm() for singular value decomposition built on top of this
+function and @ref Batch::eigenSymmetric() for a batch variant.
+
+Implementation based on *David Eberly (2014). "A Robust Eigensolver for 3x3
+Symmetric Matrices"*.
+*/
+template<class T> std::pair<Vector<3, T>, Matrix<3, T>> eigenSymmetric(const Matrix<3, T>& matrix) {
+    /* Scale to avoid overflow, zero matrix has trivial solution */
+    const T scale = Math::abs(Vector<6, T>{matrix[0][0], matrix[1][1], matrix[2][2], matrix[1][0], matrix[2][0], matrix[2][1]}).max();
+    if(scale == T(0)) return {Vector<3, T>{}, Matrix<3, T>{}};
+
+    Matrix<3, T> a{Matrix<3, T>::Zero};
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row <= col; ++row)
+            a[col][row] = a[row][col] = matrix[col][row]/scale;
+
+    Vector<3, T> eigenvalues;
+    Matrix<3, T> eigenvectors;
+
+    /* Diagonal matrix, just sort the diagonal */
+    const T offDiagonal = a[1][0]*a[1][0] + a[2][0]*a[2][0] + a[2][1]*a[2][1];
+    if(offDiagonal <= TypeTraits<T>::epsilon()*TypeTraits<T>::epsilon()) {
+        std::size_t order[]{0, 1, 2};
+        if(a[order[0]][order[0]] < a[order[1]][order[1]]) std::swap(order[0], order[1]);
+        if(a[order[1]][order[1]] < a[order[2]][order[2]]) std::swap(order[1], order[2]);
+        if(a[order[0]][order[0]] < a[order[1]][order[1]]) std::swap(order[0], order[1]);
+
+        eigenvectors = Matrix<3, T>{Matrix<3, T>::Zero};
+        for(std::size_t i = 0; i != 3; ++i) {
+            eigenvalues[i] = a[order[i]][order[i]]*scale;
+            eigenvectors[i][order[i]] = T(1);
+        }
+
+        /* Keep the eigenvector matrix a rotation */
+        if(eigenvectors.determinant() < T(0)) eigenvectors[2] = -eigenvectors[2];
+        return {eigenvalues, eigenvectors};
+    }
+
+    /* Eigenvalues of B = (A - qI)/p are 2cos(phi + 2kπ/3) */
+    const T q = a.trace()/T(3);
+    const T b00 = a[0][0] - q;
+    const T b11 = a[1][1] - q;
+    const T b22 = a[2][2] - q;
+    const T p = std::sqrt((b00*b00 + b11*b11 + b22*b22 + T(2)*offDiagonal)/T(6));
+    const T c00 = b11*b22 - a[2][1]*a[2][1];
+    const T c01 = a[1][0]*b22 - a[2][1]*a[2][0];
+    const T c02 = a[1][0]*a[2][1] - b11*a[2][0];
+    const T halfDeterminant = (b00*c00 - a[1][0]*c01 + a[2][0]*c02)/(T(2)*p*p*p);
+    const T phi = std::acos(Math::clamp(halfDeterminant, T(-1), T(1)))/T(3);
+    const T e0 = q + T(2)*p*std::cos(phi);
+    const T e2 = q + T(2)*p*std::cos(phi + T(2)*Constants<T>::pi()/T(3));
+    const T e1 = T(3)*q - e0 - e2;
+
+    /* Start with the eigenvalue that is better separated from the rest */
+    if(e0 - e1 >= e1 - e2) {
+        const Vector3<T> v0 = Implementation::eigenvectorSimple(a, e0);
+        const Vector3<T> v1 = Implementation::eigenvectorOrthogonal(a, v0, e1);
+        eigenvectors = Matrix<3, T>{v0, v1, Math::cross(v0, v1)};
+    } else {
+        const Vector3<T> v2 = Implementation::eigenvectorSimple(a, e2);
+        const Vector3<T> v1 = Implementation::eigenvectorOrthogonal(a, v2, e1);
+        eigenvectors = Matrix<3, T>{Math::cross(v1, v2), v1, v2};
+    }
+
+    eigenvalues = Vector<3, T>{e0, e1, e2}*scale;
+    return {eigenvalues, eigenvectors};
+}
+
+}}}
+
+#endif
@@ -26,10 +26,10 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Math::Algorithms::gaussJordanInPlaceTransposed(), @ref Magnum::Math::Algorithms::gaussJordanInPlace()
+ * @brief Function @ref Magnum::Math::Algorithms::gaussJordanInPlaceTransposed(), @ref Magnum::Math::Algorithms::gaussJordanInPlace(), @ref Magnum::Math::Algorithms::gaussJordanInverted()
  */
 
-#include "Magnum/Math/RectangularMatrix.h"
+#include "Magnum/Math/Matrix.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
 
@@ -111,6 +111,23 @@ template<std::size_t size, std::size_t cols, class T> bool gaussJordanInPlace(Re
     return ret;
 }
 
+/**
+@brief Gauss-Jordan matrix inversion
+
+Since @f$ (\boldsymbol{A}^{-1})^T = (\boldsymbol{A}^T)^{-1} @f$, passes
+@p matrix and an identity matrix to @ref gaussJordanInPlaceTransposed(),
+returning the inverted matrix. Expects that the matrix is invertible.
+@see @ref Matrix::inverted()
+*/
+template<std::size_t size, class T> Matrix<size, T> gaussJordanInverted(Matrix<size, T> matrix) {
+    Matrix<size, T> inverted{Matrix<size, T>::Identity};
+    const bool invertible = gaussJordanInPlaceTransposed(matrix, inverted);
+    CORRADE_ASSERT(invertible,
+        "Math::Algorithms::gaussJordanInverted(): non-invertible matrix", {});
+    static_cast<void>(invertible);
+    return inverted;
+}
+
 }}}
 
 #endif
@@ -26,13 +26,14 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Math::Algorithms::svd()
+ * @brief Function @ref Magnum::Math::Algorithms::svd(), @ref Magnum::Math::Algorithms::svdClosedForm()
  */
 
 #include <tuple>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Algorithms/EigenSymmetric.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
 
@@ -333,6 +334,54 @@ template<std::size_t cols, std::size_t rows, class T> std::tuple<RectangularMatr
     return std::make_tuple(m, q, v);
 }
 
+/**
+@brief Closed-form Singular Value Decomposition of 3x3 matrix
+
+Returns @f$ U @f$, diagonal of @f$ \Sigma @f$ and non-transposed @f$ V @f$
+in the same form as @ref svd(), with singular values sorted in descending
+order and @f$ V @f$ being a rotation. Calculated from eigendecomposition of
+@f$ M^T M @f$ using @ref eigenSymmetric(), which doesn't iterate and is thus
+considerably faster than @ref svd(), at the cost of lower relative precision
+of the smallest singular values. Rank-deficient matrices are handled by
+completing @f$ U @f$ to an orthonormal basis.
+
+Rotational part of polar decomposition @f$ M = R S @f$ can be then calculated
+as @f$ R = U V^T @f$.
+@see @ref Batch::svdClosedForm()
+*/
+template<class T> std::tuple<Matrix<3, T>, Vector<3, T>, Matrix<3, T>> svdClosedForm(const Matrix<3, T>& m) {
+    Vector<3, T> eigenvalues;
+    Matrix<3, T> v;
+    std::tie(eigenvalues, v) = eigenSymmetric(Matrix<3, T>{m.transposed()*m});
+
+    /* Columns of M*V are orthogonal with lengths equal to singular values,
+       the last one is calculated from the others to make U orthonormal even
+       for rank-deficient matrices */
+    const Vector3<T> mv0{m*v[0]};
+    const Vector3<T> mv1{m*v[1]};
+    const Vector3<T> mv2{m*v[2]};
+    Vector<3, T> w;
+    Vector3<T> u0, u1;
+
+    w[0] = mv0.length();
+    u0 = w[0] > T(0) ? mv0/w[0] : Vector3<T>::xAxis();
+
+    const Vector3<T> u1Projected = mv1 - u0*Math::dot(u0, mv1);
+    const T u1Length = u1Projected.length();
+    u1 = u1Length > TypeTraits<T>::epsilon()*w[0] ? u1Projected/u1Length : Implementation::orthogonalVector(u0);
+    w[1] = std::abs(Math::dot(u1, mv1));
+    if(Math::dot(u1, mv1) < T(0)) u1 = -u1;
+
+    Vector3<T> u2 = Math::cross(u0, u1);
+    w[2] = Math::dot(u2, mv2);
+    if(w[2] < T(0)) {
+        u2 = -u2;
+        w[2] = -w[2];
+    }
+
+    return std::make_tuple(Matrix<3, T>{u0, u1, u2}, w, v);
+}
+
 }}}
 
 #endif
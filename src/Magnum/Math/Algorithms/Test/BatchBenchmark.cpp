@@ -0,0 +1,217 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Algorithms/Batch.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/GramSchmidt.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+/* Compares per-matrix algorithms with their batched variants */
+struct BatchBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit BatchBenchmark();
+
+    template<std::size_t size, class T> void gaussJordanInvertedPerItem();
+    template<std::size_t size, class T> void gaussJordanInverted();
+    template<std::size_t size, class T> void gaussJordanSolvePerItem();
+    template<std::size_t size, class T> void gaussJordanSolve();
+    template<std::size_t size, class T> void gramSchmidtOrthonormalizePerItem();
+    template<std::size_t size, class T> void gramSchmidtOrthonormalize();
+    template<class T> void svdPerItem();
+    template<class T> void svdClosedFormPerItem();
+    template<class T> void svdClosedForm();
+    template<class T> void eigenSymmetric();
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 10000 };
+
+    template<std::size_t size, class T> std::vector<Matrix<size, T>> matrices() {
+        std::vector<Matrix<size, T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            Matrix<size, T> a{Matrix<size, T>::Identity, T(2)};
+            for(std::size_t col = 0; col != size; ++col)
+                for(std::size_t row = 0; row != size; ++row)
+                    a[col][row] += std::sin(T(i*size*size + col*size + row));
+            out.push_back(a);
+        }
+        return out;
+    }
+
+    template<std::size_t size, class T> std::string name(const std::string& operation) {
+        return operation + "(Matrix<" + std::to_string(size) + ", " + Magnum::Test::AbstractBenchmarkTester::typeName<T>() + ">)";
+    }
+}
+
+BatchBenchmark::BatchBenchmark() {
+    addTests<BatchBenchmark>({
+        &BatchBenchmark::gaussJordanInvertedPerItem<3, Float>,
+        &BatchBenchmark::gaussJordanInverted<3, Float>,
+        &BatchBenchmark::gaussJordanInvertedPerItem<4, Float>,
+        &BatchBenchmark::gaussJordanInverted<4, Float>,
+        &BatchBenchmark::gaussJordanSolvePerItem<3, Float>,
+        &BatchBenchmark::gaussJordanSolve<3, Float>,
+        &BatchBenchmark::gaussJordanSolvePerItem<4, Float>,
+        &BatchBenchmark::gaussJordanSolve<4, Float>,
+        &BatchBenchmark::gramSchmidtOrthonormalizePerItem<3, Float>,
+        &BatchBenchmark::gramSchmidtOrthonormalize<3, Float>,
+        &BatchBenchmark::svdPerItem<Float>,
+        &BatchBenchmark::svdClosedFormPerItem<Float>,
+        &BatchBenchmark::svdClosedForm<Float>,
+        &BatchBenchmark::eigenSymmetric<Float>,
+        #ifndef MAGNUM_TARGET_GLES
+        &BatchBenchmark::gaussJordanInvertedPerItem<4, Double>,
+        &BatchBenchmark::gaussJordanInverted<4, Double>,
+        &BatchBenchmark::gaussJordanSolvePerItem<4, Double>,
+        &BatchBenchmark::gaussJordanSolve<4, Double>,
+        &BatchBenchmark::svdPerItem<Double>,
+        &BatchBenchmark::svdClosedForm<Double>
+        #endif
+        });
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gaussJordanInvertedPerItem() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    std::vector<Matrix<size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::gaussJordanInverted")), BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = Algorithms::gaussJordanInverted(a[i]);
+        escape(out.data());
+    }
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gaussJordanInverted() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    std::vector<Matrix<size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::Batch::gaussJordanInverted")), BatchSize) {
+        Batch::gaussJordanInverted<size, T>({a.data(), a.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gaussJordanSolvePerItem() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    const std::vector<Vector<size, T>> b(BatchSize, Vector<size, T>{T(1)});
+    std::vector<Vector<size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::gaussJordanInPlace")), BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            RectangularMatrix<size, size, T> ai = a[i];
+            RectangularMatrix<1, size, T> t{b[i]};
+            Algorithms::gaussJordanInPlace(ai, t);
+            out[i] = t[0];
+        }
+        escape(out.data());
+    }
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gaussJordanSolve() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    const std::vector<Vector<size, T>> b(BatchSize, Vector<size, T>{T(1)});
+    std::vector<Vector<size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::Batch::gaussJordanSolve")), BatchSize) {
+        Batch::gaussJordanSolve<size, T>({a.data(), a.size()}, {b.data(), b.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gramSchmidtOrthonormalizePerItem() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    std::vector<RectangularMatrix<size, size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::gramSchmidtOrthonormalizeInPlace")), BatchSize) {
+        std::copy(a.begin(), a.end(), out.begin());
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            Algorithms::gramSchmidtOrthonormalizeInPlace(out[i]);
+        escape(out.data());
+    }
+}
+
+template<std::size_t size, class T> void BatchBenchmark::gramSchmidtOrthonormalize() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+    std::vector<RectangularMatrix<size, size, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::Batch::gramSchmidtOrthonormalizeInPlace")), BatchSize) {
+        std::copy(a.begin(), a.end(), out.begin());
+        Batch::gramSchmidtOrthonormalizeInPlace<size, size, T>({out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+template<class T> void BatchBenchmark::svdPerItem() {
+    const std::vector<Matrix<3, T>> a = matrices<3, T>();
+    std::vector<Vector<3, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<3, T>("Algorithms::svd")), BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = std::get<1>(Algorithms::svd(a[i]));
+        escape(out.data());
+    }
+}
+
+template<class T> void BatchBenchmark::svdClosedFormPerItem() {
+    const std::vector<Matrix<3, T>> a = matrices<3, T>();
+    std::vector<Vector<3, T>> out(BatchSize);
+
+    MAGNUM_BENCHMARK((name<3, T>("Algorithms::svdClosedForm")), BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = std::get<1>(Algorithms::svdClosedForm(a[i]));
+        escape(out.data());
+    }
+}
+
+template<class T> void BatchBenchmark::svdClosedForm() {
+    const std::vector<Matrix<3, T>> a = matrices<3, T>();
+    std::vector<Matrix<3, T>> u(BatchSize), v(BatchSize);
+    std::vector<Vector<3, T>> w(BatchSize);
+
+    MAGNUM_BENCHMARK((name<3, T>("Algorithms::Batch::svdClosedForm")), BatchSize) {
+        Batch::svdClosedForm<T>({a.data(), a.size()}, {u.data(), u.size()}, {w.data(), w.size()}, {v.data(), v.size()});
+        escape(w.data());
+    }
+}
+
+template<class T> void BatchBenchmark::eigenSymmetric() {
+    std::vector<Matrix<3, T>> a = matrices<3, T>();
+    for(Matrix<3, T>& m: a) m = m.transposed()*m;
+    std::vector<Matrix<3, T>> eigenvectors(BatchSize);
+    std::vector<Vector<3, T>> eigenvalues(BatchSize);
+
+    MAGNUM_BENCHMARK((name<3, T>("Algorithms::Batch::eigenSymmetric")), BatchSize) {
+        Batch::eigenSymmetric<T>({a.data(), a.size()}, {eigenvalues.data(), eigenvalues.size()}, {eigenvectors.data(), eigenvectors.size()});
+        escape(eigenvalues.data());
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchBenchmark)
@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/Batch.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/GramSchmidt.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct BatchTest: Corrade::TestSuite::Tester {
+    explicit BatchTest();
+
+    void gaussJordanInverted();
+    void gaussJordanInvertedDouble();
+    void gaussJordanInvertedSingular();
+    void gaussJordanSolve();
+    void gramSchmidtOrthonormalize();
+    void eigenSymmetric();
+    void svdClosedForm();
+
+    void sizeMismatch();
+};
+
+typedef Matrix<3, Float> Matrix3x3;
+typedef Matrix<4, Float> Matrix4x4;
+typedef RectangularMatrix<3, 4, Float> Matrix3x4;
+typedef Vector<3, Float> Vector3;
+typedef Vector<4, Float> Vector4;
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::gaussJordanInverted,
+              &BatchTest::gaussJordanInvertedDouble,
+              &BatchTest::gaussJordanInvertedSingular,
+              &BatchTest::gaussJordanSolve,
+              &BatchTest::gramSchmidtOrthonormalize,
+              &BatchTest::eigenSymmetric,
+              &BatchTest::svdClosedForm,
+
+              &BatchTest::sizeMismatch});
+}
+
+namespace {
+    /* Count not divisible by four to test also the partially filled block */
+    enum: std::size_t { Count = 7 };
+
+    template<std::size_t cols, std::size_t rows, class T> RectangularMatrix<cols, rows, T> matrix(std::size_t i) {
+        RectangularMatrix<cols, rows, T> a;
+        for(std::size_t col = 0; col != cols; ++col)
+            for(std::size_t row = 0; row != rows; ++row)
+                a[col][row] = std::sin(T(i*cols*rows + col*rows + row)) + (col == row ? T(2) : T(0));
+        return a;
+    }
+}
+
+void BatchTest::gaussJordanInverted() {
+    Matrix4x4 in[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        in[i] = matrix<4, 4, Float>(i);
+
+    Matrix4x4 out[Count];
+    CORRADE_VERIFY((Batch::gaussJordanInverted<4, Float>(in, out)));
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], Algorithms::gaussJordanInverted(in[i]));
+
+    /* In-place */
+    CORRADE_VERIFY((Batch::gaussJordanInverted<4, Float>(in, in)));
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(in[i], out[i]);
+}
+
+void BatchTest::gaussJordanInvertedDouble() {
+    #ifndef MAGNUM_TARGET_GLES
+    Matrix<3, Double> in[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        in[i] = matrix<3, 3, Double>(i);
+
+    Matrix<3, Double> out[Count];
+    CORRADE_VERIFY((Batch::gaussJordanInverted<3, Double>(in, out)));
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], in[i].inverted());
+    #else
+    CORRADE_SKIP("Double precision is not supported when targeting OpenGL ES.");
+    #endif
+}
+
+void BatchTest::gaussJordanInvertedSingular() {
+    Matrix3x3 in[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        in[i] = matrix<3, 3, Float>(i);
+    in[5] = Matrix3x3{Vector3{1.0f, 2.0f, 3.0f},
+                      Vector3{2.0f, 4.0f, 6.0f},
+                      Vector3{0.0f, 1.0f, 1.0f}};
+
+    Matrix3x3 out[Count];
+    CORRADE_VERIFY(!(Batch::gaussJordanInverted<3, Float>(in, out)));
+
+    /* Other matrices in the same block are not affected */
+    for(std::size_t i: {4, 6})
+        CORRADE_COMPARE(out[i], in[i].inverted());
+}
+
+void BatchTest::gaussJordanSolve() {
+    Matrix4x4 a[Count];
+    Vector4 b[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = matrix<4, 4, Float>(i);
+        b[i] = Vector4{Float(i), 1.0f, -2.0f, 0.5f};
+    }
+
+    Vector4 x[Count];
+    CORRADE_VERIFY((Batch::gaussJordanSolve<4, Float>(a, b, x)));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_COMPARE(a[i]*x[i], b[i]);
+
+        RectangularMatrix<1, 4, Float> t{b[i]};
+        Matrix4x4 ai = a[i];
+        CORRADE_VERIFY(Algorithms::gaussJordanInPlace(ai, t));
+        CORRADE_COMPARE(x[i], t[0]);
+    }
+}
+
+void BatchTest::gramSchmidtOrthonormalize() {
+    Matrix3x4 matrices[Count];
+    Matrix3x4 expected[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        matrices[i] = matrix<3, 4, Float>(i);
+        expected[i] = Algorithms::gramSchmidtOrthonormalize(matrices[i]);
+    }
+
+    Batch::gramSchmidtOrthonormalizeInPlace<3, 4, Float>(matrices);
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(matrices[i], expected[i]);
+}
+
+void BatchTest::eigenSymmetric() {
+    Matrix3x3 in[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        const Matrix3x3 a = matrix<3, 3, Float>(i);
+        in[i] = a.transposed()*a;
+    }
+
+    Vector3 eigenvalues[Count];
+    Matrix3x3 eigenvectors[Count];
+    Batch::eigenSymmetric<Float>(in, eigenvalues, eigenvectors);
+    for(std::size_t i = 0; i != Count; ++i) {
+        const auto expected = Algorithms::eigenSymmetric(in[i]);
+        CORRADE_COMPARE(eigenvalues[i], expected.first);
+        CORRADE_COMPARE(eigenvectors[i], expected.second);
+    }
+}
+
+void BatchTest::svdClosedForm() {
+    Matrix3x3 in[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        in[i] = matrix<3, 3, Float>(i);
+
+    Matrix3x3 u[Count];
+    Vector3 w[Count];
+    Matrix3x3 v[Count];
+    Batch::svdClosedForm<Float>(in, u, w, v);
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(u[i]*Matrix3x3::fromDiagonal(w[i])*v[i].transposed(), in[i]);
+}
+
+void BatchTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const Matrix3x3 a[2];
+    Matrix3x3 out[3];
+    Batch::gaussJordanInverted<3, Float>(a, out);
+    CORRADE_COMPARE(o.str(), "Math::Algorithms::Batch::gaussJordanInverted(): expected arrays of the same size\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchTest)
@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/EigenSymmetric.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct EigenSymmetricTest: Corrade::TestSuite::Tester {
+    explicit EigenSymmetricTest();
+
+    void general();
+    void generalDouble();
+    void diagonal();
+    void repeatedEigenvalue();
+    void zero();
+    void onlyUpperTriangle();
+};
+
+typedef Matrix<3, Float> Matrix3x3;
+typedef Vector<3, Float> Vector3;
+typedef Matrix<3, Double> Matrix3x3d;
+typedef Vector<3, Double> Vector3d;
+
+EigenSymmetricTest::EigenSymmetricTest() {
+    addTests({&EigenSymmetricTest::general,
+              &EigenSymmetricTest::generalDouble,
+              &EigenSymmetricTest::diagonal,
+              &EigenSymmetricTest::repeatedEigenvalue,
+              &EigenSymmetricTest::zero,
+              &EigenSymmetricTest::onlyUpperTriangle});
+}
+
+void EigenSymmetricTest::general() {
+    const Matrix3x3 a{Vector3{ 4.0f, 1.0f, -2.0f},
+                      Vector3{ 1.0f, 2.0f,  0.0f},
+                      Vector3{-2.0f, 0.0f,  3.0f}};
+
+    Vector3 eigenvalues;
+    Matrix3x3 eigenvectors;
+    std::tie(eigenvalues, eigenvectors) = eigenSymmetric(a);
+
+    /* Descending order, sum equal to trace */
+    CORRADE_VERIFY(eigenvalues[0] >= eigenvalues[1]);
+    CORRADE_VERIFY(eigenvalues[1] >= eigenvalues[2]);
+    CORRADE_COMPARE(eigenvalues.sum(), a.trace());
+
+    /* Eigenvectors are a rotation and decompose the matrix */
+    CORRADE_VERIFY(eigenvectors.isOrthogonal());
+    CORRADE_COMPARE(eigenvectors.determinant(), 1.0f);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(a*eigenvectors[i], eigenvectors[i]*eigenvalues[i]);
+    CORRADE_COMPARE(eigenvectors*Matrix3x3::fromDiagonal(eigenvalues)*eigenvectors.transposed(), a);
+}
+
+void EigenSymmetricTest::generalDouble() {
+    #ifndef MAGNUM_TARGET_GLES
+    const Matrix3x3d a{Vector3d{ 2.0, -1.0,  0.5},
+                       Vector3d{-1.0,  5.0,  3.0},
+                       Vector3d{ 0.5,  3.0, -4.0}};
+
+    Vector3d eigenvalues;
+    Matrix3x3d eigenvectors;
+    std::tie(eigenvalues, eigenvectors) = eigenSymmetric(a);
+
+    CORRADE_VERIFY(eigenvalues[0] >= eigenvalues[1]);
+    CORRADE_VERIFY(eigenvalues[1] >= eigenvalues[2]);
+    CORRADE_VERIFY(eigenvectors.isOrthogonal());
+    CORRADE_COMPARE(eigenvectors*Matrix3x3d::fromDiagonal(eigenvalues)*eigenvectors.transposed(), a);
+    #else
+    CORRADE_SKIP("Double precision is not supported when targeting OpenGL ES.");
+    #endif
+}
+
+void EigenSymmetricTest::diagonal() {
+    Vector3 eigenvalues;
+    Matrix3x3 eigenvectors;
+    std::tie(eigenvalues, eigenvectors) = eigenSymmetric(Matrix3x3::fromDiagonal({2.0f, -1.0f, 5.0f}));
+
+    CORRADE_COMPARE(eigenvalues, (Vector3{5.0f, 2.0f, -1.0f}));
+    CORRADE_COMPARE(eigenvectors, (Matrix3x3{Vector3{0.0f, 0.0f, 1.0f},
+                                             Vector3{1.0f, 0.0f, 0.0f},
+                                             Vector3{0.0f, 1.0f, 0.0f}}));
+}
+
+void EigenSymmetricTest::repeatedEigenvalue() {
+    /* Eigenvalues 4, 1, 1 */
+    const Matrix3x3 a{Vector3{2.0f, 1.0f, 1.0f},
+                      Vector3{1.0f, 2.0f, 1.0f},
+                      Vector3{1.0f, 1.0f, 2.0f}};
+
+    Vector3 eigenvalues;
+    Matrix3x3 eigenvectors;
+    std::tie(eigenvalues, eigenvectors) = eigenSymmetric(a);
+
+    CORRADE_COMPARE(eigenvalues, (Vector3{4.0f, 1.0f, 1.0f}));
+    CORRADE_VERIFY(eigenvectors.isOrthogonal());
+    CORRADE_COMPARE(eigenvectors.determinant(), 1.0f);
+    CORRADE_COMPARE(eigenvectors*Matrix3x3::fromDiagonal(eigenvalues)*eigenvectors.transposed(), a);
+}
+
+void EigenSymmetricTest::zero() {
+    Vector3 eigenvalues;
+    Matrix3x3 eigenvectors;
+    std::tie(eigenvalues, eigenvectors) = eigenSymmetric(Matrix3x3{Matrix3x3::Zero});
+
+    CORRADE_COMPARE(eigenvalues, Vector3{});
+    CORRADE_COMPARE(eigenvectors, Matrix3x3{});
+}
+
+void EigenSymmetricTest::onlyUpperTriangle() {
+    const Matrix3x3 a{Vector3{ 4.0f, 1.0f, -2.0f},
+                      Vector3{ 1.0f, 2.0f,  0.0f},
+                      Vector3{-2.0f, 0.0f,  3.0f}};
+
+    /* Lower triangle is garbage */
+    Matrix3x3 b = a;
+    b[0][1] = 100.0f;
+    b[0][2] = -35.0f;
+    b[1][2] = 7.0f;
+
+    CORRADE_COMPARE(eigenSymmetric(b).first, eigenSymmetric(a).first);
+    CORRADE_COMPARE(eigenSymmetric(b).second, eigenSymmetric(a).second);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::EigenSymmetricTest)
@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+/* Compares Gauss-Jordan inversion with the cofactor-based Matrix::inverted()
+   for matrices of various sizes in both precisions */
+struct GaussJordanBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit GaussJordanBenchmark();
+
+    template<std::size_t size, class T> void inverted();
+    template<std::size_t size, class T> void invertedCofactor();
+    template<std::size_t size, class T> void solve();
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    /* Diagonally dominant and thus well-conditioned matrices */
+    template<std::size_t size, class T> std::vector<Matrix<size, T>> matrices() {
+        std::vector<Matrix<size, T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            Matrix<size, T> a{Matrix<size, T>::Identity, T(size)};
+            for(std::size_t col = 0; col != size; ++col)
+                for(std::size_t row = 0; row != size; ++row)
+                    a[col][row] += std::sin(T(i + col*size + row));
+            out.push_back(a);
+        }
+        return out;
+    }
+
+    template<std::size_t size, class T> std::string name(const std::string& operation) {
+        return operation + "(Matrix<" + std::to_string(size) + ", " + Magnum::Test::AbstractBenchmarkTester::typeName<T>() + ">)";
+    }
+}
+
+GaussJordanBenchmark::GaussJordanBenchmark() {
+    addTests<GaussJordanBenchmark>({&GaussJordanBenchmark::inverted<3, Float>,
+              &GaussJordanBenchmark::inverted<4, Float>,
+              &GaussJordanBenchmark::inverted<6, Float>,
+              &GaussJordanBenchmark::invertedCofactor<3, Float>,
+              &GaussJordanBenchmark::invertedCofactor<4, Float>,
+              &GaussJordanBenchmark::invertedCofactor<6, Float>,
+              &GaussJordanBenchmark::solve<4, Float>,
+              #ifndef MAGNUM_TARGET_GLES
+              &GaussJordanBenchmark::inverted<3, Double>,
+              &GaussJordanBenchmark::inverted<4, Double>,
+              &GaussJordanBenchmark::inverted<6, Double>,
+              &GaussJordanBenchmark::invertedCofactor<3, Double>,
+              &GaussJordanBenchmark::invertedCofactor<4, Double>,
+              &GaussJordanBenchmark::invertedCofactor<6, Double>,
+              &GaussJordanBenchmark::solve<4, Double>
+              #endif
+              });
+}
+
+template<std::size_t size, class T> void GaussJordanBenchmark::inverted() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::gaussJordanInverted")), BatchSize) {
+        Matrix<size, T> out{Matrix<size, T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += gaussJordanInverted(a[i]);
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void GaussJordanBenchmark::invertedCofactor() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("Matrix::inverted")), BatchSize) {
+        Matrix<size, T> out{Matrix<size, T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].inverted();
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void GaussJordanBenchmark::solve() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("Algorithms::gaussJordanInPlaceTransposed")), BatchSize) {
+        RectangularMatrix<size, 1, T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            RectangularMatrix<size, size, T> matrix = a[i];
+            RectangularMatrix<size, 1, T> t;
+            for(std::size_t j = 0; j != size; ++j) t[j][0] = T(i + j);
+            gaussJordanInPlaceTransposed(matrix, t);
+            out += t;
+        }
+        escape(out);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GaussJordanBenchmark)
@@ -34,6 +34,7 @@ struct GaussJordanTest: Corrade::TestSuite::Tester {
 
     void singular();
     void invert();
+    void inverted();
 };
 
 typedef RectangularMatrix<4, 4, Float> Matrix4x4;
@@ -41,7 +42,8 @@ typedef Vector<4, Float> Vector4;
 
 GaussJordanTest::GaussJordanTest() {
     addTests({&GaussJordanTest::singular,
-              &GaussJordanTest::invert});
+              &GaussJordanTest::invert,
+              &GaussJordanTest::inverted});
 }
 
 void GaussJordanTest::singular() {
@@ -73,6 +75,17 @@ void GaussJordanTest::invert() {
     CORRADE_COMPARE(a*inverse, Matrix4x4::fromDiagonal(Vector4(1.0f)));
 }
 
+void GaussJordanTest::inverted() {
+    Matrix<4, Float> a(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
+                       Vector4(4.0f,  4.0f, 7.0f, 3.0f),
+                       Vector4(7.0f, -1.0f, 8.0f, 0.0f),
+                       Vector4(9.0f,  4.0f, 5.0f, 9.0f));
+
+    const Matrix<4, Float> inverse = gaussJordanInverted(a);
+    CORRADE_COMPARE(inverse, a.inverted());
+    CORRADE_COMPARE(a*inverse, (Matrix<4, Float>{}));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GaussJordanTest)
@@ -0,0 +1,81 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct SvdBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit SvdBenchmark();
+
+    template<std::size_t cols, std::size_t rows, class T> void svd();
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 100 };
+
+    template<std::size_t cols, std::size_t rows, class T> std::vector<RectangularMatrix<cols, rows, T>> matrices() {
+        std::vector<RectangularMatrix<cols, rows, T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            RectangularMatrix<cols, rows, T> a;
+            for(std::size_t col = 0; col != cols; ++col)
+                for(std::size_t row = 0; row != rows; ++row)
+                    a[col][row] = std::sin(T(i + col*rows + row));
+            out.push_back(a);
+        }
+        return out;
+    }
+}
+
+SvdBenchmark::SvdBenchmark() {
+    addTests<SvdBenchmark>({&SvdBenchmark::svd<3, 3, Float>,
+              &SvdBenchmark::svd<4, 4, Float>,
+              &SvdBenchmark::svd<5, 8, Float>,
+              #ifndef MAGNUM_TARGET_GLES
+              &SvdBenchmark::svd<3, 3, Double>,
+              &SvdBenchmark::svd<4, 4, Double>,
+              &SvdBenchmark::svd<5, 8, Double>
+              #endif
+              });
+}
+
+template<std::size_t cols, std::size_t rows, class T> void SvdBenchmark::svd() {
+    const std::vector<RectangularMatrix<cols, rows, T>> a = matrices<cols, rows, T>();
+
+    MAGNUM_BENCHMARK("Algorithms::svd(RectangularMatrix<" + std::to_string(cols) + ", " + std::to_string(rows) + ", " + typeName<T>() + ">)", BatchSize) {
+        Vector<cols, T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += std::get<1>(Algorithms::svd(a[i]));
+        escape(out);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdBenchmark)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <functional>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Algorithms/Svd.h"
@@ -34,6 +36,10 @@ struct SvdTest: Corrade::TestSuite::Tester {
 
     void testDouble();
     void testFloat();
+
+    void closedForm();
+    void closedFormRankDeficient();
+    void closedFormReflection();
 };
 
 #ifndef MAGNUM_TARGET_GLES
@@ -72,7 +78,11 @@ static const Vector5f expectedf(std::sqrt(1248.0f), 0.0f, 20.0f, std::sqrt(384.0
 
 SvdTest::SvdTest() {
     addTests({&SvdTest::testDouble,
-              &SvdTest::testFloat});
+              &SvdTest::testFloat,
+
+              &SvdTest::closedForm,
+              &SvdTest::closedFormRankDeficient,
+              &SvdTest::closedFormReflection});
 }
 
 void SvdTest::testDouble() {
@@ -117,6 +127,64 @@ void SvdTest::testFloat() {
     CORRADE_VERIFY(Math::abs(w-expectedf).max() < 1.0e-5f);
 }
 
+typedef Matrix<3, Float> Matrix3x3f;
+typedef Vector<3, Float> Vector3f;
+
+void SvdTest::closedForm() {
+    const Matrix3x3f a{Vector3f{2.0f, -1.0f,  0.5f},
+                       Vector3f{3.0f,  1.5f,  4.0f},
+                       Vector3f{0.0f, -2.0f, -1.0f}};
+
+    Matrix3x3f u;
+    Vector3f w;
+    Matrix3x3f v;
+    std::tie(u, w, v) = svdClosedForm(a);
+
+    /* Test composition */
+    CORRADE_COMPARE(u*Matrix3x3f::fromDiagonal(w)*v.transposed(), a);
+
+    /* Test that U and V are unitary, V is a rotation */
+    CORRADE_VERIFY(u.isOrthogonal());
+    CORRADE_VERIFY(v.isOrthogonal());
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+
+    /* Same singular values as the iterative algorithm, just sorted */
+    Vector3f expected = std::get<1>(svd(a));
+    std::sort(expected.data(), expected.data() + 3, std::greater<Float>());
+    CORRADE_COMPARE(w, expected);
+}
+
+void SvdTest::closedFormRankDeficient() {
+    /* Rank 1 */
+    const Matrix3x3f a{Vector3f{1.0f, 2.0f, 3.0f},
+                       Vector3f{2.0f, 4.0f, 6.0f},
+                       Vector3f{-1.0f, -2.0f, -3.0f}};
+
+    Matrix3x3f u;
+    Vector3f w;
+    Matrix3x3f v;
+    std::tie(u, w, v) = svdClosedForm(a);
+
+    CORRADE_COMPARE(u*Matrix3x3f::fromDiagonal(w)*v.transposed(), a);
+    CORRADE_VERIFY(u.isOrthogonal());
+    CORRADE_VERIFY(v.isOrthogonal());
+    CORRADE_COMPARE(w, (Vector3f{std::sqrt(84.0f), 0.0f, 0.0f}));
+}
+
+void SvdTest::closedFormReflection() {
+    /* Negative determinant, all singular values still positive */
+    const Matrix3x3f a = Matrix3x3f::fromDiagonal({2.0f, -3.0f, 0.5f});
+
+    Matrix3x3f u;
+    Vector3f w;
+    Matrix3x3f v;
+    std::tie(u, w, v) = svdClosedForm(a);
+
+    CORRADE_COMPARE(w, (Vector3f{3.0f, 2.0f, 0.5f}));
+    CORRADE_COMPARE(u*Matrix3x3f::fromDiagonal(w)*v.transposed(), a);
+    CORRADE_COMPARE(u.determinant()*v.determinant(), -1.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
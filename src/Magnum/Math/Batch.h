@@ -0,0 +1,523 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Batch
+ */
+
+#include <algorithm>
+#include <type_traits>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Implementation/Simd.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    /* Views are not used for template argument deduction, so anything
+       convertible to them can be passed */
+    template<class T> struct BatchInput { typedef Corrade::Containers::ArrayView<const T> Type; };
+    template<class T> struct BatchOutput { typedef Corrade::Containers::ArrayView<T> Type; };
+
+    template<class T> void transformSoa(const Matrix4<T>& matrix, Corrade::Containers::ArrayView<T> x, Corrade::Containers::ArrayView<T> y, Corrade::Containers::ArrayView<T> z, const bool translate) {
+        std::size_t i = 0;
+        #ifdef MAGNUM_MATH_SSE2
+        if(std::is_same<T, Float>::value)
+            i = simdTransformVectors3Soa(reinterpret_cast<const Float*>(matrix.data()), reinterpret_cast<Float*>(x.data()), reinterpret_cast<Float*>(y.data()), reinterpret_cast<Float*>(z.data()), x.size(), translate);
+        #endif
+        const T w = translate ? T(1) : T(0);
+        /* Checking all three sizes avoids a spurious GCC warning about
+           undefined behavior in the loop */
+        for(; i < x.size() && i < y.size() && i < z.size(); ++i) {
+            const Vector4<T> transformed = matrix*Vector4<T>{x[i], y[i], z[i], w};
+            x[i] = transformed.x();
+            y[i] = transformed.y();
+            z[i] = transformed.z();
+        }
+    }
+}
+
+/**
+@brief Batched operations
+
+Functions operating on whole arrays of vectors, matrices and quaternions at
+once. Data are passed either as arrays of structures (e.g. array of
+@ref Vector3) or, for three-component vectors, as structures of arrays (i.e.
+one array for each component). Output can be always the same array as input,
+in that case the operation is done in-place. All arrays are expected to have
+the same size.
+
+Array parameters accept anything convertible to
+@ref Corrade::Containers::ArrayView, such as @ref Corrade::Containers::Array
+or plain C arrays. The views are not used for template argument deduction, so
+the type is deduced only from the transformation parameter and needs to be
+specified explicitly for the other functions, e.g.:
+@code
+Containers::Array<Vector3> a, b;
+Containers::Array<Float> out;
+// ...
+Math::Batch::dot<Vector3>(a, b, out);
+Math::Batch::transformPoints(Matrix4::rotationX(15.0_degf), a, a);
+@endcode
+
+If the library is built with @ref MAGNUM_TARGET_SIMD, operations on
+@ref Magnum::Float "Float" types use SSE2 code paths where the data layout
+allows it, structure-of-arrays variants benefit from that the most.
+@see @ref MeshTools::transformPointsInPlace(),
+    @ref MeshTools::transformVectorsInPlace()
+*/
+namespace Batch {
+
+/**
+@brief Batched dot product
+@param[in]  a       First vectors
+@param[in]  b       Second vectors
+@param[out] out     Dot products
+
+Equivalent to calling @ref Math::dot() on each pair of items. Works for
+vectors and quaternions.
+*/
+template<class T> void dot(typename Implementation::BatchInput<T>::Type a, typename Implementation::BatchInput<T>::Type b, typename Implementation::BatchOutput<typename T::Type>::Type out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::Batch::dot(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::dot(a[i], b[i]);
+}
+
+/**
+@brief Batched dot product of three-component vectors stored as structure of arrays
+@param[in]  ax, ay, az  Components of first vectors
+@param[in]  bx, by, bz  Components of second vectors
+@param[out] out         Dot products
+*/
+template<class T> void dot(typename Implementation::BatchInput<T>::Type ax, typename Implementation::BatchInput<T>::Type ay, typename Implementation::BatchInput<T>::Type az, typename Implementation::BatchInput<T>::Type bx, typename Implementation::BatchInput<T>::Type by, typename Implementation::BatchInput<T>::Type bz, typename Implementation::BatchOutput<T>::Type out) {
+    CORRADE_ASSERT(ax.size() == out.size() && ay.size() == out.size() && az.size() == out.size() && bx.size() == out.size() && by.size() == out.size() && bz.size() == out.size(),
+        "Math::Batch::dot(): expected arrays of the same size", );
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SSE2
+    if(std::is_same<T, Float>::value)
+        i = Implementation::simdDot3Soa(reinterpret_cast<const Float*>(ax.data()), reinterpret_cast<const Float*>(ay.data()), reinterpret_cast<const Float*>(az.data()), reinterpret_cast<const Float*>(bx.data()), reinterpret_cast<const Float*>(by.data()), reinterpret_cast<const Float*>(bz.data()), reinterpret_cast<Float*>(out.data()), out.size());
+    #endif
+    for(; i < out.size(); ++i)
+        out[i] = ax[i]*bx[i] + ay[i]*by[i] + az[i]*bz[i];
+}
+
+/**
+@brief Batched cross product
+@param[in]  a       First vectors
+@param[in]  b       Second vectors
+@param[out] out     Cross products
+
+Equivalent to calling @ref Math::cross(const Vector3<T>&, const Vector3<T>&)
+on each pair of items.
+*/
+template<class T> void cross(typename Implementation::BatchInput<Vector3<T>>::Type a, typename Implementation::BatchInput<Vector3<T>>::Type b, typename Implementation::BatchOutput<Vector3<T>>::Type out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Math::Batch::cross(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::cross(a[i], b[i]);
+}
+
+/**
+@brief Batched normalization
+@param[in]  in      Vectors or quaternions to normalize
+@param[out] out     Normalized vectors or quaternions
+
+Equivalent to calling @ref Vector::normalized() on each item.
+*/
+template<class T> void normalize(typename Implementation::BatchInput<T>::Type in, typename Implementation::BatchOutput<T>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::normalize(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = in[i].normalized();
+}
+
+/**
+@brief Batched in-place normalization of three-component vectors stored as structure of arrays
+@param[in,out] x, y, z  Vector components
+*/
+template<class T> void normalize(typename Implementation::BatchOutput<T>::Type x, typename Implementation::BatchOutput<T>::Type y, typename Implementation::BatchOutput<T>::Type z) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size(),
+        "Math::Batch::normalize(): expected arrays of the same size", );
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SSE2
+    if(std::is_same<T, Float>::value)
+        i = Implementation::simdNormalize3Soa(reinterpret_cast<Float*>(x.data()), reinterpret_cast<Float*>(y.data()), reinterpret_cast<Float*>(z.data()), x.size());
+    #endif
+    for(; i < x.size(); ++i) {
+        const T length = std::sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+        x[i] /= length;
+        y[i] /= length;
+        z[i] /= length;
+    }
+}
+
+/**
+@brief Batched linear interpolation
+@param[in]  a       First values
+@param[in]  b       Second values
+@param[in]  t       Interpolation phase
+@param[out] out     Interpolated values
+
+Equivalent to calling @ref Math::lerp(const T&, const T&, U) or
+@ref Math::lerp(const Quaternion<T>&, const Quaternion<T>&, T) on each pair
+of items.
+*/
+template<class T> void lerp(typename Implementation::BatchInput<T>::Type a, typename Implementation::BatchInput<T>::Type b, typename T::Type t, typename Implementation::BatchOutput<T>::Type out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Math::Batch::lerp(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::lerp(a[i], b[i], t);
+}
+
+/**
+@brief Batched spherical linear interpolation
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phase
+@param[out] out         Interpolated quaternions
+
+Equivalent to calling @ref Math::slerp(const Quaternion<T>&, const Quaternion<T>&, T)
+on each pair of items.
+*/
+template<class T> void slerp(typename Implementation::BatchInput<Quaternion<T>>::Type normalizedA, typename Implementation::BatchInput<Quaternion<T>>::Type normalizedB, T t, typename Implementation::BatchOutput<Quaternion<T>>::Type out) {
+    CORRADE_ASSERT(normalizedA.size() == out.size() && normalizedB.size() == out.size(),
+        "Math::Batch::slerp(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::slerp(normalizedA[i], normalizedB[i], t);
+}
+
+/**
+@brief Batched multiplication
+@param[in]  a       Left operand
+@param[in]  b       Right operands
+@param[out] out     Products
+
+Multiplies all items of @p b with @p a from the left. Useful for propagating
+a transformation to many matrices, quaternions or dual quaternions at once.
+*/
+template<class T> void multiply(const T& a, typename Implementation::BatchInput<T>::Type b, typename Implementation::BatchOutput<T>::Type out) {
+    CORRADE_ASSERT(b.size() == out.size(),
+        "Math::Batch::multiply(): expected arrays of the same size", );
+    /* Copy the left operand first in case it aliases the output */
+    const T left = a;
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = left*b[i];
+}
+
+/**
+@brief Batched 2D vector transformation
+@param[in]  matrix  Transformation matrix
+@param[in]  in      Vectors to transform
+@param[out] out     Transformed vectors
+
+Equivalent to calling @ref Matrix3::transformVector() on each item.
+*/
+template<class T> void transformVectors(const Matrix3<T>& matrix, typename Implementation::BatchInput<Vector2<T>>::Type in, typename Implementation::BatchOutput<Vector2<T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformVectors(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = matrix.transformVector(in[i]);
+}
+
+/** @overload
+Equivalent to calling @ref Complex::transformVector() on each item.
+*/
+template<class T> void transformVectors(const Complex<T>& complex, typename Implementation::BatchInput<Vector2<T>>::Type in, typename Implementation::BatchOutput<Vector2<T>>::Type out) {
+    transformVectors(Matrix3<T>::from(complex.toMatrix(), {}), in, out);
+}
+
+/**
+@brief Batched 3D vector transformation
+@param[in]  matrix  Transformation matrix
+@param[in]  in      Vectors to transform
+@param[out] out     Transformed vectors
+
+Equivalent to calling @ref Matrix4::transformVector() on each item.
+*/
+template<class T> void transformVectors(const Matrix4<T>& matrix, typename Implementation::BatchInput<Vector3<T>>::Type in, typename Implementation::BatchOutput<Vector3<T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformVectors(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = matrix.transformVector(in[i]);
+}
+
+/** @overload
+Equivalent to calling @ref Quaternion::transformVectorNormalized() on each
+item. The quaternion is converted to rotation matrix first, as it is faster
+to apply on many vectors.
+*/
+template<class T> void transformVectors(const Quaternion<T>& normalizedQuaternion, typename Implementation::BatchInput<Vector3<T>>::Type in, typename Implementation::BatchOutput<Vector3<T>>::Type out) {
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "Math::Batch::transformVectors(): quaternion must be normalized", );
+    transformVectors(Matrix4<T>::from(normalizedQuaternion.toMatrix(), {}), in, out);
+}
+
+/**
+@brief Batched in-place 3D vector transformation of vectors stored as structure of arrays
+@param[in]     matrix   Transformation matrix
+@param[in,out] x, y, z  Vector components
+
+Equivalent to calling @ref Matrix4::transformVector() on each item.
+*/
+template<class T> void transformVectors(const Matrix4<T>& matrix, typename Implementation::BatchOutput<T>::Type x, typename Implementation::BatchOutput<T>::Type y, typename Implementation::BatchOutput<T>::Type z) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size(),
+        "Math::Batch::transformVectors(): expected arrays of the same size", );
+    Implementation::transformSoa(matrix, x, y, z, false);
+}
+
+/**
+@brief Batched 2D point transformation
+@param[in]  matrix  Transformation matrix
+@param[in]  in      Points to transform
+@param[out] out     Transformed points
+
+Equivalent to calling @ref Matrix3::transformPoint() on each item.
+*/
+template<class T> void transformPoints(const Matrix3<T>& matrix, typename Implementation::BatchInput<Vector2<T>>::Type in, typename Implementation::BatchOutput<Vector2<T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformPoints(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = matrix.transformPoint(in[i]);
+}
+
+/** @overload
+Equivalent to calling @ref DualComplex::transformPoint() on each item.
+*/
+template<class T> void transformPoints(const DualComplex<T>& dualComplex, typename Implementation::BatchInput<Vector2<T>>::Type in, typename Implementation::BatchOutput<Vector2<T>>::Type out) {
+    transformPoints(dualComplex.toMatrix(), in, out);
+}
+
+/**
+@brief Batched 3D point transformation
+@param[in]  matrix  Transformation matrix
+@param[in]  in      Points to transform
+@param[out] out     Transformed points
+
+Equivalent to calling @ref Matrix4::transformPoint() on each item.
+*/
+template<class T> void transformPoints(const Matrix4<T>& matrix, typename Implementation::BatchInput<Vector3<T>>::Type in, typename Implementation::BatchOutput<Vector3<T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformPoints(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = matrix.transformPoint(in[i]);
+}
+
+/** @overload
+Equivalent to calling @ref DualQuaternion::transformPointNormalized() on each
+item. The dual quaternion is converted to transformation matrix first, as it
+is faster to apply on many points.
+*/
+template<class T> void transformPoints(const DualQuaternion<T>& normalizedDualQuaternion, typename Implementation::BatchInput<Vector3<T>>::Type in, typename Implementation::BatchOutput<Vector3<T>>::Type out) {
+    CORRADE_ASSERT(normalizedDualQuaternion.isNormalized(),
+        "Math::Batch::transformPoints(): dual quaternion must be normalized", );
+    transformPoints(normalizedDualQuaternion.toMatrix(), in, out);
+}
+
+/**
+@brief Batched in-place 3D point transformation of points stored as structure of arrays
+@param[in]     matrix   Transformation matrix
+@param[in,out] x, y, z  Point components
+
+Equivalent to calling @ref Matrix4::transformPoint() on each item.
+*/
+template<class T> void transformPoints(const Matrix4<T>& matrix, typename Implementation::BatchOutput<T>::Type x, typename Implementation::BatchOutput<T>::Type y, typename Implementation::BatchOutput<T>::Type z) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size(),
+        "Math::Batch::transformPoints(): expected arrays of the same size", );
+    Implementation::transformSoa(matrix, x, y, z, true);
+}
+
+/**
+@brief Batched packing of floats to half-floats
+@param[in]  in      Values to pack
+@param[out] out     Packed values
+
+Equivalent to calling @ref Math::packHalf() on each item. Vectors can be
+converted by viewing them as arrays of floats.
+*/
+inline void packHalf(Implementation::BatchInput<Float>::Type in, Implementation::BatchOutput<Half>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::packHalf(): expected arrays of the same size", );
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SSE2
+    i = Implementation::simdPackHalf(in.data(), reinterpret_cast<UnsignedShort*>(out.data()), out.size());
+    #endif
+    for(; i < out.size(); ++i)
+        out[i] = Half{Math::packHalf(in[i])};
+}
+
+/**
+@brief Batched unpacking of half-floats to floats
+@param[in]  in      Values to unpack
+@param[out] out     Unpacked values
+
+Equivalent to calling @ref Math::unpackHalf() on each item.
+*/
+inline void unpackHalf(Implementation::BatchInput<Half>::Type in, Implementation::BatchOutput<Float>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::unpackHalf(): expected arrays of the same size", );
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SSE2
+    i = Implementation::simdUnpackHalf(reinterpret_cast<const UnsignedShort*>(in.data()), out.data(), out.size());
+    #endif
+    for(; i < out.size(); ++i)
+        out[i] = Math::unpackHalf(in[i].data());
+}
+
+/**
+@brief Batched packing of four-component vectors to signed 2.10.10.10 integers
+@param[in]  in      Vectors to pack
+@param[out] out     Packed values
+
+Equivalent to calling @ref Math::packInt2101010Rev() on each item.
+*/
+inline void packInt2101010Rev(Implementation::BatchInput<Vector4<Float>>::Type in, Implementation::BatchOutput<UnsignedInt>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::packInt2101010Rev(): expected arrays of the same size", );
+    #ifdef MAGNUM_MATH_SSE2
+    Implementation::simdPack2101010Rev(reinterpret_cast<const Float*>(in.data()), out.data(), out.size(), true);
+    #else
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::packInt2101010Rev(in[i]);
+    #endif
+}
+
+/**
+@brief Batched unpacking of four-component vectors from signed 2.10.10.10 integers
+@param[in]  in      Values to unpack
+@param[out] out     Unpacked vectors
+
+Equivalent to calling @ref Math::unpackInt2101010Rev() on each item.
+*/
+inline void unpackInt2101010Rev(Implementation::BatchInput<UnsignedInt>::Type in, Implementation::BatchOutput<Vector4<Float>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::unpackInt2101010Rev(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::unpackInt2101010Rev(in[i]);
+}
+
+/**
+@brief Batched packing of four-component vectors to unsigned 2.10.10.10 integers
+@param[in]  in      Vectors to pack
+@param[out] out     Packed values
+
+Equivalent to calling @ref Math::packUnsignedInt2101010Rev() on each item.
+*/
+inline void packUnsignedInt2101010Rev(Implementation::BatchInput<Vector4<Float>>::Type in, Implementation::BatchOutput<UnsignedInt>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::packUnsignedInt2101010Rev(): expected arrays of the same size", );
+    #ifdef MAGNUM_MATH_SSE2
+    Implementation::simdPack2101010Rev(reinterpret_cast<const Float*>(in.data()), out.data(), out.size(), false);
+    #else
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::packUnsignedInt2101010Rev(in[i]);
+    #endif
+}
+
+/**
+@brief Batched unpacking of four-component vectors from unsigned 2.10.10.10 integers
+@param[in]  in      Values to unpack
+@param[out] out     Unpacked vectors
+
+Equivalent to calling @ref Math::unpackUnsignedInt2101010Rev() on each item.
+*/
+inline void unpackUnsignedInt2101010Rev(Implementation::BatchInput<UnsignedInt>::Type in, Implementation::BatchOutput<Vector4<Float>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::unpackUnsignedInt2101010Rev(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::unpackUnsignedInt2101010Rev(in[i]);
+}
+
+/**
+@brief Batched octahedral packing of normalized vectors
+@param[in]  in      Normalized vectors to pack
+@param[out] out     Packed vectors
+
+Equivalent to calling @ref Math::packOctahedral() on each item.
+*/
+template<class T> void packOctahedral(typename Implementation::BatchInput<Vector3<Float>>::Type in, typename Implementation::BatchOutput<Vector2<T>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::packOctahedral(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::packOctahedral<T>(in[i]);
+}
+
+/**
+@brief Batched octahedral unpacking of normalized vectors
+@param[in]  in      Packed vectors
+@param[out] out     Unpacked normalized vectors
+
+Equivalent to calling @ref Math::unpackOctahedral() on each item.
+*/
+template<class T> void unpackOctahedral(typename Implementation::BatchInput<Vector2<T>>::Type in, typename Implementation::BatchOutput<Vector3<Float>>::Type out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::unpackOctahedral(): expected arrays of the same size", );
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = Math::unpackOctahedral(in[i]);
+}
+
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline void dot<Vector4<Float>>(Corrade::Containers::ArrayView<const Vector4<Float>> a, Corrade::Containers::ArrayView<const Vector4<Float>> b, Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::Batch::dot(): expected arrays of the same size", );
+    std::size_t i = Implementation::simdDot4Batch(reinterpret_cast<const Float*>(a.data()), reinterpret_cast<const Float*>(b.data()), out.data(), out.size());
+    for(; i < out.size(); ++i)
+        out[i] = Implementation::simdDot4(a[i].data(), b[i].data());
+}
+
+template<> inline void multiply<Matrix4<Float>>(const Matrix4<Float>& a, Corrade::Containers::ArrayView<const Matrix4<Float>> b, Corrade::Containers::ArrayView<Matrix4<Float>> out) {
+    CORRADE_ASSERT(b.size() == out.size(),
+        "Math::Batch::multiply(): expected arrays of the same size", );
+    /* Copy the left operand first in case it aliases the output */
+    const Matrix4<Float> left = a;
+    Implementation::simdMultiplyMatrix4Batch(left.data(), reinterpret_cast<const Float*>(b.data()), reinterpret_cast<Float*>(out.data()), out.size());
+}
+
+template<> inline void transformVectors<Float>(const Matrix4<Float>& matrix, Corrade::Containers::ArrayView<const Vector3<Float>> in, Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformVectors(): expected arrays of the same size", );
+    Implementation::simdTransformVectors3(matrix.data(), reinterpret_cast<const Float*>(in.data()), reinterpret_cast<Float*>(out.data()), out.size(), false);
+}
+
+template<> inline void transformPoints<Float>(const Matrix4<Float>& matrix, Corrade::Containers::ArrayView<const Vector3<Float>> in, Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(in.size() == out.size(),
+        "Math::Batch::transformPoints(): expected arrays of the same size", );
+    Implementation::simdTransformVectors3(matrix.data(), reinterpret_cast<const Float*>(in.data()), reinterpret_cast<Float*>(out.data()), out.size(), true);
+}
+#endif
+
+}
+
+}}
+
+#endif
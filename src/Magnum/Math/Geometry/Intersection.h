@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
@@ -123,6 +124,46 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersection of a ray and a triangle
+         * @param p             Starting point of the ray
+         * @param r             Direction of the ray
+         * @param a             First triangle vertex
+         * @param b             Second triangle vertex
+         * @param c             Third triangle vertex
+         * @return Intersection point position `t` on the ray and barycentric
+         *      coordinates `u`, `v` of the intersection point relative to
+         *      @p b and @p c, packed in a vector in this order. `t` is
+         *      infinity if the line doesn't go through inside of the
+         *      triangle or is parallel to it. Intersection point can be then
+         *      computed with `p + t*r` or `(1 - u - v)*a + u*b + v*c`. If `t`
+         *      is negative, the intersection lies behind the starting point.
+         *
+         * Uses the Möller–Trumbore algorithm, which solves the following
+         * equation for **t**, **u** and **v** using Cramer's rule without
+         * computing plane equation of the triangle: @f[
+         *      \boldsymbol p + t \boldsymbol r = (1 - u - v) \boldsymbol a + u \boldsymbol b + v \boldsymbol c
+         * @f]
+         */
+        template<class T> static Vector3<T> rayTriangle(const Vector3<T>& p, const Vector3<T>& r, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c) {
+            const Vector3<T> e1 = b - a;
+            const Vector3<T> e2 = c - a;
+            const Vector3<T> pe2 = cross(r, e2);
+            const T determinant = dot(e1, pe2);
+            if(determinant == T(0)) return {Constants<T>::inf(), T(0), T(0)};
+
+            const T inverseDeterminant = T(1)/determinant;
+            const Vector3<T> s = p - a;
+            const T u = dot(s, pe2)*inverseDeterminant;
+            if(u < T(0) || u > T(1)) return {Constants<T>::inf(), T(0), T(0)};
+
+            const Vector3<T> q = cross(s, e1);
+            const T v = dot(r, q)*inverseDeterminant;
+            if(v < T(0) || u + v > T(1)) return {Constants<T>::inf(), T(0), T(0)};
+
+            return {dot(e2, q)*inverseDeterminant, u, v};
+        }
 };
 
 }}}
@@ -34,6 +34,7 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
 
     void planeLine();
     void lineLine();
+    void rayTriangle();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -42,7 +43,8 @@ typedef Math::Constants<Float> Constants;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+              &IntersectionTest::rayTriangle});
 }
 
 void IntersectionTest::planeLine() {
@@ -97,6 +99,30 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), Constants::inf());
 }
 
+void IntersectionTest::rayTriangle() {
+    const Vector3 a(1.0f, 0.0f, 0.0f);
+    const Vector3 b(3.0f, 0.0f, 0.0f);
+    const Vector3 c(1.0f, 2.0f, 0.0f);
+
+    /* Inside the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({1.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -0.5f}, a, b, c),
+        Vector3(4.0f, 0.25f, 0.5f));
+
+    /* Inside the triangle, behind starting point */
+    CORRADE_COMPARE(Intersection::rayTriangle({1.5f, 1.0f, -1.0f}, {0.0f, 0.0f, -1.0f}, a, b, c),
+        Vector3(-1.0f, 0.25f, 0.5f));
+
+    /* Outside of the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({2.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -1.0f}, a, b, c).x(),
+        Constants::inf());
+    CORRADE_COMPARE(Intersection::rayTriangle({0.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -1.0f}, a, b, c).x(),
+        Constants::inf());
+
+    /* Ray is parallel to the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({1.5f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, c).x(),
+        Constants::inf());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
@@ -0,0 +1,97 @@
+#ifndef Magnum_Math_Half_h
+#define Magnum_Math_Half_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Half
+ */
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Half-precision float
+
+Storage-only 16-bit floating-point type with one sign bit, five exponent bits
+and ten mantissa bits, compatible with @ref Attribute::DataType::HalfFloat.
+No arithmetic operations are provided, convert the value to
+@ref Magnum::Float "Float" for calculations. Conversion is done using
+@ref packHalf() and @ref unpackHalf(), see @ref Batch::packHalf() and
+@ref Batch::unpackHalf() for bulk conversion.
+
+Comparison is done on the bit representation, thus positive and negative zero
+compare as different and NaN compares equal to itself.
+@see @ref Magnum::Half
+*/
+class Half {
+    public:
+        /** @brief Default constructor, creates zero value */
+        constexpr /*implicit*/ Half() noexcept: _data{} {}
+
+        /** @brief Construct from bit representation */
+        constexpr explicit Half(UnsignedShort data) noexcept: _data{data} {}
+
+        /**
+         * @brief Construct from 32-bit float
+         *
+         * @see @ref packHalf()
+         */
+        explicit Half(Float value) noexcept: _data{packHalf(value)} {}
+
+        /**
+         * @brief Convert to 32-bit float
+         *
+         * @see @ref unpackHalf()
+         */
+        explicit operator Float() const { return unpackHalf(_data); }
+
+        /** @brief Bit representation */
+        constexpr UnsignedShort data() const { return _data; }
+
+        /** @brief Equality comparison */
+        constexpr bool operator==(Half other) const { return _data == other._data; }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(Half other) const { return _data != other._data; }
+
+        /** @brief Negated value */
+        constexpr Half operator-() const { return Half{UnsignedShort(_data ^ 0x8000)}; }
+
+    private:
+        UnsignedShort _data;
+};
+
+/** @debugoperator{Magnum::Math::Half} */
+inline Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, Half value) {
+    return debug << Float(value);
+}
+
+}}
+
+#endif
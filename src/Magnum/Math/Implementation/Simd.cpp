@@ -0,0 +1,61 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simd.h"
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* Compiled only once as part of the library, so unlike inline functions in
+   the header this can use instruction sets enabled for the library build */
+#ifdef MAGNUM_MATH_SSE2
+void simdMultiplyMatrix4Batch(const Float* const a, const Float* b, Float* out, const std::size_t count) {
+    #ifndef MAGNUM_MATH_AVX
+    for(std::size_t i = 0; i != count; ++i, b += 16, out += 16)
+        simdMultiplyMatrix4(a, b, out);
+    #else
+    /* Columns of the left matrix duplicated into both 128-bit lanes, two
+       columns of the right matrix processed at once. In-lane shuffle of the
+       right column pair then gives the needed per-column broadcasts. */
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    const __m256 aa0 = _mm256_insertf128_ps(_mm256_castps128_ps256(a0), a0, 1);
+    const __m256 aa1 = _mm256_insertf128_ps(_mm256_castps128_ps256(a1), a1, 1);
+    const __m256 aa2 = _mm256_insertf128_ps(_mm256_castps128_ps256(a2), a2, 1);
+    const __m256 aa3 = _mm256_insertf128_ps(_mm256_castps128_ps256(a3), a3, 1);
+    for(std::size_t i = 0; i != count*16; i += 8) {
+        const __m256 bb = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(aa0, _mm256_shuffle_ps(bb, bb, _MM_SHUFFLE(0, 0, 0, 0))),
+                          _mm256_mul_ps(aa1, _mm256_shuffle_ps(bb, bb, _MM_SHUFFLE(1, 1, 1, 1)))),
+            _mm256_add_ps(_mm256_mul_ps(aa2, _mm256_shuffle_ps(bb, bb, _MM_SHUFFLE(2, 2, 2, 2))),
+                          _mm256_mul_ps(aa3, _mm256_shuffle_ps(bb, bb, _MM_SHUFFLE(3, 3, 3, 3))))));
+    }
+    #endif
+}
+#endif
+
+}}}
@@ -0,0 +1,386 @@
+#ifndef Magnum_Math_Implementation_Simd_h
+#define Magnum_Math_Implementation_Simd_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+
+/* SIMD code paths are used only if explicitly enabled with MAGNUM_TARGET_SIMD.
+   Inline functions in headers can end up compiled in files with different
+   compiler flags and the linker then picks just one of the copies, so their
+   bodies must not depend on per-file flags. Because of that, the inline code
+   uses only SSE2 and only on x86-64, where it is always available.
+
+   SSSE3 and AVX are used only if the compiler targets given instruction set
+   (i.e. -mssse3 or -mavx is in effect). The MAGNUM_MATH_SSSE3 and
+   MAGNUM_MATH_AVX macros thus may be used only in source files compiled as
+   part of the libraries and never in inline code in headers. The same
+   applies to NEON, which is not part of every 32-bit ARM target. */
+
+#if defined(MAGNUM_TARGET_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define MAGNUM_MATH_SSE2
+#include <emmintrin.h>
+#ifdef __SSSE3__
+#define MAGNUM_MATH_SSSE3
+#include <tmmintrin.h>
+#endif
+#ifdef __AVX__
+#define MAGNUM_MATH_AVX
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(MAGNUM_TARGET_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define MAGNUM_MATH_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef MAGNUM_MATH_SSE2
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* All functions operate on raw column-major data and use unaligned loads and
+   stores, as Math types are not guaranteed to be aligned to 16 bytes */
+
+/* Dot product of two four-component vectors */
+inline Float simdDot4(const Float* const a, const Float* const b) {
+    const __m128 m = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+    /* (m0 + m1, m1 + m0, m2 + m3, m3 + m2) */
+    const __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+}
+
+/* Column of 4x4 matrix multiplied with four-component vector */
+inline __m128 simdLinearCombination4(const __m128 a0, const __m128 a1, const __m128 a2, const __m128 a3, const Float* const b) {
+    return _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(b[0])), _mm_mul_ps(a1, _mm_set1_ps(b[1]))),
+        _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(b[2])), _mm_mul_ps(a3, _mm_set1_ps(b[3]))));
+}
+
+/* 4x4 matrix multiplied with four-component vector */
+inline void simdMultiplyMatrix4Vector4(const Float* const a, const Float* const b, Float* const out) {
+    _mm_storeu_ps(out, simdLinearCombination4(_mm_loadu_ps(a), _mm_loadu_ps(a + 4), _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12), b));
+}
+
+/* 4x4 matrix multiplication */
+inline void simdMultiplyMatrix4(const Float* const a, const Float* const b, Float* const out) {
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    for(std::size_t col = 0; col != 4; ++col)
+        _mm_storeu_ps(out + col*4, simdLinearCombination4(a0, a1, a2, a3, b + col*4));
+}
+
+/* Multiplication of count 4x4 matrices with the same left operand, output
+   can be the same as the right operands. Implemented in Simd.cpp, uses AVX if
+   the library is built with it. */
+MAGNUM_EXPORT void simdMultiplyMatrix4Batch(const Float* a, const Float* b, Float* out, std::size_t count);
+
+/* Pair of 2x2 subdeterminants (c, c, s, s) for rows p and q, where c is from
+   the last two columns and s from the first two columns */
+template<int p, int q> inline __m128 simdSubdeterminants(const __m128 c0, const __m128 c1, const __m128 c2, const __m128 c3) {
+    return _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c2, c0, _MM_SHUFFLE(p, p, p, p)),
+                   _mm_shuffle_ps(c3, c1, _MM_SHUFFLE(q, q, q, q))),
+        _mm_mul_ps(_mm_shuffle_ps(c3, c1, _MM_SHUFFLE(p, p, p, p)),
+                   _mm_shuffle_ps(c2, c0, _MM_SHUFFLE(q, q, q, q))));
+}
+
+/* Swaps neighboring elements, (x, y, z, w) -> (y, x, w, z) */
+inline __m128 simdSwapPairs(const __m128 a) {
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* General 4x4 matrix inversion using cofactors computed from twelve 2x2
+   subdeterminants. Returns the determinant. */
+inline Float simdInvertMatrix4(const Float* const m, Float* const out) {
+    const __m128 c0 = _mm_loadu_ps(m);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = _mm_loadu_ps(m + 12);
+
+    /* Subdeterminants of first two and last two columns */
+    const __m128 d0 = simdSubdeterminants<0, 1>(c0, c1, c2, c3);
+    const __m128 d1 = simdSubdeterminants<0, 2>(c0, c1, c2, c3);
+    const __m128 d2 = simdSubdeterminants<0, 3>(c0, c1, c2, c3);
+    const __m128 d3 = simdSubdeterminants<1, 2>(c0, c1, c2, c3);
+    const __m128 d4 = simdSubdeterminants<1, 3>(c0, c1, c2, c3);
+    const __m128 d5 = simdSubdeterminants<2, 3>(c0, c1, c2, c3);
+
+    /* Determinant, sum of first and third element of the result */
+    const __m128 detPairs = _mm_add_ps(_mm_sub_ps(
+        _mm_mul_ps(d5, _mm_shuffle_ps(d0, d0, _MM_SHUFFLE(1, 0, 3, 2))),
+        _mm_mul_ps(d4, _mm_shuffle_ps(d1, d1, _MM_SHUFFLE(1, 0, 3, 2)))),
+        _mm_mul_ps(d3, _mm_shuffle_ps(d2, d2, _MM_SHUFFLE(1, 0, 3, 2))));
+    const Float determinant = _mm_cvtss_f32(_mm_add_ss(detPairs, _mm_movehl_ps(detPairs, detPairs)));
+
+    /* Rows of the matrix, with neighboring elements swapped */
+    __m128 r0 = c0, r1 = c1, r2 = c2, r3 = c3;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    r0 = simdSwapPairs(r0);
+    r1 = simdSwapPairs(r1);
+    r2 = simdSwapPairs(r2);
+    r3 = simdSwapPairs(r3);
+
+    /* Cofactors multiplied with inverse determinant and alternating sign */
+    const __m128 invDet = _mm_set1_ps(Float(1)/determinant);
+    const __m128 plusMinus = _mm_mul_ps(invDet, _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+    const __m128 minusPlus = _mm_mul_ps(invDet, _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f));
+    _mm_storeu_ps(out, _mm_mul_ps(plusMinus, _mm_add_ps(_mm_sub_ps(
+        _mm_mul_ps(r1, d5), _mm_mul_ps(r2, d4)), _mm_mul_ps(r3, d3))));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(minusPlus, _mm_add_ps(_mm_sub_ps(
+        _mm_mul_ps(r0, d5), _mm_mul_ps(r2, d2)), _mm_mul_ps(r3, d1))));
+    _mm_storeu_ps(out + 8, _mm_mul_ps(plusMinus, _mm_add_ps(_mm_sub_ps(
+        _mm_mul_ps(r0, d4), _mm_mul_ps(r1, d2)), _mm_mul_ps(r3, d0))));
+    _mm_storeu_ps(out + 12, _mm_mul_ps(minusPlus, _mm_add_ps(_mm_sub_ps(
+        _mm_mul_ps(r0, d3), _mm_mul_ps(r1, d1)), _mm_mul_ps(r2, d0))));
+
+    return determinant;
+}
+
+/* Inversion of rigid transformation matrix (transposed rotation part and
+   inversely rotated negative translation) */
+inline void simdInvertRigidMatrix4(const Float* const m, Float* const out) {
+    __m128 r0 = _mm_loadu_ps(m);
+    __m128 r1 = _mm_loadu_ps(m + 4);
+    __m128 r2 = _mm_loadu_ps(m + 8);
+    __m128 r3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(out, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f),
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, _mm_set1_ps(m[12])),
+                              _mm_mul_ps(r1, _mm_set1_ps(m[13]))),
+                              _mm_mul_ps(r2, _mm_set1_ps(m[14])))));
+}
+
+/* Quaternion multiplication, both quaternions and output in (x, y, z, w)
+   layout */
+inline void simdMultiplyQuaternion(const Float* const a, const Float* const b, Float* const out) {
+    const __m128 va = _mm_loadu_ps(a);
+    const __m128 vb = _mm_loadu_ps(b);
+
+    /* (wa xb, wa yb, wa zb, wa wb) */
+    const __m128 t0 = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 3, 3, 3)), vb);
+    /* (xa wb, ya wb, za wb, xa xb) */
+    const __m128 t1 = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(0, 2, 1, 0)),
+                                 _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(0, 3, 3, 3)));
+    /* (ya zb, za xb, xa yb, ya yb) */
+    const __m128 t2 = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(1, 0, 2, 1)),
+                                 _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1, 1, 0, 2)));
+    /* (za yb, xa zb, ya xb, za zb) */
+    const __m128 t3 = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 1, 0, 2)),
+                                 _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 0, 2, 1)));
+
+    /* Flip sign of the last component of t1 + t2 */
+    const __m128 signW = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, int(0x80000000u)));
+    _mm_storeu_ps(out, _mm_sub_ps(_mm_add_ps(t0, _mm_xor_ps(_mm_add_ps(t1, t2), signW)), t3));
+}
+
+/* Batched transformation of three-component vectors by 4x4 matrix, the
+   translation column is added only if translate is true. Input and output
+   can be the same. */
+inline void simdTransformVectors3(const Float* const m, const Float* in, Float* out, const std::size_t count, const bool translate) {
+    const __m128 c0 = _mm_loadu_ps(m);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = translate ? _mm_loadu_ps(m + 12) : _mm_setzero_ps();
+    for(std::size_t i = 0; i != count; ++i, in += 3, out += 3) {
+        const __m128 r = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(in[0])), _mm_mul_ps(c1, _mm_set1_ps(in[1]))),
+            _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(in[2])), c3));
+        /* Store only three components to avoid writing past the end */
+        _mm_storel_pi(reinterpret_cast<__m64*>(out), r);
+        _mm_store_ss(out + 2, _mm_movehl_ps(r, r));
+    }
+}
+
+/* Batched transformation of three-component vectors stored as separate
+   component arrays, processes four vectors at a time and returns count of
+   processed vectors, the rest is left to the caller */
+inline std::size_t simdTransformVectors3Soa(const Float* const m, Float* const x, Float* const y, Float* const z, const std::size_t count, const bool translate) {
+    __m128 c[4][3];
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            c[col][row] = col == 3 && !translate ? _mm_setzero_ps() : _mm_set1_ps(m[col*4 + row]);
+
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4) {
+        const __m128 vx = _mm_loadu_ps(x + i);
+        const __m128 vy = _mm_loadu_ps(y + i);
+        const __m128 vz = _mm_loadu_ps(z + i);
+        Float* const out[]{x + i, y + i, z + i};
+        for(std::size_t row = 0; row != 3; ++row)
+            _mm_storeu_ps(out[row], _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(c[0][row], vx), _mm_mul_ps(c[1][row], vy)),
+                _mm_add_ps(_mm_mul_ps(c[2][row], vz), c[3][row])));
+    }
+    return i;
+}
+
+/* Batched dot product of four-component vectors stored as array of
+   structures, returns count of processed vectors. Component-wise products of
+   four pairs are transposed so each register holds two components of two
+   pairs and the sums are then done vertically, yielding four dot products per
+   iteration. Transposing the products instead of both inputs needs less than
+   half the shuffles. */
+inline std::size_t simdDot4Batch(const Float* const a, const Float* const b, Float* const out, const std::size_t count) {
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4) {
+        const Float* const ai = a + i*4;
+        const Float* const bi = b + i*4;
+        const __m128 m0 = _mm_mul_ps(_mm_loadu_ps(ai), _mm_loadu_ps(bi));
+        const __m128 m1 = _mm_mul_ps(_mm_loadu_ps(ai + 4), _mm_loadu_ps(bi + 4));
+        const __m128 m2 = _mm_mul_ps(_mm_loadu_ps(ai + 8), _mm_loadu_ps(bi + 8));
+        const __m128 m3 = _mm_mul_ps(_mm_loadu_ps(ai + 12), _mm_loadu_ps(bi + 12));
+        /* (x0 + z0, x1 + z1, y0 + w0, y1 + w1) and the same for pairs 2, 3 */
+        const __m128 s01 = _mm_add_ps(_mm_unpacklo_ps(m0, m1), _mm_unpackhi_ps(m0, m1));
+        const __m128 s23 = _mm_add_ps(_mm_unpacklo_ps(m2, m3), _mm_unpackhi_ps(m2, m3));
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_movelh_ps(s01, s23), _mm_movehl_ps(s23, s01)));
+    }
+    return i;
+}
+
+/* Batched dot product of three-component vectors stored as separate component
+   arrays, returns count of processed vectors */
+inline std::size_t simdDot3Soa(const Float* const ax, const Float* const ay, const Float* const az, const Float* const bx, const Float* const by, const Float* const bz, Float* const out, const std::size_t count) {
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)),
+                       _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))),
+            _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i))));
+    return i;
+}
+
+/* Batched in-place normalization of three-component vectors stored as
+   separate component arrays, returns count of processed vectors */
+inline std::size_t simdNormalize3Soa(Float* const x, Float* const y, Float* const z, const std::size_t count) {
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4) {
+        const __m128 vx = _mm_loadu_ps(x + i);
+        const __m128 vy = _mm_loadu_ps(y + i);
+        const __m128 vz = _mm_loadu_ps(z + i);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+        _mm_storeu_ps(x + i, _mm_div_ps(vx, length));
+        _mm_storeu_ps(y + i, _mm_div_ps(vy, length));
+        _mm_storeu_ps(z + i, _mm_div_ps(vz, length));
+    }
+    return i;
+}
+
+/* Batched float to half-float conversion with the same rounding as
+   packHalf(), returns count of processed values */
+inline std::size_t simdPackHalf(const Float* const in, UnsignedShort* const out, const std::size_t count) {
+    const __m128i f16max = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+    const __m128i denormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i normalBias = _mm_set1_epi32(Int(0xfffu + ((15u - 127u) << 23)));
+    const __m128i infinity = _mm_set1_epi32(0x7c00);
+    const __m128i nanBit = _mm_set1_epi32(0x200);
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000u)));
+
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4) {
+        const __m128 value = _mm_loadu_ps(in + i);
+        const __m128 sign = _mm_and_ps(value, signMask);
+        const __m128 absolute = _mm_xor_ps(value, sign);
+        const __m128i absoluteBits = _mm_castps_si128(absolute);
+
+        /* Infinity or NaN for values out of range */
+        const __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+        const __m128i isRegular = _mm_cmpgt_epi32(f16max, absoluteBits);
+        const __m128i infinityOrNan = _mm_or_si128(infinity, _mm_and_si128(isNan, nanBit));
+
+        /* Denormals rounded by the FPU */
+        const __m128i isDenormal = _mm_cmpgt_epi32(minNormal, absoluteBits);
+        const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(denormalMagic))), denormalMagic);
+
+        /* Normal values rebiased and rounded to nearest even */
+        const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absoluteBits, 31 - 13), 31);
+        const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absoluteBits, normalBias), mantissaOdd), 13);
+
+        const __m128i finite = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+        __m128i result = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infinityOrNan));
+        result = _mm_or_si128(result, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+
+        /* Sign-extend so the signed saturation in packs doesn't clamp the
+           values, then store the lower four 16-bit values */
+        result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(result, result));
+    }
+    return i;
+}
+
+/* Batched half-float to float conversion, same as unpackHalf(), returns
+   count of processed values */
+inline std::size_t simdUnpackHalf(const UnsignedShort* const in, Float* const out, const std::size_t count) {
+    const __m128i exponentMantissaMask = _mm_set1_epi32(0x7fff);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i wasInfinityOrNan = _mm_set1_epi32(0x7bff);
+    const __m128i infinityOrNanExponent = _mm_set1_epi32(255 << 23);
+
+    std::size_t i = 0;
+    for(; count - i >= 4; i += 4) {
+        const __m128i value = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)), _mm_setzero_si128());
+        const __m128i exponentMantissa = _mm_and_si128(value, exponentMantissaMask);
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(value, exponentMantissa), 16);
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+        const __m128i infinityOrNan = _mm_and_si128(_mm_cmpgt_epi32(exponentMantissa, wasInfinityOrNan), infinityOrNanExponent);
+        _mm_storeu_ps(out + i, _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infinityOrNan))));
+    }
+    return i;
+}
+
+/* Four-component vector clamped, scaled and rounded half away from zero, as
+   in packInt2101010Rev() and packUnsignedInt2101010Rev() */
+inline __m128i simdRoundScaled(const Float* const in, const __m128 min, const __m128 scale) {
+    const __m128 scaled = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in), min), _mm_set1_ps(1.0f)), scale);
+    const __m128 half = _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(scaled, _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000u)))));
+    return _mm_cvttps_epi32(_mm_add_ps(scaled, half));
+}
+
+/* Batched packing of four-component vectors to 2.10.10.10 integers */
+inline void simdPack2101010Rev(const Float* const in, UnsignedInt* const out, const std::size_t count, const bool isSigned) {
+    const __m128 min = _mm_set1_ps(isSigned ? -1.0f : 0.0f);
+    const __m128 scale = isSigned ? _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f) : _mm_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f);
+    const __m128i mask = _mm_setr_epi32(0x3ff, 0x3ff, 0x3ff, 0x3);
+    for(std::size_t i = 0; i != count; ++i) {
+        UnsignedInt c[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c), _mm_and_si128(simdRoundScaled(in + i*4, min, scale), mask));
+        out[i] = c[0] | c[1] << 10 | c[2] << 20 | c[3] << 30;
+    }
+}
+
+}}}
+#endif
+
+#endif
@@ -313,6 +313,14 @@ template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted()
     return out;
 }
 
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Matrix<4, Float> Matrix<4, Float>::inverted() const {
+    Matrix<4, Float> out(Zero);
+    Implementation::simdInvertMatrix4(this->data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -573,6 +573,17 @@ template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     return from(inverseRotation, inverseRotation*-translation());
 }
 
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Matrix4<Float> Matrix4<Float>::invertedRigid() const {
+    CORRADE_ASSERT(isRigidTransformation(),
+        "Math::Matrix4::invertedRigid(): the matrix doesn't represent rigid transformation", {});
+
+    Matrix4<Float> out{Matrix4<Float>::Zero};
+    Implementation::simdInvertRigidMatrix4(data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
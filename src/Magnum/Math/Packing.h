@@ -0,0 +1,232 @@
+#ifndef Magnum_Math_Packing_h
+#define Magnum_Math_Packing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packInt2101010Rev(), @ref Magnum::Math::unpackInt2101010Rev(), @ref Magnum::Math::packUnsignedInt2101010Rev(), @ref Magnum::Math::unpackUnsignedInt2101010Rev(), @ref Magnum::Math::packOctahedral(), @ref Magnum::Math::unpackOctahedral()
+ */
+
+#include <cstring>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    inline UnsignedInt floatBits(const Float value) {
+        UnsignedInt bits;
+        std::memcpy(&bits, &value, 4);
+        return bits;
+    }
+
+    inline Float bitsFloat(const UnsignedInt bits) {
+        Float value;
+        std::memcpy(&value, &bits, 4);
+        return value;
+    }
+}
+
+/**
+@{ @name Packing functions
+
+Conversion of floating-point values to compact storage types usable for
+example as vertex attributes, see @ref Batch for variants operating on whole
+arrays.
+*/
+
+/**
+@brief Pack 32-bit float to half-float
+
+Uses round-to-nearest-even. Values larger than largest representable
+half-float are converted to infinity, values too small to be represented
+even as a denormal are rounded to zero, NaN is preserved.
+@see @ref unpackHalf(), @ref Half, @ref Batch::packHalf()
+*/
+inline UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits = Implementation::floatBits(value);
+    const UnsignedInt sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    UnsignedInt out;
+    /* Overflow, infinity or NaN */
+    if(bits >= (127u + 16u) << 23)
+        out = bits > 255u << 23 ? 0x7e00 : 0x7c00;
+
+    /* Result is denormal or zero, let the FPU do the rounding by adding a
+       magic value that shifts the mantissa to the right place */
+    else if(bits < (127u - 14u) << 23) {
+        const UnsignedInt magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        out = Implementation::floatBits(Implementation::bitsFloat(bits) + Implementation::bitsFloat(magic)) - magic;
+
+    /* Normal number, rebias the exponent and round mantissa to nearest
+       even */
+    } else {
+        const UnsignedInt mantissaOdd = (bits >> 13) & 1;
+        bits += ((15u - 127u) << 23) + 0xfff + mantissaOdd;
+        out = bits >> 13;
+    }
+
+    return UnsignedShort(out | sign >> 16);
+}
+
+/**
+@brief Unpack half-float to 32-bit float
+
+The conversion is exact.
+@see @ref packHalf(), @ref Half, @ref Batch::unpackHalf()
+*/
+inline Float unpackHalf(const UnsignedShort value) {
+    /* Exponent and mantissa shifted into place, multiplying by the magic
+       value rebiases the exponent and handles denormals as well */
+    const UnsignedInt exponentMantissa = value & 0x7fff;
+    UnsignedInt bits = Implementation::floatBits(Implementation::bitsFloat(exponentMantissa << 13)*Implementation::bitsFloat((254u - 15u) << 23));
+
+    /* Infinity and NaN */
+    if(exponentMantissa > 0x7bff) bits |= 255u << 23;
+
+    return Implementation::bitsFloat(bits | (value & 0x8000u) << 16);
+}
+
+/**
+@brief Pack four-component vector to signed 2.10.10.10 integer
+
+Expects values in range @f$ [-1, 1] @f$, values outside are clamped. First
+three components are stored in 10 bits each starting from the least
+significant bits, the fourth component is stored in the two most significant
+bits. The layout matches @ref Attribute::DataType::Int2101010Rev with
+@ref Attribute::DataOption::Normalized.
+@see @ref unpackInt2101010Rev(), @ref packUnsignedInt2101010Rev(),
+    @ref Batch::packInt2101010Rev()
+*/
+inline UnsignedInt packInt2101010Rev(const Vector4<Float>& value) {
+    const Vector4<Float> scaled = Math::clamp(value, -1.0f, 1.0f)*Vector4<Float>{511.0f, 511.0f, 511.0f, 1.0f};
+    return (UnsignedInt(Int(std::round(scaled[0]))) & 0x3ff) |
+           (UnsignedInt(Int(std::round(scaled[1]))) & 0x3ff) << 10 |
+           (UnsignedInt(Int(std::round(scaled[2]))) & 0x3ff) << 20 |
+           (UnsignedInt(Int(std::round(scaled[3]))) & 0x3) << 30;
+}
+
+/**
+@brief Unpack four-component vector from signed 2.10.10.10 integer
+
+Inverse to @ref packInt2101010Rev(). The most negative value of each
+component maps to @f$ -1 @f$, same as in OpenGL 4.2 and OpenGL ES 3.0.
+@see @ref Batch::unpackInt2101010Rev()
+*/
+inline Vector4<Float> unpackInt2101010Rev(const UnsignedInt value) {
+    /* Sign-extend the components by shifting them to the top */
+    const Vector4<Float> unpacked{Float(Int(value << 22) >> 22),
+                                  Float(Int(value << 12) >> 22),
+                                  Float(Int(value << 2) >> 22),
+                                  Float(Int(value) >> 30)};
+    return Math::max(unpacked/Vector4<Float>{511.0f, 511.0f, 511.0f, 1.0f}, Vector<4, Float>{-1.0f});
+}
+
+/**
+@brief Pack four-component vector to unsigned 2.10.10.10 integer
+
+Expects values in range @f$ [0, 1] @f$, values outside are clamped. The layout
+matches @ref Attribute::DataType::UnsignedInt2101010Rev with
+@ref Attribute::DataOption::Normalized.
+@see @ref unpackUnsignedInt2101010Rev(), @ref packInt2101010Rev(),
+    @ref Batch::packUnsignedInt2101010Rev()
+*/
+inline UnsignedInt packUnsignedInt2101010Rev(const Vector4<Float>& value) {
+    const Vector4<Float> scaled = Math::clamp(value, 0.0f, 1.0f)*Vector4<Float>{1023.0f, 1023.0f, 1023.0f, 3.0f};
+    return UnsignedInt(std::round(scaled[0])) |
+           UnsignedInt(std::round(scaled[1])) << 10 |
+           UnsignedInt(std::round(scaled[2])) << 20 |
+           UnsignedInt(std::round(scaled[3])) << 30;
+}
+
+/**
+@brief Unpack four-component vector from unsigned 2.10.10.10 integer
+
+Inverse to @ref packUnsignedInt2101010Rev().
+@see @ref Batch::unpackUnsignedInt2101010Rev()
+*/
+inline Vector4<Float> unpackUnsignedInt2101010Rev(const UnsignedInt value) {
+    return Vector4<Float>{Float(value & 0x3ff),
+                          Float((value >> 10) & 0x3ff),
+                          Float((value >> 20) & 0x3ff),
+                          Float(value >> 30)}/Vector4<Float>{1023.0f, 1023.0f, 1023.0f, 3.0f};
+}
+
+/**
+@brief Pack normalized vector using octahedral encoding
+
+Projects the unit vector onto an octahedron and unfolds it into a square,
+which is then stored in two normalized signed integers. Compared to storing
+three components, the encoding takes only two thirds of the space and the
+precision is distributed uniformly over the sphere. Use
+@ref unpackOctahedral() or equivalent code in the shader to decode it. Example
+usage:
+@code
+Math::Vector2<Short> packed = Math::packOctahedral<Short>(normal);
+@endcode
+@see @ref Vector::isNormalized(), @ref Batch::packOctahedral()
+*/
+template<class Integral> Vector2<Integral> packOctahedral(const Vector3<Float>& normalized) {
+    static_assert(std::is_integral<Integral>::value && std::is_signed<Integral>::value,
+        "Math::packOctahedral(): packing must be done to signed integral type");
+    Vector2<Float> projected = normalized.xy()/(std::abs(normalized.x()) + std::abs(normalized.y()) + std::abs(normalized.z()));
+
+    /* Fold the lower hemisphere over the diagonals */
+    if(normalized.z() < 0.0f) projected = Vector2<Float>{
+        (1.0f - std::abs(projected.y()))*(projected.x() >= 0.0f ? 1.0f : -1.0f),
+        (1.0f - std::abs(projected.x()))*(projected.y() >= 0.0f ? 1.0f : -1.0f)};
+
+    const Float max = std::numeric_limits<Integral>::max();
+    return {Integral(std::round(projected.x()*max)),
+            Integral(std::round(projected.y()*max))};
+}
+
+/**
+@brief Unpack normalized vector from octahedral encoding
+
+Inverse to @ref packOctahedral(). The result is normalized.
+@see @ref Batch::unpackOctahedral()
+*/
+template<class Integral> Vector3<Float> unpackOctahedral(const Vector2<Integral>& packed) {
+    const Vector2<Float> projected = normalize<Vector2<Float>>(packed);
+    Vector3<Float> out{projected, 1.0f - std::abs(projected.x()) - std::abs(projected.y())};
+
+    /* Unfold the lower hemisphere */
+    if(out.z() < 0.0f) {
+        const Float x = out.x();
+        out.x() = (1.0f - std::abs(out.y()))*(x >= 0.0f ? 1.0f : -1.0f);
+        out.y() = (1.0f - std::abs(x))*(out.y() >= 0.0f ? 1.0f : -1.0f);
+    }
+
+    return out.normalized();
+}
+
+/*@}*/
+
+}}
+
+#endif
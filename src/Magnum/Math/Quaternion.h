@@ -603,6 +603,15 @@ template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion
             _scalar*other._scalar - Math::dot(_vector, other._vector)};
 }
 
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    /* Vector part is immediately followed by the scalar in memory */
+    Float out[4];
+    Implementation::simdMultiplyQuaternion(_vector.data(), other._vector.data(), out);
+    return {{out[0], out[1], out[2]}, out[3]};
+}
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized", {});
     return conjugated();
@@ -640,6 +640,20 @@ template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...se
 }
 #endif
 
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<4, 4, Float>& other) const {
+    RectangularMatrix<4, 4, Float> out;
+    Implementation::simdMultiplyMatrix4(data(), other.data(), out.data());
+    return out;
+}
+
+template<> inline Vector<4, Float> RectangularMatrix<4, 4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out;
+    Implementation::simdMultiplyMatrix4Vector4(data(), other.data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
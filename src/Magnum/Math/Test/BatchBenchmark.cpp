@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+
+/* Compares per-item transformation with batched transformation of arrays of
+   structures and structures of arrays */
+struct BatchBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit BatchBenchmark();
+
+    void transformPointsPerItem();
+    void transformPoints();
+    void transformPointsSoa();
+    void transformPointsDualQuaternionPerItem();
+    void transformPointsDualQuaternion();
+    void normalizePerItem();
+    void normalize();
+    void normalizeSoa();
+    void dotVector4PerItem();
+    void dotVector4();
+
+    private:
+        std::vector<Vector3> _points, _out;
+        std::vector<Float> _x, _y, _z;
+        std::vector<Vector4> _a, _b;
+        Matrix4 _matrix;
+        DualQuaternion _dualQuaternion;
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 10000 };
+}
+
+BatchBenchmark::BatchBenchmark(): _out(BatchSize), _x(BatchSize), _y(BatchSize), _z(BatchSize) {
+    addTests({&BatchBenchmark::transformPointsPerItem,
+              &BatchBenchmark::transformPoints,
+              &BatchBenchmark::transformPointsSoa,
+              &BatchBenchmark::transformPointsDualQuaternionPerItem,
+              &BatchBenchmark::transformPointsDualQuaternion,
+              &BatchBenchmark::normalizePerItem,
+              &BatchBenchmark::normalize,
+              &BatchBenchmark::normalizeSoa,
+              &BatchBenchmark::dotVector4PerItem,
+              &BatchBenchmark::dotVector4});
+
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        _points.push_back({Float(i), 1.0f + Float(i%7), -0.5f*Float(i%13)});
+        _a.push_back({_points.back(), 1.0f});
+        _b.push_back({0.5f*Float(i%11), -Float(i%5), 2.0f, Float(i%3)});
+    }
+
+    _matrix = Matrix4::translation({1.0f, -2.0f, 0.5f})*Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    _dualQuaternion = DualQuaternion::translation({1.0f, -2.0f, 0.5f})*DualQuaternion::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+}
+
+void BatchBenchmark::transformPointsPerItem() {
+    MAGNUM_BENCHMARK("Matrix4::transformPoint()", BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            _out[i] = _matrix.transformPoint(_points[i]);
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::transformPoints() {
+    MAGNUM_BENCHMARK("Batch::transformPoints(Matrix4)", BatchSize) {
+        Batch::transformPoints(_matrix, {_points.data(), BatchSize}, {_out.data(), BatchSize});
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::transformPointsSoa() {
+    MAGNUM_BENCHMARK("Batch::transformPoints(Matrix4), SoA", BatchSize) {
+        /* Copying the input is included in the measured time */
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            _x[i] = _points[i].x();
+            _y[i] = _points[i].y();
+            _z[i] = _points[i].z();
+        }
+        Batch::transformPoints(_matrix, {_x.data(), BatchSize}, {_y.data(), BatchSize}, {_z.data(), BatchSize});
+        escape(_x.front());
+    }
+}
+
+void BatchBenchmark::transformPointsDualQuaternionPerItem() {
+    MAGNUM_BENCHMARK("DualQuaternion::transformPointNormalized()", BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            _out[i] = _dualQuaternion.transformPointNormalized(_points[i]);
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::transformPointsDualQuaternion() {
+    MAGNUM_BENCHMARK("Batch::transformPoints(DualQuaternion)", BatchSize) {
+        Batch::transformPoints(_dualQuaternion, {_points.data(), BatchSize}, {_out.data(), BatchSize});
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::normalizePerItem() {
+    MAGNUM_BENCHMARK("Vector3::normalized()", BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            _out[i] = _points[i].normalized();
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::normalize() {
+    MAGNUM_BENCHMARK("Batch::normalize()", BatchSize) {
+        Batch::normalize<Vector3>({_points.data(), BatchSize}, {_out.data(), BatchSize});
+        escape(_out.front());
+    }
+}
+
+void BatchBenchmark::normalizeSoa() {
+    MAGNUM_BENCHMARK("Batch::normalize(), SoA", BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            _x[i] = _points[i].x();
+            _y[i] = _points[i].y();
+            _z[i] = _points[i].z();
+        }
+        Batch::normalize<Float>({_x.data(), BatchSize}, {_y.data(), BatchSize}, {_z.data(), BatchSize});
+        escape(_x.front());
+    }
+}
+
+void BatchBenchmark::dotVector4PerItem() {
+    MAGNUM_BENCHMARK("Math::dot(Vector4)", BatchSize) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            _x[i] = Math::dot(_a[i], _b[i]);
+        escape(_x.front());
+    }
+}
+
+void BatchBenchmark::dotVector4() {
+    MAGNUM_BENCHMARK("Batch::dot(Vector4)", BatchSize) {
+        Batch::dot<Vector4>({_a.data(), BatchSize}, {_b.data(), BatchSize}, {_x.data(), BatchSize});
+        escape(_x.front());
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchBenchmark)
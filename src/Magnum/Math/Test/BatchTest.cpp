@@ -0,0 +1,388 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct BatchTest: Corrade::TestSuite::Tester {
+    explicit BatchTest();
+
+    void dot();
+    void dotVector4();
+    void dotSoa();
+    void cross();
+    void normalize();
+    void normalizeSoa();
+    void lerp();
+    void slerp();
+    void multiply();
+    void multiplyAliased();
+
+    void transformVectors2D();
+    void transformVectors3D();
+    void transformVectorsSoa();
+    void transformPoints2D();
+    void transformPoints3D();
+    void transformPointsSoa();
+    void transformInPlace();
+
+    void packHalf();
+    void unpackHalf();
+    void packInt2101010Rev();
+    void packUnsignedInt2101010Rev();
+    void packOctahedral();
+
+    void sizeMismatch();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector2<Short> Vector2s;
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Complex<Float> Complex;
+typedef Math::DualComplex<Float> DualComplex;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::dot,
+              &BatchTest::dotVector4,
+              &BatchTest::dotSoa,
+              &BatchTest::cross,
+              &BatchTest::normalize,
+              &BatchTest::normalizeSoa,
+              &BatchTest::lerp,
+              &BatchTest::slerp,
+              &BatchTest::multiply,
+              &BatchTest::multiplyAliased,
+
+              &BatchTest::transformVectors2D,
+              &BatchTest::transformVectors3D,
+              &BatchTest::transformVectorsSoa,
+              &BatchTest::transformPoints2D,
+              &BatchTest::transformPoints3D,
+              &BatchTest::transformPointsSoa,
+              &BatchTest::transformInPlace,
+
+              &BatchTest::packHalf,
+              &BatchTest::unpackHalf,
+              &BatchTest::packInt2101010Rev,
+              &BatchTest::packUnsignedInt2101010Rev,
+              &BatchTest::packOctahedral,
+
+              &BatchTest::sizeMismatch});
+}
+
+void BatchTest::dot() {
+    const Vector3 a[]{{1.0f, 0.5f, 0.75f}, {2.0f, -1.0f, 0.0f}};
+    const Vector3 b[]{{2.0f, 4.0f, 1.0f}, {3.0f, 1.0f, 7.0f}};
+    Float out[2];
+    Batch::dot<Vector3>(a, b, out);
+    CORRADE_COMPARE(out[0], 4.75f);
+    CORRADE_COMPARE(out[1], 5.0f);
+}
+
+void BatchTest::dotVector4() {
+    /* Float Vector4 has a SIMD-accelerated specialization, six items to test
+       both the four-item SIMD blocks and the remainder */
+    const Vector4 a[]{{1.0f, 0.5f, 0.75f, 1.5f}, {2.0f, -1.0f, 0.0f, 1.0f},
+                      {0.0f, 3.0f, -2.0f, 0.5f}, {-1.0f, -1.0f, 4.0f, 2.0f},
+                      {1.0f, 2.0f, 3.0f, 4.0f}, {0.25f, 0.0f, -0.5f, 8.0f}};
+    const Vector4 b[]{{2.0f, 4.0f, 1.0f, 7.0f}, {3.0f, 1.0f, 7.0f, -5.0f},
+                      {5.0f, 1.0f, 0.5f, -4.0f}, {2.0f, 3.0f, 1.0f, 0.5f},
+                      {-1.0f, 1.0f, -1.0f, 1.0f}, {4.0f, 9.0f, 2.0f, 0.25f}};
+    Float out[6];
+    Batch::dot<Vector4>(a, b, out);
+    CORRADE_COMPARE(out[0], 15.25f);
+    CORRADE_COMPARE(out[1], 0.0f);
+    CORRADE_COMPARE(out[2], 0.0f);
+    CORRADE_COMPARE(out[3], 0.0f);
+    CORRADE_COMPARE(out[4], 2.0f);
+    CORRADE_COMPARE(out[5], 2.0f);
+}
+
+void BatchTest::dotSoa() {
+    /* Seven items to test both the four-item SIMD blocks and the remainder */
+    const Float ax[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+    const Float ay[]{0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f};
+    const Float az[]{-1.0f, -2.0f, -3.0f, -4.0f, -5.0f, -6.0f, -7.0f};
+    const Float bx[]{2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f};
+    const Float by[]{4.0f, 2.0f, 0.0f, -2.0f, -4.0f, -6.0f, -8.0f};
+    const Float bz[]{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    Float out[7];
+    Batch::dot<Float>(ax, ay, az, bx, by, bz, out);
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::dot(Vector3(ax[i], ay[i], az[i]), Vector3(bx[i], by[i], bz[i])));
+}
+
+void BatchTest::cross() {
+    const Vector3 a[]{Vector3::xAxis(), Vector3::yAxis()};
+    const Vector3 b[]{Vector3::yAxis(), Vector3::xAxis()};
+    Vector3 out[2];
+    Batch::cross<Float>(a, b, out);
+    CORRADE_COMPARE(out[0], Vector3::zAxis());
+    CORRADE_COMPARE(out[1], -Vector3::zAxis());
+}
+
+void BatchTest::normalize() {
+    Vector3 a[]{{3.0f, 0.0f, 4.0f}, {0.0f, -2.0f, 0.0f}};
+    Batch::normalize<Vector3>(a, a);
+    CORRADE_COMPARE(a[0], Vector3(0.6f, 0.0f, 0.8f));
+    CORRADE_COMPARE(a[1], -Vector3::yAxis());
+}
+
+void BatchTest::normalizeSoa() {
+    Float x[]{3.0f, 0.0f, 1.0f, 2.0f, 0.0f};
+    Float y[]{0.0f, -2.0f, 1.0f, 0.0f, 0.0f};
+    Float z[]{4.0f, 0.0f, 1.0f, 0.0f, 5.0f};
+    Batch::normalize<Float>(x, y, z);
+    CORRADE_COMPARE(Vector3(x[0], y[0], z[0]), Vector3(0.6f, 0.0f, 0.8f));
+    CORRADE_COMPARE(Vector3(x[1], y[1], z[1]), -Vector3::yAxis());
+    CORRADE_COMPARE(Vector3(x[2], y[2], z[2]), Vector3(1.0f).normalized());
+    CORRADE_COMPARE(Vector3(x[3], y[3], z[3]), Vector3::xAxis());
+    CORRADE_COMPARE(Vector3(x[4], y[4], z[4]), Vector3::zAxis());
+}
+
+void BatchTest::lerp() {
+    const Vector3 a[]{{1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 0.0f}};
+    const Vector3 b[]{{3.0f, 4.0f, 5.0f}, {-4.0f, 2.0f, 8.0f}};
+    Vector3 out[2];
+    Batch::lerp<Vector3>(a, b, 0.25f, out);
+    CORRADE_COMPARE(out[0], Vector3(1.5f, 2.5f, 3.5f));
+    CORRADE_COMPARE(out[1], Vector3(-1.0f, 0.5f, 2.0f));
+}
+
+void BatchTest::slerp() {
+    const Quaternion a[]{Quaternion::rotation(Deg(15.0f), Vector3::xAxis())};
+    const Quaternion b[]{Quaternion::rotation(Deg(57.0f), Vector3::xAxis())};
+    Quaternion out[1];
+    Batch::slerp<Float>(a, b, 0.5f, out);
+    CORRADE_COMPARE(out[0], Quaternion::rotation(Deg(36.0f), Vector3::xAxis()));
+}
+
+void BatchTest::multiply() {
+    const Matrix4 a = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling({2.0f, 2.0f, 2.0f});
+    const Matrix4 b[]{Matrix4::rotationX(Deg(35.0f)), Matrix4::translation({-1.0f, 0.5f, 0.0f})};
+    Matrix4 out[2];
+    Batch::multiply(a, b, out);
+    CORRADE_COMPARE(out[0], a*b[0]);
+    CORRADE_COMPARE(out[1], a*b[1]);
+
+    const DualQuaternion c = DualQuaternion::translation({1.0f, 2.0f, 3.0f});
+    const DualQuaternion d[]{DualQuaternion::rotation(Deg(35.0f), Vector3::xAxis())};
+    DualQuaternion outDual[1];
+    Batch::multiply(c, d, outDual);
+    CORRADE_COMPARE(outDual[0], c*d[0]);
+}
+
+void BatchTest::multiplyAliased() {
+    Matrix4 a[]{Matrix4::translation({1.0f, 2.0f, 3.0f}), Matrix4::rotationZ(Deg(15.0f))};
+    const Matrix4 expected = a[0]*a[1];
+    Batch::multiply(a[0], a, a);
+    CORRADE_COMPARE(a[1], expected);
+}
+
+void BatchTest::transformVectors2D() {
+    const Vector2 a[]{{1.0f, 0.0f}, {2.0f, -3.0f}};
+    Vector2 out[2];
+
+    const Matrix3 matrix = Matrix3::translation({5.0f, 2.0f})*Matrix3::rotation(Deg(90.0f));
+    Batch::transformVectors(matrix, a, out);
+    CORRADE_COMPARE(out[0], Vector2(0.0f, 1.0f));
+    CORRADE_COMPARE(out[1], Vector2(3.0f, 2.0f));
+
+    Batch::transformVectors(Complex::rotation(Deg(90.0f)), a, out);
+    CORRADE_COMPARE(out[0], Vector2(0.0f, 1.0f));
+    CORRADE_COMPARE(out[1], Vector2(3.0f, 2.0f));
+}
+
+void BatchTest::transformVectors3D() {
+    const Vector3 a[]{{1.0f, 0.0f, 2.0f}, {2.0f, -3.0f, 0.5f}};
+    Vector3 out[2];
+
+    const Matrix4 matrix = Matrix4::translation({5.0f, 2.0f, 1.0f})*Matrix4::rotationZ(Deg(90.0f));
+    Batch::transformVectors(matrix, a, out);
+    CORRADE_COMPARE(out[0], Vector3(0.0f, 1.0f, 2.0f));
+    CORRADE_COMPARE(out[1], Vector3(3.0f, 2.0f, 0.5f));
+
+    const Quaternion quaternion = Quaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Batch::transformVectors(quaternion, a, out);
+    CORRADE_COMPARE(out[0], quaternion.transformVectorNormalized(a[0]));
+    CORRADE_COMPARE(out[1], quaternion.transformVectorNormalized(a[1]));
+}
+
+void BatchTest::transformVectorsSoa() {
+    Float x[]{1.0f, 2.0f, 0.0f, 0.0f, 1.0f};
+    Float y[]{0.0f, -3.0f, 1.0f, 0.0f, 1.0f};
+    Float z[]{2.0f, 0.5f, 0.0f, 1.0f, 1.0f};
+
+    const Matrix4 matrix = Matrix4::translation({5.0f, 2.0f, 1.0f})*Matrix4::rotationZ(Deg(90.0f));
+    Vector3 expected[5];
+    for(std::size_t i = 0; i != 5; ++i)
+        expected[i] = matrix.transformVector({x[i], y[i], z[i]});
+
+    Batch::transformVectors(matrix, Corrade::Containers::ArrayView<Float>{x}, Corrade::Containers::ArrayView<Float>{y}, Corrade::Containers::ArrayView<Float>{z});
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(Vector3(x[i], y[i], z[i]), expected[i]);
+}
+
+void BatchTest::transformPoints2D() {
+    const Vector2 a[]{{1.0f, 0.0f}, {2.0f, -3.0f}};
+    Vector2 out[2];
+
+    const Matrix3 matrix = Matrix3::translation({5.0f, 2.0f})*Matrix3::rotation(Deg(90.0f));
+    Batch::transformPoints(matrix, a, out);
+    CORRADE_COMPARE(out[0], Vector2(5.0f, 3.0f));
+    CORRADE_COMPARE(out[1], Vector2(8.0f, 4.0f));
+
+    Batch::transformPoints(DualComplex::translation({5.0f, 2.0f})*DualComplex::rotation(Deg(90.0f)), a, out);
+    CORRADE_COMPARE(out[0], Vector2(5.0f, 3.0f));
+    CORRADE_COMPARE(out[1], Vector2(8.0f, 4.0f));
+}
+
+void BatchTest::transformPoints3D() {
+    const Vector3 a[]{{1.0f, 0.0f, 2.0f}, {2.0f, -3.0f, 0.5f}};
+    Vector3 out[2];
+
+    const Matrix4 matrix = Matrix4::translation({5.0f, 2.0f, 1.0f})*Matrix4::rotationZ(Deg(90.0f));
+    Batch::transformPoints(matrix, a, out);
+    CORRADE_COMPARE(out[0], Vector3(5.0f, 3.0f, 3.0f));
+    CORRADE_COMPARE(out[1], Vector3(8.0f, 4.0f, 1.5f));
+
+    const DualQuaternion dualQuaternion = DualQuaternion::translation({5.0f, 2.0f, 1.0f})*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Batch::transformPoints(dualQuaternion, a, out);
+    CORRADE_COMPARE(out[0], Vector3(5.0f, 3.0f, 3.0f));
+    CORRADE_COMPARE(out[1], Vector3(8.0f, 4.0f, 1.5f));
+}
+
+void BatchTest::transformPointsSoa() {
+    Float x[]{1.0f, 2.0f, 0.0f, 0.0f, 1.0f};
+    Float y[]{0.0f, -3.0f, 1.0f, 0.0f, 1.0f};
+    Float z[]{2.0f, 0.5f, 0.0f, 1.0f, 1.0f};
+
+    const Matrix4 matrix = Matrix4::translation({5.0f, 2.0f, 1.0f})*Matrix4::rotationZ(Deg(90.0f));
+    Vector3 expected[5];
+    for(std::size_t i = 0; i != 5; ++i)
+        expected[i] = matrix.transformPoint({x[i], y[i], z[i]});
+
+    Batch::transformPoints(matrix, Corrade::Containers::ArrayView<Float>{x}, Corrade::Containers::ArrayView<Float>{y}, Corrade::Containers::ArrayView<Float>{z});
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(Vector3(x[i], y[i], z[i]), expected[i]);
+}
+
+void BatchTest::transformInPlace() {
+    Vector3 a[]{{1.0f, 0.0f, 2.0f}, {2.0f, -3.0f, 0.5f}};
+    Batch::transformPoints(Matrix4::translation({5.0f, 2.0f, 1.0f})*Matrix4::rotationZ(Deg(90.0f)), a, a);
+    CORRADE_COMPARE(a[0], Vector3(5.0f, 3.0f, 3.0f));
+    CORRADE_COMPARE(a[1], Vector3(8.0f, 4.0f, 1.5f));
+}
+
+void BatchTest::packHalf() {
+    /* Odd count to test also the non-vectorized remainder, values covering
+       normals, denormals, rounding and special values */
+    const Float in[]{0.0f, -0.0f, 1.0f, -2.0f, 65504.0f, 65520.0f,
+        5.9604644775e-08f, 6.097555161e-05f, 1.00048828125f, 1.00146484375f,
+        Constants<Float>::inf(), -Constants<Float>::nan(), 2.0e-08f};
+    Half out[13];
+    Batch::packHalf(in, out);
+    for(std::size_t i = 0; i != 13; ++i)
+        CORRADE_COMPARE(out[i].data(), Math::packHalf(in[i]));
+}
+
+void BatchTest::unpackHalf() {
+    /* Go over all values, NaNs have to stay NaNs */
+    Half in[65536];
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        in[i] = Half{UnsignedShort(i)};
+    Float out[65536];
+    Batch::unpackHalf(in, out);
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        const Float expected = Math::unpackHalf(UnsignedShort(i));
+        if(expected != expected) CORRADE_VERIFY(out[i] != out[i]);
+        else CORRADE_COMPARE(out[i], expected);
+    }
+}
+
+void BatchTest::packInt2101010Rev() {
+    const Vector4 in[]{{0.0f, 0.0f, 1.0f, -1.0f}, {0.25f, -0.7f, 0.9f, 1.0f},
+        {2.0f, -2.0f, 0.5f, 0.5f}};
+    UnsignedInt packed[3];
+    Batch::packInt2101010Rev(in, packed);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(packed[i], Math::packInt2101010Rev(in[i]));
+
+    Vector4 unpacked[3];
+    Batch::unpackInt2101010Rev(packed, unpacked);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackInt2101010Rev(packed[i]));
+}
+
+void BatchTest::packUnsignedInt2101010Rev() {
+    const Vector4 in[]{{0.0f, 1.0f, 0.0f, 1.0f}, {0.25f, 0.7f, 0.9f, 0.3333333f},
+        {-1.0f, 2.0f, 0.5f, 0.5f}};
+    UnsignedInt packed[3];
+    Batch::packUnsignedInt2101010Rev(in, packed);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(packed[i], Math::packUnsignedInt2101010Rev(in[i]));
+
+    Vector4 unpacked[3];
+    Batch::unpackUnsignedInt2101010Rev(packed, unpacked);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackUnsignedInt2101010Rev(packed[i]));
+}
+
+void BatchTest::packOctahedral() {
+    const Vector3 in[]{{0.0f, 0.0f, 1.0f}, Vector3{1.0f, -2.0f, -0.5f}.normalized()};
+    Vector2s packed[2];
+    Batch::packOctahedral<Short>(in, packed);
+    CORRADE_COMPARE(packed[0], Math::packOctahedral<Short>(in[0]));
+    CORRADE_COMPARE(packed[1], Math::packOctahedral<Short>(in[1]));
+
+    Vector3 unpacked[2];
+    Batch::unpackOctahedral<Short>(packed, unpacked);
+    CORRADE_COMPARE(unpacked[0], in[0]);
+    CORRADE_COMPARE(unpacked[1], in[1]);
+}
+
+void BatchTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const Vector3 a[2]{};
+    Vector3 out[3];
+    Batch::transformPoints(Matrix4{}, a, out);
+    CORRADE_COMPARE(o.str(), "Math::Batch::transformPoints(): expected arrays of the same size\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
@@ -0,0 +1,186 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix<4, Float> Matrix4x4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Deg<Float> Deg;
+
+/* The *Scalar() variants measure plain loops equivalent to the generic
+   implementation, so the gain of MAGNUM_TARGET_SIMD can be seen directly */
+struct Matrix4Benchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit Matrix4Benchmark();
+
+    void multiply();
+    void multiplyScalar();
+    void transformVector();
+    void transformVectorScalar();
+    void inverted();
+    void invertedScalar();
+    void invertedRigid();
+    void invertedRigidScalar();
+
+    private:
+        std::vector<Matrix4> _a, _b;
+        std::vector<Vector4> _v;
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    Matrix4 multiplyScalarImplementation(const Matrix4& a, const Matrix4& b) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 4; ++row)
+                for(std::size_t pos = 0; pos != 4; ++pos)
+                    out[col][row] += a[pos][row]*b[col][pos];
+        return out;
+    }
+
+    Vector4 transformVectorScalarImplementation(const Matrix4& a, const Vector4& b) {
+        Vector4 out;
+        for(std::size_t row = 0; row != 4; ++row)
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                out[row] += a[pos][row]*b[pos];
+        return out;
+    }
+
+    Matrix4 invertedScalarImplementation(const Matrix4& a) {
+        Matrix4 out{Matrix4::Zero};
+        const Float determinant = a.determinant();
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 4; ++row)
+                out[col][row] = (((row + col) & 1) ? -1 : 1)*a.ij(row, col).determinant()/determinant;
+        return out;
+    }
+
+    Matrix4 invertedRigidScalarImplementation(const Matrix4& a) {
+        const Math::Matrix<3, Float> inverseRotation = a.rotationScaling().transposed();
+        return Matrix4::from(inverseRotation, inverseRotation*-a.translation());
+    }
+}
+
+Matrix4Benchmark::Matrix4Benchmark() {
+    addTests({&Matrix4Benchmark::multiply,
+              &Matrix4Benchmark::multiplyScalar,
+              &Matrix4Benchmark::transformVector,
+              &Matrix4Benchmark::transformVectorScalar,
+              &Matrix4Benchmark::inverted,
+              &Matrix4Benchmark::invertedScalar,
+              &Matrix4Benchmark::invertedRigid,
+              &Matrix4Benchmark::invertedRigidScalar});
+
+    /* Rigid transformations, so they can be used for all benchmarks */
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        const Float f = Float(i);
+        _a.push_back(Matrix4::translation({f, -1.0f, 0.5f*f})*Matrix4::rotation(Deg(f), Vector3(1.0f, 2.0f, -3.0f).normalized()));
+        _b.push_back(Matrix4::rotationX(Deg(-f))*Matrix4::translation({0.25f, f, 3.0f}));
+        _v.push_back({f, 2.0f, -f, 1.0f});
+    }
+}
+
+void Matrix4Benchmark::multiply() {
+    MAGNUM_BENCHMARK("Matrix4*Matrix4", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += _a[i]*_b[i];
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::multiplyScalar() {
+    MAGNUM_BENCHMARK("Matrix4*Matrix4, scalar", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += multiplyScalarImplementation(_a[i], _b[i]);
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::transformVector() {
+    MAGNUM_BENCHMARK("Matrix4*Vector4", BatchSize) {
+        Vector4 out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += _a[i]*_v[i];
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::transformVectorScalar() {
+    MAGNUM_BENCHMARK("Matrix4*Vector4, scalar", BatchSize) {
+        Vector4 out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += transformVectorScalarImplementation(_a[i], _v[i]);
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::inverted() {
+    MAGNUM_BENCHMARK("Matrix4::inverted()", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += _a[i].inverted();
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::invertedScalar() {
+    MAGNUM_BENCHMARK("Matrix4::inverted(), scalar", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += invertedScalarImplementation(_a[i]);
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::invertedRigid() {
+    MAGNUM_BENCHMARK("Matrix4::invertedRigid()", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += _a[i].invertedRigid();
+        escape(out);
+    }
+}
+
+void Matrix4Benchmark::invertedRigidScalar() {
+    MAGNUM_BENCHMARK("Matrix4::invertedRigid(), scalar", BatchSize) {
+        Matrix4 out{Matrix4::Zero};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += invertedRigidScalarImplementation(_a[i]);
+        escape(out);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::Matrix4Benchmark)
@@ -96,6 +96,9 @@ struct Matrix4Test: Corrade::TestSuite::Tester {
     void invertedRigid();
     void transform();
 
+    void multiply();
+    void multiplyVector();
+
     void debug();
     void configuration();
 };
@@ -106,6 +109,7 @@ typedef Math::Matrix4<Float> Matrix4;
 typedef Math::Matrix4<Int> Matrix4i;
 typedef Math::Matrix<3, Float> Matrix3x3;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
 typedef Math::Constants<Float> Constants;
 
 Matrix4Test::Matrix4Test() {
@@ -144,6 +148,9 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::invertedRigid,
               &Matrix4Test::transform,
 
+              &Matrix4Test::multiply,
+              &Matrix4Test::multiplyVector,
+
               &Matrix4Test::debug,
               &Matrix4Test::configuration});
 }
@@ -511,6 +518,33 @@ void Matrix4Test::transform() {
     CORRADE_COMPARE(a.transformPoint(v), Vector3(3.0f, -4.0f, 9.0f));
 }
 
+void Matrix4Test::multiply() {
+    /* Float 4x4 multiplication has a SIMD-accelerated variant, verify it
+       gives the same results as the generic one */
+    Matrix4 a({3.0f,  5.0f, 8.0f, 4.0f},
+              {4.0f,  4.0f, 7.0f, 3.0f},
+              {7.0f, -1.0f, 8.0f, 0.0f},
+              {9.0f,  4.0f, 5.0f, 9.0f});
+    Matrix4 b({-1.0f,  2.0f, 0.0f,  3.0f},
+              { 4.0f,  0.5f, 1.0f, -2.0f},
+              { 0.0f,  0.0f, 2.0f,  1.0f},
+              { 1.0f, -3.0f, 0.0f,  2.0f});
+
+    CORRADE_COMPARE(a*b, Matrix4({32.0f, 15.0f, 21.0f, 29.0f},
+                                 { 3.0f, 13.0f, 33.5f, -0.5f},
+                                 {23.0f,  2.0f, 21.0f,  9.0f},
+                                 { 9.0f,  1.0f, -3.0f, 13.0f}));
+}
+
+void Matrix4Test::multiplyVector() {
+    Matrix4 a({3.0f,  5.0f, 8.0f, 4.0f},
+              {4.0f,  4.0f, 7.0f, 3.0f},
+              {7.0f, -1.0f, 8.0f, 0.0f},
+              {9.0f,  4.0f, 5.0f, 9.0f});
+
+    CORRADE_COMPARE(a*Vector4(1.0f, -2.0f, 3.0f, 0.5f), Vector4(20.5f, -4.0f, 20.5f, 2.5f));
+}
+
 void Matrix4Test::lookAt() {
     Matrix4 a = Matrix4::lookAt({0.0f, 0.0f, 0.0f},
                                 {0.0f, 1.0f, 0.0f},
@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Generic square matrix operations in both precisions, SIMD-accelerated
+   four-component float variants are in Matrix4Benchmark */
+struct MatrixBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit MatrixBenchmark();
+
+    template<std::size_t size, class T> void multiply();
+    template<std::size_t size, class T> void multiplyVector();
+    template<std::size_t size, class T> void transposed();
+    template<std::size_t size, class T> void determinant();
+    template<std::size_t size, class T> void inverted();
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    /* Diagonally dominant and thus well-conditioned matrices */
+    template<std::size_t size, class T> std::vector<Matrix<size, T>> matrices() {
+        std::vector<Matrix<size, T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            Matrix<size, T> a{Matrix<size, T>::Identity, T(size)};
+            for(std::size_t col = 0; col != size; ++col)
+                for(std::size_t row = 0; row != size; ++row)
+                    a[col][row] += std::sin(T(i + col*size + row));
+            out.push_back(a);
+        }
+        return out;
+    }
+
+    template<std::size_t size, class T> std::string name(const std::string& operation) {
+        return "Matrix<" + std::to_string(size) + ", " + Magnum::Test::AbstractBenchmarkTester::typeName<T>() + ">" + operation;
+    }
+}
+
+MatrixBenchmark::MatrixBenchmark() {
+    addTests<MatrixBenchmark>({&MatrixBenchmark::multiply<3, Float>,
+              &MatrixBenchmark::multiply<4, Float>,
+              &MatrixBenchmark::multiplyVector<3, Float>,
+              &MatrixBenchmark::multiplyVector<4, Float>,
+              &MatrixBenchmark::transposed<4, Float>,
+              &MatrixBenchmark::determinant<3, Float>,
+              &MatrixBenchmark::determinant<4, Float>,
+              &MatrixBenchmark::inverted<3, Float>,
+              &MatrixBenchmark::inverted<4, Float>,
+              &MatrixBenchmark::inverted<5, Float>,
+              #ifndef MAGNUM_TARGET_GLES
+              &MatrixBenchmark::multiply<3, Double>,
+              &MatrixBenchmark::multiply<4, Double>,
+              &MatrixBenchmark::multiplyVector<3, Double>,
+              &MatrixBenchmark::multiplyVector<4, Double>,
+              &MatrixBenchmark::transposed<4, Double>,
+              &MatrixBenchmark::determinant<3, Double>,
+              &MatrixBenchmark::determinant<4, Double>,
+              &MatrixBenchmark::inverted<3, Double>,
+              &MatrixBenchmark::inverted<4, Double>,
+              &MatrixBenchmark::inverted<5, Double>
+              #endif
+              });
+}
+
+template<std::size_t size, class T> void MatrixBenchmark::multiply() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("::operator*(Matrix)")), BatchSize) {
+        Matrix<size, T> out{Matrix<size, T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i]*a[BatchSize - i - 1];
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void MatrixBenchmark::multiplyVector() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("::operator*(Vector)")), BatchSize) {
+        Vector<size, T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i]*a[BatchSize - i - 1][0];
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void MatrixBenchmark::transposed() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("::transposed()")), BatchSize) {
+        Matrix<size, T> out{Matrix<size, T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].transposed();
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void MatrixBenchmark::determinant() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("::determinant()")), BatchSize) {
+        T out{};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].determinant();
+        escape(out);
+    }
+}
+
+template<std::size_t size, class T> void MatrixBenchmark::inverted() {
+    const std::vector<Matrix<size, T>> a = matrices<size, T>();
+
+    MAGNUM_BENCHMARK((name<size, T>("::inverted()")), BatchSize) {
+        Matrix<size, T> out{Matrix<size, T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].inverted();
+        escape(out);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBenchmark)
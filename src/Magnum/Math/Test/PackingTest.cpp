@@ -0,0 +1,226 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct PackingTest: Corrade::TestSuite::Tester {
+    explicit PackingTest();
+
+    void packHalf();
+    void packHalfRounding();
+    void packHalfDenormal();
+    void packHalfSpecial();
+    void unpackHalf();
+    void unpackHalfDenormal();
+    void unpackHalfSpecial();
+    void halfRoundTrip();
+
+    void packInt2101010Rev();
+    void unpackInt2101010Rev();
+    void packUnsignedInt2101010Rev();
+    void unpackUnsignedInt2101010Rev();
+
+    void packOctahedral();
+    void octahedralRoundTrip();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector2<Short> Vector2s;
+typedef Math::Vector2<Byte> Vector2b;
+
+PackingTest::PackingTest() {
+    addTests({&PackingTest::packHalf,
+              &PackingTest::packHalfRounding,
+              &PackingTest::packHalfDenormal,
+              &PackingTest::packHalfSpecial,
+              &PackingTest::unpackHalf,
+              &PackingTest::unpackHalfDenormal,
+              &PackingTest::unpackHalfSpecial,
+              &PackingTest::halfRoundTrip,
+
+              &PackingTest::packInt2101010Rev,
+              &PackingTest::unpackInt2101010Rev,
+              &PackingTest::packUnsignedInt2101010Rev,
+              &PackingTest::unpackUnsignedInt2101010Rev,
+
+              &PackingTest::packOctahedral,
+              &PackingTest::octahedralRoundTrip});
+}
+
+void PackingTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(Math::packHalf(0.333251953f), 0x3555);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+    CORRADE_COMPARE(Math::packHalf(6.103515625e-05f), 0x0400);
+}
+
+void PackingTest::packHalfRounding() {
+    /* Exactly in the middle between 1.0 and the next value, round to even */
+    CORRADE_COMPARE(Math::packHalf(1.00048828125f), 0x3c00);
+    /* Exactly in the middle between two values with odd lowest bit */
+    CORRADE_COMPARE(Math::packHalf(1.00146484375f), 0x3c02);
+    /* Slightly above the middle */
+    CORRADE_COMPARE(Math::packHalf(1.0005f), 0x3c01);
+    /* Largest value that doesn't overflow to infinity */
+    CORRADE_COMPARE(Math::packHalf(65519.0f), 0x7bff);
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+}
+
+void PackingTest::packHalfDenormal() {
+    /* Smallest denormal */
+    CORRADE_COMPARE(Math::packHalf(5.9604644775e-08f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(-5.9604644775e-08f), 0x8001);
+    /* Largest denormal */
+    CORRADE_COMPARE(Math::packHalf(6.097555161e-05f), 0x03ff);
+    /* Too small, rounded to zero */
+    CORRADE_COMPARE(Math::packHalf(2.0e-08f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(1.0e-30f), 0x0000);
+}
+
+void PackingTest::packHalfSpecial() {
+    CORRADE_COMPARE(Math::packHalf(Constants<Float>::inf()), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-Constants<Float>::inf()), 0xfc00);
+    CORRADE_COMPARE(Math::packHalf(1.0e10f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(Constants<Float>::nan()), 0x7e00);
+}
+
+void PackingTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3555), 0.333251953f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+
+    /* Negative zero */
+    CORRADE_VERIFY(std::signbit(Math::unpackHalf(0x8000)));
+}
+
+void PackingTest::unpackHalfDenormal() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0001), 5.9604644775e-08f);
+    CORRADE_COMPARE(Math::unpackHalf(0x83ff), -6.097555161e-05f);
+}
+
+void PackingTest::unpackHalfSpecial() {
+    CORRADE_COMPARE(Math::unpackHalf(0x7c00), Constants<Float>::inf());
+    CORRADE_COMPARE(Math::unpackHalf(0xfc00), -Constants<Float>::inf());
+    CORRADE_VERIFY(Math::unpackHalf(0x7e00) != Math::unpackHalf(0x7e00));
+}
+
+void PackingTest::halfRoundTrip() {
+    /* Every half-float except NaNs should survive the round trip bit-exact */
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        if((i & 0x7c00) == 0x7c00 && (i & 0x03ff)) continue;
+        const UnsignedShort packed = Math::packHalf(Math::unpackHalf(UnsignedShort(i)));
+        if(packed != i) {
+            CORRADE_COMPARE(packed, i);
+            break;
+        }
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void PackingTest::packInt2101010Rev() {
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, 0.0f, 0.0f, 0.0f}), 0x00000000u);
+    CORRADE_COMPARE(Math::packInt2101010Rev({1.0f, 0.0f, 0.0f, 0.0f}), 0x000001ffu);
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, -1.0f, 0.0f, 0.0f}), 0x00080400u);
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, 0.0f, 1.0f, -1.0f}), 0xdff00000u);
+
+    /* Values outside of the range are clamped */
+    CORRADE_COMPARE(Math::packInt2101010Rev({2.0f, -2.0f, 0.0f, 1.0f}), Math::packInt2101010Rev({1.0f, -1.0f, 0.0f, 1.0f}));
+}
+
+void PackingTest::unpackInt2101010Rev() {
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x000001ffu), (Vector4{1.0f, 0.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0xdff00000u), (Vector4{0.0f, 0.0f, 1.0f, -1.0f}));
+
+    /* Most negative value is clamped to -1 */
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x80000200u), (Vector4{-1.0f, 0.0f, 0.0f, -1.0f}));
+
+    /* Error is at most half of the quantization step */
+    const Vector4 a{0.25f, -0.7f, 0.9f, 1.0f};
+    CORRADE_VERIFY((Math::abs(Math::unpackInt2101010Rev(Math::packInt2101010Rev(a)) - a) <= Vector4{0.5f/511.0f}).all());
+}
+
+void PackingTest::packUnsignedInt2101010Rev() {
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({1.0f, 0.0f, 0.0f, 0.0f}), 0x000003ffu);
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({0.0f, 1.0f, 0.0f, 1.0f}), 0xc00ffc00u);
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({0.0f, 0.0f, 1.0f, 0.0f}), 0x3ff00000u);
+
+    /* Values outside of the range are clamped */
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({-1.0f, 2.0f, 0.0f, 0.0f}), 0x000ffc00u);
+}
+
+void PackingTest::unpackUnsignedInt2101010Rev() {
+    CORRADE_COMPARE(Math::unpackUnsignedInt2101010Rev(0xc00ffc00u), (Vector4{0.0f, 1.0f, 0.0f, 1.0f}));
+
+    /* Error is at most half of the quantization step */
+    const Vector4 a{0.25f, 0.7f, 0.9f, 0.3333333f};
+    CORRADE_VERIFY((Math::abs(Math::unpackUnsignedInt2101010Rev(Math::packUnsignedInt2101010Rev(a)) - a) <= Vector4{0.5f/1023.0f}).all());
+}
+
+void PackingTest::packOctahedral() {
+    CORRADE_COMPARE(Math::packOctahedral<Short>({0.0f, 0.0f, 1.0f}), (Vector2s{0, 0}));
+    CORRADE_COMPARE(Math::packOctahedral<Short>({1.0f, 0.0f, 0.0f}), (Vector2s{32767, 0}));
+    CORRADE_COMPARE(Math::packOctahedral<Short>({0.0f, -1.0f, 0.0f}), (Vector2s{0, -32767}));
+    CORRADE_COMPARE(Math::packOctahedral<Byte>({0.0f, 0.0f, -1.0f}), (Vector2b{127, 127}));
+
+    CORRADE_COMPARE(Math::unpackOctahedral(Vector2s{0, 0}), (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(Math::unpackOctahedral(Vector2b{127, 127}), (Vector3{0.0f, 0.0f, -1.0f}));
+}
+
+void PackingTest::octahedralRoundTrip() {
+    /* Go over the whole sphere, 16-bit encoding should have error well below
+       0.01 degree */
+    Float maxError = 0.0f;
+    for(Int i = 0; i != 37; ++i) {
+        for(Int j = 0; j != 72; ++j) {
+            const Float theta = Float(i)*Constants<Float>::pi()/36.0f;
+            const Float phi = Float(j)*Constants<Float>::pi()/36.0f;
+            const Vector3 normal{std::sin(theta)*std::cos(phi),
+                                 std::sin(theta)*std::sin(phi),
+                                 std::cos(theta)};
+            const Vector3 unpacked = Math::unpackOctahedral(Math::packOctahedral<Short>(normal));
+            CORRADE_VERIFY(unpacked.isNormalized());
+            maxError = std::max(maxError, (unpacked - normal).length());
+        }
+    }
+
+    CORRADE_VERIFY(maxError < 0.0001f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Deg<Float> Deg;
+
+struct QuaternionBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit QuaternionBenchmark();
+
+    void multiply();
+    void multiplyScalar();
+
+    template<class T> void multiplyGeneric();
+    template<class T> void lerp();
+    template<class T> void slerp();
+    template<class T> void transformVectorNormalized();
+    template<class T> void toMatrix();
+
+    private:
+        std::vector<Quaternion> _a, _b;
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    Quaternion multiplyScalarImplementation(const Quaternion& a, const Quaternion& b) {
+        return {a.scalar()*b.vector() + b.scalar()*a.vector() + Math::cross(a.vector(), b.vector()),
+                a.scalar()*b.scalar() - Math::dot(a.vector(), b.vector())};
+    }
+
+    template<class T> std::vector<Math::Quaternion<T>> quaternions(const Math::Vector3<T>& axis, T angleStep) {
+        std::vector<Math::Quaternion<T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out.push_back(Math::Quaternion<T>::rotation(Math::Deg<T>(angleStep*T(i)), axis.normalized()));
+        return out;
+    }
+
+    template<class T> std::string name(const std::string& operation) {
+        return operation + "<" + Magnum::Test::AbstractBenchmarkTester::typeName<T>() + ">";
+    }
+}
+
+QuaternionBenchmark::QuaternionBenchmark() {
+    addTests({&QuaternionBenchmark::multiply,
+              &QuaternionBenchmark::multiplyScalar,
+
+              &QuaternionBenchmark::lerp<Float>,
+              &QuaternionBenchmark::slerp<Float>,
+              &QuaternionBenchmark::transformVectorNormalized<Float>,
+              &QuaternionBenchmark::toMatrix<Float>,
+              #ifndef MAGNUM_TARGET_GLES
+              &QuaternionBenchmark::multiplyGeneric<Double>,
+              &QuaternionBenchmark::lerp<Double>,
+              &QuaternionBenchmark::slerp<Double>,
+              &QuaternionBenchmark::transformVectorNormalized<Double>,
+              &QuaternionBenchmark::toMatrix<Double>
+              #endif
+              });
+
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        const Float f = Float(i);
+        _a.push_back(Quaternion::rotation(Deg(f), Vector3(1.0f, 2.0f, -3.0f).normalized()));
+        _b.push_back(Quaternion::rotation(Deg(-f), Vector3::yAxis()));
+    }
+}
+
+void QuaternionBenchmark::multiply() {
+    MAGNUM_BENCHMARK("Quaternion*Quaternion", BatchSize) {
+        Quaternion out{{}, 0.0f};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += _a[i]*_b[i];
+        escape(out);
+    }
+}
+
+void QuaternionBenchmark::multiplyScalar() {
+    MAGNUM_BENCHMARK("Quaternion*Quaternion, scalar", BatchSize) {
+        Quaternion out{{}, 0.0f};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += multiplyScalarImplementation(_a[i], _b[i]);
+        escape(out);
+    }
+}
+
+template<class T> void QuaternionBenchmark::multiplyGeneric() {
+    const auto a = quaternions<T>({T(1), T(2), T(-3)}, T(1));
+    const auto b = quaternions<T>(Math::Vector3<T>::yAxis(), T(-1));
+
+    MAGNUM_BENCHMARK(name<T>("Quaternion*Quaternion"), BatchSize) {
+        Math::Quaternion<T> out{{}, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i]*b[i];
+        escape(out);
+    }
+}
+
+template<class T> void QuaternionBenchmark::lerp() {
+    const auto a = quaternions<T>({T(1), T(2), T(-3)}, T(1));
+    const auto b = quaternions<T>(Math::Vector3<T>::yAxis(), T(-1));
+
+    MAGNUM_BENCHMARK(name<T>("Math::lerp(Quaternion)"), BatchSize) {
+        Math::Quaternion<T> out{{}, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += Math::lerp(a[i], b[i], T(0.35));
+        escape(out);
+    }
+}
+
+template<class T> void QuaternionBenchmark::slerp() {
+    const auto a = quaternions<T>({T(1), T(2), T(-3)}, T(1));
+    const auto b = quaternions<T>(Math::Vector3<T>::yAxis(), T(-1));
+
+    MAGNUM_BENCHMARK(name<T>("Math::slerp(Quaternion)"), BatchSize) {
+        Math::Quaternion<T> out{{}, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += Math::slerp(a[i], b[i], T(0.35));
+        escape(out);
+    }
+}
+
+template<class T> void QuaternionBenchmark::transformVectorNormalized() {
+    const auto a = quaternions<T>({T(1), T(2), T(-3)}, T(1));
+
+    MAGNUM_BENCHMARK(name<T>("Quaternion::transformVectorNormalized()"), BatchSize) {
+        Math::Vector3<T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].transformVectorNormalized({T(i), T(1), T(-2)});
+        escape(out);
+    }
+}
+
+template<class T> void QuaternionBenchmark::toMatrix() {
+    const auto a = quaternions<T>({T(1), T(2), T(-3)}, T(1));
+
+    MAGNUM_BENCHMARK(name<T>("Quaternion::toMatrix()"), BatchSize) {
+        Math::Matrix3x3<T> out{Math::Matrix3x3<T>::Identity, T(0)};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].toMatrix();
+        escape(out);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::QuaternionBenchmark)
@@ -0,0 +1,120 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct Vector3Benchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit Vector3Benchmark();
+
+    template<class T> void dot();
+    template<class T> void cross();
+    template<class T> void length();
+    template<class T> void normalized();
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    template<class T> std::vector<Math::Vector3<T>> vectors(T offset) {
+        std::vector<Math::Vector3<T>> out;
+        out.reserve(BatchSize);
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out.push_back({T(i) + offset, T(1), -T(i)});
+        return out;
+    }
+
+    template<class T> std::string name(const std::string& operation) {
+        return operation + "(Vector3<" + Magnum::Test::AbstractBenchmarkTester::typeName<T>() + ">)";
+    }
+}
+
+Vector3Benchmark::Vector3Benchmark() {
+    addTests<Vector3Benchmark>({&Vector3Benchmark::dot<Float>,
+              &Vector3Benchmark::cross<Float>,
+              &Vector3Benchmark::length<Float>,
+              &Vector3Benchmark::normalized<Float>,
+              #ifndef MAGNUM_TARGET_GLES
+              &Vector3Benchmark::dot<Double>,
+              &Vector3Benchmark::cross<Double>,
+              &Vector3Benchmark::length<Double>,
+              &Vector3Benchmark::normalized<Double>
+              #endif
+              });
+}
+
+template<class T> void Vector3Benchmark::dot() {
+    const auto a = vectors<T>(T(0.5));
+    const auto b = vectors<T>(T(-2));
+
+    MAGNUM_BENCHMARK(name<T>("Math::dot"), BatchSize) {
+        T out{};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += Math::dot(a[i], b[i]);
+        escape(out);
+    }
+}
+
+template<class T> void Vector3Benchmark::cross() {
+    const auto a = vectors<T>(T(0.5));
+    const auto b = vectors<T>(T(-2));
+
+    MAGNUM_BENCHMARK(name<T>("Math::cross"), BatchSize) {
+        Math::Vector3<T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += Math::cross(a[i], b[i]);
+        escape(out);
+    }
+}
+
+template<class T> void Vector3Benchmark::length() {
+    const auto a = vectors<T>(T(0.5));
+
+    MAGNUM_BENCHMARK(name<T>("Vector::length"), BatchSize) {
+        T out{};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].length();
+        escape(out);
+    }
+}
+
+template<class T> void Vector3Benchmark::normalized() {
+    const auto a = vectors<T>(T(0.5));
+
+    MAGNUM_BENCHMARK(name<T>("Vector::normalized"), BatchSize) {
+        Math::Vector3<T> out;
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += a[i].normalized();
+        escape(out);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::Vector3Benchmark)
@@ -0,0 +1,87 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+typedef Math::Vector4<Float> Vector4;
+
+struct Vector4Benchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit Vector4Benchmark();
+
+    void dot();
+    void dotScalar();
+
+    private:
+        std::vector<Vector4> _a, _b;
+};
+
+namespace {
+    enum: std::size_t { BatchSize = 1000 };
+
+    Float dotScalarImplementation(const Vector4& a, const Vector4& b) {
+        Float out{};
+        for(std::size_t i = 0; i != 4; ++i)
+            out += a[i]*b[i];
+        return out;
+    }
+}
+
+Vector4Benchmark::Vector4Benchmark() {
+    addTests({&Vector4Benchmark::dot,
+              &Vector4Benchmark::dotScalar});
+
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        const Float f = Float(i);
+        _a.push_back({f, 1.0f, -f, 0.5f});
+        _b.push_back({2.0f, -f, 0.25f, f});
+    }
+}
+
+void Vector4Benchmark::dot() {
+    MAGNUM_BENCHMARK("dot(Vector4, Vector4)", BatchSize) {
+        Float out{};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += Math::dot(_a[i], _b[i]);
+        escape(out);
+    }
+}
+
+void Vector4Benchmark::dotScalar() {
+    MAGNUM_BENCHMARK("dot(Vector4, Vector4), scalar", BatchSize) {
+        Float out{};
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out += dotScalarImplementation(_a[i], _b[i]);
+        escape(out);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::Vector4Benchmark)
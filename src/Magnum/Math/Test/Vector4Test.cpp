@@ -68,6 +68,8 @@ struct Vector4Test: Corrade::TestSuite::Tester {
     void threeComponent();
     void twoComponent();
 
+    void dot();
+
     void swizzleType();
     void debug();
     void configuration();
@@ -93,6 +95,8 @@ Vector4Test::Vector4Test() {
               &Vector4Test::threeComponent,
               &Vector4Test::twoComponent,
 
+              &Vector4Test::dot,
+
               &Vector4Test::swizzleType,
               &Vector4Test::debug,
               &Vector4Test::configuration});
@@ -218,6 +222,11 @@ void Vector4Test::twoComponent() {
     CORRADE_COMPARE(d, 1.0f);
 }
 
+void Vector4Test::dot() {
+    /* Float variant has a SIMD-accelerated specialization */
+    CORRADE_COMPARE(Math::dot(Vector4(1.0f, 0.5f, 0.75f, 1.5f), Vector4(2.0f, 4.0f, 1.0f, 7.0f)), 15.25f);
+}
+
 void Vector4Test::swizzleType() {
     constexpr Vector4i orig;
     constexpr auto c = swizzle<'y', 'a', 'y', 'x'>(orig);
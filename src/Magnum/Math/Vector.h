@@ -39,6 +39,7 @@
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/BoolVector.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 namespace Magnum { namespace Math {
 
@@ -1325,6 +1326,12 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#if defined(MAGNUM_MATH_SSE2) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Float dot(const Vector<4, Float>& a, const Vector<4, Float>& b) {
+    return Implementation::simdDot4(a.data(), b.data());
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -401,6 +401,17 @@ void Mesh::destroyImplementationVAO() {
 }
 
 void Mesh::attributePointerInternal(const GenericAttribute& attribute) {
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Packed 2.10.10.10 types are accepted by GL only with four components,
+       three-component attributes just ignore the W part */
+    if(attribute.size == 3 && (attribute.type == GL_UNSIGNED_INT_2_10_10_10_REV || attribute.type == GL_INT_2_10_10_10_REV)) {
+        GenericAttribute packed{attribute};
+        packed.size = 4;
+        (this->*Context::current()->state().mesh->attributePointerImplementation)(packed);
+        return;
+    }
+    #endif
+
     (this->*Context::current()->state().mesh->attributePointerImplementation)(attribute);
 }
 
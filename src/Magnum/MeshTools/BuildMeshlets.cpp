@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BuildMeshlets.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/MeshTools/Implementation/Adjacency.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Marks vertex not present in current meshlet */
+constexpr UnsignedShort NoLocalIndex = 0xffff;
+
+/* Bounding sphere using Ritter's algorithm */
+void calculateBoundingSphere(Meshlet& meshlet, const UnsignedInt* const vertices, const std::vector<Vector3>& positions) {
+    /* Start with sphere around the vertex farthest from the first one and
+       vertex farthest from that one */
+    Vector3 a = positions[vertices[0]];
+    Vector3 b = a;
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+        if((positions[vertices[i]] - a).dot() > (b - a).dot()) b = positions[vertices[i]];
+    a = b;
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+        if((positions[vertices[i]] - b).dot() > (a - b).dot()) a = positions[vertices[i]];
+
+    Vector3 center = (a + b)*0.5f;
+    Float radius = (a - b).length()*0.5f;
+
+    /* Grow it to contain all remaining vertices */
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i) {
+        const Vector3 direction = positions[vertices[i]] - center;
+        const Float distance = direction.length();
+        if(distance <= radius) continue;
+
+        const Float newRadius = (radius + distance)*0.5f;
+        center += direction*((newRadius - radius)/distance);
+        radius = newRadius;
+    }
+
+    meshlet.center = center;
+    meshlet.radius = radius;
+}
+
+void calculateNormalCone(Meshlet& meshlet, const UnsignedInt* const vertices, const UnsignedByte* const triangles, const std::vector<Vector3>& positions) {
+    /* Average of normalized face normals, skipping degenerate faces */
+    Vector3 sum;
+    for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const Vector3 a = positions[vertices[triangles[i]]];
+        const Vector3 normal = Math::cross(positions[vertices[triangles[i + 1]]] - a, positions[vertices[triangles[i + 2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) sum += normal/length;
+    }
+
+    const Float sumLength = sum.length();
+    if(sumLength == 0.0f) {
+        meshlet.coneAxis = {};
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+
+    /* Find the normal farthest from the axis */
+    const Vector3 axis = sum/sumLength;
+    Float minDot = 1.0f;
+    for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const Vector3 a = positions[vertices[triangles[i]]];
+        const Vector3 normal = Math::cross(positions[vertices[triangles[i + 1]]] - a, positions[vertices[triangles[i + 2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) minDot = std::min(minDot, Math::dot(axis, normal/length));
+    }
+
+    meshlet.coneAxis = axis;
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot);
+}
+
+}
+
+std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::buildMeshlets(): index count is not divisible by 3!", (std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>>()));
+    CORRADE_ASSERT(maxVertices >= 3 && maxVertices <= 256 && maxTriangles >= 1 && maxTriangles <= 65535,
+        "MeshTools::buildMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got" << maxVertices << "and" << maxTriangles, (std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>>()));
+
+    const std::size_t faceCount = indices.size()/3;
+    std::vector<UnsignedInt> offsets, corners;
+    Implementation::buildVertexCorners(indices, positions.size(), offsets, corners);
+
+    /* Count of faces not yet put into any meshlet for each vertex */
+    std::vector<UnsignedInt> liveFaceCount(positions.size());
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        liveFaceCount[i] = offsets[i + 1] - offsets[i];
+
+    std::vector<bool> used(faceCount);
+    std::vector<UnsignedShort> localIndex(positions.size(), NoLocalIndex);
+    std::vector<UnsignedInt> candidates;
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> meshletVertices;
+    std::vector<UnsignedByte> meshletIndices;
+    meshletIndices.reserve(indices.size());
+
+    Meshlet meshlet{};
+    auto finishMeshlet = [&]() {
+        const UnsignedInt* const vertices = meshletVertices.data() + meshlet.vertexOffset;
+        calculateBoundingSphere(meshlet, vertices, positions);
+        calculateNormalCone(meshlet, vertices, meshletIndices.data() + meshlet.indexOffset, positions);
+        meshlets.push_back(meshlet);
+
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            localIndex[vertices[i]] = NoLocalIndex;
+        candidates.clear();
+
+        meshlet = Meshlet{};
+        meshlet.vertexOffset = meshletVertices.size();
+        meshlet.indexOffset = meshletIndices.size();
+    };
+
+    Vector3 centroid;
+    std::size_t nextUnused = 0;
+    for(std::size_t remaining = faceCount; remaining; --remaining) {
+        /* Pick the candidate adding the least new vertices, then the one
+           closest to centroid of the meshlet to keep it compact, then the one
+           having the least live faces around its vertices, then the one first
+           in the index array. Remove used faces from the candidate list along
+           the way. Distance is compared on triple of the face centroid to
+           avoid a division. */
+        UnsignedInt best = ~UnsignedInt{};
+        UnsignedInt bestNewVertexCount = 4;
+        UnsignedInt bestLiveFaceCount = ~UnsignedInt{};
+        Float bestDistance = Constants::inf();
+        std::size_t candidateCount = 0;
+        for(const UnsignedInt face: candidates) {
+            if(used[face]) continue;
+            candidates[candidateCount++] = face;
+
+            const UnsignedInt* const faceIndices = indices.data() + face*3;
+            UnsignedInt newVertexCount = 0, faceLiveFaceCount = 0;
+            for(std::size_t i = 0; i != 3; ++i) {
+                if(localIndex[faceIndices[i]] == NoLocalIndex) ++newVertexCount;
+                faceLiveFaceCount += liveFaceCount[faceIndices[i]];
+            }
+
+            const Float distance = (positions[faceIndices[0]] + positions[faceIndices[1]] + positions[faceIndices[2]] - centroid*3.0f).dot();
+            if(newVertexCount < bestNewVertexCount || (newVertexCount == bestNewVertexCount && (distance < bestDistance || (distance == bestDistance && (faceLiveFaceCount < bestLiveFaceCount || (faceLiveFaceCount == bestLiveFaceCount && face < best)))))) {
+                best = face;
+                bestDistance = distance;
+                bestNewVertexCount = newVertexCount;
+                bestLiveFaceCount = faceLiveFaceCount;
+            }
+        }
+        candidates.resize(candidateCount);
+
+        /* No adjacent face, continue with first unused one */
+        if(best == ~UnsignedInt{}) {
+            while(used[nextUnused]) ++nextUnused;
+            best = nextUnused;
+            bestNewVertexCount = 0;
+            for(std::size_t i = 0; i != 3; ++i)
+                if(localIndex[indices[best*3 + i]] == NoLocalIndex) ++bestNewVertexCount;
+        }
+
+        /* The face doesn't fit, start a new meshlet with it. The meshlet is
+           empty now, so the face surely fits. */
+        if(meshlet.vertexCount + bestNewVertexCount > maxVertices || meshlet.triangleCount == maxTriangles)
+            finishMeshlet();
+
+        /* Add the face, put faces around its new vertices to candidates */
+        used[best] = true;
+        ++meshlet.triangleCount;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt vertex = indices[best*3 + i];
+            if(localIndex[vertex] == NoLocalIndex) {
+                centroid = (centroid*meshlet.vertexCount + positions[vertex])/(meshlet.vertexCount + 1);
+                localIndex[vertex] = meshlet.vertexCount++;
+                meshletVertices.push_back(vertex);
+                for(std::size_t j = offsets[vertex]; j != offsets[vertex + 1]; ++j)
+                    if(!used[corners[j]/3]) candidates.push_back(corners[j]/3);
+            }
+
+            meshletIndices.push_back(localIndex[vertex]);
+            --liveFaceCount[vertex];
+        }
+    }
+
+    if(meshlet.triangleCount) finishMeshlet();
+
+    return std::make_tuple(std::move(meshlets), std::move(meshletVertices), std::move(meshletIndices));
+}
+
+}}
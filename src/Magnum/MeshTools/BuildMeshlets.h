@@ -0,0 +1,141 @@
+#ifndef Magnum_MeshTools_BuildMeshlets_h
+#define Magnum_MeshTools_BuildMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, function @ref Magnum::MeshTools::buildMeshlets()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Cluster of triangles produced by @ref buildMeshlets(). Vertices and triangles
+of all meshlets are stored in two flat arrays, each meshlet references a
+contiguous range in both of them.
+*/
+struct Meshlet {
+    /** @brief Offset of first vertex in meshlet vertex array */
+    UnsignedInt vertexOffset;
+
+    /** @brief Offset of first local index in meshlet index array */
+    UnsignedInt indexOffset;
+
+    /** @brief Vertex count */
+    UnsignedShort vertexCount;
+
+    /** @brief Triangle count */
+    UnsignedShort triangleCount;
+
+    /** @brief Center of bounding sphere */
+    Vector3 center;
+
+    /** @brief Radius of bounding sphere */
+    Float radius;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average of normals of all triangles in the meshlet, zero if
+     * all triangles are degenerate.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of angle between @ref coneAxis and the farthest triangle normal.
+     * Set to `1.0f` if the normals span a half-space or more, in which case
+     * the meshlet can't be backface culled.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Build meshlets
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param maxVertices  Max vertex count in one meshlet, at least `3` and at most
+    `256`
+@param maxTriangles Max triangle count in one meshlet, at least `1` and at
+    most `65535`
+@return Meshlets, meshlet vertex array and meshlet index array
+
+Partitions the mesh into clusters of triangles suitable for culling and
+streaming at cluster granularity. The meshlet vertex array contains indices
+into original vertex arrays, the meshlet index array contains three 8-bit
+indices into meshlet vertex range for each triangle, with the same winding as
+in @p indices. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<MeshTools::Meshlet> meshlets;
+std::vector<UnsignedInt> meshletVertices;
+std::vector<UnsignedByte> meshletIndices;
+std::tie(meshlets, meshletVertices, meshletIndices) = MeshTools::buildMeshlets(indices, positions);
+
+for(const MeshTools::Meshlet& meshlet: meshlets) {
+    const UnsignedInt* vertices = meshletVertices.data() + meshlet.vertexOffset;
+    const UnsignedByte* triangles = meshletIndices.data() + meshlet.indexOffset;
+    // ...
+}
+@endcode
+
+Meshlets are built greedily using vertex-to-face adjacency. Each meshlet grows
+by the face adjacent to it which adds the least new vertices, preferring
+faces closest to centroid of the meshlet, and is closed once no adjacent face
+fits into the limits. The closing face then starts a new
+meshlet. If a meshlet has no adjacent faces left, the first not yet used face
+in @p indices continues it. The result is deterministic and the meshlets
+cover each face exactly once.
+
+Each meshlet has also bounding sphere and normal cone calculated (assuming
+counterclockwise winding). All triangles of a meshlet are facing away from
+camera at position @f$ \boldsymbol{c} @f$ if the following is true, with
+@f$ \boldsymbol{s} @f$ being @ref Meshlet::center, @f$ r @f$
+@ref Meshlet::radius, @f$ \boldsymbol{a} @f$ @ref Meshlet::coneAxis and
+@f$ k @f$ @ref Meshlet::coneCutoff: @f[
+    (\boldsymbol{s} - \boldsymbol{c}) \cdot \boldsymbol{a} > k |\boldsymbol{s} - \boldsymbol{c}| + r
+@f]
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref tipsify()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 126);
+
+}}
+
+#endif
@@ -0,0 +1,586 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+using Implementation::BvhNode;
+using Implementation::BvhTriangle;
+
+static_assert(sizeof(BvhNode) == 32, "improper size of BVH node");
+
+namespace {
+
+/* Centroid bin count for surface area heuristic */
+constexpr std::size_t BinCount = 16;
+
+/* Nodes with at most this many triangles are always leafs, nodes with more
+   than this many triangles are always split */
+constexpr UnsignedInt MinLeafSize = 2;
+constexpr UnsignedInt MaxLeafSize = 8;
+
+/* Cost of traversing a node relative to cost of ray/triangle test */
+constexpr Float TraversalCost = 1.0f;
+
+/* Subtrees with at most this many triangles are built as separate tasks */
+constexpr UnsignedInt TaskSize = 4096;
+
+/* Max depth of the tree, below that the nodes are split into halves instead
+   of using surface area heuristic to limit traversal stack size. Depth of
+   the tree is thus at most this plus binary logarithm of triangle count. */
+constexpr UnsignedInt MaxSahDepth = 64;
+constexpr std::size_t StackSize = MaxSahDepth + 32;
+
+/* Don't bother spawning threads for less items than this */
+constexpr std::size_t MinParallelRangeSize = 16384;
+constexpr std::size_t MinParallelPacketCount = 256;
+
+/* Math::min() / Math::max() are generic loops which don't always get
+   inlined in the hot loops */
+inline Vector3 componentMin(const Vector3& a, const Vector3& b) {
+    return {std::min(a.x(), b.x()), std::min(a.y(), b.y()), std::min(a.z(), b.z())};
+}
+
+inline Vector3 componentMax(const Vector3& a, const Vector3& b) {
+    return {std::max(a.x(), b.x()), std::max(a.y(), b.y()), std::max(a.z(), b.z())};
+}
+
+inline Float halfArea(const Vector3& min, const Vector3& max) {
+    const Vector3 size = max - min;
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Inverse direction with zero components replaced with a tiny value, so the
+   slab test doesn't produce NaNs for rays lying in a slab plane */
+inline Vector3 inverseDirection(const Vector3& direction) {
+    Vector3 out;
+    for(std::size_t i = 0; i != 3; ++i)
+        out[i] = 1.0f/(std::abs(direction[i]) < 1.0e-30f ? (direction[i] < 0.0f ? -1.0e-30f : 1.0e-30f) : direction[i]);
+    return out;
+}
+
+struct Task {
+    UnsignedInt node, begin, end, depth;
+};
+
+/* Triangle bounds, stored contiguously and reordered during the build so
+   the passes over them don't jump around in memory */
+struct Primitive {
+    Vector3 min, max, centroid;
+    UnsignedInt id;
+};
+
+class Builder {
+    public:
+        explicit Builder(std::vector<Primitive>& primitives): _primitives(primitives) {}
+
+        /* Builds node at given index and its children from primitives in
+           given range. If tasks is not null, subtrees small enough are not
+           built but put into the task list instead. */
+        void build(std::vector<BvhNode>& nodes, UnsignedInt node, UnsignedInt begin, UnsignedInt end, UnsignedInt depth, std::vector<Task>* tasks) const;
+
+    private:
+        /* Returns index at which the range is split */
+        UnsignedInt split(UnsignedInt begin, UnsignedInt end, const Vector3& min, const Vector3& max, const Vector3& centroidMin, const Vector3& centroidMax, UnsignedInt depth) const;
+
+        std::vector<Primitive>& _primitives;
+};
+
+void Builder::build(std::vector<BvhNode>& nodes, const UnsignedInt node, const UnsignedInt begin, const UnsignedInt end, const UnsignedInt depth, std::vector<Task>* const tasks) const {
+    if(tasks && end - begin <= TaskSize) {
+        tasks->push_back({node, begin, end, depth});
+        return;
+    }
+
+    /* Bounds of triangles and their centroids */
+    Vector3 min{Constants::inf()}, max{-Constants::inf()};
+    Vector3 centroidMin{Constants::inf()}, centroidMax{-Constants::inf()};
+    for(UnsignedInt i = begin; i != end; ++i) {
+        const Primitive& primitive = _primitives[i];
+        min = componentMin(min, primitive.min);
+        max = componentMax(max, primitive.max);
+        centroidMin = componentMin(centroidMin, primitive.centroid);
+        centroidMax = componentMax(centroidMax, primitive.centroid);
+    }
+
+    nodes[node].min = min;
+    nodes[node].max = max;
+
+    const UnsignedInt mid = split(begin, end, min, max, centroidMin, centroidMax, depth);
+    if(mid == begin) {
+        nodes[node].offset = begin;
+        nodes[node].count = end - begin;
+        return;
+    }
+
+    /* Children are next to each other. Don't keep references to the nodes,
+       as the array gets reallocated. */
+    const UnsignedInt children = nodes.size();
+    nodes.resize(children + 2);
+    nodes[node].offset = children;
+    nodes[node].count = 0;
+    build(nodes, children, begin, mid, depth + 1, tasks);
+    build(nodes, children + 1, mid, end, depth + 1, tasks);
+}
+
+UnsignedInt Builder::split(const UnsignedInt begin, const UnsignedInt end, const Vector3& min, const Vector3& max, const Vector3& centroidMin, const Vector3& centroidMax, const UnsignedInt depth) const {
+    const UnsignedInt count = end - begin;
+    if(count <= MinLeafSize) return begin;
+
+    /* All centroids are at the same place or the tree is too deep already,
+       split in half along the largest axis */
+    const Vector3 centroidSize = centroidMax - centroidMin;
+    const std::size_t largestAxis = centroidSize.x() >= centroidSize.y() && centroidSize.x() >= centroidSize.z() ? 0 : centroidSize.y() >= centroidSize.z() ? 1 : 2;
+    if(centroidSize[largestAxis] == 0.0f || depth >= MaxSahDepth) {
+        if(count <= MaxLeafSize) return begin;
+        const UnsignedInt mid = begin + count/2;
+        std::nth_element(_primitives.begin() + begin, _primitives.begin() + mid, _primitives.begin() + end, [&](const Primitive& a, const Primitive& b) {
+            return a.centroid[largestAxis] < b.centroid[largestAxis] || (a.centroid[largestAxis] == b.centroid[largestAxis] && a.id < b.id);
+        });
+        return mid;
+    }
+
+    /* Bin the centroids on all axes at once, use less bins for small nodes
+       as the fixed cost of sweeping the bins would dominate */
+    const std::size_t binCount = std::min(BinCount, std::size_t(count));
+    struct Bin {
+        Vector3 min{Constants::inf()}, max{-Constants::inf()};
+        UnsignedInt count{};
+    } bins[3][BinCount];
+    Vector3 scale;
+    for(std::size_t axis = 0; axis != 3; ++axis)
+        scale[axis] = centroidSize[axis] == 0.0f ? 0.0f : binCount*(1.0f - 1.0e-6f)/centroidSize[axis];
+    for(UnsignedInt i = begin; i != end; ++i) {
+        const Primitive& primitive = _primitives[i];
+        const Vector3 position = (primitive.centroid - centroidMin)*scale;
+        for(std::size_t axis = 0; axis != 3; ++axis) {
+            Bin& bin = bins[axis][std::min(binCount - 1, std::size_t(position[axis]))];
+            bin.min = componentMin(bin.min, primitive.min);
+            bin.max = componentMax(bin.max, primitive.max);
+            ++bin.count;
+        }
+    }
+
+    /* Find the cheapest split between bins on all axes */
+    Float bestCost = Constants::inf();
+    std::size_t bestAxis = 0, bestBin = 0;
+    for(std::size_t axis = 0; axis != 3; ++axis) {
+        if(centroidSize[axis] == 0.0f) continue;
+
+        /* Cost of everything right of given bin boundary */
+        Float rightCost[BinCount];
+        Vector3 rightMin{Constants::inf()}, rightMax{-Constants::inf()};
+        UnsignedInt rightCount = 0;
+        for(std::size_t i = binCount - 1; i != 0; --i) {
+            rightMin = componentMin(rightMin, bins[axis][i].min);
+            rightMax = componentMax(rightMax, bins[axis][i].max);
+            rightCount += bins[axis][i].count;
+            rightCost[i] = rightCount ? halfArea(rightMin, rightMax)*rightCount : 0.0f;
+        }
+
+        /* Sweep from the left, skipping splits with empty side */
+        Vector3 leftMin{Constants::inf()}, leftMax{-Constants::inf()};
+        UnsignedInt leftCount = 0;
+        for(std::size_t i = 0; i != binCount - 1; ++i) {
+            leftMin = componentMin(leftMin, bins[axis][i].min);
+            leftMax = componentMax(leftMax, bins[axis][i].max);
+            leftCount += bins[axis][i].count;
+            if(!leftCount || leftCount == count) continue;
+
+            const Float cost = halfArea(leftMin, leftMax)*leftCount + rightCost[i + 1];
+            if(cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = i;
+            }
+        }
+    }
+
+    /* Make a leaf if the split isn't worth it */
+    if(count <= MaxLeafSize && TraversalCost*halfArea(min, max) + bestCost >= halfArea(min, max)*count)
+        return begin;
+
+    return std::partition(_primitives.begin() + begin, _primitives.begin() + end, [&](const Primitive& primitive) {
+        return std::min(binCount - 1, std::size_t((primitive.centroid[bestAxis] - centroidMin[bestAxis])*scale[bestAxis])) <= bestBin;
+    }) - _primitives.begin();
+}
+
+#ifdef MAGNUM_MATH_SSE2
+/* Entry distance of a ray into the node, infinity if it doesn't hit it
+   before max distance. Fourth component of origin and inverse direction is
+   ignored. */
+inline Float nodeDistance(const BvhNode& node, const __m128 origin, const __m128 inverseDirection, const Float maxDistance) {
+    /* Fourth component is offset / count, replace it with the third */
+    const __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.min.data()), origin), inverseDirection);
+    const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.max.data()), origin), inverseDirection);
+    __m128 entry = _mm_min_ps(t0, t1);
+    __m128 exit = _mm_max_ps(t0, t1);
+    entry = _mm_shuffle_ps(entry, entry, _MM_SHUFFLE(2, 2, 1, 0));
+    exit = _mm_shuffle_ps(exit, exit, _MM_SHUFFLE(2, 2, 1, 0));
+
+    /* Horizontal max of entry and min of exit distances */
+    entry = _mm_max_ps(entry, _mm_shuffle_ps(entry, entry, _MM_SHUFFLE(1, 0, 3, 2)));
+    entry = _mm_max_ss(entry, _mm_shuffle_ps(entry, entry, _MM_SHUFFLE(2, 3, 0, 1)));
+    exit = _mm_min_ps(exit, _mm_shuffle_ps(exit, exit, _MM_SHUFFLE(1, 0, 3, 2)));
+    exit = _mm_min_ss(exit, _mm_shuffle_ps(exit, exit, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    const Float entryDistance = std::max(_mm_cvtss_f32(entry), 0.0f);
+    return entryDistance <= std::min(_mm_cvtss_f32(exit), maxDistance) ? entryDistance : Constants::inf();
+}
+#else
+inline Float nodeDistance(const BvhNode& node, const Vector3& origin, const Vector3& inverseDirection, const Float maxDistance) {
+    const Vector3 t0 = (node.min - origin)*inverseDirection;
+    const Vector3 t1 = (node.max - origin)*inverseDirection;
+    const Float entryDistance = std::max(componentMin(t0, t1).max(), 0.0f);
+    return entryDistance <= std::min(componentMax(t0, t1).min(), maxDistance) ? entryDistance : Constants::inf();
+}
+#endif
+
+/* Ray/triangle test with precomputed edges, the same as
+   Math::Geometry::Intersection::rayTriangle(). Updates the hit and returns
+   true if the triangle is hit before current hit distance. */
+inline bool intersectTriangle(const BvhTriangle& triangle, const Vector3& origin, const Vector3& direction, Float& distance, Vector2& barycentric) {
+    const Vector3 p = Math::cross(direction, triangle.e2);
+    const Float determinant = Math::dot(triangle.e1, p);
+    if(determinant == 0.0f) return false;
+
+    const Float inverseDeterminant = 1.0f/determinant;
+    const Vector3 s = origin - triangle.a;
+    const Float u = Math::dot(s, p)*inverseDeterminant;
+    if(u < 0.0f || u > 1.0f) return false;
+
+    const Vector3 q = Math::cross(s, triangle.e1);
+    const Float v = Math::dot(direction, q)*inverseDeterminant;
+    if(v < 0.0f || u + v > 1.0f) return false;
+
+    const Float t = Math::dot(triangle.e2, q)*inverseDeterminant;
+    if(t < 0.0f || t >= distance) return false;
+
+    distance = t;
+    barycentric = {u, v};
+    return true;
+}
+
+}
+
+Bvh::Bvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::Bvh: index count is not divisible by 3!", );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Bounds and centroids of all triangles */
+    std::vector<Primitive> primitives(triangleCount);
+    Magnum::Implementation::parallelFor(triangleCount, threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const Vector3& a = positions[indices[i*3]];
+            const Vector3& b = positions[indices[i*3 + 1]];
+            const Vector3& c = positions[indices[i*3 + 2]];
+            Primitive& primitive = primitives[i];
+            primitive.min = componentMin(componentMin(a, b), c);
+            primitive.max = componentMax(componentMax(a, b), c);
+            primitive.centroid = (primitive.min + primitive.max)*0.5f;
+            primitive.id = i;
+        }
+    });
+
+    /* Build top of the tree serially, collecting subtrees to build in
+       parallel */
+    const Builder builder{primitives};
+    std::vector<Task> tasks;
+    _nodes.resize(1);
+    builder.build(_nodes, 0, 0, triangleCount, 0, &tasks);
+
+    std::vector<std::vector<BvhNode>> subtrees(tasks.size());
+    Magnum::Implementation::parallelFor(tasks.size(), threadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            subtrees[i].resize(1);
+            builder.build(subtrees[i], 0, tasks[i].begin, tasks[i].end, tasks[i].depth, nullptr);
+        }
+    });
+
+    /* Append the subtrees in task order, root of each subtree replaces the
+       placeholder node */
+    for(std::size_t i = 0; i != tasks.size(); ++i) {
+        const UnsignedInt base = _nodes.size() - 1;
+        for(std::size_t j = 0; j != subtrees[i].size(); ++j) {
+            BvhNode node = subtrees[i][j];
+            if(!node.count) node.offset += base;
+            if(j) _nodes.push_back(node);
+            else _nodes[tasks[i].node] = node;
+        }
+    }
+
+    /* Triangles in leaf order */
+    _triangleIds.resize(triangleCount);
+    _triangles.resize(triangleCount);
+    Magnum::Implementation::parallelFor(triangleCount, threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            _triangleIds[i] = primitives[i].id;
+            const UnsignedInt* const triangle = indices.data() + _triangleIds[i]*3;
+            const Vector3& a = positions[triangle[0]];
+            _triangles[i] = {a, positions[triangle[1]] - a, positions[triangle[2]] - a};
+        }
+    });
+}
+
+namespace {
+
+/* Checked before delegating so the tree isn't built from invalid data */
+const std::vector<UnsignedInt>& triangleIndices(const Trade::MeshData3D& meshData) {
+    static const std::vector<UnsignedInt> empty;
+    CORRADE_ASSERT(meshData.isIndexed() && meshData.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::Bvh: expected indexed triangle mesh", empty);
+    return meshData.indices();
+}
+
+}
+
+Bvh::Bvh(const Trade::MeshData3D& meshData, const std::size_t threadCount): Bvh{triangleIndices(meshData), meshData.positions(0), threadCount} {}
+
+Range3D Bvh::bounds() const {
+    if(_nodes.empty()) return {};
+    return {_nodes[0].min, _nodes[0].max};
+}
+
+Bvh::Hit Bvh::intersect(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    return traverse<false>(origin, direction, maxDistance);
+}
+
+bool Bvh::occluded(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    return !!traverse<true>(origin, direction, maxDistance);
+}
+
+template<bool anyHit> Bvh::Hit Bvh::traverse(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    Hit hit{~UnsignedInt{}, maxDistance, {}};
+    if(_nodes.empty()) return hit;
+
+    #ifdef MAGNUM_MATH_SSE2
+    const Vector3 inverse = inverseDirection(direction);
+    const __m128 rayOrigin = _mm_setr_ps(origin.x(), origin.y(), origin.z(), 0.0f);
+    const __m128 rayInverseDirection = _mm_setr_ps(inverse.x(), inverse.y(), inverse.z(), 0.0f);
+    #else
+    const Vector3& rayOrigin = origin;
+    const Vector3 rayInverseDirection = inverseDirection(direction);
+    #endif
+
+    /* Stack of nodes to visit along with their entry distance, so nodes
+       farther than current nearest hit can be skipped */
+    struct Entry {
+        UnsignedInt node;
+        Float distance;
+    } stack[StackSize];
+    std::size_t stackSize = 0;
+
+    const Float rootDistance = nodeDistance(_nodes[0], rayOrigin, rayInverseDirection, maxDistance);
+    if(rootDistance == Constants::inf()) return hit;
+    stack[stackSize++] = {0, rootDistance};
+
+    while(stackSize) {
+        const Entry entry = stack[--stackSize];
+        if(entry.distance >= hit.distance) continue;
+
+        const BvhNode* node = &_nodes[entry.node];
+        for(;;) {
+            /* Leaf, test all triangles */
+            if(node->count) {
+                for(UnsignedInt i = node->offset, end = node->offset + node->count; i != end; ++i) {
+                    if(!intersectTriangle(_triangles[i], origin, direction, hit.distance, hit.barycentric)) continue;
+                    hit.triangle = _triangleIds[i];
+                    if(anyHit) return hit;
+                }
+                break;
+            }
+
+            /* Inner node, continue to the nearer child and put the other on
+               the stack */
+            const Float leftDistance = nodeDistance(_nodes[node->offset], rayOrigin, rayInverseDirection, hit.distance);
+            const Float rightDistance = nodeDistance(_nodes[node->offset + 1], rayOrigin, rayInverseDirection, hit.distance);
+            if(leftDistance == Constants::inf() && rightDistance == Constants::inf()) break;
+
+            const UnsignedInt left = node->offset;
+            if(rightDistance == Constants::inf())
+                node = &_nodes[left];
+            else if(leftDistance == Constants::inf())
+                node = &_nodes[left + 1];
+            else if(leftDistance <= rightDistance) {
+                stack[stackSize++] = {left + 1, rightDistance};
+                node = &_nodes[left];
+            } else {
+                stack[stackSize++] = {left, leftDistance};
+                node = &_nodes[left + 1];
+            }
+        }
+    }
+
+    return hit;
+}
+
+void Bvh::intersect(const Containers::ArrayView<const Vector3> origins, const Containers::ArrayView<const Vector3> directions, const Containers::ArrayView<Hit> hits, const Float maxDistance, const std::size_t threadCount) const {
+    CORRADE_ASSERT(origins.size() == directions.size() && origins.size() == hits.size(),
+        "MeshTools::Bvh::intersect(): expected" << origins.size() << "directions and hits but got" << directions.size() << "and" << hits.size(), );
+
+    const std::size_t packetCount = (origins.size() + 3)/4;
+    Magnum::Implementation::parallelFor(packetCount, threadCount, MinParallelPacketCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const std::size_t offset = i*4;
+            traversePacket(origins.data() + offset, directions.data() + offset, hits.data() + offset, std::min(std::size_t(4), origins.size() - offset), maxDistance);
+        }
+    });
+}
+
+#ifdef MAGNUM_MATH_SSE2
+namespace {
+
+inline __m128 select(const __m128 mask, const __m128 a, const __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+}
+
+void Bvh::traversePacket(const Vector3* const origins, const Vector3* const directions, Hit* const hits, const std::size_t count, const Float maxDistance) const {
+    /* Rays in structure-of-arrays layout, unused rays in the packet have
+       negative max distance so they never hit anything */
+    alignas(16) Float data[9][4];
+    alignas(16) Float initialDistance[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        const std::size_t ray = i < count ? i : 0;
+        const Vector3 inverse = inverseDirection(directions[ray]);
+        for(std::size_t j = 0; j != 3; ++j) {
+            data[j][i] = origins[ray][j];
+            data[3 + j][i] = directions[ray][j];
+            data[6 + j][i] = inverse[j];
+        }
+        initialDistance[i] = i < count ? maxDistance : -1.0f;
+    }
+
+    const __m128 ox = _mm_load_ps(data[0]), oy = _mm_load_ps(data[1]), oz = _mm_load_ps(data[2]);
+    const __m128 dx = _mm_load_ps(data[3]), dy = _mm_load_ps(data[4]), dz = _mm_load_ps(data[5]);
+    const __m128 ix = _mm_load_ps(data[6]), iy = _mm_load_ps(data[7]), iz = _mm_load_ps(data[8]);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 distance = _mm_load_ps(initialDistance);
+    __m128 u = zero, v = zero;
+    __m128i triangle = _mm_set1_epi32(-1);
+
+    UnsignedInt stack[StackSize];
+    std::size_t stackSize = 0;
+    if(!_nodes.empty()) stack[stackSize++] = 0;
+
+    while(stackSize) {
+        const BvhNode& node = _nodes[stack[--stackSize]];
+
+        /* Slab test for all rays at once */
+        const __m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.x()), ox), ix);
+        const __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.x()), ox), ix);
+        const __m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.y()), oy), iy);
+        const __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.y()), oy), iy);
+        const __m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.z()), oz), iz);
+        const __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.z()), oz), iz);
+        const __m128 entry = _mm_max_ps(_mm_max_ps(_mm_min_ps(t0x, t1x), _mm_min_ps(t0y, t1y)), _mm_max_ps(_mm_min_ps(t0z, t1z), zero));
+        const __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(t0x, t1x), _mm_max_ps(t0y, t1y)), _mm_min_ps(_mm_max_ps(t0z, t1z), distance));
+        if(!_mm_movemask_ps(_mm_cmple_ps(entry, exit))) continue;
+
+        /* Inner node, visit the child nearer to the first ray first */
+        if(!node.count) {
+            const BvhNode& left = _nodes[node.offset];
+            const BvhNode& right = _nodes[node.offset + 1];
+            const Vector3 separation = (right.min + right.max) - (left.min + left.max);
+            const std::size_t axis = std::abs(separation.x()) >= std::abs(separation.y()) && std::abs(separation.x()) >= std::abs(separation.z()) ? 0 : std::abs(separation.y()) >= std::abs(separation.z()) ? 1 : 2;
+            const bool leftFirst = (separation[axis] >= 0.0f) == (data[3 + axis][0] >= 0.0f);
+            stack[stackSize++] = node.offset + leftFirst;
+            stack[stackSize++] = node.offset + !leftFirst;
+            continue;
+        }
+
+        /* Leaf, test all triangles with all rays at once */
+        for(UnsignedInt i = node.offset, end = node.offset + node.count; i != end; ++i) {
+            const BvhTriangle& t = _triangles[i];
+            const __m128 e1x = _mm_set1_ps(t.e1.x()), e1y = _mm_set1_ps(t.e1.y()), e1z = _mm_set1_ps(t.e1.z());
+            const __m128 e2x = _mm_set1_ps(t.e2.x()), e2y = _mm_set1_ps(t.e2.y()), e2z = _mm_set1_ps(t.e2.z());
+
+            /* p = cross(direction, e2), determinant = dot(e1, p) */
+            const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+            const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+            const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+            const __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+            const __m128 inverseDeterminant = _mm_div_ps(one, determinant);
+
+            /* s = origin - a, u = dot(s, p)/determinant */
+            const __m128 sx = _mm_sub_ps(ox, _mm_set1_ps(t.a.x()));
+            const __m128 sy = _mm_sub_ps(oy, _mm_set1_ps(t.a.y()));
+            const __m128 sz = _mm_sub_ps(oz, _mm_set1_ps(t.a.z()));
+            const __m128 hitU = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inverseDeterminant);
+
+            /* q = cross(s, e1), v = dot(direction, q)/determinant,
+               t = dot(e2, q)/determinant */
+            const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+            const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+            const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+            const __m128 hitV = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDeterminant);
+            const __m128 hitDistance = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDeterminant);
+
+            /* All comparisons are false for NaNs resulting from zero
+               determinant */
+            const __m128 mask = _mm_and_ps(
+                _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(hitU, zero), _mm_cmple_ps(hitU, one)),
+                           _mm_and_ps(_mm_cmpge_ps(hitV, zero), _mm_cmple_ps(_mm_add_ps(hitU, hitV), one))),
+                _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(hitDistance, zero), _mm_cmplt_ps(hitDistance, distance)), _mm_cmpneq_ps(determinant, zero)));
+            if(!_mm_movemask_ps(mask)) continue;
+
+            distance = select(mask, hitDistance, distance);
+            u = select(mask, hitU, u);
+            v = select(mask, hitV, v);
+            triangle = _mm_castps_si128(select(mask, _mm_castsi128_ps(_mm_set1_epi32(_triangleIds[i])), _mm_castsi128_ps(triangle)));
+        }
+    }
+
+    alignas(16) Float outDistance[4], outU[4], outV[4];
+    alignas(16) UnsignedInt outTriangle[4];
+    _mm_store_ps(outDistance, distance);
+    _mm_store_ps(outU, u);
+    _mm_store_ps(outV, v);
+    _mm_store_si128(reinterpret_cast<__m128i*>(outTriangle), triangle);
+    for(std::size_t i = 0; i != count; ++i)
+        hits[i] = {outTriangle[i], outDistance[i], {outU[i], outV[i]}};
+}
+#else
+void Bvh::traversePacket(const Vector3* const origins, const Vector3* const directions, Hit* const hits, const std::size_t count, const Float maxDistance) const {
+    for(std::size_t i = 0; i != count; ++i)
+        hits[i] = traverse<false>(origins[i], directions[i], maxDistance);
+}
+#endif
+
+}}
@@ -0,0 +1,213 @@
+#ifndef Magnum_MeshTools_Bvh_h
+#define Magnum_MeshTools_Bvh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::Bvh
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+    /* Flattened node, children of inner node are next to each other. The
+       layout allows loading both corners with their padding in one SIMD
+       load. */
+    struct BvhNode {
+        Vector3 min;
+        /* First child for inner node, first triangle for leaf */
+        UnsignedInt offset;
+        Vector3 max;
+        /* Zero for inner node */
+        UnsignedInt count;
+    };
+
+    /* Triangle with precomputed edges */
+    struct BvhTriangle {
+        Vector3 a, e1, e2;
+    };
+}
+
+/**
+@brief Bounding volume hierarchy over mesh triangles
+
+Acceleration structure for casting rays against triangle meshes, e.g. for
+picking or lightmap and ambient occlusion baking. Triangle data are copied
+into the structure, so the original arrays don't need to be kept around.
+Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+MeshTools::Bvh bvh{indices, positions};
+
+MeshTools::Bvh::Hit hit = bvh.intersect(origin, direction);
+if(hit) {
+    Vector3 position = origin + direction*hit.distance;
+    // ...
+}
+@endcode
+
+@section MeshTools-Bvh-construction Construction
+
+The hierarchy is a binary tree built top-down using surface area heuristic
+with binned centroids. Subtrees with less than a few thousand triangles are
+built as separate tasks split among threads. The task division doesn't depend
+on thread count, so the resulting structure is always the same. Nodes are
+stored in a single flat array with both children of each node next to each
+other and triangles in each leaf are stored contiguously.
+
+@section MeshTools-Bvh-traversal Traversal
+
+Single rays traverse the tree front-to-back, skipping nodes farther than the
+nearest hit so far. @ref occluded() returns on the first hit. The batch
+variant of @ref intersect() processes the rays in packets of four, with the
+packets split among threads. Ray packets are efficient mainly for coherent
+rays, e.g. primary rays or rays from the same texel in baking.
+
+If Magnum is built with `MAGNUM_TARGET_SIMD` and SSE2 is available, ray/box
+test for single rays and both ray/box and ray/triangle tests for ray packets
+are done using SSE2 instructions. Otherwise a scalar implementation is used.
+Ray/triangle intersection uses the same algorithm as
+@ref Math::Geometry::Intersection::rayTriangle().
+*/
+class MAGNUM_MESHTOOLS_EXPORT Bvh {
+    public:
+        /** @brief Ray hit */
+        struct Hit {
+            /**
+             * @brief Triangle index
+             *
+             * Index of the triangle in original index array divided by 3,
+             * `~UnsignedInt{}` if nothing was hit.
+             */
+            UnsignedInt triangle;
+
+            /**
+             * @brief Hit distance
+             *
+             * Distance of the hit from ray origin in multiples of ray
+             * direction. Equal to max distance if nothing was hit.
+             */
+            Float distance;
+
+            /**
+             * @brief Barycentric coordinates
+             *
+             * Coordinates of the hit point relative to second and third
+             * triangle vertex, see
+             * @ref Math::Geometry::Intersection::rayTriangle() for more
+             * information.
+             */
+            Vector2 barycentric;
+
+            /** @brief Whether anything was hit */
+            explicit operator bool() const { return triangle != ~UnsignedInt{}; }
+        };
+
+        /**
+         * @brief Constructor
+         * @param indices       Array of triangle face indices
+         * @param positions     Array of vertex positions
+         * @param threadCount   Thread count. If `0`, hardware concurrency is
+         *      used.
+         *
+         * @attention The function requires the mesh to have triangle faces,
+         *      thus index count must be divisible by 3.
+         */
+        explicit Bvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t threadCount = 0);
+
+        /**
+         * @brief Construct from mesh data
+         *
+         * Uses indices and first position array of @p meshData. Expects
+         * that the mesh is indexed and has @ref MeshPrimitive::Triangles.
+         */
+        explicit Bvh(const Trade::MeshData3D& meshData, std::size_t threadCount = 0);
+
+        /** @brief Triangle count */
+        std::size_t triangleCount() const { return _triangles.size(); }
+
+        /** @brief Node count */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /** @brief Bounds of all triangles */
+        Range3D bounds() const;
+
+        /**
+         * @brief Nearest intersection of a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction, doesn't need to be normalized
+         * @param maxDistance   Max hit distance in multiples of @p direction
+         *
+         * Returns the nearest hit with distance in range
+         * @f$ [ 0 ; maxDistance ) @f$.
+         */
+        Hit intersect(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Nearest intersections of a batch of rays
+         * @param origins       Ray origins
+         * @param directions    Ray directions, don't need to be normalized
+         * @param[out] hits     Nearest hit for each ray
+         * @param maxDistance   Max hit distance in multiples of ray direction
+         * @param threadCount   Thread count. If `0`, hardware concurrency is
+         *      used.
+         *
+         * Equivalent to calling @ref intersect(const Vector3&, const Vector3&, Float) const
+         * for each ray, but the rays are traversed in packets of four. Expects
+         * that all arrays have the same size.
+         */
+        void intersect(Containers::ArrayView<const Vector3> origins, Containers::ArrayView<const Vector3> directions, Containers::ArrayView<Hit> hits, Float maxDistance = Constants::inf(), std::size_t threadCount = 0) const;
+
+        /**
+         * @brief Whether a ray hits anything
+         *
+         * Similar to @ref intersect(const Vector3&, const Vector3&, Float) const,
+         * but stops at first found hit. Useful for shadow and occlusion rays.
+         */
+        bool occluded(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+    private:
+        template<bool anyHit> Hit traverse(const Vector3& origin, const Vector3& direction, Float maxDistance) const;
+        void traversePacket(const Vector3* origins, const Vector3* directions, Hit* hits, std::size_t count, Float maxDistance) const;
+
+        std::vector<Implementation::BvhNode> _nodes;
+        std::vector<Implementation::BvhTriangle> _triangles;
+        std::vector<UnsignedInt> _triangleIds;
+};
+
+}}
+
+#endif
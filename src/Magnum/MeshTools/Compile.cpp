@@ -26,9 +26,12 @@
 #include "Compile.h"
 
 #include "Magnum/Buffer.h"
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Quantize.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -38,6 +41,24 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Interleaves given attribute into the data, adds it to the mesh and returns
+   offset of next one */
+template<class T, class Attribute> std::size_t addAttribute(Mesh& mesh, Buffer& buffer, Containers::Array<char>& data, const std::size_t offset, const std::size_t stride, const Attribute& attribute, const std::vector<T>& values) {
+    MeshTools::interleaveInto(data, offset, values, stride - offset - sizeof(T));
+    mesh.addVertexBuffer(buffer, 0, offset, attribute, stride - offset - sizeof(T));
+    return offset + sizeof(T);
+}
+
+template<class T> std::vector<Math::Vector2<T>> packOctahedral(const std::vector<Vector3>& normals) {
+    std::vector<Math::Vector2<T>> out(normals.size());
+    Math::Batch::packOctahedral<T>({normals.data(), normals.size()}, {out.data(), out.size()});
+    return out;
+}
+
+}
+
 std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, const BufferUsage usage) {
     Mesh mesh;
     mesh.setPrimitive(meshData.primitive());
@@ -165,4 +186,108 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
 
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>, Matrix4> compile(const Trade::MeshData3D& meshData, const BufferUsage usage, const PositionQuantization positions, const NormalQuantization normals, const TextureCoordinateQuantization textureCoords) {
+    Mesh mesh;
+    mesh.setPrimitive(meshData.primitive());
+
+    /* Convert the attributes first to know the stride */
+    std::vector<Math::Vector3<UnsignedShort>> quantizedPositions;
+    Matrix4 dequantization;
+    std::size_t stride = sizeof(Vector3);
+    if(positions == PositionQuantization::UnsignedShort) {
+        std::tie(quantizedPositions, dequantization) = quantizePositions(meshData.positions(0));
+        stride = sizeof(Math::Vector3<UnsignedShort>);
+    }
+
+    std::vector<Math::Vector2<Byte>> octahedralNormals8;
+    std::vector<Math::Vector2<Short>> octahedralNormals16;
+    if(meshData.hasNormals()) switch(normals) {
+        case NormalQuantization::None:
+            stride += sizeof(Vector3);
+            break;
+        case NormalQuantization::Octahedral8:
+            octahedralNormals8 = packOctahedral<Byte>(meshData.normals(0));
+            stride += sizeof(Math::Vector2<Byte>);
+            break;
+        case NormalQuantization::Octahedral16:
+            octahedralNormals16 = packOctahedral<Short>(meshData.normals(0));
+            stride += sizeof(Math::Vector2<Short>);
+            break;
+    }
+
+    std::vector<Math::Vector2<Half>> halfTextureCoords;
+    if(meshData.hasTextureCoords2D()) {
+        if(textureCoords == TextureCoordinateQuantization::Half) {
+            const std::vector<Vector2>& coords = meshData.textureCoords2D(0);
+            halfTextureCoords.resize(coords.size());
+            Math::Batch::packHalf({coords.data()->data(), coords.size()*2}, {halfTextureCoords.data()->data(), halfTextureCoords.size()*2});
+            stride += sizeof(Math::Vector2<Half>);
+        } else stride += sizeof(Vector2);
+    }
+
+    /* Six-byte positions and two-byte normals may leave the stride unaligned,
+       pad it to four bytes */
+    stride = (stride + 3) & ~std::size_t(3);
+
+    /* Interleave the attributes. They are put in order of decreasing
+       component size and the four-byte-sized ones go first among the
+       two-byte ones, so float attributes are always aligned to four bytes
+       and the others at least to their component size. The data are
+       zero-initialized so the padding doesn't upload garbage to the GPU. */
+    const std::size_t vertexCount = meshData.positions(0).size();
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(vertexCount*stride);
+    std::size_t offset = 0;
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+
+    /* 32-bit floats */
+    if(positions == PositionQuantization::None)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::Position{}, meshData.positions(0));
+    if(meshData.hasNormals() && normals == NormalQuantization::None)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::Normal{}, meshData.normals(0));
+    if(meshData.hasTextureCoords2D() && textureCoords == TextureCoordinateQuantization::None)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::TextureCoordinates{}, meshData.textureCoords2D(0));
+
+    /* 16-bit components, four bytes in total */
+    if(meshData.hasNormals() && normals == NormalQuantization::Octahedral16)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::OctahedralNormal{Shaders::Generic3D::OctahedralNormal::DataType::Short, Shaders::Generic3D::OctahedralNormal::DataOption::Normalized}, octahedralNormals16);
+    if(meshData.hasTextureCoords2D() && textureCoords == TextureCoordinateQuantization::Half)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::TextureCoordinates{Shaders::Generic3D::TextureCoordinates::DataType::HalfFloat}, halfTextureCoords);
+
+    /* 16-bit components, six bytes in total */
+    if(positions == PositionQuantization::UnsignedShort)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::Position{Shaders::Generic3D::Position::DataType::UnsignedShort, Shaders::Generic3D::Position::DataOption::Normalized}, quantizedPositions);
+
+    /* 8-bit components */
+    if(meshData.hasNormals() && normals == NormalQuantization::Octahedral8)
+        offset = addAttribute(mesh, *vertexBuffer, data, offset, stride,
+            Shaders::Generic3D::OctahedralNormal{Shaders::Generic3D::OctahedralNormal::DataType::Byte, Shaders::Generic3D::OctahedralNormal::DataOption::Normalized}, octahedralNormals8);
+
+    /* Fill vertex buffer with interleaved data */
+    vertexBuffer->setData(data, usage);
+
+    /* If indexed, fill index buffer and configure indexed mesh */
+    std::unique_ptr<Buffer> indexBuffer;
+    if(meshData.isIndexed()) {
+        Containers::Array<char> indexData;
+        Mesh::IndexType indexType;
+        UnsignedInt indexStart, indexEnd;
+        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(meshData.indices());
+
+        indexBuffer.reset(new Buffer{Buffer::TargetHint::ElementArray});
+        indexBuffer->setData(indexData, usage);
+        mesh.setCount(meshData.indices().size())
+            .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
+
+    /* Else set vertex count */
+    } else mesh.setCount(vertexCount);
+
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer), dequantization);
+}
+
 }}
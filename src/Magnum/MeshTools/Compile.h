@@ -26,18 +26,74 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compile()
+ * @brief Function @ref Magnum::MeshTools::compile(), enum @ref Magnum::MeshTools::PositionQuantization, @ref Magnum::MeshTools::NormalQuantization, @ref Magnum::MeshTools::TextureCoordinateQuantization
  */
 
 #include <tuple>
 #include <memory>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
+/**
+@brief Position quantization
+
+@see @ref compile(const Trade::MeshData3D&, BufferUsage, PositionQuantization, NormalQuantization, TextureCoordinateQuantization)
+*/
+enum class PositionQuantization: UnsignedByte {
+    None,           /**< Three 32-bit floats, 12 bytes */
+
+    /**
+     * Three 16-bit normalized unsigned integers relative to the bounding box,
+     * 6 bytes. See @ref quantizePositions() for details.
+     */
+    UnsignedShort
+};
+
+/**
+@brief Normal quantization
+
+@see @ref compile(const Trade::MeshData3D&, BufferUsage, PositionQuantization, NormalQuantization, TextureCoordinateQuantization)
+*/
+enum class NormalQuantization: UnsignedByte {
+    None,           /**< Three 32-bit floats, 12 bytes */
+
+    /**
+     * Octahedral encoding in two 8-bit normalized integers, 2 bytes. See
+     * @ref Math::packOctahedral() for details.
+     */
+    Octahedral8,
+
+    /**
+     * Octahedral encoding in two 16-bit normalized integers, 4 bytes. See
+     * @ref Math::packOctahedral() for details.
+     */
+    Octahedral16
+};
+
+/**
+@brief Texture coordinate quantization
+
+@see @ref compile(const Trade::MeshData3D&, BufferUsage, PositionQuantization, NormalQuantization, TextureCoordinateQuantization)
+*/
+enum class TextureCoordinateQuantization: UnsignedByte {
+    None,           /**< Two 32-bit floats, 8 bytes */
+
+    /**
+     * Two half-floats, 4 bytes. See @ref Math::packHalf() for details.
+     * @requires_gl30 Extension @extension{ARB,half_float_vertex}
+     * @requires_gles30 Extension @es_extension{OES,vertex_half_float} in
+     *      OpenGL ES 2.0
+     * @requires_webgl20 Half float vertex attributes are not available in
+     *      WebGL 1.0.
+     */
+    Half
+};
+
 /**
 @brief Compile 2D mesh data
 
@@ -80,6 +136,54 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage);
 
+/**
+@brief Compile 3D mesh data with quantized attributes
+@param meshData     Mesh data
+@param usage        Buffer usage
+@param positions    Position quantization
+@param normals      Normal quantization
+@param textureCoords Texture coordinate quantization
+@return Mesh, vertex buffer, index buffer and dequantization matrix
+
+Similar to @ref compile(const Trade::MeshData3D&, BufferUsage), but stores
+the vertex attributes in smaller types, reducing memory and bandwidth
+requirements. With @ref PositionQuantization::UnsignedShort,
+@ref NormalQuantization::Octahedral8 and
+@ref TextureCoordinateQuantization::Half the vertex takes 12 bytes instead of
+32, with maximal position error of 1/131070 of the bounding box size, normal
+direction error below one degree and texture coordinate error of 1/2048
+relative to the coordinate. The attributes are ordered by decreasing
+component size, so float attributes are always aligned to four bytes and the
+others at least to their component size. The stride is aligned to four bytes.
+
+Quantized positions are relative to the bounding box of the mesh, multiply the
+transformation passed to the shader with the returned matrix, which is
+identity if positions are not quantized. Octahedral normals need a shader
+supporting them, such as @ref Shaders::Phong with
+@ref Shaders::Phong::Flag::OctahedralNormals, they are bound to
+@ref Shaders::Generic3D::OctahedralNormal instead of
+@ref Shaders::Generic3D::Normal:
+@code
+Mesh mesh;
+std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+Matrix4 dequantization;
+std::tie(mesh, vertexBuffer, indexBuffer, dequantization) = MeshTools::compile(meshData, BufferUsage::StaticDraw,
+    MeshTools::PositionQuantization::UnsignedShort,
+    MeshTools::NormalQuantization::Octahedral8,
+    MeshTools::TextureCoordinateQuantization::Half);
+
+Shaders::Phong shader{Shaders::Phong::Flag::OctahedralNormals};
+shader.setTransformationMatrix(transformation*dequantization)
+    .setNormalMatrix(transformation.rotation())
+    .setProjectionMatrix(projection);
+mesh.draw(shader);
+@endcode
+
+@see @ref quantizePositions(), @ref Math::Batch::packOctahedral(),
+    @ref Math::Batch::packHalf()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>, Matrix4> compile(const Trade::MeshData3D& meshData, BufferUsage usage, PositionQuantization positions, NormalQuantization normals, TextureCoordinateQuantization textureCoords);
+
 }}
 
 #endif
@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateSmoothNormals.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/Adjacency.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Don't bother spawning threads for less items than this */
+constexpr std::size_t MinParallelRangeSize = 16384;
+
+/* Unnormalized face normals (assuming counterclockwise winding), their length
+   is twice the face area */
+std::vector<Vector3> faceNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t threadCount) {
+    std::vector<Vector3> normals(indices.size()/3);
+    Magnum::Implementation::parallelFor(normals.size(), threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        const UnsignedInt* face = indices.data() + begin*3;
+        for(std::size_t i = begin; i != end; ++i, face += 3) {
+            const Vector3 a = positions[face[0]];
+            normals[i] = Math::cross(positions[face[1]] - a, positions[face[2]] - a);
+        }
+    });
+    return normals;
+}
+
+/* Contribution of face normal to normal of vertex at given corner */
+inline Vector3 weightedNormal(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const NormalWeighting weighting, const std::size_t corner) {
+    const Vector3& normal = normals[corner/3];
+    if(weighting == NormalWeighting::Area) return normal;
+
+    /* Angle between the two edges adjacent to the corner, the length of the
+       unnormalized normal is length of their cross product */
+    const std::size_t face = corner - corner%3;
+    const Vector3 position = positions[indices[corner]];
+    const Vector3 a = positions[indices[face + (corner%3 + 1)%3]] - position;
+    const Vector3 b = positions[indices[face + (corner%3 + 2)%3]] - position;
+    const Float length = normal.length();
+    if(length == 0.0f) return {};
+    return normal*(std::atan2(length, Math::dot(a, b))/length);
+}
+
+inline Vector3 normalizeOrZero(const Vector3& vector) {
+    const Float dot = vector.dot();
+    return dot == 0.0f ? Vector3{} : vector/std::sqrt(dot);
+}
+
+}
+
+Debug operator<<(Debug debug, const NormalWeighting value) {
+    switch(value) {
+        #define _c(value) case NormalWeighting::value: return debug << "MeshTools::NormalWeighting::" #value;
+        _c(Area)
+        _c(Angle)
+        #undef _c
+    }
+
+    return debug << "MeshTools::NormalWeighting::(invalid)";
+}
+
+std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const NormalWeighting weighting, const std::size_t threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3!", {});
+
+    const std::vector<Vector3> normals = faceNormals(indices, positions, threadCount);
+    std::vector<UnsignedInt> offsets, corners;
+    Implementation::buildVertexCorners(indices, positions.size(), offsets, corners);
+
+    /* Each vertex gathers normals of its faces, so there are no concurrent
+       writes to the same location */
+    std::vector<Vector3> vertexNormals(positions.size());
+    Magnum::Implementation::parallelFor(positions.size(), threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Vector3 sum;
+            for(std::size_t j = offsets[i]; j != offsets[i + 1]; ++j)
+                sum += weightedNormal(indices, positions, normals, weighting, corners[j]);
+            vertexNormals[i] = normalizeOrZero(sum);
+        }
+    });
+
+    return vertexNormals;
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const Rad creaseAngle, const NormalWeighting weighting, const std::size_t threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+
+    const std::vector<Vector3> normals = faceNormals(indices, positions, threadCount);
+    std::vector<UnsignedInt> offsets, corners;
+    Implementation::buildVertexCorners(indices, positions.size(), offsets, corners);
+    const Float cosCreaseAngle = Math::cos(creaseAngle);
+
+    /* Calculate normal for each corner from faces around its vertex which
+       are not separated by a crease. For each corner also remember first
+       corner of the same vertex having equal normal. */
+    std::vector<Vector3> cornerNormals(indices.size());
+    std::vector<UnsignedInt> firstEqualCorner(indices.size());
+    Magnum::Implementation::parallelFor(positions.size(), threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Vector3> weighted, directions;
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt* const vertexCorners = corners.data() + offsets[i];
+            const std::size_t count = offsets[i + 1] - offsets[i];
+
+            weighted.resize(count);
+            directions.resize(count);
+            for(std::size_t j = 0; j != count; ++j) {
+                weighted[j] = weightedNormal(indices, positions, normals, weighting, vertexCorners[j]);
+                directions[j] = normalizeOrZero(normals[vertexCorners[j]/3]);
+            }
+
+            for(std::size_t j = 0; j != count; ++j) {
+                Vector3 sum;
+                for(std::size_t k = 0; k != count; ++k)
+                    if(Math::dot(directions[j], directions[k]) >= cosCreaseAngle)
+                        sum += weighted[k];
+
+                const UnsignedInt corner = vertexCorners[j];
+                cornerNormals[corner] = normalizeOrZero(sum);
+                firstEqualCorner[corner] = corner;
+                for(std::size_t k = 0; k != j; ++k) if(cornerNormals[vertexCorners[k]] == cornerNormals[corner]) {
+                    firstEqualCorner[corner] = firstEqualCorner[vertexCorners[k]];
+                    break;
+                }
+            }
+        }
+    });
+
+    /* Assign indices to unique normals in vertex order */
+    std::vector<UnsignedInt> normalIndices(indices.size());
+    std::vector<Vector3> uniqueNormals;
+    uniqueNormals.reserve(positions.size());
+    for(const UnsignedInt corner: corners) {
+        if(firstEqualCorner[corner] == corner) {
+            normalIndices[corner] = uniqueNormals.size();
+            uniqueNormals.push_back(cornerNormals[corner]);
+        } else normalIndices[corner] = normalIndices[firstEqualCorner[corner]];
+    }
+
+    return std::make_tuple(std::move(normalIndices), std::move(uniqueNormals));
+}
+
+}}
@@ -0,0 +1,128 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateSmoothNormals(), enum @ref Magnum::MeshTools::NormalWeighting
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Face normal weighting
+
+@see @ref generateSmoothNormals()
+*/
+enum class NormalWeighting: UnsignedByte {
+    /**
+     * Each face contributes to normals of its vertices proportionally to its
+     * area. Cheapest to calculate, suitable for uniformly tessellated meshes.
+     */
+    Area,
+
+    /**
+     * Each face contributes to normal of given vertex proportionally to its
+     * angle at that vertex. The result doesn't depend on how the surface
+     * around the vertex is tessellated.
+     */
+    Angle
+};
+
+/** @debugoperatorenum{Magnum::MeshTools::NormalWeighting} */
+MAGNUM_MESHTOOLS_EXPORT Debug operator<<(Debug debug, NormalWeighting value);
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param weighting    Face normal weighting
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+@return Normal for each vertex
+
+Calculates normal of each face (assuming counterclockwise winding) and then
+normal of each vertex as normalized weighted sum of normals of all faces
+sharing given vertex. The returned array has the same size as @p positions and
+uses the same @p indices. Vertices not referenced by any face or having only
+degenerate faces get zero normal. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions);
+@endcode
+
+Both the face normal calculation and the accumulation are split among
+@p threadCount threads. Faces around each vertex are found using
+vertex-to-face adjacency in compressed sparse row format, so each vertex is
+processed by exactly one thread and the result doesn't depend on the thread
+count. Meshes which don't share vertices among faces (e.g. output of
+@ref duplicate()) result in flat normals, use @ref removeDuplicates() first.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref generateFlatNormals()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, NormalWeighting weighting = NormalWeighting::Area, std::size_t threadCount = 0);
+
+/**
+@brief Generate smooth normals with crease angle
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param creaseAngle  Max angle between face normals to be smoothed
+@param weighting    Face normal weighting
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+@return Normal indices and vectors
+
+Similar to @ref generateSmoothNormals(const std::vector<UnsignedInt>&, const std::vector<Vector3>&, NormalWeighting, std::size_t),
+but the normal of each face corner is calculated only from faces which have
+angle with given face not larger than @p creaseAngle. Vertices on sharp edges
+thus get more than one normal. Equal normals of the same vertex are shared,
+the output is indexed similarly to @ref generateFlatNormals():
+@code
+std::vector<UnsignedInt> vertexIndices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> normalIndices;
+std::vector<Vector3> normals;
+std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(vertexIndices, positions, Deg(40.0f));
+@endcode
+You can then use @ref combineIndexedArrays() to combine normal and vertex array
+to use the same indices.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, Rad creaseAngle, NormalWeighting weighting = NormalWeighting::Area, std::size_t threadCount = 0);
+
+}}
+
+#endif
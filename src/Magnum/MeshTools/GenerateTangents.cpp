@@ -0,0 +1,313 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Implementation/Adjacency.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Don't bother spawning threads for less items than this */
+constexpr std::size_t MinParallelRangeSize = 16384;
+
+constexpr UnsignedInt Invalid = ~UnsignedInt{};
+
+/* Vector projected to plane perpendicular to given normal */
+inline Vector3 projected(const Vector3& vector, const Vector3& normal) {
+    return vector - normal*Math::dot(normal, vector);
+}
+
+inline Vector3 normalizeOrZero(const Vector3& vector) {
+    const Float dot = vector.dot();
+    return dot == 0.0f ? Vector3{} : vector/std::sqrt(dot);
+}
+
+/* Arbitrary unit vector perpendicular to given normal */
+inline Vector3 perpendicular(const Vector3& normal) {
+    return normalizeOrZero(projected(std::abs(normal.x()) < 0.9f ? Vector3::xAxis() : Vector3::yAxis(), normal));
+}
+
+struct Face {
+    /* Normalized direction of increasing first texture coordinate, pointing
+       the other way for mirrored mapping */
+    Vector3 tangent;
+
+    /* Whether the mapping isn't mirrored. For faces with degenerate mapping
+       it's taken from the first group the face joins. */
+    bool orientationPreserving;
+
+    /* Degenerate texture mapping, the face doesn't contribute to tangents
+       but joins any group with the same orientation */
+    bool groupWithAny;
+
+    /* Two corners share the same (welded) vertex, the face is excluded from
+       grouping */
+    bool degenerate;
+};
+
+/* Fan of faces around a vertex connected through shared edges, having the
+   same orientation */
+struct Grouping {
+    const std::vector<UnsignedInt>& weldedIndices;
+    const std::vector<UnsignedInt>& neighbors;
+    std::vector<Face>& faces;
+    std::vector<UnsignedInt>& cornerGroups;
+    std::vector<UnsignedInt>& groupFaces;
+
+    UnsignedInt group;
+    UnsignedInt vertex;
+    bool orientationPreserving;
+};
+
+/* Adds the face to the group and continues to neighbors sharing the group
+   vertex. Same traversal order as in MikkTSpace, as it decides orientation of
+   faces with degenerate mapping. */
+void addToGroup(Grouping& grouping, const UnsignedInt face) {
+    const UnsignedInt* const faceIndices = grouping.weldedIndices.data() + face*3;
+    const UnsignedInt i = faceIndices[0] == grouping.vertex ? 0 : faceIndices[1] == grouping.vertex ? 1 : 2;
+    if(grouping.cornerGroups[face*3 + i] != Invalid) return;
+
+    Face& info = grouping.faces[face];
+    if(info.groupWithAny &&
+       grouping.cornerGroups[face*3] == Invalid &&
+       grouping.cornerGroups[face*3 + 1] == Invalid &&
+       grouping.cornerGroups[face*3 + 2] == Invalid)
+        info.orientationPreserving = grouping.orientationPreserving;
+    if(info.orientationPreserving != grouping.orientationPreserving) return;
+
+    grouping.groupFaces.push_back(face);
+    grouping.cornerGroups[face*3 + i] = grouping.group;
+
+    /* Neighbors across the two edges adjacent to the corner */
+    const UnsignedInt left = grouping.neighbors[face*3 + i];
+    const UnsignedInt right = grouping.neighbors[face*3 + (i + 2)%3];
+    if(left != Invalid) addToGroup(grouping, left);
+    if(right != Invalid) addToGroup(grouping, right);
+}
+
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector4>> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, const std::size_t threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateTangents(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector4>>()));
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(), "MeshTools::generateTangents(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoordinates.size(), (std::tuple<std::vector<UnsignedInt>, std::vector<Vector4>>()));
+
+    /* Weld vertices with equal position, normal and texture coordinates,
+       each is replaced with the one with lowest index */
+    std::vector<UnsignedInt> welded(positions.size());
+    {
+        std::vector<UnsignedInt> order(positions.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](const UnsignedInt a, const UnsignedInt b) {
+            for(std::size_t i = 0; i != 3; ++i) if(positions[a][i] != positions[b][i])
+                return positions[a][i] < positions[b][i];
+            for(std::size_t i = 0; i != 3; ++i) if(normals[a][i] != normals[b][i])
+                return normals[a][i] < normals[b][i];
+            for(std::size_t i = 0; i != 2; ++i) if(textureCoordinates[a][i] != textureCoordinates[b][i])
+                return textureCoordinates[a][i] < textureCoordinates[b][i];
+            return a < b;
+        });
+        for(std::size_t i = 0; i != order.size(); ++i) {
+            const UnsignedInt v = order[i];
+            const UnsignedInt previous = i ? order[i - 1] : Invalid;
+            welded[v] = previous != Invalid &&
+                positions[v] == positions[previous] &&
+                normals[v] == normals[previous] &&
+                textureCoordinates[v] == textureCoordinates[previous] ? welded[previous] : v;
+        }
+    }
+    std::vector<UnsignedInt> weldedIndices(indices.size());
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        weldedIndices[i] = welded[indices[i]];
+
+    /* Tangent and orientation of the texture mapping for each face */
+    const std::size_t faceCount = indices.size()/3;
+    std::vector<Face> faces(faceCount);
+    Magnum::Implementation::parallelFor(faceCount, threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        const UnsignedInt* face = indices.data() + begin*3;
+        const UnsignedInt* weldedFace = weldedIndices.data() + begin*3;
+        for(std::size_t i = begin; i != end; ++i, face += 3, weldedFace += 3) {
+            const Vector3 e1 = positions[face[1]] - positions[face[0]];
+            const Vector3 e2 = positions[face[2]] - positions[face[0]];
+            const Vector2 t1 = textureCoordinates[face[1]] - textureCoordinates[face[0]];
+            const Vector2 t2 = textureCoordinates[face[2]] - textureCoordinates[face[0]];
+
+            const Float signedArea = Math::cross(t1, t2);
+            const Vector3 tangent = e1*t2.y() - e2*t1.y();
+            const Vector3 bitangent = e2*t1.x() - e1*t2.x();
+
+            Face& info = faces[i];
+            info.orientationPreserving = signedArea > 0.0f;
+            info.tangent = normalizeOrZero(signedArea > 0.0f ? tangent : -tangent);
+            info.groupWithAny = signedArea == 0.0f || tangent.isZero() || bitangent.isZero();
+            info.degenerate = weldedFace[0] == weldedFace[1] || weldedFace[1] == weldedFace[2] || weldedFace[0] == weldedFace[2];
+        }
+    });
+
+    /* Face neighbors across each edge, with edge i going from corner i to
+       corner i + 1. Only edges with opposite direction are paired, each at
+       most once, the pairing goes in order of the faces. */
+    std::vector<UnsignedInt> neighbors(indices.size(), Invalid);
+    {
+        std::vector<std::pair<UnsignedLong, UnsignedInt>> edges;
+        edges.reserve(indices.size());
+        for(UnsignedInt i = 0; i != indices.size(); ++i) {
+            if(faces[i/3].degenerate) continue;
+            const UnsignedInt a = weldedIndices[i];
+            const UnsignedInt b = weldedIndices[i - i%3 + (i%3 + 1)%3];
+            edges.emplace_back((UnsignedLong(std::min(a, b)) << 32)|std::max(a, b), i);
+        }
+        std::sort(edges.begin(), edges.end());
+
+        for(std::size_t i = 0; i != edges.size(); ++i) {
+            const UnsignedInt a = edges[i].second;
+            if(neighbors[a] != Invalid) continue;
+
+            for(std::size_t j = i + 1; j != edges.size() && edges[j].first == edges[i].first; ++j) {
+                const UnsignedInt b = edges[j].second;
+                if(neighbors[b] != Invalid || weldedIndices[a] == weldedIndices[b]) continue;
+
+                neighbors[a] = b/3;
+                neighbors[b] = a/3;
+                break;
+            }
+        }
+    }
+
+    /* Split faces around each vertex into groups. Each group is started from
+       the first face corner that isn't grouped yet, faces with degenerate
+       mapping only join existing groups. */
+    std::vector<UnsignedInt> cornerGroups(indices.size(), Invalid);
+    std::vector<UnsignedInt> groupOffsets{0};
+    std::vector<UnsignedInt> groupVertices;
+    std::vector<UnsignedInt> groupFaces;
+    std::vector<bool> groupOrientations;
+    for(UnsignedInt i = 0; i != indices.size(); ++i) {
+        const Face& info = faces[i/3];
+        if(info.degenerate || info.groupWithAny || cornerGroups[i] != Invalid) continue;
+
+        Grouping grouping{weldedIndices, neighbors, faces, cornerGroups, groupFaces,
+            UnsignedInt(groupVertices.size()), weldedIndices[i], info.orientationPreserving};
+        addToGroup(grouping, i/3);
+
+        groupVertices.push_back(grouping.vertex);
+        groupOrientations.push_back(grouping.orientationPreserving);
+        groupOffsets.push_back(groupFaces.size());
+    }
+
+    /* Tangent of each group is sum of face tangents projected to the plane
+       perpendicular to the vertex normal, weighted by angle between the
+       projected edges at the vertex */
+    const std::size_t groupCount = groupVertices.size();
+    std::vector<Vector4> groupTangents(groupCount);
+    Magnum::Implementation::parallelFor(groupCount, threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Vector3 sum;
+            for(std::size_t j = groupOffsets[i]; j != groupOffsets[i + 1]; ++j) {
+                const UnsignedInt face = groupFaces[j];
+                if(faces[face].groupWithAny) continue;
+
+                const UnsignedInt* const faceIndices = weldedIndices.data() + face*3;
+                const UnsignedInt corner = faceIndices[0] == groupVertices[i] ? 0 : faceIndices[1] == groupVertices[i] ? 1 : 2;
+                const Vector3 position = positions[indices[face*3 + corner]];
+                const Vector3 normal = normals[indices[face*3 + corner]];
+
+                const Vector3 a = normalizeOrZero(projected(positions[indices[face*3 + (corner + 2)%3]] - position, normal));
+                const Vector3 b = normalizeOrZero(projected(positions[indices[face*3 + (corner + 1)%3]] - position, normal));
+                const Float angle = std::acos(Math::clamp(Math::dot(a, b), -1.0f, 1.0f));
+
+                sum += normalizeOrZero(projected(faces[face].tangent, normal))*angle;
+            }
+
+            Vector3 tangent = normalizeOrZero(sum);
+            if(tangent.isZero()) tangent = perpendicular(normals[groupVertices[i]]);
+            groupTangents[i] = {tangent, groupOrientations[i] ? 1.0f : -1.0f};
+        }
+    });
+
+    /* Tangent of each corner is tangent of its group. Corners of degenerate
+       faces take tangent of the first non-degenerate corner of the same
+       vertex. */
+    std::vector<UnsignedInt> firstCorners(positions.size(), Invalid);
+    for(UnsignedInt i = 0; i != indices.size(); ++i)
+        if(!faces[i/3].degenerate && firstCorners[weldedIndices[i]] == Invalid)
+            firstCorners[weldedIndices[i]] = i;
+    std::vector<Vector4> cornerTangents(indices.size());
+    const auto cornerTangent = [&](const UnsignedInt corner) -> Vector4 {
+        const UnsignedInt group = cornerGroups[corner];
+        if(group != Invalid) return groupTangents[group];
+        return Vector4{perpendicular(normals[indices[corner]]), faces[corner/3].orientationPreserving ? 1.0f : -1.0f};
+    };
+    Magnum::Implementation::parallelFor(faceCount, threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin*3; i != end*3; ++i) {
+            const UnsignedInt* const faceIndices = weldedIndices.data() + i - i%3;
+            const bool fullyDegenerate = faceIndices[0] == faceIndices[1] && faceIndices[1] == faceIndices[2];
+            const UnsignedInt corner = !faces[i/3].degenerate || fullyDegenerate || firstCorners[weldedIndices[i]] == Invalid ? i : firstCorners[weldedIndices[i]];
+            cornerTangents[i] = cornerTangent(corner);
+        }
+    });
+
+    /* For each corner remember first corner of the same vertex having equal
+       tangent */
+    std::vector<UnsignedInt> offsets, corners;
+    Implementation::buildVertexCorners(indices, positions.size(), offsets, corners);
+    std::vector<UnsignedInt> firstEqualCorner(indices.size());
+    Magnum::Implementation::parallelFor(positions.size(), threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            for(std::size_t j = offsets[i]; j != offsets[i + 1]; ++j) {
+                const UnsignedInt corner = corners[j];
+                firstEqualCorner[corner] = corner;
+                for(std::size_t k = offsets[i]; k != j; ++k) if(cornerTangents[corners[k]] == cornerTangents[corner]) {
+                    firstEqualCorner[corner] = firstEqualCorner[corners[k]];
+                    break;
+                }
+            }
+        }
+    });
+
+    /* Assign indices to unique tangents in vertex order */
+    std::vector<UnsignedInt> tangentIndices(indices.size());
+    std::vector<Vector4> tangents;
+    tangents.reserve(positions.size());
+    for(const UnsignedInt corner: corners) {
+        if(firstEqualCorner[corner] == corner) {
+            tangentIndices[corner] = tangents.size();
+            tangents.push_back(cornerTangents[corner]);
+        } else tangentIndices[corner] = tangentIndices[firstEqualCorner[corner]];
+    }
+
+    return std::make_tuple(std::move(tangentIndices), std::move(tangents));
+}
+
+}}
@@ -0,0 +1,97 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangents for normal mapping
+@param indices              Array of triangle face indices
+@param positions            Array of vertex positions
+@param normals              Array of vertex normals
+@param textureCoordinates   Array of vertex texture coordinates
+@param threadCount          Thread count. If `0`, hardware concurrency is
+    used.
+@return Tangent indices and vectors
+
+The tangent space is calculated the same way as in MikkTSpace, which is used
+by most normal map baking tools, so normal maps baked by them are reproduced
+without seams. Vertices with equal position, normal and texture coordinates
+are treated as one vertex. For each face the direction of increasing first
+texture coordinate is projected to the plane perpendicular to the vertex normal
+and contributions of faces around given vertex are weighted by angle between
+the projected face edges at that vertex. Fourth component of the tangent is
+`1.0f` or `-1.0f` depending on handedness of the texture mapping, the
+bitangent is then calculated in the shader as
+@code
+vec3 bitangent = tangent.w*cross(normal, tangent.xyz);
+@endcode
+
+Only faces connected to each other through edges around the vertex and having
+texture mapping of the same handedness contribute to each other's tangents, so
+a vertex can get more than one tangent (e.g. on mirrored texture seams). Faces
+with degenerate texture mapping don't contribute, but take tangent and
+handedness of the faces they are connected to. The output is indexed similarly
+to @ref generateFlatNormals() and you can use @ref combineIndexedArrays() to
+combine it with the vertex data. Tangents of vertices having only faces with
+degenerate texture mapping are chosen to be an arbitrary unit vector
+perpendicular to the normal, where MikkTSpace outputs a fixed default vector.
+
+Faces and their groups around the vertices are processed in @p threadCount
+chunks in parallel, the grouping itself is done sequentially in the same order
+as in MikkTSpace, so the result doesn't depend on the thread count. Example
+usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions, normals;
+std::vector<Vector2> textureCoordinates;
+
+std::vector<UnsignedInt> tangentIndices;
+std::vector<Vector4> tangents;
+std::tie(tangentIndices, tangents) = MeshTools::generateTangents(indices, positions, normals, textureCoordinates);
+@endcode
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. The normals are expected to be normalized.
+    The normal and texture coordinate arrays are expected to have the same
+    size as the position array.
+@see @ref Shaders::Generic3D::Tangent
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::vector<UnsignedInt>, std::vector<Vector4>> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, std::size_t threadCount = 0);
+
+}}
+
+#endif
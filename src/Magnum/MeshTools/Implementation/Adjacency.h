@@ -1,5 +1,5 @@
-#ifndef Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
-#define Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
+#ifndef Magnum_MeshTools_Implementation_Adjacency_h
+#define Magnum_MeshTools_Implementation_Adjacency_h
 /*
     This file is part of Magnum.
 
@@ -25,25 +25,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <QtCore/QObject>
+#include <vector>
 
-#include "Magnum/Magnum.h"
+#include "Magnum/Types.h"
 
-namespace Magnum { namespace MeshTools { namespace Test {
+namespace Magnum { namespace MeshTools { namespace Implementation {
 
-class SubdivideRemoveDuplicatesBenchmark: public QObject {
-    Q_OBJECT
-
-    private slots:
-        void subdivide();
-        void subdivideAndRemoveDuplicatesMeshAfter();
-        void subdivideAndRemoveDuplicatesMeshBetween();
-
-    private:
-        static Magnum::Vector4 interpolator(const Magnum::Vector4& a, const Magnum::Vector4& b) {
-            return (a+b).xyz().normalized();
-        }
-};
+/* Vertex to face corner adjacency in compressed sparse row format. Corners of
+   i-th vertex are in interval corners[offsets[i]] ; corners[offsets[i+1]],
+   sorted by corner index. Face index is corner index divided by 3. */
+void buildVertexCorners(const std::vector<UnsignedInt>& indices, std::size_t vertexCount, std::vector<UnsignedInt>& offsets, std::vector<UnsignedInt>& corners);
 
 }}}
 
@@ -0,0 +1,63 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Interleave.h"
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+#ifndef MAGNUM_TARGET_WEBGL
+void interleaveIntoBuffer(Buffer& buffer, const BufferUsage usage, const std::size_t size, const std::function<void(Containers::ArrayView<char>)>& write) {
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(Context::current()->isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+    #endif
+    {
+        buffer.setData({nullptr, size}, usage);
+
+        /* Write directly into the mapped memory, if possible */
+        if(char* const data = buffer.map<char>(0, size, Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer)) {
+            write({data, size});
+            if(buffer.unmap()) return;
+        }
+    }
+
+    /* Mapping is not supported or the data got corrupted while mapped,
+       upload them from a temporary */
+    interleaveIntoBufferUpload(buffer, usage, size, write);
+}
+
+void interleaveIntoBufferUpload(Buffer& buffer, const BufferUsage usage, const std::size_t size, const std::function<void(Containers::ArrayView<char>)>& write) {
+    Containers::Array<char> data{size};
+    write(data);
+    buffer.setData(data, usage);
+}
+#endif
+
+}}}
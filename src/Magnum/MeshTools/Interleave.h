@@ -26,14 +26,19 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto()
+ * @brief Function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto(), @ref Magnum::MeshTools::interleaveIntoParallel()
  */
 
+#include <cstdint>
 #include <cstring>
+#include <functional>
+#include <iterator>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Assert.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -68,24 +73,88 @@ struct Stride {
     constexpr std::size_t operator()() const { return 0; }
 };
 
-/* Copy data to the buffer */
-template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type writeOneInterleaved(std::size_t stride, char* startingOffset, const T& attributeList) {
+/* Copy one attribute from contiguous memory to strided destination. The
+   common attribute sizes have the copy spelled out with fixed-size integer
+   moves, so the loop doesn't end up calling memcpy() for each element. */
+template<std::size_t size> struct StridedCopy {
+    static void copy(char* out, std::size_t stride, const char* in, std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i, out += stride, in += size)
+            std::memcpy(out, in, size);
+    }
+};
+template<> struct StridedCopy<8> {
+    static void copy(char* out, std::size_t stride, const char* in, std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i, out += stride, in += 8) {
+            std::uint64_t a;
+            std::memcpy(&a, in, 8);
+            std::memcpy(out, &a, 8);
+        }
+    }
+};
+template<> struct StridedCopy<12> {
+    static void copy(char* out, std::size_t stride, const char* in, std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i, out += stride, in += 12) {
+            std::uint64_t a;
+            UnsignedInt b;
+            std::memcpy(&a, in, 8);
+            std::memcpy(&b, in + 8, 4);
+            std::memcpy(out, &a, 8);
+            std::memcpy(out + 8, &b, 4);
+        }
+    }
+};
+template<> struct StridedCopy<16> {
+    static void copy(char* out, std::size_t stride, const char* in, std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i, out += stride, in += 16) {
+            std::uint64_t a, b;
+            std::memcpy(&a, in, 8);
+            std::memcpy(&b, in + 8, 8);
+            std::memcpy(out, &a, 8);
+            std::memcpy(out + 8, &b, 8);
+        }
+    }
+};
+
+/* Copy data of contiguous containers to the buffer */
+template<class T> auto writeOneInterleavedAttribute(std::size_t stride, char* startingOffset, const T& attributeList, std::size_t begin, std::size_t end, int) -> decltype(attributeList.data(), std::size_t()) {
+    StridedCopy<sizeof(typename T::value_type)>::copy(startingOffset + begin*stride, stride, reinterpret_cast<const char*>(attributeList.data() + begin), end - begin);
+
+    return sizeof(typename T::value_type);
+}
+
+/* Copy data of other containers to the buffer */
+template<class T> std::size_t writeOneInterleavedAttribute(std::size_t stride, char* startingOffset, const T& attributeList, std::size_t begin, std::size_t end, long) {
     auto it = attributeList.begin();
-    for(std::size_t i = 0; i != attributeList.size(); ++i, ++it)
+    std::advance(it, begin);
+    for(std::size_t i = begin; i != end; ++i, ++it)
         std::memcpy(startingOffset + i*stride, reinterpret_cast<const char*>(&*it), sizeof(typename T::value_type));
 
     return sizeof(typename T::value_type);
 }
 
+/* Copy data to the buffer */
+template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type writeOneInterleaved(std::size_t stride, char* startingOffset, const T& attributeList, std::size_t begin, std::size_t end) {
+    return writeOneInterleavedAttribute(stride, startingOffset, attributeList, begin, end, 0);
+}
+
 /* Skip gap */
-constexpr std::size_t writeOneInterleaved(std::size_t, char*, std::size_t gap) { return gap; }
+constexpr std::size_t writeOneInterleaved(std::size_t, char*, std::size_t gap, std::size_t, std::size_t) { return gap; }
 
-/* Write interleaved data */
-inline void writeInterleaved(std::size_t, char*) {}
-template<class T, class ...U> void writeInterleaved(std::size_t stride, char* startingOffset, const T& first, const U&... next) {
-    writeInterleaved(stride, startingOffset + writeOneInterleaved(stride, startingOffset, first), next...);
+/* Write interleaved data of vertices in range [begin, end) */
+inline void writeInterleaved(std::size_t, char*, std::size_t, std::size_t) {}
+template<class T, class ...U> void writeInterleaved(std::size_t stride, char* startingOffset, std::size_t begin, std::size_t end, const T& first, const U&... next) {
+    writeInterleaved(stride, startingOffset + writeOneInterleaved(stride, startingOffset, first, begin, end), begin, end, next...);
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+/* Maps the buffer for writing and calls @p write on the mapped range, falls
+   back to interleaveIntoBufferUpload() if mapping is not supported or fails */
+MAGNUM_MESHTOOLS_EXPORT void interleaveIntoBuffer(Buffer& buffer, BufferUsage usage, std::size_t size, const std::function<void(Containers::ArrayView<char>)>& write);
+
+/* Calls @p write on a temporary and uploads it to the buffer */
+MAGNUM_MESHTOOLS_EXPORT void interleaveIntoBufferUpload(Buffer& buffer, BufferUsage usage, std::size_t size, const std::function<void(Containers::ArrayView<char>)>& write);
+#endif
+
 }
 
 /**
@@ -128,7 +197,7 @@ would be 21 bytes, causing possible performance loss.
     for) and function `size()` returning count of elements. In most cases it
     will be `std::vector` or `std::array`.
 
-@see @ref interleaveInto()
+@see @ref interleaveInto(), @ref interleaveIntoParallel()
 @todo remove `std::enable_if` when deprecated overloads are removed
 */
 /* enable_if to avoid clash with overloaded function below */
@@ -142,7 +211,7 @@ template<class T, class ...U> typename std::enable_if<!std::is_same<T, Mesh>::va
     /* Create output buffer only if we have some attributes */
     if(attributeCount && attributeCount != ~std::size_t(0)) {
         Containers::Array<char> data = Containers::Array<char>::zeroInitialized(attributeCount*stride);
-        Implementation::writeInterleaved(stride, data.begin(), first, next...);
+        Implementation::writeInterleaved(stride, data.begin(), 0, attributeCount, first, next...);
 
         return data;
 
@@ -158,9 +227,16 @@ buffer and leaves gaps untouched instead of zero-initializing them. This
 function can thus be used for interleaving data depending on runtime
 parameters.
 
+Attribute containers with contiguous storage (i.e. having `data()` and
+`size()`) are copied with loops specialized for common attribute sizes, so
+writing into e.g. a @ref Buffer::map() "mapped buffer" is not slower than
+@ref interleave().
+
 @attention Similarly to @ref interleave(), this function expects that all
     arrays have the same size. The passed buffer must also be large enough to
     contain the interleaved data.
+@see @ref interleaveIntoParallel(),
+    @ref interleaveInto(Buffer&, BufferUsage, const T&, const U&...)
 */
 template<class T, class ...U> void interleaveInto(Containers::ArrayView<char> buffer, const T& first, const U&... next) {
     /* Verify expected buffer size */
@@ -169,9 +245,67 @@ template<class T, class ...U> void interleaveInto(Containers::ArrayView<char> bu
     CORRADE_ASSERT(attributeCount*stride <= buffer.size(), "MeshTools::interleaveInto(): the data buffer is too small, expected" << attributeCount*stride << "but got" << buffer.size(), );
 
     /* Write data */
-    Implementation::writeInterleaved(stride, buffer.begin(), first, next...);
+    if(attributeCount != ~std::size_t(0))
+        Implementation::writeInterleaved(stride, buffer.begin(), 0, attributeCount, first, next...);
 }
 
+/**
+@brief Interleave vertex attributes into existing buffer in parallel
+
+Same as @ref interleaveInto(Containers::ArrayView<char>, const T&, const U&...),
+but splits the vertex range into @p threadCount consecutive parts and
+interleaves each of them in a separate thread. If @p threadCount is `0`,
+hardware concurrency is used. Small meshes are not split to avoid the
+threading overhead. Attribute containers with contiguous storage (i.e. having
+`data()` and `size()`) are the most efficient, for other containers the
+iterators have to be advanced to the beginning of each range.
+*/
+template<class T, class ...U> void interleaveIntoParallel(Containers::ArrayView<char> buffer, std::size_t threadCount, const T& first, const U&... next) {
+    /* Verify expected buffer size */
+    const std::size_t attributeCount = Implementation::AttributeCount{}(first, next...);
+    const std::size_t stride = Implementation::Stride{}(first, next...);
+    CORRADE_ASSERT(attributeCount*stride <= buffer.size(), "MeshTools::interleaveIntoParallel(): the data buffer is too small, expected" << attributeCount*stride << "but got" << buffer.size(), );
+
+    /* Write data */
+    if(attributeCount != ~std::size_t(0))
+        Magnum::Implementation::parallelFor(attributeCount, threadCount, 16384, [&](std::size_t begin, std::size_t end) {
+            Implementation::writeInterleaved(stride, buffer.begin(), begin, end, first, next...);
+        });
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+/**
+@brief Interleave vertex attributes directly into a buffer
+
+Sets @p buffer storage to size of the interleaved data with given @p usage,
+maps it for writing and interleaves the attributes directly into the mapped
+memory. Compared to passing output of @ref interleave() to
+@ref Buffer::setData() this avoids one allocation and one full copy of the
+data, which is useful mainly for streaming dynamic meshes. If the buffer
+cannot be mapped (i.e. @extension{ARB,map_buffer_range} in OpenGL or
+@es_extension{EXT,map_buffer_range} in OpenGL ES 2.0 is not available or the
+data got corrupted while mapped), the data are interleaved into a temporary
+array and uploaded with @ref Buffer::setData(). Gaps are left uninitialized.
+@code
+Buffer vertexBuffer;
+MeshTools::interleaveInto(vertexBuffer, BufferUsage::DynamicDraw, positions, normals);
+@endcode
+
+@requires_gles Buffer mapping is not available in WebGL, use
+    @ref interleave() and @ref Buffer::setData() instead.
+@see @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+*/
+template<class T, class ...U> void interleaveInto(Buffer& buffer, BufferUsage usage, const T& first, const U&... next) {
+    const std::size_t attributeCount = Implementation::AttributeCount{}(first, next...);
+    const std::size_t stride = Implementation::Stride{}(first, next...);
+    if(!attributeCount || attributeCount == ~std::size_t(0)) return;
+
+    Implementation::interleaveIntoBuffer(buffer, usage, attributeCount*stride, [&](Containers::ArrayView<char> data) {
+        Implementation::writeInterleaved(stride, data.begin(), 0, attributeCount, first, next...);
+    });
+}
+#endif
+
 }}
 
 #endif
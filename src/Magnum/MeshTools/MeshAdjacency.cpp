@@ -0,0 +1,92 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MeshAdjacency.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/MeshTools/Implementation/Adjacency.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Don't bother spawning threads for less items than this */
+constexpr std::size_t MinParallelRangeSize = 16384;
+
+}
+
+MeshAdjacency::MeshAdjacency(const std::vector<UnsignedInt>& indices, const std::size_t vertexCount, const std::size_t threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::MeshAdjacency: index count is not divisible by 3!", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::MeshAdjacency: index" << index << "out of bounds for" << vertexCount << "vertices", );
+    #endif
+
+    Implementation::buildVertexCorners(indices, vertexCount, _offsets, _corners);
+
+    /* Each half-edge is resolved independently, only reading the shared
+       corner lists */
+    _opposites.resize(indices.size());
+    Magnum::Implementation::parallelFor(indices.size(), threadCount, MinParallelRangeSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt a = indices[i];
+            const UnsignedInt b = indices[next(i)];
+            UnsignedInt opposite = Invalid;
+
+            if(a != b) {
+                /* Half-edges of the same direction, there should be only
+                   this one */
+                UnsignedInt sameCount = 0;
+                for(std::size_t j = _offsets[a]; j != _offsets[a + 1]; ++j)
+                    if(indices[next(_corners[j])] == b) ++sameCount;
+
+                /* Half-edges going back, there should be exactly one */
+                UnsignedInt oppositeCount = 0;
+                for(std::size_t j = _offsets[b]; j != _offsets[b + 1]; ++j) {
+                    const UnsignedInt corner = _corners[j];
+                    if(indices[next(corner)] != a) continue;
+                    opposite = corner;
+                    ++oppositeCount;
+                }
+
+                /* The opposite can be in the same face only if the face is
+                   degenerate */
+                if(sameCount != 1 || oppositeCount != 1 || opposite/3 == i/3)
+                    opposite = Invalid;
+            }
+
+            _opposites[i] = opposite;
+        }
+    });
+}
+
+std::size_t MeshAdjacency::memoryUsage() const {
+    return (_offsets.size() + _corners.size() + _opposites.size())*sizeof(UnsignedInt);
+}
+
+}}
@@ -0,0 +1,187 @@
+#ifndef Magnum_MeshTools_MeshAdjacency_h
+#define Magnum_MeshTools_MeshAdjacency_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::MeshAdjacency
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Triangle mesh adjacency
+
+Compact half-edge structure for topology queries on indexed triangle meshes,
+replacing ad-hoc per-algorithm neighbor lookups. The structure doesn't copy
+the index array, half-edges and corners are identified directly by position
+in it:
+
+-   Face @f$ f @f$ consists of corners (and half-edges) @f$ 3f @f$,
+    @f$ 3f + 1 @f$ and @f$ 3f + 2 @f$, vertex of corner @f$ c @f$ is
+    `indices[c]`.
+-   Half-edge @f$ h @f$ goes from vertex of corner @f$ h @f$ to vertex of
+    corner @ref next() "next(h)".
+
+Queries for faces around a vertex (@ref vertexCorners()), opposite half-edge
+(@ref opposite()) and face neighbors (@ref adjacentFace()) are all
+@f$ \mathcal{O}(1) @f$. Example usage, collecting faces neighboring the first
+one:
+@code
+std::vector<UnsignedInt> indices;
+MeshTools::MeshAdjacency adjacency{indices, vertexCount};
+
+for(UnsignedInt i = 0; i != 3; ++i) {
+    const UnsignedInt face = adjacency.adjacentFace(0, i);
+    if(face == MeshTools::MeshAdjacency::Invalid) continue;
+    // ...
+}
+@endcode
+
+@section MeshTools-MeshAdjacency-memory Memory usage
+
+The structure stores vertex-to-corner adjacency in compressed sparse row
+format (one 32-bit offset per vertex, one 32-bit corner index per corner) and
+one 32-bit opposite half-edge index per half-edge. That is 24 bytes per
+triangle plus 4 bytes per vertex, which for closed manifold meshes (where
+there are roughly twice as many triangles as vertices) gives ~26 bytes per
+triangle. Use @ref memoryUsage() to get the exact value.
+
+@section MeshTools-MeshAdjacency-manifold Boundaries and non-manifold edges
+
+Half-edge has an opposite only if the mesh contains exactly one half-edge in
+opposite direction and exactly one half-edge in the same direction between
+given two vertices. Boundary edges, non-manifold edges shared by more than two
+faces, edges between inconsistently oriented faces, degenerate edges
+connecting the same vertex and edges of degenerate faces that would be
+opposite to each other have no opposite and @ref opposite() returns
+@ref Invalid for them. The relation is symmetric, i.e.
+`opposite(opposite(h)) == h` for all half-edges that have an opposite.
+
+@section MeshTools-MeshAdjacency-performance Performance
+
+The vertex-to-corner adjacency is built using a linear counting sort, the
+opposite half-edges are then found by going through the (usually very short)
+corner lists of both edge vertices, distributed across multiple threads.
+@see @ref generateSmoothNormals(), @ref tipsify()
+*/
+class MAGNUM_MESHTOOLS_EXPORT MeshAdjacency {
+    public:
+        enum: UnsignedInt {
+            /** Invalid face or half-edge index */
+            Invalid = ~UnsignedInt{}
+        };
+
+        /**
+         * @brief Half-edge following given one in the same face
+         *
+         * Counterclockwise for counterclockwise-wound faces.
+         */
+        static UnsignedInt next(UnsignedInt halfEdge) {
+            return halfEdge%3 == 2 ? halfEdge - 2 : halfEdge + 1;
+        }
+
+        /** @brief Half-edge preceding given one in the same face */
+        static UnsignedInt previous(UnsignedInt halfEdge) {
+            return halfEdge%3 == 0 ? halfEdge + 2 : halfEdge - 1;
+        }
+
+        /**
+         * @brief Constructor
+         * @param indices       Array of triangle face indices
+         * @param vertexCount   Vertex count. All indices are expected to be
+         *      smaller than this value.
+         * @param threadCount   Thread count. If `0`, hardware concurrency is
+         *      used.
+         *
+         * The index count is expected to be divisible by 3.
+         */
+        explicit MeshAdjacency(const std::vector<UnsignedInt>& indices, std::size_t vertexCount, std::size_t threadCount = 0);
+
+        /** @brief Vertex count */
+        std::size_t vertexCount() const { return _offsets.size() - 1; }
+
+        /** @brief Face count */
+        std::size_t faceCount() const { return _opposites.size()/3; }
+
+        /** @brief Half-edge count */
+        std::size_t halfEdgeCount() const { return _opposites.size(); }
+
+        /**
+         * @brief Corners of given vertex
+         *
+         * Sorted by corner index. Face containing given corner is the corner
+         * index divided by 3, i.e. for manifold meshes the count of corners
+         * is the count of faces around the vertex.
+         */
+        Containers::ArrayView<const UnsignedInt> vertexCorners(UnsignedInt vertex) const {
+            return {_corners.data() + _offsets[vertex], _offsets[vertex + 1] - _offsets[vertex]};
+        }
+
+        /**
+         * @brief Opposite half-edge
+         *
+         * Half-edge going in opposite direction between the same two vertices
+         * in neighboring face or @ref Invalid if the edge is on boundary or is
+         * non-manifold.
+         */
+        UnsignedInt opposite(UnsignedInt halfEdge) const {
+            return _opposites[halfEdge];
+        }
+
+        /** @brief Whether given half-edge has no opposite */
+        bool isBoundary(UnsignedInt halfEdge) const {
+            return _opposites[halfEdge] == Invalid;
+        }
+
+        /**
+         * @brief Face adjacent to given face
+         * @param face      Face index
+         * @param edge      Edge in the face, from `0` to `2`. Edge `i` goes
+         *      from `i`-th to `(i + 1)%3`-th vertex of the face.
+         *
+         * Returns @ref Invalid if the face has no neighbor across given edge.
+         */
+        UnsignedInt adjacentFace(UnsignedInt face, UnsignedInt edge) const {
+            const UnsignedInt opposite = _opposites[face*3 + edge];
+            return opposite == Invalid ? Invalid : opposite/3;
+        }
+
+        /** @brief Memory used by the structure in bytes */
+        std::size_t memoryUsage() const;
+
+    private:
+        std::vector<UnsignedInt> _offsets, _corners, _opposites;
+};
+
+}}
+
+#endif
@@ -0,0 +1,390 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCodec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Implementation/Simd.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* First two bytes of encoded data, format identifier and version */
+constexpr char IndexHeader[]{'I', 1};
+constexpr char VertexHeader[]{'V', 1};
+
+/* Vertices are encoded in blocks to keep the decoded byte planes in cache,
+   the deltas in each block are packed in groups */
+constexpr std::size_t BlockSize = 256;
+constexpr std::size_t GroupSize = 16;
+constexpr std::size_t MaxStride = 256;
+
+/* LEB128, at most five bytes as the values have at most 34 bits */
+void writeVarint(std::vector<char>& out, std::uint64_t value) {
+    while(value >= 0x80) {
+        out.push_back(char(value|0x80));
+        value >>= 7;
+    }
+    out.push_back(char(value));
+}
+
+inline bool readVarint(const char*& in, const char* const end, std::uint64_t& value) {
+    value = 0;
+    for(UnsignedInt shift = 0; shift != 35 && in != end; shift += 7) {
+        const UnsignedByte byte = *in++;
+        value |= std::uint64_t(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+inline UnsignedInt zigzag(const Int value) {
+    return (UnsignedInt(value) << 1)^UnsignedInt(value >> 31);
+}
+
+inline Int unzigzag(const UnsignedInt value) {
+    return Int(value >> 1)^-Int(value & 1);
+}
+
+inline UnsignedByte zigzag(const UnsignedByte value) {
+    return UnsignedByte(value << 1)^UnsignedByte(Byte(value) >> 7);
+}
+
+inline UnsignedByte unzigzag(const UnsignedByte value) {
+    return UnsignedByte(value >> 1)^UnsignedByte(-(value & 1));
+}
+
+/* Bits per value for each group mode */
+constexpr UnsignedInt GroupBits[]{0, 2, 4, 8};
+
+template<class T> bool decodeIndicesInto(const char* in, const char* const end, const std::size_t count, const UnsignedInt max, T* const out) {
+    /* The last three indices, the oldest being at the same corner of previous
+       triangle as the current one */
+    UnsignedInt previous[3]{};
+    for(std::size_t i = 0; i != count; ++i) {
+        std::uint64_t code;
+        if(!readVarint(in, end, code) || (code & 3) == 3 || code >> 34) return false;
+
+        const UnsignedInt index = previous[(i + 2 - (code & 3))%3] + UnsignedInt(unzigzag(UnsignedInt(code >> 2)));
+        if(index > max) return false;
+
+        out[i] = T(index);
+        previous[i%3] = index;
+    }
+
+    return in == end;
+}
+
+/* Unpacks one column of a block into 16-byte aligned plane */
+bool decodeColumn(const char*& in, const char* const end, const std::size_t groupCount, UnsignedByte* const out) {
+    const std::size_t headerSize = (groupCount + 3)/4;
+    if(std::size_t(end - in) < headerSize) return false;
+    const UnsignedByte* const header = reinterpret_cast<const UnsignedByte*>(in);
+    in += headerSize;
+
+    for(std::size_t group = 0; group != groupCount; ++group) {
+        const UnsignedInt bits = GroupBits[(header[group/4] >> (group%4*2)) & 3];
+        const std::size_t size = GroupSize*bits/8;
+        if(std::size_t(end - in) < size) return false;
+
+        UnsignedByte* const values = out + group*GroupSize;
+        const UnsignedByte* const packed = reinterpret_cast<const UnsignedByte*>(in);
+        in += size;
+
+        #ifdef MAGNUM_MATH_SSE2
+        const __m128i mask2 = _mm_set1_epi8(0x03);
+        const __m128i mask4 = _mm_set1_epi8(0x0f);
+        #endif
+        switch(bits) {
+            case 0:
+                std::memset(values, 0, GroupSize);
+                break;
+            case 2: {
+                #ifdef MAGNUM_MATH_SSE2
+                Int word;
+                std::memcpy(&word, packed, 4);
+                const __m128i x = _mm_cvtsi32_si128(word);
+                const __m128i ab = _mm_unpacklo_epi8(_mm_and_si128(x, mask2), _mm_and_si128(_mm_srli_epi16(x, 2), mask2));
+                const __m128i cd = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(x, 4), mask2), _mm_and_si128(_mm_srli_epi16(x, 6), mask2));
+                _mm_store_si128(reinterpret_cast<__m128i*>(values), _mm_unpacklo_epi16(ab, cd));
+                #else
+                for(std::size_t i = 0; i != GroupSize; ++i)
+                    values[i] = (packed[i/4] >> (i%4*2)) & 0x03;
+                #endif
+            } break;
+            case 4: {
+                #ifdef MAGNUM_MATH_SSE2
+                const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(packed));
+                _mm_store_si128(reinterpret_cast<__m128i*>(values), _mm_unpacklo_epi8(_mm_and_si128(x, mask4), _mm_and_si128(_mm_srli_epi16(x, 4), mask4)));
+                #else
+                for(std::size_t i = 0; i != GroupSize; ++i)
+                    values[i] = (packed[i/2] >> (i%2*4)) & 0x0f;
+                #endif
+            } break;
+            case 8:
+                std::memcpy(values, packed, GroupSize);
+                break;
+        }
+    }
+
+    return true;
+}
+
+#ifdef MAGNUM_MATH_SSE2
+/* Transposes 16x16 byte matrix by interleaving the rows four times */
+inline void transpose16(__m128i* const rows) {
+    __m128i temporary[16];
+    for(std::size_t pass = 0; pass != 4; ++pass) {
+        for(std::size_t i = 0; i != 8; ++i) {
+            temporary[2*i] = _mm_unpacklo_epi8(rows[i], rows[i + 8]);
+            temporary[2*i + 1] = _mm_unpackhi_epi8(rows[i], rows[i + 8]);
+        }
+        for(std::size_t i = 0; i != 16; ++i) rows[i] = temporary[i];
+    }
+}
+
+inline __m128i unzigzag(const __m128i value) {
+    const __m128i one = _mm_set1_epi8(1);
+    return _mm_xor_si128(
+        _mm_and_si128(_mm_srli_epi16(value, 1), _mm_set1_epi8(0x7f)),
+        _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(value, one)));
+}
+#endif
+
+}
+
+Containers::Array<char> encodeIndices(const std::vector<UnsignedInt>& indices) {
+    std::vector<char> out{IndexHeader, IndexHeader + sizeof(IndexHeader)};
+    out.reserve(indices.size() + 16);
+
+    UnsignedInt min = ~UnsignedInt{}, max = 0;
+    for(const UnsignedInt index: indices) {
+        if(index < min) min = index;
+        if(index > max) max = index;
+    }
+    writeVarint(out, indices.size());
+    writeVarint(out, indices.empty() ? 0 : min);
+    writeVarint(out, max);
+
+    /* Difference to one of the three previous indices, whichever is the
+       smallest, the lowest two bits say which one is used */
+    UnsignedInt previous[3]{};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt index = indices[i];
+        std::uint64_t code = ~std::uint64_t{};
+        for(UnsignedInt back = 0; back != 3; ++back) {
+            const std::uint64_t candidate = (std::uint64_t(zigzag(Int(index - previous[(i + 2 - back)%3]))) << 2)|back;
+            if(candidate < code) code = candidate;
+        }
+        writeVarint(out, code);
+        previous[i%3] = index;
+    }
+
+    Containers::Array<char> data{out.size()};
+    std::memcpy(data.data(), out.data(), out.size());
+    return data;
+}
+
+std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> decodeIndices(const Containers::ArrayView<const char> data) {
+    const char* in = data.data();
+    const char* const end = in + data.size();
+    std::uint64_t count, min, max;
+    if(data.size() < sizeof(IndexHeader) || std::memcmp(in, IndexHeader, sizeof(IndexHeader)) != 0) {
+        Error() << "MeshTools::decodeIndices(): invalid header";
+        return {};
+    }
+    in += sizeof(IndexHeader);
+    /* Each index takes at least one byte */
+    if(!readVarint(in, end, count) || !readVarint(in, end, min) || !readVarint(in, end, max) || count > std::uint64_t(end - in) || min > max || max > ~UnsignedInt{}) {
+        Error() << "MeshTools::decodeIndices(): invalid header";
+        return {};
+    }
+
+    Containers::Array<char> out;
+    Mesh::IndexType type;
+    bool valid;
+    if(max <= 0xff) {
+        out = Containers::Array<char>{std::size_t(count)};
+        type = Mesh::IndexType::UnsignedByte;
+        valid = decodeIndicesInto(in, end, count, max, reinterpret_cast<UnsignedByte*>(out.data()));
+    } else if(max <= 0xffff) {
+        out = Containers::Array<char>{std::size_t(count*2)};
+        type = Mesh::IndexType::UnsignedShort;
+        valid = decodeIndicesInto(in, end, count, max, reinterpret_cast<UnsignedShort*>(out.data()));
+    } else {
+        out = Containers::Array<char>{std::size_t(count*4)};
+        type = Mesh::IndexType::UnsignedInt;
+        valid = decodeIndicesInto(in, end, count, max, reinterpret_cast<UnsignedInt*>(out.data()));
+    }
+
+    if(!valid) {
+        Error() << "MeshTools::decodeIndices(): invalid index data";
+        return {};
+    }
+
+    return std::make_tuple(std::move(out), type, UnsignedInt(min), UnsignedInt(max));
+}
+
+Containers::Array<char> encodeVertices(const Containers::ArrayView<const char> data, const std::size_t stride) {
+    CORRADE_ASSERT(stride && stride <= MaxStride && !(data.size()%stride),
+        "MeshTools::encodeVertices(): expected stride between 1 and 256 and data size divisible by it but got" << stride << "and" << data.size(), nullptr);
+
+    const std::size_t count = data.size()/stride;
+    const UnsignedByte* const vertices = reinterpret_cast<const UnsignedByte*>(data.data());
+    std::vector<char> out{VertexHeader, VertexHeader + sizeof(VertexHeader)};
+    out.reserve(data.size() + 16);
+    writeVarint(out, count);
+    writeVarint(out, stride);
+
+    UnsignedByte values[BlockSize];
+    for(std::size_t blockBegin = 0; blockBegin < count; blockBegin += BlockSize) {
+        const std::size_t blockSize = std::min(BlockSize, count - blockBegin);
+        const std::size_t groupCount = (blockSize + GroupSize - 1)/GroupSize;
+
+        for(std::size_t k = 0; k != stride; ++k) {
+            /* Zigzagged byte difference to previous vertex, the last group is
+               padded with zeros */
+            std::fill_n(values, groupCount*GroupSize, 0);
+            for(std::size_t i = 0; i != blockSize; ++i) {
+                const std::size_t vertex = blockBegin + i;
+                const UnsignedByte previous = vertex ? vertices[(vertex - 1)*stride + k] : 0;
+                values[i] = zigzag(UnsignedByte(vertices[vertex*stride + k] - previous));
+            }
+
+            const std::size_t header = out.size();
+            out.resize(out.size() + (groupCount + 3)/4);
+            for(std::size_t group = 0; group != groupCount; ++group) {
+                const UnsignedByte* const groupValues = values + group*GroupSize;
+                UnsignedByte bits = 0;
+                for(std::size_t i = 0; i != GroupSize; ++i) bits |= groupValues[i];
+                const UnsignedInt mode = bits == 0 ? 0 : bits < 0x04 ? 1 : bits < 0x10 ? 2 : 3;
+                out[header + group/4] |= char(mode << (group%4*2));
+
+                const UnsignedInt valueBits = GroupBits[mode];
+                for(std::size_t i = 0; valueBits && i != GroupSize; i += 8/valueBits) {
+                    UnsignedByte byte = 0;
+                    for(std::size_t j = 0; j != 8/valueBits; ++j)
+                        byte |= groupValues[i + j] << (j*valueBits);
+                    out.push_back(char(byte));
+                }
+            }
+        }
+    }
+
+    Containers::Array<char> encoded{out.size()};
+    std::memcpy(encoded.data(), out.data(), out.size());
+    return encoded;
+}
+
+Containers::Array<char> decodeVertices(const Containers::ArrayView<const char> data) {
+    const char* in = data.data();
+    const char* const end = in + data.size();
+    std::uint64_t count, stride;
+    if(data.size() < sizeof(VertexHeader) || std::memcmp(in, VertexHeader, sizeof(VertexHeader)) != 0) {
+        Error() << "MeshTools::decodeVertices(): invalid header";
+        return nullptr;
+    }
+    in += sizeof(VertexHeader);
+    /* Each column of each block takes at least one byte */
+    if(!readVarint(in, end, count) || !readVarint(in, end, stride) || !stride || stride > MaxStride || (count + BlockSize - 1)/BlockSize*stride > std::uint64_t(end - in)) {
+        Error() << "MeshTools::decodeVertices(): invalid header";
+        return nullptr;
+    }
+
+    Containers::Array<char> out{std::size_t(count*stride)};
+    UnsignedByte* const vertices = reinterpret_cast<UnsignedByte*>(out.data());
+    #ifdef MAGNUM_MATH_SSE2
+    UnsignedByte* const verticesEnd = vertices + out.size();
+    #endif
+
+    /* Byte planes of one block, padded to whole groups of 16 columns with
+       zeros, and the last decoded vertex */
+    const std::size_t paddedStride = (stride + 15) & ~std::size_t(15);
+    std::vector<UnsignedByte> planeStorage(paddedStride*BlockSize + 15);
+    UnsignedByte* const planes = reinterpret_cast<UnsignedByte*>((reinterpret_cast<std::uintptr_t>(planeStorage.data()) + 15) & ~std::uintptr_t(15));
+    UnsignedByte last[MaxStride]{};
+
+    for(std::size_t blockBegin = 0; blockBegin < count; blockBegin += BlockSize) {
+        const std::size_t blockSize = std::min<std::size_t>(BlockSize, count - blockBegin);
+        const std::size_t groupCount = (blockSize + GroupSize - 1)/GroupSize;
+
+        for(std::size_t k = 0; k != stride; ++k) if(!decodeColumn(in, end, groupCount, planes + k*BlockSize)) {
+            Error() << "MeshTools::decodeVertices(): invalid vertex data";
+            return nullptr;
+        }
+
+        #ifdef MAGNUM_MATH_SSE2
+        /* Sixteen columns at once, starting from the last (partial) one. A
+           partial group writes past the vertex, but the overwritten bytes
+           belong to following vertices or preceding columns, which are written
+           later. */
+        for(std::size_t k = paddedStride; k != 0; ) {
+            k -= GroupSize;
+            __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last + k));
+            for(std::size_t group = 0; group != groupCount; ++group) {
+                __m128i rows[16];
+                for(std::size_t i = 0; i != 16; ++i)
+                    rows[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(planes + (k + i)*BlockSize + group*GroupSize));
+                transpose16(rows);
+
+                const std::size_t groupEnd = std::min(GroupSize, blockSize - group*GroupSize);
+                for(std::size_t i = 0; i != groupEnd; ++i) {
+                    previous = _mm_add_epi8(previous, unzigzag(rows[i]));
+                    UnsignedByte* const vertex = vertices + (blockBegin + group*GroupSize + i)*stride + k;
+                    if(verticesEnd - vertex >= 16)
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(vertex), previous);
+                    else {
+                        alignas(16) UnsignedByte bytes[16];
+                        _mm_store_si128(reinterpret_cast<__m128i*>(bytes), previous);
+                        std::memcpy(vertex, bytes, verticesEnd - vertex);
+                    }
+                }
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(last + k), previous);
+        }
+        #else
+        for(std::size_t i = 0; i != blockSize; ++i) {
+            UnsignedByte* const vertex = vertices + (blockBegin + i)*stride;
+            for(std::size_t k = 0; k != stride; ++k)
+                vertex[k] = last[k] += unzigzag(planes[k*BlockSize + i]);
+        }
+        #endif
+    }
+
+    if(in != end) {
+        Error() << "MeshTools::decodeVertices(): invalid vertex data";
+        return nullptr;
+    }
+
+    return out;
+}
+
+}}
@@ -0,0 +1,129 @@
+#ifndef Magnum_MeshTools_MeshCodec_h
+#define Magnum_MeshTools_MeshCodec_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::encodeIndices(), @ref Magnum::MeshTools::decodeIndices(), @ref Magnum::MeshTools::encodeVertices(), @ref Magnum::MeshTools::decodeVertices()
+ */
+
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Encode index array
+@param indices  Index array
+
+Losslessly compresses the index array for storage or transfer. Each index is
+stored as a variable-length difference to one of the three previous indices,
+whichever is the closest. This catches shared edges of adjacent triangles as
+well as triangle fans and strips stored as lists, which are common after
+@ref tipsify() or @ref sortTrianglesSpatially(), in which case most indices
+take a single byte. The result is usually further compressible with general-purpose compression.
+@see @ref decodeIndices(), @ref encodeVertices()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const std::vector<UnsignedInt>& indices);
+
+/**
+@brief Decode index array
+@param data     Data produced by @ref encodeIndices()
+@return Index data, type and range, or empty array on error
+
+The indices are decoded directly into the smallest type able to hold them, the
+same as with @ref compressIndices(), so the output can be uploaded as-is:
+@code
+Containers::Array<char> data;
+
+Containers::Array<char> indexData;
+Mesh::IndexType indexType;
+UnsignedInt indexStart, indexEnd;
+std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::decodeIndices(data);
+
+Buffer indexBuffer;
+indexBuffer.setData(indexData, BufferUsage::StaticDraw);
+@endcode
+
+If the data are truncated or otherwise malformed, prints message to error
+output and returns empty array.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> decodeIndices(Containers::ArrayView<const char> data);
+
+/**
+@brief Encode vertex data
+@param data     Vertex data
+@param stride   Vertex stride
+
+Losslessly compresses interleaved vertex data for storage or transfer. Each
+byte of each vertex is stored as difference to the same byte of previous
+vertex, the differences are then split into byte planes and packed to 0, 2, 4
+or 8 bits per value in groups of 16 vertices. Since the encoding operates on
+bytes, it benefits greatly from quantized attributes --- for example normals
+packed to @ref Magnum::Byte "Byte" or positions packed to normalized
+@ref Magnum::UnsignedShort "UnsignedShort" have mostly small differences
+in the high bytes, which then take almost no space. Vertex order also matters,
+sort the vertices spatially with @ref sortVerticesSpatially() or by first use
+with @ref tipsify() to get better ratio.
+
+Expects that @p stride is at most 256 bytes and that data size is divisible by
+it.
+@see @ref decodeVertices(), @ref encodeIndices(), @ref interleave()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertices(Containers::ArrayView<const char> data, std::size_t stride);
+
+/** @overload */
+template<class T> inline Containers::Array<char> encodeVertices(const std::vector<T>& data) {
+    return encodeVertices({reinterpret_cast<const char*>(data.data()), data.size()*sizeof(T)}, sizeof(T));
+}
+
+/**
+@brief Decode vertex data
+@param data     Data produced by @ref encodeVertices()
+@return Vertex data, or empty array on error
+
+The vertices are decoded into the original interleaved layout, so the output
+can be uploaded as-is:
+@code
+Containers::Array<char> data;
+
+Buffer vertexBuffer;
+vertexBuffer.setData(MeshTools::decodeVertices(data), BufferUsage::StaticDraw);
+@endcode
+
+If Magnum is built with `MAGNUM_TARGET_SIMD` and SSE2 is available, the
+decoding is vectorized, processing 16 vertices at once. If the data are
+truncated or otherwise malformed, prints message to error output and returns
+empty array.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> decodeVertices(Containers::ArrayView<const char> data);
+
+}}
+
+#endif
@@ -0,0 +1,60 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <cmath>
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<std::vector<Math::Vector3<UnsignedShort>>, Matrix4> quantizePositions(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return std::make_tuple(std::vector<Math::Vector3<UnsignedShort>>{}, Matrix4{});
+
+    Vector3 min = positions[0], max = positions[0];
+    for(const Vector3& position: positions) for(std::size_t i = 0; i != 3; ++i) {
+        if(position[i] < min[i]) min[i] = position[i];
+        if(position[i] > max[i]) max[i] = position[i];
+    }
+
+    /* Flat axes are all quantized to zero */
+    const Vector3 extent = max - min;
+    Vector3 scale;
+    for(std::size_t i = 0; i != 3; ++i)
+        scale[i] = extent[i] > 0.0f ? 65535.0f/extent[i] : 0.0f;
+
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    quantized.reserve(positions.size());
+    for(const Vector3& position: positions) {
+        const Vector3 scaled = (position - min)*scale;
+        Math::Vector3<UnsignedShort> out;
+        for(std::size_t i = 0; i != 3; ++i)
+            out[i] = UnsignedShort(scaled[i] >= 65535.0f ? 65535 : std::lround(scaled[i]));
+        quantized.push_back(out);
+    }
+
+    return std::make_tuple(std::move(quantized), Matrix4::translation(min)*Matrix4::scaling(extent));
+}
+
+}}
@@ -0,0 +1,71 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantizePositions()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantize positions to 16-bit normalized integers
+@param positions    Positions
+@return Quantized positions and dequantization matrix
+
+Maps the bounding box of @p positions to the full range of
+@ref Magnum::UnsignedShort "UnsignedShort" on each axis. Transforming the
+quantized positions, interpreted as normalized values in range @f$ [0, 1] @f$,
+with the returned matrix gives back the original positions with error at most
+half of the bounding box size divided by 65535 on each axis. Multiply the
+transformation passed to the shader with the matrix to render the quantized
+mesh:
+@code
+std::vector<Math::Vector3<UnsignedShort>> quantized;
+Matrix4 dequantization;
+std::tie(quantized, dequantization) = MeshTools::quantizePositions(positions);
+
+shader.setTransformationMatrix(transformation*dequantization);
+@endcode
+
+As the matrix contains only translation and scaling, it doesn't need to be
+applied to normals, the normal matrix should be calculated from the original
+transformation.
+@see @ref compile(const Trade::MeshData3D&, BufferUsage, PositionQuantization, NormalQuantization, TextureCoordinateQuantization),
+    @ref Math::packOctahedral(), @ref Math::packHalf()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<std::vector<Math::Vector3<UnsignedShort>>, Matrix4> quantizePositions(const std::vector<Vector3>& positions);
+
+}}
+
+#endif
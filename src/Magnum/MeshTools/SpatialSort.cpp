@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SpatialSort.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+constexpr UnsignedInt BitsPerAxis = 10;
+constexpr UnsignedInt AxisMax = (1 << BitsPerAxis) - 1;
+
+/* Spreads lower 10 bits so there are two zero bits between each */
+inline UnsignedInt expandBits(UnsignedInt v) {
+    v = (v*0x00010001u) & 0xFF0000FFu;
+    v = (v*0x00000101u) & 0x0F00F00Fu;
+    v = (v*0x00000011u) & 0xC30C30C3u;
+    v = (v*0x00000005u) & 0x49249249u;
+    return v;
+}
+
+inline UnsignedInt mortonCode(const UnsignedInt x, const UnsignedInt y, const UnsignedInt z) {
+    return (expandBits(x) << 2)|(expandBits(y) << 1)|expandBits(z);
+}
+
+/* Converts the coordinates to transposed Hilbert index and interleaves it,
+   J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004 */
+UnsignedInt hilbertCode(UnsignedInt x, UnsignedInt y, UnsignedInt z) {
+    UnsignedInt X[]{x, y, z};
+
+    /* Inverse undo */
+    for(UnsignedInt q = 1 << (BitsPerAxis - 1); q > 1; q >>= 1) {
+        const UnsignedInt p = q - 1;
+        for(UnsignedInt& i: X) {
+            if(i & q) X[0] ^= p;
+            else {
+                const UnsignedInt t = (X[0]^i) & p;
+                X[0] ^= t;
+                i ^= t;
+            }
+        }
+    }
+
+    /* Gray encode */
+    X[1] ^= X[0];
+    X[2] ^= X[1];
+    UnsignedInt t = 0;
+    for(UnsignedInt q = 1 << (BitsPerAxis - 1); q > 1; q >>= 1)
+        if(X[2] & q) t ^= q - 1;
+    for(UnsignedInt& i: X) i ^= t;
+
+    return mortonCode(X[0], X[1], X[2]);
+}
+
+/* Stable LSD radix sort of 30-bit keys, returns permutation */
+std::vector<UnsignedInt> sortedOrder(const std::vector<UnsignedInt>& keys) {
+    std::vector<UnsignedInt> order(keys.size()), temporary(keys.size());
+    for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+
+    UnsignedInt counts[1 << BitsPerAxis];
+    for(UnsignedInt shift = 0; shift != 3*BitsPerAxis; shift += BitsPerAxis) {
+        std::fill_n(counts, 1 << BitsPerAxis, 0);
+        for(const UnsignedInt key: keys) ++counts[(key >> shift) & AxisMax];
+
+        /* Keys consisting only of lower bits have one bucket here, skip */
+        if(counts[(keys.empty() ? 0 : keys[0] >> shift) & AxisMax] == keys.size())
+            continue;
+
+        UnsignedInt offset = 0;
+        for(UnsignedInt& count: counts) {
+            const UnsignedInt c = count;
+            count = offset;
+            offset += c;
+        }
+
+        for(const UnsignedInt i: order)
+            temporary[counts[(keys[i] >> shift) & AxisMax]++] = i;
+        order.swap(temporary);
+    }
+
+    return order;
+}
+
+}
+
+Debug operator<<(Debug debug, const SpaceFillingCurve value) {
+    switch(value) {
+        #define _c(value) case SpaceFillingCurve::value: return debug << "MeshTools::SpaceFillingCurve::" #value;
+        _c(Morton)
+        _c(Hilbert)
+        #undef _c
+    }
+
+    return debug << "MeshTools::SpaceFillingCurve::(invalid)";
+}
+
+std::vector<UnsignedInt> spaceFillingCurveCodes(const std::vector<Vector3>& positions, const SpaceFillingCurve curve) {
+    if(positions.empty()) return {};
+
+    /* Cube around the bounding box, so the curve isn't stretched */
+    Vector3 min = positions[0], max = positions[0];
+    for(const Vector3& position: positions) for(std::size_t i = 0; i != 3; ++i) {
+        if(position[i] < min[i]) min[i] = position[i];
+        if(position[i] > max[i]) max[i] = position[i];
+    }
+    const Float extent = (max - min).max();
+    const Float scale = extent > 0.0f ? AxisMax/extent : 0.0f;
+
+    std::vector<UnsignedInt> codes;
+    codes.reserve(positions.size());
+    for(const Vector3& position: positions) {
+        const Vector3 scaled = (position - min)*scale;
+        UnsignedInt q[3];
+        for(std::size_t i = 0; i != 3; ++i)
+            q[i] = scaled[i] >= Float(AxisMax) ? AxisMax : UnsignedInt(scaled[i]);
+        codes.push_back(curve == SpaceFillingCurve::Hilbert ?
+            hilbertCode(q[0], q[1], q[2]) : mortonCode(q[0], q[1], q[2]));
+    }
+
+    return codes;
+}
+
+std::vector<UnsignedInt> spatialVertexOrder(const std::vector<Vector3>& positions, const SpaceFillingCurve curve) {
+    return sortedOrder(spaceFillingCurveCodes(positions, curve));
+}
+
+std::vector<UnsignedInt> sortVerticesSpatially(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, const SpaceFillingCurve curve) {
+    std::vector<UnsignedInt> order = spatialVertexOrder(positions, curve);
+
+    std::vector<UnsignedInt> remap(order.size());
+    for(std::size_t i = 0; i != order.size(); ++i) remap[order[i]] = i;
+    for(UnsignedInt& index: indices) index = remap[index];
+
+    reorderVertices(positions, order);
+    return order;
+}
+
+void sortTrianglesSpatially(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const SpaceFillingCurve curve) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::sortTrianglesSpatially(): index count is not divisible by 3!", );
+
+    std::vector<Vector3> centroids;
+    centroids.reserve(indices.size()/3);
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        centroids.push_back((positions[indices[i]] + positions[indices[i + 1]] + positions[indices[i + 2]])/3.0f);
+
+    const std::vector<UnsignedInt> order = spatialVertexOrder(centroids, curve);
+    std::vector<UnsignedInt> out;
+    out.reserve(indices.size());
+    for(const UnsignedInt face: order) {
+        out.push_back(indices[face*3]);
+        out.push_back(indices[face*3 + 1]);
+        out.push_back(indices[face*3 + 2]);
+    }
+    indices.swap(out);
+}
+
+}}
@@ -0,0 +1,165 @@
+#ifndef Magnum_MeshTools_SpatialSort_h
+#define Magnum_MeshTools_SpatialSort_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::MeshTools::SpaceFillingCurve, function @ref Magnum::MeshTools::spaceFillingCurveCodes(), @ref Magnum::MeshTools::spatialVertexOrder(), @ref Magnum::MeshTools::sortVerticesSpatially(), @ref Magnum::MeshTools::sortTrianglesSpatially(), @ref Magnum::MeshTools::reorderVertices()
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Space-filling curve
+
+@see @ref spaceFillingCurveCodes()
+*/
+enum class SpaceFillingCurve: UnsignedByte {
+    /**
+     * Z-order curve. Cheapest to calculate, but has long jumps between
+     * octants.
+     */
+    Morton,
+
+    /**
+     * Hilbert curve. Consecutive points on the curve are always neighbors,
+     * which gives better locality at a slightly higher calculation cost.
+     */
+    Hilbert
+};
+
+/** @debugoperatorenum{Magnum::MeshTools::SpaceFillingCurve} */
+MAGNUM_MESHTOOLS_EXPORT Debug operator<<(Debug debug, SpaceFillingCurve value);
+
+/**
+@brief Space-filling curve codes of positions
+@param positions    Array of positions
+@param curve        Space-filling curve
+
+Quantizes the positions to 10 bits per axis relative to cube containing
+bounding box of all positions and returns 30-bit index of each quantized
+position along given curve. Positions close to each other in the 3D space
+mostly have close codes.
+@see @ref spatialVertexOrder()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> spaceFillingCurveCodes(const std::vector<Vector3>& positions, SpaceFillingCurve curve = SpaceFillingCurve::Morton);
+
+/**
+@brief Spatial order of vertices
+@param positions    Array of positions
+@param curve        Space-filling curve
+@return Original index of each vertex in the new order
+
+Sorts @ref spaceFillingCurveCodes() using a radix sort. The sort is stable, so
+vertices with the same code keep their original relative order. Use
+@ref reorderVertices() to reorder vertex data using the returned array.
+@see @ref sortVerticesSpatially()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> spatialVertexOrder(const std::vector<Vector3>& positions, SpaceFillingCurve curve = SpaceFillingCurve::Morton);
+
+/**
+@brief Reorder vertex data
+@param[in,out] data Vertex data
+@param order        Original index of each vertex in the new order, e.g.
+    returned by @ref spatialVertexOrder()
+
+Expects that @p data has the same size as @p order.
+*/
+template<class T> void reorderVertices(std::vector<T>& data, const std::vector<UnsignedInt>& order) {
+    CORRADE_ASSERT(data.size() == order.size(), "MeshTools::reorderVertices(): expected" << order.size() << "items but got" << data.size(), );
+
+    std::vector<T> out;
+    out.reserve(data.size());
+    for(const UnsignedInt i: order) out.push_back(data[i]);
+    data.swap(out);
+}
+
+/**
+@brief Sort vertices spatially
+@param[in,out] indices      Index array to remap
+@param[in,out] positions    Vertex positions to sort
+@param curve                Space-filling curve
+@return Original index of each vertex in the new order
+
+Sorts the vertices along given space-filling curve and remaps @p indices to
+the new order, so vertices close to each other are close also in memory. This
+improves cache locality of all operations going through the vertices, for
+example hash-based welding using @ref removeDuplicates() or normal
+generation, and vertex fetch on the GPU. Other vertex attributes can be
+reordered with the returned array using @ref reorderVertices():
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+
+const std::vector<UnsignedInt> order = MeshTools::sortVerticesSpatially(indices, positions);
+MeshTools::reorderVertices(normals, order);
+@endcode
+
+For non-indexed meshes the vertex reordering would break the faces, sort
+the triangles using @ref sortTrianglesSpatially() instead. Doing that before
+welding the vertices makes lookups into the hash table of
+@ref removeDuplicates() much more coherent:
+@code
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> indices(positions.size());
+std::iota(indices.begin(), indices.end(), 0);
+MeshTools::sortTrianglesSpatially(indices, positions);
+positions = MeshTools::duplicate(indices, positions);
+indices = MeshTools::removeDuplicates(positions);
+@endcode
+@see @ref spatialVertexOrder()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> sortVerticesSpatially(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, SpaceFillingCurve curve = SpaceFillingCurve::Morton);
+
+/**
+@brief Sort triangles spatially
+@param[in,out] indices  Index array to operate on
+@param positions        Vertex positions
+@param curve            Space-filling curve
+
+Sorts the triangles by codes of their centroids along given space-filling
+curve. Vertex order in each triangle is preserved. Improves locality of
+rasterization and of operations going through the faces, such as
+@ref generateSmoothNormals() or @ref Bvh construction. Use
+@ref sortVerticesSpatially() or @ref tipsify() afterwards to also improve
+vertex locality.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT void sortTrianglesSpatially(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, SpaceFillingCurve curve = SpaceFillingCurve::Morton);
+
+}}
+
+#endif
@@ -26,12 +26,15 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::subdivide()
+ * @brief Function @ref Magnum::MeshTools::subdivide(), @ref Magnum::MeshTools::subdivideWelded()
  */
 
+#include <cstdint>
 #include <vector>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Types.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
@@ -71,11 +74,33 @@ template<class Vertex, class Interpolator> class Subdivide {
 
 Goes through all triangle faces and subdivides them into four new. Removing
 duplicate vertices in the mesh is up to user.
+@see @ref subdivideWelded()
 */
 template<class Vertex, class Interpolator> inline void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
 }
 
+/**
+@brief Subdivide the mesh without duplicating vertices on shared edges
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+
+Similar to @ref subdivide(), but the new vertex for each edge is created only
+once and shared by all faces having given edge, so subdividing a welded mesh
+results in welded mesh again and there is no need to call
+@ref removeDuplicates() afterwards. Midpoints are cached in a hash table keyed
+by index pair of the edge, the index and vertex arrays are reallocated only
+once to exact output size, i.e. four times the original index count and
+original vertex count plus edge count. The faces are laid out the same as in
+@ref subdivide(). The interpolator is expected to give the same result
+regardless of order of its arguments.
+*/
+template<class Vertex, class Interpolator> void subdivideWelded(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator);
+
 namespace Implementation {
 
 template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>::operator()(Interpolator interpolator) {
@@ -112,6 +137,82 @@ template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>:
     }
 }
 
+/* Open-addressing hash map from an edge to index of its midpoint vertex */
+class SubdivideEdgeMap {
+    public:
+        /* Edge count is at most index count, keep the load factor below 0.5 */
+        explicit SubdivideEdgeMap(std::size_t indexCount): _mask{1} {
+            while(_mask < indexCount*2) _mask <<= 1;
+            _keys.assign(_mask, ~std::uint64_t{});
+            _values.resize(_mask);
+            _mask -= 1;
+        }
+
+        /* Returns index of the midpoint, adding it as @p next if the edge is
+           not there yet */
+        UnsignedInt insert(UnsignedInt a, UnsignedInt b, UnsignedInt next) {
+            const std::uint64_t key = a < b ? (std::uint64_t(a) << 32)|b : (std::uint64_t(b) << 32)|a;
+            std::size_t i = std::size_t((key*0x9e3779b97f4a7c15ull) >> 32) & _mask;
+            for(;; i = (i + 1) & _mask) {
+                if(_keys[i] == key) return _values[i];
+                if(_keys[i] == ~std::uint64_t{}) {
+                    _keys[i] = key;
+                    return _values[i] = next;
+                }
+            }
+        }
+
+    private:
+        std::size_t _mask;
+        std::vector<std::uint64_t> _keys;
+        std::vector<UnsignedInt> _values;
+};
+
+}
+
+template<class Vertex, class Interpolator> void subdivideWelded(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideWelded(): index count is not divisible by 3!", );
+
+    const std::size_t indexCount = indices.size();
+    const std::size_t vertexCount = vertices.size();
+
+    /* Assign midpoint index to each edge first to know the exact vertex
+       count, the original index array gets replaced by the midpoints */
+    std::vector<UnsignedInt> midpoints(indexCount);
+    UnsignedInt next = vertexCount;
+    {
+        Implementation::SubdivideEdgeMap edges{indexCount};
+        for(std::size_t i = 0; i != indexCount; i += 3) for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i + j];
+            const UnsignedInt b = indices[i + (j + 1)%3];
+            if((midpoints[i + j] = edges.insert(a, b, next)) == next) ++next;
+        }
+    }
+
+    /* Interpolate each edge exactly once */
+    vertices.reserve(next);
+    for(std::size_t i = 0; i != indexCount; ++i) if(midpoints[i] == vertices.size())
+        vertices.push_back(interpolator(vertices[indices[i]], vertices[indices[i - i%3 + (i%3 + 1)%3]]));
+
+    /* Add three new faces for each face and update the original to the
+       middle one, the same layout as in subdivide() */
+    indices.resize(indexCount*4);
+    for(std::size_t i = 0, out = indexCount; i != indexCount; i += 3, out += 9) {
+        const UnsignedInt original[]{indices[i], indices[i + 1], indices[i + 2]};
+        const UnsignedInt* const midpoint = midpoints.data() + i;
+        indices[out + 0] = original[0];
+        indices[out + 1] = midpoint[0];
+        indices[out + 2] = midpoint[2];
+        indices[out + 3] = midpoint[0];
+        indices[out + 4] = original[1];
+        indices[out + 5] = midpoint[1];
+        indices[out + 6] = midpoint[2];
+        indices[out + 7] = midpoint[1];
+        indices[out + 8] = original[2];
+        indices[i + 0] = midpoint[0];
+        indices[i + 1] = midpoint[1];
+        indices[i + 2] = midpoint[2];
+    }
 }
 
 }}
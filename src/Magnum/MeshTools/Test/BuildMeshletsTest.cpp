@@ -0,0 +1,265 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BuildMeshletsTest: TestSuite::Tester {
+    explicit BuildMeshletsTest();
+
+    void wrongIndexCount();
+    void wrongLimits();
+    void empty();
+    void singleTriangle();
+    void limits();
+    void bounds();
+    void disconnected();
+    void statistics();
+};
+
+BuildMeshletsTest::BuildMeshletsTest() {
+    addTests({&BuildMeshletsTest::wrongIndexCount,
+              &BuildMeshletsTest::wrongLimits,
+              &BuildMeshletsTest::empty,
+              &BuildMeshletsTest::singleTriangle,
+              &BuildMeshletsTest::limits,
+              &BuildMeshletsTest::bounds,
+              &BuildMeshletsTest::disconnected,
+              &BuildMeshletsTest::statistics});
+}
+
+namespace {
+
+/* Wavy grid of given size */
+void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    positions.clear();
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x)
+        positions.emplace_back(Float(x), Float(y), Math::sin(Rad(x*0.3f))*Math::cos(Rad(y*0.2f)));
+
+    indices.clear();
+    for(UnsignedInt y = 0; y != size - 1; ++y) for(UnsignedInt x = 0; x != size - 1; ++x) {
+        const UnsignedInt i = y*size + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 1, i, i + size + 1, i + size});
+    }
+}
+
+/* Reconstructs original indices from the meshlets, sorted by face */
+std::vector<UnsignedInt> sortedFaces(const std::vector<Meshlet>& meshlets, const std::vector<UnsignedInt>& vertices, const std::vector<UnsignedByte>& indices) {
+    std::vector<std::array<UnsignedInt, 3>> faces;
+    for(const Meshlet& meshlet: meshlets) for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const UnsignedByte* const triangle = indices.data() + meshlet.indexOffset + i;
+        faces.push_back({{vertices[meshlet.vertexOffset + triangle[0]],
+                          vertices[meshlet.vertexOffset + triangle[1]],
+                          vertices[meshlet.vertexOffset + triangle[2]]}});
+    }
+
+    std::sort(faces.begin(), faces.end());
+    std::vector<UnsignedInt> out;
+    for(const auto& face: faces) out.insert(out.end(), face.begin(), face.end());
+    return out;
+}
+
+std::vector<UnsignedInt> sortedFaces(const std::vector<UnsignedInt>& indices) {
+    std::vector<std::array<UnsignedInt, 3>> faces;
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        faces.push_back({{indices[i], indices[i + 1], indices[i + 2]}});
+
+    std::sort(faces.begin(), faces.end());
+    std::vector<UnsignedInt> out;
+    for(const auto& face: faces) out.insert(out.end(), face.begin(), face.end());
+    return out;
+}
+
+}
+
+void BuildMeshletsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets({0, 1}, {});
+
+    CORRADE_COMPARE(meshlets.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::buildMeshlets(): index count is not divisible by 3!\n");
+}
+
+void BuildMeshletsTest::wrongLimits() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    MeshTools::buildMeshlets({}, {}, 2, 16);
+    MeshTools::buildMeshlets({}, {}, 257, 16);
+    MeshTools::buildMeshlets({}, {}, 64, 0);
+
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::buildMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got 2 and 16\n"
+        "MeshTools::buildMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got 257 and 16\n"
+        "MeshTools::buildMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got 64 and 0\n");
+}
+
+void BuildMeshletsTest::empty() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets({}, {});
+
+    CORRADE_COMPARE(meshlets.size(), 0);
+    CORRADE_COMPARE(vertices.size(), 0);
+    CORRADE_COMPARE(indices.size(), 0);
+}
+
+void BuildMeshletsTest::singleTriangle() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets({3, 1, 0}, {
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 2.0f, 0.0f},
+        {},
+        {2.0f, 0.0f, 0.0f}});
+
+    CORRADE_COMPARE(vertices, (std::vector<UnsignedInt>{3, 1, 0}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedByte>{0, 1, 2}));
+    CORRADE_COMPARE(meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets[0].vertexOffset, 0);
+    CORRADE_COMPARE(meshlets[0].indexOffset, 0);
+    CORRADE_COMPARE(meshlets[0].vertexCount, 3);
+    CORRADE_COMPARE(meshlets[0].triangleCount, 1);
+    CORRADE_COMPARE(meshlets[0].center, (Vector3{1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(meshlets[0].radius, Constants::sqrt2());
+    CORRADE_COMPARE(meshlets[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(meshlets[0].coneCutoff, 0.0f);
+}
+
+void BuildMeshletsTest::limits() {
+    std::vector<UnsignedInt> originalIndices;
+    std::vector<Vector3> positions;
+    grid(32, originalIndices, positions);
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets(originalIndices, positions, 16, 20);
+
+    /* The ranges are contiguous and within limits */
+    UnsignedInt vertexOffset = 0, indexOffset = 0;
+    for(const Meshlet& meshlet: meshlets) {
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.indexOffset, indexOffset);
+        CORRADE_VERIFY(meshlet.vertexCount <= 16);
+        CORRADE_VERIFY(meshlet.triangleCount >= 1);
+        CORRADE_VERIFY(meshlet.triangleCount <= 20);
+        vertexOffset += meshlet.vertexCount;
+        indexOffset += meshlet.triangleCount*3;
+    }
+    CORRADE_COMPARE(vertexOffset, vertices.size());
+    CORRADE_COMPARE(indexOffset, indices.size());
+
+    /* Each face is there exactly once, with the same winding */
+    CORRADE_COMPARE(sortedFaces(meshlets, vertices, indices), sortedFaces(originalIndices));
+}
+
+void BuildMeshletsTest::bounds() {
+    std::vector<UnsignedInt> originalIndices;
+    std::vector<Vector3> positions;
+    grid(32, originalIndices, positions);
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets(originalIndices, positions);
+
+    for(const Meshlet& meshlet: meshlets) {
+        /* All vertices are in the sphere */
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            CORRADE_VERIFY((positions[vertices[meshlet.vertexOffset + i]] - meshlet.center).length() <= meshlet.radius*1.0001f);
+
+        /* All face normals are in the cone */
+        CORRADE_VERIFY(meshlet.coneCutoff < 1.0f);
+        const Float minDot = std::sqrt(1.0f - meshlet.coneCutoff*meshlet.coneCutoff);
+        for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+            const UnsignedByte* const triangle = indices.data() + meshlet.indexOffset + i;
+            const Vector3 a = positions[vertices[meshlet.vertexOffset + triangle[0]]];
+            const Vector3 normal = Math::cross(positions[vertices[meshlet.vertexOffset + triangle[1]]] - a, positions[vertices[meshlet.vertexOffset + triangle[2]]] - a).normalized();
+            CORRADE_VERIFY(Math::dot(normal, meshlet.coneAxis) >= minDot - 0.0001f);
+        }
+    }
+}
+
+void BuildMeshletsTest::disconnected() {
+    /* Triangle soup without any shared vertices, the meshlets are still
+       filled up to the vertex limit */
+    std::vector<UnsignedInt> originalIndices(300);
+    std::vector<Vector3> positions(300);
+    for(UnsignedInt i = 0; i != 300; ++i) {
+        originalIndices[i] = i;
+        positions[i] = {Float(i/3), Float(i%3 == 1), Float(i%3 == 2)};
+    }
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets(originalIndices, positions, 64, 126);
+
+    CORRADE_COMPARE(meshlets.size(), 5);
+    CORRADE_COMPARE(meshlets[0].triangleCount, 21);
+    CORRADE_COMPARE(meshlets[4].triangleCount, 16);
+    CORRADE_COMPARE(sortedFaces(meshlets, vertices, indices), originalIndices);
+}
+
+void BuildMeshletsTest::statistics() {
+    std::vector<UnsignedInt> originalIndices;
+    std::vector<Vector3> positions;
+    grid(256, originalIndices, positions);
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> indices;
+    std::tie(meshlets, vertices, indices) = MeshTools::buildMeshlets(originalIndices, positions);
+
+    const Float averageVertexCount = Float(vertices.size())/meshlets.size();
+    const Float averageTriangleCount = Float(indices.size()/3)/meshlets.size();
+    Debug() << "Meshlet count:" << meshlets.size();
+    Debug() << "Average vertex count:" << averageVertexCount;
+    Debug() << "Average triangle count:" << averageTriangleCount;
+    Debug() << "Vertex transform ratio:" << Float(vertices.size())/positions.size();
+
+    /* Vertex limit is the dominant one for regular meshes */
+    CORRADE_VERIFY(averageVertexCount > 56.0f);
+    CORRADE_VERIFY(averageTriangleCount > 70.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsTest)
@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Bvh.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BvhBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit BvhBenchmark();
+
+    void build();
+    void buildSingleThread();
+    void coherent();
+    void coherentPacket();
+    void coherentPacketSingleThread();
+    void incoherent();
+    void incoherentPacket();
+    void incoherentOccluded();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        std::vector<Vector3> _positions;
+        std::vector<Vector3> _coherentOrigins, _coherentDirections;
+        std::vector<Vector3> _incoherentOrigins, _incoherentDirections;
+};
+
+namespace {
+
+/* Half a million triangles */
+constexpr UnsignedInt GridSize = 512;
+constexpr std::size_t RayCount = 256*256;
+
+}
+
+BvhBenchmark::BvhBenchmark(): AbstractBenchmarkTester{10} {
+    addTests({&BvhBenchmark::build,
+              &BvhBenchmark::buildSingleThread,
+              &BvhBenchmark::coherent,
+              &BvhBenchmark::coherentPacket,
+              &BvhBenchmark::coherentPacketSingleThread,
+              &BvhBenchmark::incoherent,
+              &BvhBenchmark::incoherentPacket,
+              &BvhBenchmark::incoherentOccluded});
+
+    /* Terrain-like wavy grid */
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+        _positions.emplace_back(Float(x), Float(y), 8.0f*Math::sin(Rad(x*0.05f))*Math::cos(Rad(y*0.03f)) + Math::sin(Rad(x*0.7f + y*0.3f)));
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+        const UnsignedInt i = y*GridSize + x;
+        _indices.insert(_indices.end(), {i, i + 1, i + GridSize + 1, i, i + GridSize + 1, i + GridSize});
+    }
+
+    /* Primary rays of a perspective camera looking down at the terrain, in
+       2x2 tiles so neighboring rays end up in one packet */
+    const Vector3 eye{GridSize*0.5f, -GridSize*0.25f, 200.0f};
+    for(std::size_t i = 0; i != RayCount; ++i) {
+        const std::size_t tile = i/4;
+        const Float x = Float((tile%128)*2 + i%2)/256.0f - 0.5f;
+        const Float y = Float((tile/128)*2 + (i/2)%2)/256.0f - 0.5f;
+        _coherentOrigins.push_back(eye);
+        _coherentDirections.push_back(Vector3{x, 0.7f + y*0.5f, -0.7f}.normalized());
+    }
+
+    /* Ambient occlusion rays from points on the surface to all directions
+       in upper hemisphere */
+    for(std::size_t i = 0; i != RayCount; ++i) {
+        const std::size_t vertex = (i*7919)%_positions.size();
+        const Float a = Float(i)*0.618034f;
+        const Rad azimuth(Constants::tau()*(a - Math::floor(a)));
+        const Float height = Float(i%97)/97.0f;
+        const Float radius = std::sqrt(1.0f - height*height);
+        _incoherentOrigins.push_back(_positions[vertex] + Vector3::zAxis(0.01f));
+        _incoherentDirections.emplace_back(Math::cos(azimuth)*radius, Math::sin(azimuth)*radius, height);
+    }
+}
+
+void BvhBenchmark::build() {
+    MAGNUM_BENCHMARK("build, triangles", _indices.size()/3) {
+        Bvh bvh{_indices, _positions};
+        escape(bvh);
+    }
+}
+
+void BvhBenchmark::buildSingleThread() {
+    MAGNUM_BENCHMARK("build, triangles, single thread", _indices.size()/3) {
+        Bvh bvh{_indices, _positions, 1};
+        escape(bvh);
+    }
+}
+
+void BvhBenchmark::coherent() {
+    Bvh bvh{_indices, _positions};
+    MAGNUM_BENCHMARK("coherent rays, single", RayCount) {
+        std::size_t hitCount = 0;
+        for(std::size_t i = 0; i != RayCount; ++i)
+            if(bvh.intersect(_coherentOrigins[i], _coherentDirections[i])) ++hitCount;
+        escape(hitCount);
+    }
+}
+
+void BvhBenchmark::coherentPacket() {
+    Bvh bvh{_indices, _positions};
+    std::vector<Bvh::Hit> hits(RayCount);
+    MAGNUM_BENCHMARK("coherent rays, packets", RayCount) {
+        bvh.intersect({_coherentOrigins.data(), RayCount}, {_coherentDirections.data(), RayCount}, {hits.data(), RayCount});
+        escape(hits.data());
+    }
+}
+
+void BvhBenchmark::coherentPacketSingleThread() {
+    Bvh bvh{_indices, _positions};
+    std::vector<Bvh::Hit> hits(RayCount);
+    MAGNUM_BENCHMARK("coherent rays, packets, single thread", RayCount) {
+        bvh.intersect({_coherentOrigins.data(), RayCount}, {_coherentDirections.data(), RayCount}, {hits.data(), RayCount}, Constants::inf(), 1);
+        escape(hits.data());
+    }
+}
+
+void BvhBenchmark::incoherent() {
+    Bvh bvh{_indices, _positions};
+    MAGNUM_BENCHMARK("incoherent rays, single", RayCount) {
+        std::size_t hitCount = 0;
+        for(std::size_t i = 0; i != RayCount; ++i)
+            if(bvh.intersect(_incoherentOrigins[i], _incoherentDirections[i], 16.0f)) ++hitCount;
+        escape(hitCount);
+    }
+}
+
+void BvhBenchmark::incoherentPacket() {
+    Bvh bvh{_indices, _positions};
+    std::vector<Bvh::Hit> hits(RayCount);
+    MAGNUM_BENCHMARK("incoherent rays, packets", RayCount) {
+        bvh.intersect({_incoherentOrigins.data(), RayCount}, {_incoherentDirections.data(), RayCount}, {hits.data(), RayCount}, 16.0f);
+        escape(hits.data());
+    }
+}
+
+void BvhBenchmark::incoherentOccluded() {
+    Bvh bvh{_indices, _positions};
+    MAGNUM_BENCHMARK("incoherent rays, occlusion", RayCount) {
+        std::size_t hitCount = 0;
+        for(std::size_t i = 0; i != RayCount; ++i)
+            if(bvh.occluded(_incoherentOrigins[i], _incoherentDirections[i], 16.0f)) ++hitCount;
+        escape(hitCount);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BvhBenchmark)
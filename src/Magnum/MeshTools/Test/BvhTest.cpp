@@ -0,0 +1,296 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/MeshTools/Bvh.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BvhTest: TestSuite::Tester {
+    explicit BvhTest();
+
+    void wrongIndexCount();
+    void wrongBatchSize();
+    void empty();
+    void singleTriangle();
+    void nearest();
+    void bruteForce();
+    void occluded();
+    void packet();
+    void parallel();
+    void meshData();
+    void meshDataNotIndexedTriangles();
+};
+
+BvhTest::BvhTest() {
+    addTests({&BvhTest::wrongIndexCount,
+              &BvhTest::wrongBatchSize,
+              &BvhTest::empty,
+              &BvhTest::singleTriangle,
+              &BvhTest::nearest,
+              &BvhTest::bruteForce,
+              &BvhTest::occluded,
+              &BvhTest::packet,
+              &BvhTest::parallel,
+              &BvhTest::meshData,
+              &BvhTest::meshDataNotIndexedTriangles});
+}
+
+namespace {
+
+/* Wavy grid in XY plane */
+void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    positions.clear();
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x)
+        positions.emplace_back(Float(x), Float(y), 2.0f*Math::sin(Rad(x*0.7f))*Math::cos(Rad(y*0.4f)));
+
+    indices.clear();
+    for(UnsignedInt y = 0; y != size - 1; ++y) for(UnsignedInt x = 0; x != size - 1; ++x) {
+        const UnsignedInt i = y*size + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 1, i, i + size + 1, i + size});
+    }
+}
+
+/* Rays from above and from the side of the grid, in various directions */
+void rays(const UnsignedInt size, const std::size_t count, std::vector<Vector3>& origins, std::vector<Vector3>& directions) {
+    origins.clear();
+    directions.clear();
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float a = Float(i)*0.618034f;
+        origins.emplace_back((a - Math::floor(a))*size, Float(i%size), i%3 ? 5.0f : 0.0f);
+        directions.emplace_back(Math::sin(Rad(a*3.0f)), Math::cos(Rad(a*5.0f)), i%3 ? -1.0f : 0.1f*Math::sin(Rad(a)));
+    }
+}
+
+Bvh::Hit intersectBruteForce(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const Vector3& origin, const Vector3& direction) {
+    Bvh::Hit hit{~UnsignedInt{}, Constants::inf(), {}};
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 result = Math::Geometry::Intersection::rayTriangle(origin, direction, positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]]);
+        if(result.x() < 0.0f || result.x() >= hit.distance) continue;
+        hit = {UnsignedInt(i/3), result.x(), {result.y(), result.z()}};
+    }
+    return hit;
+}
+
+}
+
+void BvhTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    Bvh bvh{{0, 1}, {{}, {}}};
+    CORRADE_COMPARE(bvh.triangleCount(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::Bvh: index count is not divisible by 3!\n");
+}
+
+void BvhTest::wrongBatchSize() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    Bvh bvh{{}, {}};
+    const Vector3 origins[3]{};
+    const Vector3 directions[2]{};
+    Bvh::Hit hits[3];
+    bvh.intersect(origins, directions, hits);
+    CORRADE_COMPARE(ss.str(), "MeshTools::Bvh::intersect(): expected 3 directions and hits but got 2 and 3\n");
+}
+
+void BvhTest::empty() {
+    Bvh bvh{{}, {}};
+    CORRADE_COMPARE(bvh.triangleCount(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_VERIFY(!bvh.intersect({}, Vector3::zAxis()));
+    CORRADE_VERIFY(!bvh.occluded({}, Vector3::zAxis()));
+}
+
+void BvhTest::singleTriangle() {
+    Bvh bvh{{2, 0, 1}, {
+        {3.0f, 0.0f, 0.0f},
+        {1.0f, 2.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}}};
+    CORRADE_COMPARE(bvh.triangleCount(), 1);
+    CORRADE_COMPARE(bvh.nodeCount(), 1);
+    CORRADE_COMPARE(bvh.bounds().min(), (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(bvh.bounds().max(), (Vector3{3.0f, 2.0f, 0.0f}));
+
+    const Bvh::Hit hit = bvh.intersect({1.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -0.5f});
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.triangle, 0);
+    CORRADE_COMPARE(hit.distance, 4.0f);
+    CORRADE_COMPARE(hit.barycentric, (Vector2{0.25f, 0.5f}));
+
+    /* Behind the origin, outside, farther than max distance */
+    CORRADE_VERIFY(!bvh.intersect({1.5f, 1.0f, 2.0f}, {0.0f, 0.0f, 1.0f}));
+    CORRADE_VERIFY(!bvh.intersect({2.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -1.0f}));
+    const Bvh::Hit far = bvh.intersect({1.5f, 1.0f, 2.0f}, {0.0f, 0.0f, -0.5f}, 3.5f);
+    CORRADE_VERIFY(!far);
+    CORRADE_COMPARE(far.distance, 3.5f);
+}
+
+void BvhTest::nearest() {
+    /* Two parallel triangles above each other, ray lies in a slab plane of
+       the bounding boxes */
+    Bvh bvh{{0, 1, 2, 3, 4, 5}, {
+        {0.0f, 0.0f, 1.0f},
+        {2.0f, 0.0f, 1.0f},
+        {0.0f, 2.0f, 1.0f},
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}}};
+
+    const Bvh::Hit above = bvh.intersect({0.0f, 0.5f, 3.0f}, {0.0f, 0.0f, -1.0f});
+    CORRADE_COMPARE(above.triangle, 0);
+    CORRADE_COMPARE(above.distance, 2.0f);
+
+    const Bvh::Hit below = bvh.intersect({0.0f, 0.5f, -1.0f}, {0.0f, 0.0f, 1.0f});
+    CORRADE_COMPARE(below.triangle, 1);
+    CORRADE_COMPARE(below.distance, 1.0f);
+
+    const Bvh::Hit between = bvh.intersect({0.0f, 0.5f, 0.5f}, {0.0f, 0.0f, 1.0f});
+    CORRADE_COMPARE(between.triangle, 0);
+    CORRADE_COMPARE(between.distance, 0.5f);
+}
+
+void BvhTest::bruteForce() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(32, indices, positions);
+    std::vector<Vector3> origins, directions;
+    rays(32, 500, origins, directions);
+
+    Bvh bvh{indices, positions};
+    CORRADE_COMPARE(bvh.triangleCount(), indices.size()/3);
+
+    std::size_t hitCount = 0;
+    for(std::size_t i = 0; i != origins.size(); ++i) {
+        const Bvh::Hit expected = intersectBruteForce(indices, positions, origins[i], directions[i]);
+        const Bvh::Hit actual = bvh.intersect(origins[i], directions[i]);
+        CORRADE_COMPARE(actual.triangle, expected.triangle);
+        CORRADE_COMPARE(actual.distance, expected.distance);
+        CORRADE_COMPARE(actual.barycentric, expected.barycentric);
+        if(actual) ++hitCount;
+    }
+
+    /* Verify that the test isn't trivial */
+    CORRADE_VERIFY(hitCount > 250);
+    CORRADE_VERIFY(hitCount < 500);
+}
+
+void BvhTest::occluded() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(32, indices, positions);
+    std::vector<Vector3> origins, directions;
+    rays(32, 500, origins, directions);
+
+    Bvh bvh{indices, positions};
+    for(std::size_t i = 0; i != origins.size(); ++i) {
+        const Bvh::Hit hit = bvh.intersect(origins[i], directions[i]);
+        CORRADE_COMPARE(bvh.occluded(origins[i], directions[i]), !!hit);
+        if(hit) CORRADE_VERIFY(!bvh.occluded(origins[i], directions[i], hit.distance));
+    }
+}
+
+void BvhTest::packet() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(32, indices, positions);
+
+    /* Count not divisible by packet size */
+    std::vector<Vector3> origins, directions;
+    rays(32, 503, origins, directions);
+
+    Bvh bvh{indices, positions};
+    std::vector<Bvh::Hit> hits(origins.size());
+    bvh.intersect({origins.data(), origins.size()}, {directions.data(), directions.size()}, {hits.data(), hits.size()}, 25.0f);
+    for(std::size_t i = 0; i != origins.size(); ++i) {
+        const Bvh::Hit expected = bvh.intersect(origins[i], directions[i], 25.0f);
+        CORRADE_COMPARE(hits[i].triangle, expected.triangle);
+        CORRADE_COMPARE(hits[i].distance, expected.distance);
+        CORRADE_COMPARE(hits[i].barycentric, expected.barycentric);
+    }
+}
+
+void BvhTest::parallel() {
+    /* Grid large enough to be split into more tasks */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(128, indices, positions);
+    std::vector<Vector3> origins, directions;
+    rays(128, 2000, origins, directions);
+
+    Bvh single{indices, positions, 1};
+    Bvh multiple{indices, positions, 4};
+    CORRADE_COMPARE(multiple.nodeCount(), single.nodeCount());
+
+    std::vector<Bvh::Hit> hits(origins.size());
+    multiple.intersect({origins.data(), origins.size()}, {directions.data(), directions.size()}, {hits.data(), hits.size()}, Constants::inf(), 4);
+    for(std::size_t i = 0; i != origins.size(); ++i) {
+        const Bvh::Hit expected = single.intersect(origins[i], directions[i]);
+        CORRADE_COMPARE(multiple.intersect(origins[i], directions[i]).triangle, expected.triangle);
+        CORRADE_COMPARE(hits[i].triangle, expected.triangle);
+        CORRADE_COMPARE(hits[i].distance, expected.distance);
+    }
+}
+
+void BvhTest::meshData() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(8, indices, positions);
+
+    Bvh bvh{Trade::MeshData3D{MeshPrimitive::Triangles, indices, {positions}, {}, {}}};
+    CORRADE_COMPARE(bvh.triangleCount(), indices.size()/3);
+    CORRADE_COMPARE(bvh.intersect({2.5f, 3.25f, 5.0f}, {0.0f, 0.0f, -1.0f}).triangle,
+        intersectBruteForce(indices, positions, {2.5f, 3.25f, 5.0f}, {0.0f, 0.0f, -1.0f}).triangle);
+}
+
+void BvhTest::meshDataNotIndexedTriangles() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(4, indices, positions);
+
+    /* The tree shouldn't be built from the data at all */
+    Bvh notIndexed{Trade::MeshData3D{MeshPrimitive::Triangles, {}, {positions}, {}, {}}};
+    Bvh lines{Trade::MeshData3D{MeshPrimitive::Lines, indices, {positions}, {}, {}}};
+    CORRADE_COMPARE(notIndexed.triangleCount(), 0);
+    CORRADE_COMPARE(lines.triangleCount(), 0);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::Bvh: expected indexed triangle mesh\n"
+        "MeshTools::Bvh: expected indexed triangle mesh\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BvhTest)
@@ -0,0 +1,178 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct CompileGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit CompileGLTest();
+
+    void quantized();
+    void quantizedPositionsOnly();
+};
+
+CompileGLTest::CompileGLTest() {
+    addTests({&CompileGLTest::quantized,
+              &CompileGLTest::quantizedPositionsOnly});
+}
+
+namespace {
+    const std::vector<Vector3> Positions{{-1.0f, 0.5f, 2.0f}, {3.0f, -0.25f, 0.0f}, {0.75f, 1.5f, -1.0f}};
+    const std::vector<Vector3> Normals{Vector3{1.0f, 2.0f, 2.0f}/3.0f, {0.0f, 0.0f, 1.0f}, {0.0f, -0.6f, 0.8f}};
+    const std::vector<Vector2> TextureCoords{{0.0f, 0.5f}, {1.0f, 0.25f}, {0.125f, 0.75f}};
+
+    /* Expected layout for all combinations, float attributes should be
+       always aligned to four bytes */
+    struct {
+        PositionQuantization positions;
+        NormalQuantization normals;
+        TextureCoordinateQuantization textureCoords;
+        std::size_t stride, positionOffset, normalOffset, textureCoordOffset;
+    } Data[]{
+        {PositionQuantization::None, NormalQuantization::None, TextureCoordinateQuantization::None, 32, 0, 12, 24},
+        {PositionQuantization::None, NormalQuantization::None, TextureCoordinateQuantization::Half, 28, 0, 12, 24},
+        {PositionQuantization::None, NormalQuantization::Octahedral8, TextureCoordinateQuantization::None, 24, 0, 20, 12},
+        {PositionQuantization::None, NormalQuantization::Octahedral8, TextureCoordinateQuantization::Half, 20, 0, 16, 12},
+        {PositionQuantization::None, NormalQuantization::Octahedral16, TextureCoordinateQuantization::None, 24, 0, 20, 12},
+        {PositionQuantization::None, NormalQuantization::Octahedral16, TextureCoordinateQuantization::Half, 20, 0, 12, 16},
+        {PositionQuantization::UnsignedShort, NormalQuantization::None, TextureCoordinateQuantization::None, 28, 20, 0, 12},
+        {PositionQuantization::UnsignedShort, NormalQuantization::None, TextureCoordinateQuantization::Half, 24, 16, 0, 12},
+        {PositionQuantization::UnsignedShort, NormalQuantization::Octahedral8, TextureCoordinateQuantization::None, 16, 8, 14, 0},
+        {PositionQuantization::UnsignedShort, NormalQuantization::Octahedral8, TextureCoordinateQuantization::Half, 12, 4, 10, 0},
+        {PositionQuantization::UnsignedShort, NormalQuantization::Octahedral16, TextureCoordinateQuantization::None, 20, 12, 8, 0},
+        {PositionQuantization::UnsignedShort, NormalQuantization::Octahedral16, TextureCoordinateQuantization::Half, 16, 8, 0, 4}
+    };
+
+    bool halfFloatSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current()->isExtensionSupported<Extensions::GL::ARB::half_float_vertex>();
+        #elif defined(MAGNUM_TARGET_GLES2)
+        return Context::current()->isExtensionSupported<Extensions::GL::OES::vertex_half_float>();
+        #else
+        return true;
+        #endif
+    }
+
+    template<class T> T get(const Containers::Array<char>& data, const std::size_t offset) {
+        T value;
+        std::memcpy(value.data(), data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    bool closeEnough(const Vector3& a, const Vector3& b, const Float epsilon) {
+        return (a - b).length() < epsilon;
+    }
+}
+
+void CompileGLTest::quantized() {
+    const Trade::MeshData3D meshData{MeshPrimitive::Triangles, {0, 1, 2}, {Positions}, {Normals}, {TextureCoords}};
+
+    for(const auto& data: Data) {
+        if(data.textureCoords == TextureCoordinateQuantization::Half && !halfFloatSupported()) {
+            Debug() << "Half-float vertex attributes are not supported, skipping" << UnsignedInt(data.positions) << UnsignedInt(data.normals);
+            continue;
+        }
+
+        Mesh mesh;
+        std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+        Matrix4 dequantization;
+        std::tie(mesh, vertexBuffer, indexBuffer, dequantization) = MeshTools::compile(meshData, BufferUsage::StaticDraw, data.positions, data.normals, data.textureCoords);
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(vertexBuffer);
+        CORRADE_VERIFY(indexBuffer);
+        CORRADE_COMPARE(mesh.count(), 3);
+        CORRADE_COMPARE(vertexBuffer->size(), 3*data.stride);
+
+        if(data.positions == PositionQuantization::None)
+            CORRADE_COMPARE(dequantization, Matrix4{});
+
+        /** @todo How to verify the contents in ES? */
+        #ifndef MAGNUM_TARGET_GLES
+        const Containers::Array<char> vertices = vertexBuffer->data<char>();
+        for(std::size_t i = 0; i != 3; ++i) {
+            const std::size_t vertex = i*data.stride;
+
+            if(data.positions == PositionQuantization::None)
+                CORRADE_COMPARE(get<Vector3>(vertices, vertex + data.positionOffset), Positions[i]);
+            else {
+                const Vector3 normalized = Vector3{get<Math::Vector3<UnsignedShort>>(vertices, vertex + data.positionOffset)}/65535.0f;
+                CORRADE_VERIFY(closeEnough(dequantization.transformPoint(normalized), Positions[i], 1.0e-4f));
+            }
+
+            switch(data.normals) {
+                case NormalQuantization::None:
+                    CORRADE_COMPARE(get<Vector3>(vertices, vertex + data.normalOffset), Normals[i]);
+                    break;
+                case NormalQuantization::Octahedral8:
+                    CORRADE_VERIFY(closeEnough(Math::unpackOctahedral(get<Math::Vector2<Byte>>(vertices, vertex + data.normalOffset)), Normals[i], 0.03f));
+                    break;
+                case NormalQuantization::Octahedral16:
+                    CORRADE_VERIFY(closeEnough(Math::unpackOctahedral(get<Math::Vector2<Short>>(vertices, vertex + data.normalOffset)), Normals[i], 1.0e-3f));
+                    break;
+            }
+
+            if(data.textureCoords == TextureCoordinateQuantization::None)
+                CORRADE_COMPARE(get<Vector2>(vertices, vertex + data.textureCoordOffset), TextureCoords[i]);
+            else {
+                const Math::Vector2<Half> packed = get<Math::Vector2<Half>>(vertices, vertex + data.textureCoordOffset);
+                CORRADE_COMPARE((Vector2{Float(packed[0]), Float(packed[1])}), TextureCoords[i]);
+            }
+        }
+        #endif
+    }
+}
+
+void CompileGLTest::quantizedPositionsOnly() {
+    /* Six-byte positions alone have the stride padded to four bytes */
+    const Trade::MeshData3D meshData{MeshPrimitive::Triangles, {}, {Positions}, {}, {}};
+
+    Mesh mesh;
+    std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+    Matrix4 dequantization;
+    std::tie(mesh, vertexBuffer, indexBuffer, dequantization) = MeshTools::compile(meshData, BufferUsage::StaticDraw, PositionQuantization::UnsignedShort, NormalQuantization::Octahedral8, TextureCoordinateQuantization::Half);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(!indexBuffer);
+    CORRADE_COMPARE(mesh.count(), 3);
+    CORRADE_COMPARE(vertexBuffer->size(), 3*8);
+
+    /* Bounding box is {-1, -0.25, -1} to {3, 1.5, 2} */
+    CORRADE_COMPARE(dequantization, Matrix4::translation({-1.0f, -0.25f, -1.0f})*Matrix4::scaling({4.0f, 1.75f, 3.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileGLTest)
@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit GenerateSmoothNormalsBenchmark();
+
+    void area();
+    void areaSingleThread();
+    void angle();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        std::vector<Vector3> _positions;
+};
+
+namespace {
+    /* 50M triangles, needs about 2.5 GB of memory */
+    enum: UnsignedInt { GridSize = 5000 };
+}
+
+GenerateSmoothNormalsBenchmark::GenerateSmoothNormalsBenchmark(): AbstractBenchmarkTester{3} {
+    addTests({&GenerateSmoothNormalsBenchmark::area,
+              &GenerateSmoothNormalsBenchmark::areaSingleThread,
+              &GenerateSmoothNormalsBenchmark::angle});
+
+    /* Slightly bumpy grid so the normals aren't all the same */
+    _positions.reserve((GridSize + 1)*(GridSize + 1));
+    for(UnsignedInt y = 0; y != GridSize + 1; ++y) for(UnsignedInt x = 0; x != GridSize + 1; ++x)
+        _positions.emplace_back(Float(x), Float(y), Float((x*7 + y*13) % 5)*0.1f);
+
+    _indices.reserve(GridSize*GridSize*6);
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x) {
+        const UnsignedInt a = y*(GridSize + 1) + x;
+        const UnsignedInt b = a + GridSize + 1;
+        _indices.insert(_indices.end(), {a, a + 1, b + 1, a, b + 1, b});
+    }
+}
+
+void GenerateSmoothNormalsBenchmark::area() {
+    MAGNUM_BENCHMARK("area weighting", _indices.size()/3) {
+        std::vector<Vector3> normals = generateSmoothNormals(_indices, _positions, NormalWeighting::Area);
+        escape(normals.data());
+    }
+}
+
+void GenerateSmoothNormalsBenchmark::areaSingleThread() {
+    MAGNUM_BENCHMARK("area weighting, single thread", _indices.size()/3) {
+        std::vector<Vector3> normals = generateSmoothNormals(_indices, _positions, NormalWeighting::Area, 1);
+        escape(normals.data());
+    }
+}
+
+void GenerateSmoothNormalsBenchmark::angle() {
+    MAGNUM_BENCHMARK("angle weighting", _indices.size()/3) {
+        std::vector<Vector3> normals = generateSmoothNormals(_indices, _positions, NormalWeighting::Angle);
+        escape(normals.data());
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsBenchmark)
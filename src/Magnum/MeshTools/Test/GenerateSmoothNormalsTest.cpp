@@ -0,0 +1,192 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsTest: TestSuite::Tester {
+    explicit GenerateSmoothNormalsTest();
+
+    void wrongIndexCount();
+    void area();
+    void angle();
+    void crease();
+    void creaseSmooth();
+    void parallel();
+    void debugWeighting();
+};
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::wrongIndexCount,
+              &GenerateSmoothNormalsTest::area,
+              &GenerateSmoothNormalsTest::angle,
+              &GenerateSmoothNormalsTest::crease,
+              &GenerateSmoothNormalsTest::creaseSmooth,
+              &GenerateSmoothNormalsTest::parallel,
+              &GenerateSmoothNormalsTest::debugWeighting});
+}
+
+namespace {
+
+/* Three perpendicular faces sharing vertex 0, the first is four times larger
+   than the others. The two smaller share also vertex 4. */
+const std::vector<UnsignedInt> cornerIndices{
+    0, 1, 2,
+    0, 3, 4,
+    0, 4, 5
+};
+
+const std::vector<Vector3> cornerPositions{
+    {0.0f, 0.0f, 0.0f},
+    {2.0f, 0.0f, 0.0f},
+    {0.0f, 2.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, 0.0f}
+};
+
+}
+
+void GenerateSmoothNormalsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({0, 1}, {});
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> creaseNormals;
+    std::tie(indices, creaseNormals) = MeshTools::generateSmoothNormals({0, 1}, {}, Deg(30.0f));
+
+    CORRADE_COMPARE(normals.size(), 0);
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(creaseNormals.size(), 0);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::generateSmoothNormals(): index count is not divisible by 3!\n"
+        "MeshTools::generateSmoothNormals(): index count is not divisible by 3!\n");
+}
+
+void GenerateSmoothNormalsTest::area() {
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(cornerIndices, cornerPositions, NormalWeighting::Area);
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3{1.0f, 1.0f, 4.0f}/Math::sqrt(18.0f),
+        Vector3::zAxis(),
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3{1.0f, 1.0f, 0.0f}/Constants::sqrt2(),
+        Vector3::yAxis()
+    }));
+}
+
+void GenerateSmoothNormalsTest::angle() {
+    /* The faces have the same angle at vertex 0 */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(cornerIndices, cornerPositions, NormalWeighting::Angle);
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3{1.0f}/Constants::sqrt3(),
+        Vector3::zAxis(),
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3{1.0f, 1.0f, 0.0f}/Constants::sqrt2(),
+        Vector3::yAxis()
+    }));
+}
+
+void GenerateSmoothNormalsTest::crease() {
+    /* All faces are perpendicular, so the normals are flat */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(cornerIndices, cornerPositions, Deg(30.0f));
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 3, 4,
+        1, 5, 6,
+        2, 7, 8
+    }));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3::yAxis(),
+        Vector3::zAxis(),
+        Vector3::zAxis(),
+        Vector3::xAxis(),
+        Vector3::xAxis(),
+        Vector3::yAxis(),
+        Vector3::yAxis()
+    }));
+}
+
+void GenerateSmoothNormalsTest::creaseSmooth() {
+    /* Crease angle larger than angle between the faces gives the same result
+       as without crease, equal normals of each vertex are shared */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(cornerIndices, cornerPositions, Deg(100.0f), NormalWeighting::Angle);
+
+    CORRADE_COMPARE(indices, cornerIndices);
+    CORRADE_COMPARE(normals, MeshTools::generateSmoothNormals(cornerIndices, cornerPositions, NormalWeighting::Angle));
+}
+
+void GenerateSmoothNormalsTest::parallel() {
+    /* Grid large enough to be split among more threads */
+    constexpr UnsignedInt size = 256;
+    std::vector<Vector3> positions;
+    positions.reserve(size*size);
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x)
+        positions.emplace_back(Float(x), Float(y), Math::sin(Rad(x*0.1f))*Math::cos(Rad(y*0.2f)));
+
+    std::vector<UnsignedInt> indices;
+    indices.reserve((size - 1)*(size - 1)*6);
+    for(UnsignedInt y = 0; y != size - 1; ++y) for(UnsignedInt x = 0; x != size - 1; ++x) {
+        const UnsignedInt i = y*size + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 1, i, i + size + 1, i + size});
+    }
+
+    CORRADE_COMPARE(MeshTools::generateSmoothNormals(indices, positions, NormalWeighting::Angle, 4),
+        MeshTools::generateSmoothNormals(indices, positions, NormalWeighting::Angle, 1));
+
+    std::vector<UnsignedInt> normalIndices, normalIndicesSingle;
+    std::vector<Vector3> normals, normalsSingle;
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(indices, positions, Deg(10.0f), NormalWeighting::Area, 4);
+    std::tie(normalIndicesSingle, normalsSingle) = MeshTools::generateSmoothNormals(indices, positions, Deg(10.0f), NormalWeighting::Area, 1);
+    CORRADE_COMPARE(normalIndices, normalIndicesSingle);
+    CORRADE_COMPARE(normals, normalsSingle);
+}
+
+void GenerateSmoothNormalsTest::debugWeighting() {
+    std::ostringstream out;
+
+    Debug(&out) << NormalWeighting::Angle << NormalWeighting(0xde);
+    CORRADE_COMPARE(out.str(), "MeshTools::NormalWeighting::Angle MeshTools::NormalWeighting::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
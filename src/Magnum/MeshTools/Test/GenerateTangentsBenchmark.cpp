@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/ObjImporter/ObjImporter.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateTangentsBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit GenerateTangentsBenchmark();
+
+    void uvSphereNaive();
+    void uvSphere();
+    void uvSphereSingleThread();
+    void objNaive();
+    void obj();
+    void objSingleThread();
+
+    private:
+        void benchmark(const std::string& name, const Trade::MeshData3D& mesh, std::size_t threadCount);
+        void benchmarkNaive(const std::string& name, const Trade::MeshData3D& mesh);
+
+        Trade::MeshData3D _uvSphere, _obj;
+};
+
+namespace {
+
+/* Torus with texture wrapped around it, the importer duplicates vertices on
+   the seams */
+std::string torusObj(const UnsignedInt rings, const UnsignedInt segments) {
+    std::ostringstream out;
+    for(UnsignedInt i = 0; i <= rings; ++i) for(UnsignedInt j = 0; j <= segments; ++j) {
+        const Rad u(Float(i)/rings*Constants::tau());
+        const Rad v(Float(j)/segments*Constants::tau());
+        const Vector3 center{Math::cos(u), Math::sin(u), 0.0f};
+        const Vector3 normal{Math::cos(u)*Math::cos(v), Math::sin(u)*Math::cos(v), Math::sin(v)};
+        const Vector3 position = center*2.0f + normal*0.5f;
+        out << "v " << position.x() << ' ' << position.y() << ' ' << position.z() << '\n'
+            << "vt " << Float(i)/rings << ' ' << Float(j)/segments << '\n'
+            << "vn " << normal.x() << ' ' << normal.y() << ' ' << normal.z() << '\n';
+    }
+
+    for(UnsignedInt i = 0; i != rings; ++i) for(UnsignedInt j = 0; j != segments; ++j) {
+        const UnsignedInt a = i*(segments + 1) + j + 1;
+        const UnsignedInt b = a + segments + 1;
+        out << "f " << a << '/' << a << '/' << a << ' '
+                    << b << '/' << b << '/' << b << ' '
+                    << b + 1 << '/' << b + 1 << '/' << b + 1 << '\n'
+            << "f " << a << '/' << a << '/' << a << ' '
+                    << b + 1 << '/' << b + 1 << '/' << b + 1 << ' '
+                    << a + 1 << '/' << a + 1 << '/' << a + 1 << '\n';
+    }
+
+    return out.str();
+}
+
+Trade::MeshData3D importObj(const std::string& data) {
+    Trade::ObjImporter importer;
+    CORRADE_INTERNAL_ASSERT_OUTPUT(importer.openData({data.data(), data.size()}));
+    std::optional<Trade::MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_INTERNAL_ASSERT(mesh);
+    return std::move(*mesh);
+}
+
+}
+
+GenerateTangentsBenchmark::GenerateTangentsBenchmark(): AbstractBenchmarkTester{10},
+    _uvSphere{Primitives::UVSphere::solid(256, 512, Primitives::UVSphere::TextureCoords::Generate)},
+    _obj{importObj(torusObj(512, 256))}
+{
+    addTests({&GenerateTangentsBenchmark::uvSphereNaive,
+              &GenerateTangentsBenchmark::uvSphere,
+              &GenerateTangentsBenchmark::uvSphereSingleThread,
+              &GenerateTangentsBenchmark::objNaive,
+              &GenerateTangentsBenchmark::obj,
+              &GenerateTangentsBenchmark::objSingleThread});
+}
+
+void GenerateTangentsBenchmark::benchmark(const std::string& name, const Trade::MeshData3D& mesh, const std::size_t threadCount) {
+    MAGNUM_BENCHMARK(name, mesh.indices().size()/3) {
+        std::vector<UnsignedInt> indices;
+        std::vector<Vector4> tangents;
+        std::tie(indices, tangents) = MeshTools::generateTangents(mesh.indices(), mesh.positions(0), mesh.normals(0), mesh.textureCoords2D(0), threadCount);
+        escape(tangents.data());
+    }
+}
+
+/* Commonly used per-face scatter followed by Gram-Schmidt, for comparison */
+void GenerateTangentsBenchmark::benchmarkNaive(const std::string& name, const Trade::MeshData3D& mesh) {
+    const std::vector<UnsignedInt>& indices = mesh.indices();
+    const std::vector<Vector3>& positions = mesh.positions(0);
+    const std::vector<Vector3>& normals = mesh.normals(0);
+    const std::vector<Vector2>& textureCoordinates = mesh.textureCoords2D(0);
+
+    MAGNUM_BENCHMARK(name, indices.size()/3) {
+        std::vector<Vector3> tangents(positions.size()), bitangents(positions.size());
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            const Vector3 e1 = positions[indices[i + 1]] - positions[indices[i]];
+            const Vector3 e2 = positions[indices[i + 2]] - positions[indices[i]];
+            const Vector2 t1 = textureCoordinates[indices[i + 1]] - textureCoordinates[indices[i]];
+            const Vector2 t2 = textureCoordinates[indices[i + 2]] - textureCoordinates[indices[i]];
+            const Float r = 1.0f/Math::cross(t1, t2);
+            const Vector3 tangent = (e1*t2.y() - e2*t1.y())*r;
+            const Vector3 bitangent = (e2*t1.x() - e1*t2.x())*r;
+            for(std::size_t j = 0; j != 3; ++j) {
+                tangents[indices[i + j]] += tangent;
+                bitangents[indices[i + j]] += bitangent;
+            }
+        }
+
+        std::vector<Vector4> out(positions.size());
+        for(std::size_t i = 0; i != positions.size(); ++i) {
+            const Vector3 tangent = (tangents[i] - normals[i]*Math::dot(normals[i], tangents[i])).normalized();
+            out[i] = {tangent, Math::dot(Math::cross(normals[i], tangent), bitangents[i]) < 0.0f ? -1.0f : 1.0f};
+        }
+
+        escape(out.data());
+    }
+}
+
+void GenerateTangentsBenchmark::uvSphereNaive() {
+    benchmarkNaive("naive, UVSphere", _uvSphere);
+}
+
+void GenerateTangentsBenchmark::uvSphere() {
+    benchmark("generateTangents(), UVSphere", _uvSphere, 0);
+}
+
+void GenerateTangentsBenchmark::uvSphereSingleThread() {
+    benchmark("generateTangents(), UVSphere, single thread", _uvSphere, 1);
+}
+
+void GenerateTangentsBenchmark::objNaive() {
+    benchmarkNaive("naive, OBJ torus", _obj);
+}
+
+void GenerateTangentsBenchmark::obj() {
+    benchmark("generateTangents(), OBJ torus", _obj, 0);
+}
+
+void GenerateTangentsBenchmark::objSingleThread() {
+    benchmark("generateTangents(), OBJ torus, single thread", _obj, 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsBenchmark)
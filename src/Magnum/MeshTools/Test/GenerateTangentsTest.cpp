@@ -0,0 +1,329 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    void wrongIndexCount();
+    void wrongAttributeCount();
+    void generate();
+    void projected();
+    void mirrored();
+    void disconnected();
+    void welded();
+    void degenerateMapping();
+    void degenerate();
+    void parallel();
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({&GenerateTangentsTest::wrongIndexCount,
+              &GenerateTangentsTest::wrongAttributeCount,
+              &GenerateTangentsTest::generate,
+              &GenerateTangentsTest::projected,
+              &GenerateTangentsTest::mirrored,
+              &GenerateTangentsTest::disconnected,
+              &GenerateTangentsTest::welded,
+              &GenerateTangentsTest::degenerateMapping,
+              &GenerateTangentsTest::degenerate,
+              &GenerateTangentsTest::parallel});
+}
+
+void GenerateTangentsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({0, 1}, {}, {}, {});
+
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(tangents.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): index count is not divisible by 3!\n");
+}
+
+void GenerateTangentsTest::wrongAttributeCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({0, 1, 2}, {{}, {}, {}}, {{}, {}, {}}, {{}, {}});
+
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(tangents.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): expected 3 normals and texture coordinates but got 3 and 2\n");
+}
+
+void GenerateTangentsTest::generate() {
+    /* Quad in XY plane with texture coordinates rotated by 90 degrees */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2,
+        0, 2, 3
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }, std::vector<Vector3>(4, Vector3::zAxis()), {
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {-1.0f, 1.0f},
+        {-1.0f, 0.0f}
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 2, 3
+    }));
+    CORRADE_COMPARE(tangents, std::vector<Vector4>(4, {0.0f, -1.0f, 0.0f, 1.0f}));
+}
+
+void GenerateTangentsTest::projected() {
+    /* Tangent is perpendicular to the (not flat) normal */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }, {
+        Vector3{1.0f, 0.0f, 1.0f}.normalized(),
+        Vector3::zAxis(),
+        Vector3::zAxis()
+    }, {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f}
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {Vector3{1.0f, 0.0f, -1.0f}.normalized(), 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f}
+    }));
+}
+
+void GenerateTangentsTest::mirrored() {
+    /* Two faces sharing edge 0-1 with texture mirrored around it, the
+       vertices on the edge get two tangents */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 2, 1,
+        0, 1, 3
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f}
+    }, std::vector<Vector3>(4, Vector3::zAxis()), {
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 0.0f},
+        {1.0f, 0.0f}
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 4, 2,
+        1, 3, 5
+    }));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f, -1.0f}
+    }));
+}
+
+void GenerateTangentsTest::disconnected() {
+    /* Two faces sharing only vertex 0, which gets two tangents */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2,
+        0, 3, 4
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f},
+        {-1.0f, -1.0f, 0.0f}
+    }, std::vector<Vector3>(5, Vector3::zAxis()), {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f},
+        {-1.0f, 1.0f}
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 2, 3,
+        1, 4, 5
+    }));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f}
+    }));
+}
+
+void GenerateTangentsTest::welded() {
+    /* Two faces with duplicated vertices on the shared edge, the duplicates
+       have equal attributes and are treated as one vertex */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2,
+        3, 4, 5
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }, std::vector<Vector3>(6, Vector3::zAxis()), {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 2.0f}
+    });
+
+    /* Both faces have the same angle at the shared vertices */
+    const Vector4 a{1.0f, 0.0f, 0.0f, 1.0f};
+    const Vector4 b{Vector3{2.0f, 1.0f, 0.0f}.normalized(), 1.0f};
+    const Vector4 shared{(a.xyz() + b.xyz()).normalized(), 1.0f};
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        3, 4, 5
+    }));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{shared, a, shared, shared, shared, b}));
+}
+
+void GenerateTangentsTest::degenerateMapping() {
+    /* Second face has degenerate texture mapping, so it takes tangent and
+       handedness of the (mirrored) first face on the shared vertices */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2,
+        0, 2, 3
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }, std::vector<Vector3>(4, Vector3::zAxis()), {
+        {0.0f, 0.0f},
+        {0.0f, -1.0f},
+        {-1.0f, -1.0f},
+        {-2.0f, -2.0f}
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 2, 3
+    }));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{
+        {0.0f, -1.0f, 0.0f, -1.0f},
+        {0.0f, -1.0f, 0.0f, -1.0f},
+        {0.0f, -1.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f, -1.0f}
+    }));
+}
+
+void GenerateTangentsTest::degenerate() {
+    /* All texture coordinates are the same, arbitrary perpendicular vector is
+       chosen. Mapping with zero area isn't orientation-preserving, same as in
+       MikkTSpace. */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector4> tangents;
+    std::tie(indices, tangents) = MeshTools::generateTangents({
+        0, 1, 2
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }, std::vector<Vector3>(3, Vector3::zAxis()), std::vector<Vector2>(3));
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(tangents, std::vector<Vector4>(3, {1.0f, 0.0f, 0.0f, -1.0f}));
+}
+
+void GenerateTangentsTest::parallel() {
+    /* Grid large enough to be split among more threads, with the texture
+       mirrored in the middle */
+    constexpr UnsignedInt size = 256;
+    std::vector<Vector3> positions, normals;
+    std::vector<Vector2> textureCoordinates;
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const Float z = Math::sin(Rad(x*0.1f))*Math::cos(Rad(y*0.2f));
+        positions.emplace_back(Float(x), Float(y), z);
+        normals.push_back(Vector3{-0.1f*Math::cos(Rad(x*0.1f)), 0.2f*Math::sin(Rad(y*0.2f)), 1.0f}.normalized());
+        textureCoordinates.emplace_back(Math::abs(Float(x) - size/2), Float(y));
+    }
+
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != size - 1; ++y) for(UnsignedInt x = 0; x != size - 1; ++x) {
+        const UnsignedInt i = y*size + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 1, i, i + size + 1, i + size});
+    }
+
+    std::vector<UnsignedInt> tangentIndices, tangentIndicesSingle;
+    std::vector<Vector4> tangents, tangentsSingle;
+    std::tie(tangentIndices, tangents) = MeshTools::generateTangents(indices, positions, normals, textureCoordinates, 4);
+    std::tie(tangentIndicesSingle, tangentsSingle) = MeshTools::generateTangents(indices, positions, normals, textureCoordinates, 1);
+
+    /* Vertices on the mirror seam get two tangents */
+    CORRADE_COMPARE(tangents.size(), size*(size + 1));
+    CORRADE_COMPARE(tangentIndices, tangentIndicesSingle);
+    CORRADE_COMPARE(tangents, tangentsSingle);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct InterleaveGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit InterleaveGLTest();
+
+    void intoBuffer();
+    void intoBufferUpload();
+    void intoBufferEmpty();
+
+    private:
+        void verifyContents(Buffer& buffer);
+};
+
+InterleaveGLTest::InterleaveGLTest() {
+    addTests({&InterleaveGLTest::intoBuffer,
+              &InterleaveGLTest::intoBufferUpload,
+              &InterleaveGLTest::intoBufferEmpty});
+}
+
+namespace {
+    const std::vector<Byte> a{0, 1, 2};
+    const std::vector<Short> b{3, 4, 5};
+    const std::vector<Int> c{6, 7, 8};
+}
+
+void InterleaveGLTest::verifyContents(Buffer& buffer) {
+    /* Gaps are left uninitialized in the buffer, so they are not compared */
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> data = buffer.data<char>();
+    CORRADE_COMPARE(data.size(), 27);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(Byte(data[i*9]), a[i]);
+        Short bData;
+        Int cData;
+        std::memcpy(&bData, data.data() + i*9 + 1, 2);
+        std::memcpy(&cData, data.data() + i*9 + 5, 4);
+        CORRADE_COMPARE(bData, b[i]);
+        CORRADE_COMPARE(cData, c[i]);
+    }
+    #else
+    CORRADE_COMPARE(buffer.size(), 27);
+    #endif
+}
+
+void InterleaveGLTest::intoBuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current()->isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    /* Existing contents of different size should get replaced */
+    Buffer buffer;
+    buffer.setData({nullptr, 5}, BufferUsage::StaticDraw);
+
+    MeshTools::interleaveInto(buffer, BufferUsage::DynamicDraw, a, b, 2, c);
+    MAGNUM_VERIFY_NO_ERROR();
+    verifyContents(buffer);
+}
+
+void InterleaveGLTest::intoBufferUpload() {
+    /* Fallback used when mapping is not supported or the data got corrupted,
+       tested directly as it can't be triggered otherwise */
+    Buffer buffer;
+    buffer.setData({nullptr, 5}, BufferUsage::StaticDraw);
+
+    Implementation::interleaveIntoBufferUpload(buffer, BufferUsage::DynamicDraw, 27, [](Containers::ArrayView<char> data) {
+        Implementation::writeInterleaved(9, data.begin(), 0, 3, a, b, 2, c);
+    });
+    MAGNUM_VERIFY_NO_ERROR();
+    verifyContents(buffer);
+}
+
+void InterleaveGLTest::intoBufferEmpty() {
+    /* No attributes, the buffer should be left untouched */
+    Buffer buffer;
+    buffer.setData({nullptr, 5}, BufferUsage::StaticDraw);
+
+    MeshTools::interleaveInto(buffer, BufferUsage::DynamicDraw, std::vector<Int>{});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(buffer.size(), 5);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveGLTest)
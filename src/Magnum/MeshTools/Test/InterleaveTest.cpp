@@ -23,11 +23,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <array>
+#include <list>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/MeshTools/Interleave.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -43,6 +46,14 @@ struct InterleaveTest: Corrade::TestSuite::Tester {
     void writeGaps();
 
     void interleaveInto();
+    void interleaveIntoAttributeSize8();
+    void interleaveIntoAttributeSize12();
+    void interleaveIntoAttributeSize16();
+    void interleaveIntoAttributeSizeGeneric();
+    void interleaveIntoNonContiguous();
+    void interleaveIntoParallel();
+    void interleaveIntoParallelSmall();
+    void interleaveIntoParallelTooSmallBuffer();
 };
 
 InterleaveTest::InterleaveTest() {
@@ -53,7 +64,15 @@ InterleaveTest::InterleaveTest() {
               &InterleaveTest::write,
               &InterleaveTest::writeGaps,
 
-              &InterleaveTest::interleaveInto});
+              &InterleaveTest::interleaveInto,
+              &InterleaveTest::interleaveIntoAttributeSize8,
+              &InterleaveTest::interleaveIntoAttributeSize12,
+              &InterleaveTest::interleaveIntoAttributeSize16,
+              &InterleaveTest::interleaveIntoAttributeSizeGeneric,
+              &InterleaveTest::interleaveIntoNonContiguous,
+              &InterleaveTest::interleaveIntoParallel,
+              &InterleaveTest::interleaveIntoParallelSmall,
+              &InterleaveTest::interleaveIntoParallelTooSmallBuffer});
 }
 
 void InterleaveTest::attributeCount() {
@@ -158,6 +177,136 @@ void InterleaveTest::interleaveInto() {
     }
 }
 
+namespace {
+    /* Interleaves contiguous data, which goes through the specialized copy
+       for given size, and compares them to the same data interleaved through
+       the iterator path. The attribute is put at an unaligned offset after a
+       one-byte gap. The parallel variant starts copying in the middle of the
+       array. */
+    template<class T> void compareInterleavedContiguous(const std::vector<T>& attribute, Containers::Array<char>& contiguous, Containers::Array<char>& contiguousParallel, Containers::Array<char>& nonContiguous) {
+        const std::size_t size = attribute.size()*(1 + sizeof(T) + 3);
+        contiguous = Containers::Array<char>::zeroInitialized(size);
+        contiguousParallel = Containers::Array<char>::zeroInitialized(size);
+        nonContiguous = Containers::Array<char>::zeroInitialized(size);
+        MeshTools::interleaveInto(contiguous, 1, attribute, 3);
+        MeshTools::interleaveIntoParallel(contiguousParallel, 2, 1, attribute, 3);
+        MeshTools::interleaveInto(nonContiguous, 1, std::list<T>{attribute.begin(), attribute.end()}, 3);
+    }
+}
+
+void InterleaveTest::interleaveIntoAttributeSize8() {
+    std::vector<Vector2> a(40001);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        a[i] = {Float(i), -Float(i)};
+
+    Containers::Array<char> contiguous, contiguousParallel, nonContiguous;
+    compareInterleavedContiguous(a, contiguous, contiguousParallel, nonContiguous);
+    CORRADE_VERIFY(std::memcmp(contiguous + 1, &a[0], 8) == 0);
+    CORRADE_VERIFY(std::memcmp(contiguous + 40000*12 + 1, &a[40000], 8) == 0);
+    CORRADE_COMPARE(std::vector<char>(contiguous.begin(), contiguous.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+    CORRADE_COMPARE(std::vector<char>(contiguousParallel.begin(), contiguousParallel.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+}
+
+void InterleaveTest::interleaveIntoAttributeSize12() {
+    std::vector<Vector3> a(40001);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        a[i] = {Float(i), -Float(i), 0.5f*Float(i)};
+
+    Containers::Array<char> contiguous, contiguousParallel, nonContiguous;
+    compareInterleavedContiguous(a, contiguous, contiguousParallel, nonContiguous);
+    CORRADE_VERIFY(std::memcmp(contiguous + 1, &a[0], 12) == 0);
+    CORRADE_VERIFY(std::memcmp(contiguous + 40000*16 + 1, &a[40000], 12) == 0);
+    CORRADE_COMPARE(std::vector<char>(contiguous.begin(), contiguous.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+    CORRADE_COMPARE(std::vector<char>(contiguousParallel.begin(), contiguousParallel.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+}
+
+void InterleaveTest::interleaveIntoAttributeSize16() {
+    std::vector<Vector4> a(40001);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        a[i] = {Float(i), -Float(i), 0.5f*Float(i), 1.0f};
+
+    Containers::Array<char> contiguous, contiguousParallel, nonContiguous;
+    compareInterleavedContiguous(a, contiguous, contiguousParallel, nonContiguous);
+    CORRADE_VERIFY(std::memcmp(contiguous + 1, &a[0], 16) == 0);
+    CORRADE_VERIFY(std::memcmp(contiguous + 40000*20 + 1, &a[40000], 16) == 0);
+    CORRADE_COMPARE(std::vector<char>(contiguous.begin(), contiguous.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+    CORRADE_COMPARE(std::vector<char>(contiguousParallel.begin(), contiguousParallel.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+}
+
+void InterleaveTest::interleaveIntoAttributeSizeGeneric() {
+    /* Six bytes don't have a specialized copy */
+    std::vector<std::array<UnsignedShort, 3>> a(40001);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        a[i] = {{UnsignedShort(i), UnsignedShort(i*3), UnsignedShort(i*7)}};
+
+    Containers::Array<char> contiguous, contiguousParallel, nonContiguous;
+    compareInterleavedContiguous(a, contiguous, contiguousParallel, nonContiguous);
+    CORRADE_VERIFY(std::memcmp(contiguous + 1, &a[0], 6) == 0);
+    CORRADE_VERIFY(std::memcmp(contiguous + 40000*10 + 1, &a[40000], 6) == 0);
+    CORRADE_COMPARE(std::vector<char>(contiguous.begin(), contiguous.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+    CORRADE_COMPARE(std::vector<char>(contiguousParallel.begin(), contiguousParallel.end()),
+        std::vector<char>(nonContiguous.begin(), nonContiguous.end()));
+}
+
+void InterleaveTest::interleaveIntoNonContiguous() {
+    const std::vector<Vector3> a{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    const std::vector<Short> b{10, 11, 12};
+
+    Containers::Array<char> contiguous = Containers::Array<char>::zeroInitialized(3*16);
+    Containers::Array<char> nonContiguous = Containers::Array<char>::zeroInitialized(3*16);
+    MeshTools::interleaveInto(contiguous, a, 2, b);
+    MeshTools::interleaveInto(nonContiguous, std::list<Vector3>{a.begin(), a.end()}, 2, std::list<Short>{b.begin(), b.end()});
+
+    CORRADE_COMPARE(std::vector<char>(nonContiguous.begin(), nonContiguous.end()),
+        std::vector<char>(contiguous.begin(), contiguous.end()));
+}
+
+void InterleaveTest::interleaveIntoParallel() {
+    /* Large enough to be split among more threads */
+    std::vector<Vector3> positions(100001);
+    std::vector<UnsignedShort> indices(100001);
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        positions[i] = Vector3(Float(i));
+        indices[i] = UnsignedShort(i);
+    }
+
+    const Containers::Array<char> expected = MeshTools::interleave(positions, indices, 2);
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(expected.size());
+    MeshTools::interleaveIntoParallel(data, 4, positions, indices, 2);
+
+    CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()),
+        std::vector<char>(expected.begin(), expected.end()));
+}
+
+void InterleaveTest::interleaveIntoParallelSmall() {
+    /* Not split, but the result should be the same */
+    const std::vector<Int> a{4, 5, 6};
+    const std::vector<Short> b{0, 1, 2};
+
+    const Containers::Array<char> expected = MeshTools::interleave(a, 1, b);
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(expected.size());
+    MeshTools::interleaveIntoParallel(data, 0, a, 1, b);
+
+    CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()),
+        std::vector<char>(expected.begin(), expected.end()));
+}
+
+void InterleaveTest::interleaveIntoParallelTooSmallBuffer() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    Containers::Array<char> data{10};
+    MeshTools::interleaveIntoParallel(data, 2, std::vector<Int>{4, 5, 6}, 1);
+    CORRADE_COMPARE(ss.str(), "MeshTools::interleaveIntoParallel(): the data buffer is too small, expected 15 but got 10\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveTest)
@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <unordered_map>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/MeshTools/MeshAdjacency.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct MeshAdjacencyBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit MeshAdjacencyBenchmark();
+
+    void buildNaive();
+    void build();
+    void buildSingleThread();
+    void adjacentFaces();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        std::size_t _vertexCount;
+};
+
+namespace {
+    enum: UnsignedInt { GridSize = 512 };
+}
+
+MeshAdjacencyBenchmark::MeshAdjacencyBenchmark(): AbstractBenchmarkTester{10}, _vertexCount{(GridSize + 1)*(GridSize + 1)} {
+    addTests({&MeshAdjacencyBenchmark::buildNaive,
+              &MeshAdjacencyBenchmark::build,
+              &MeshAdjacencyBenchmark::buildSingleThread,
+              &MeshAdjacencyBenchmark::adjacentFaces});
+
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x) {
+        const UnsignedInt a = y*(GridSize + 1) + x;
+        const UnsignedInt b = a + GridSize + 1;
+        _indices.insert(_indices.end(), {a, a + 1, b + 1, a, b + 1, b});
+    }
+
+    const MeshAdjacency adjacency{_indices, _vertexCount};
+    Debug() << "MeshAdjacency uses" << Float(adjacency.memoryUsage())/adjacency.faceCount() << "bytes per triangle";
+}
+
+/* Commonly used hash map from directed edge to half-edge, for comparison */
+void MeshAdjacencyBenchmark::buildNaive() {
+    MAGNUM_BENCHMARK("hash map", _indices.size()/3) {
+        std::unordered_map<UnsignedLong, UnsignedInt> edges;
+        for(std::size_t i = 0; i != _indices.size(); ++i)
+            edges.emplace((UnsignedLong(_indices[i]) << 32)|_indices[MeshAdjacency::next(i)], i);
+
+        std::vector<UnsignedInt> opposites(_indices.size(), MeshAdjacency::Invalid);
+        for(std::size_t i = 0; i != _indices.size(); ++i) {
+            auto found = edges.find((UnsignedLong(_indices[MeshAdjacency::next(i)]) << 32)|_indices[i]);
+            if(found != edges.end()) opposites[i] = found->second;
+        }
+
+        escape(opposites.data());
+    }
+}
+
+void MeshAdjacencyBenchmark::build() {
+    MAGNUM_BENCHMARK("MeshAdjacency", _indices.size()/3) {
+        MeshAdjacency adjacency{_indices, _vertexCount};
+        escape(&adjacency);
+    }
+}
+
+void MeshAdjacencyBenchmark::buildSingleThread() {
+    MAGNUM_BENCHMARK("MeshAdjacency, single thread", _indices.size()/3) {
+        MeshAdjacency adjacency{_indices, _vertexCount, 1};
+        escape(&adjacency);
+    }
+}
+
+void MeshAdjacencyBenchmark::adjacentFaces() {
+    const MeshAdjacency adjacency{_indices, _vertexCount};
+    MAGNUM_BENCHMARK("adjacentFace()", adjacency.faceCount()) {
+        UnsignedInt sum = 0;
+        for(UnsignedInt i = 0; i != adjacency.faceCount(); ++i)
+            for(UnsignedInt j = 0; j != 3; ++j)
+                sum += adjacency.adjacentFace(i, j);
+        escape(&sum);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshAdjacencyBenchmark)
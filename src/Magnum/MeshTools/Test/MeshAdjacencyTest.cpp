@@ -0,0 +1,238 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/MeshAdjacency.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct MeshAdjacencyTest: TestSuite::Tester {
+    explicit MeshAdjacencyTest();
+
+    void nextPrevious();
+    void empty();
+    void quad();
+    void closed();
+    void nonManifold();
+    void inconsistentOrientation();
+    void degenerate();
+    void multipleThreads();
+    void memoryUsage();
+
+    void wrongIndexCount();
+    void indexOutOfBounds();
+};
+
+MeshAdjacencyTest::MeshAdjacencyTest() {
+    addTests({&MeshAdjacencyTest::nextPrevious,
+              &MeshAdjacencyTest::empty,
+              &MeshAdjacencyTest::quad,
+              &MeshAdjacencyTest::closed,
+              &MeshAdjacencyTest::nonManifold,
+              &MeshAdjacencyTest::inconsistentOrientation,
+              &MeshAdjacencyTest::degenerate,
+              &MeshAdjacencyTest::multipleThreads,
+              &MeshAdjacencyTest::memoryUsage,
+
+              &MeshAdjacencyTest::wrongIndexCount,
+              &MeshAdjacencyTest::indexOutOfBounds});
+}
+
+namespace {
+
+/* Grid of (size + 1)^2 vertices, two triangles per cell */
+std::vector<UnsignedInt> grid(const UnsignedInt size) {
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt a = y*(size + 1) + x;
+        const UnsignedInt b = a + size + 1;
+        indices.insert(indices.end(), {a, a + 1, b + 1, a, b + 1, b});
+    }
+    return indices;
+}
+
+}
+
+void MeshAdjacencyTest::nextPrevious() {
+    CORRADE_COMPARE(MeshAdjacency::next(0), 1);
+    CORRADE_COMPARE(MeshAdjacency::next(1), 2);
+    CORRADE_COMPARE(MeshAdjacency::next(2), 0);
+    CORRADE_COMPARE(MeshAdjacency::next(5), 3);
+    CORRADE_COMPARE(MeshAdjacency::previous(3), 5);
+    CORRADE_COMPARE(MeshAdjacency::previous(4), 3);
+    CORRADE_COMPARE(MeshAdjacency::previous(5), 4);
+}
+
+void MeshAdjacencyTest::empty() {
+    MeshAdjacency adjacency{{}, 3};
+    CORRADE_COMPARE(adjacency.vertexCount(), 3);
+    CORRADE_COMPARE(adjacency.faceCount(), 0);
+    CORRADE_COMPARE(adjacency.halfEdgeCount(), 0);
+    CORRADE_VERIFY(adjacency.vertexCorners(1).empty());
+}
+
+void MeshAdjacencyTest::quad() {
+    /* 3 --- 2
+       |   / |
+       | /   |
+       0 --- 1 */
+    const std::vector<UnsignedInt> indices{0, 1, 2, 0, 2, 3};
+    MeshAdjacency adjacency{indices, 4};
+    CORRADE_COMPARE(adjacency.vertexCount(), 4);
+    CORRADE_COMPARE(adjacency.faceCount(), 2);
+    CORRADE_COMPARE(adjacency.halfEdgeCount(), 6);
+
+    /* Edge 2 -> 0 of first face and 0 -> 2 of second face are shared */
+    CORRADE_COMPARE(adjacency.opposite(2), 3);
+    CORRADE_COMPARE(adjacency.opposite(3), 2);
+    CORRADE_COMPARE(adjacency.adjacentFace(0, 2), 1);
+    CORRADE_COMPARE(adjacency.adjacentFace(1, 0), 0);
+    for(UnsignedInt halfEdge: {0, 1, 4, 5}) {
+        CORRADE_VERIFY(adjacency.isBoundary(halfEdge));
+        CORRADE_COMPARE(adjacency.opposite(halfEdge), MeshAdjacency::Invalid);
+    }
+    CORRADE_COMPARE(adjacency.adjacentFace(0, 0), MeshAdjacency::Invalid);
+
+    /* Corners around vertices, sorted */
+    const Containers::ArrayView<const UnsignedInt> corners0 = adjacency.vertexCorners(0);
+    CORRADE_COMPARE((std::vector<UnsignedInt>{corners0.begin(), corners0.end()}), (std::vector<UnsignedInt>{0, 3}));
+    const Containers::ArrayView<const UnsignedInt> corners1 = adjacency.vertexCorners(1);
+    CORRADE_COMPARE((std::vector<UnsignedInt>{corners1.begin(), corners1.end()}), (std::vector<UnsignedInt>{1}));
+    const Containers::ArrayView<const UnsignedInt> corners2 = adjacency.vertexCorners(2);
+    CORRADE_COMPARE((std::vector<UnsignedInt>{corners2.begin(), corners2.end()}), (std::vector<UnsignedInt>{2, 4}));
+    const Containers::ArrayView<const UnsignedInt> corners3 = adjacency.vertexCorners(3);
+    CORRADE_COMPARE((std::vector<UnsignedInt>{corners3.begin(), corners3.end()}), (std::vector<UnsignedInt>{5}));
+}
+
+void MeshAdjacencyTest::closed() {
+    /* Tetrahedron, consistently oriented */
+    const std::vector<UnsignedInt> indices{
+        0, 2, 1,
+        0, 1, 3,
+        1, 2, 3,
+        2, 0, 3};
+    MeshAdjacency adjacency{indices, 4};
+
+    for(UnsignedInt i = 0; i != indices.size(); ++i) {
+        const UnsignedInt opposite = adjacency.opposite(i);
+        CORRADE_VERIFY(opposite != MeshAdjacency::Invalid);
+        CORRADE_COMPARE(adjacency.opposite(opposite), i);
+        CORRADE_COMPARE(indices[opposite], indices[MeshAdjacency::next(i)]);
+        CORRADE_COMPARE(indices[MeshAdjacency::next(opposite)], indices[i]);
+        CORRADE_VERIFY(adjacency.adjacentFace(i/3, i%3) != i/3);
+    }
+
+    for(UnsignedInt i = 0; i != 4; ++i)
+        CORRADE_COMPARE(adjacency.vertexCorners(i).size(), 3);
+}
+
+void MeshAdjacencyTest::nonManifold() {
+    /* Three faces sharing edge 0 -- 1 */
+    const std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        1, 0, 3,
+        1, 0, 4};
+    MeshAdjacency adjacency{indices, 5};
+
+    for(UnsignedInt i = 0; i != indices.size(); ++i)
+        CORRADE_VERIFY(adjacency.isBoundary(i));
+}
+
+void MeshAdjacencyTest::inconsistentOrientation() {
+    /* Both faces have edge 0 -> 1 */
+    const std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        0, 1, 3};
+    MeshAdjacency adjacency{indices, 4};
+
+    CORRADE_VERIFY(adjacency.isBoundary(0));
+    CORRADE_VERIFY(adjacency.isBoundary(3));
+}
+
+void MeshAdjacencyTest::degenerate() {
+    const std::vector<UnsignedInt> indices{
+        0, 0, 1,
+        2, 3, 4,
+        4, 3, 5};
+    MeshAdjacency adjacency{indices, 6};
+
+    /* Neither the degenerate edge nor the two other edges of the degenerate
+       face, going in opposite directions, are connected */
+    CORRADE_VERIFY(adjacency.isBoundary(0));
+    CORRADE_VERIFY(adjacency.isBoundary(1));
+    CORRADE_VERIFY(adjacency.isBoundary(2));
+    CORRADE_COMPARE(adjacency.vertexCorners(0).size(), 2);
+
+    /* Other faces are not affected */
+    CORRADE_COMPARE(adjacency.opposite(4), 6);
+    CORRADE_COMPARE(adjacency.opposite(6), 4);
+}
+
+void MeshAdjacencyTest::multipleThreads() {
+    /* Large enough to be split across threads */
+    const std::vector<UnsignedInt> indices = grid(128);
+    MeshAdjacency single{indices, 129*129, 1};
+    MeshAdjacency multiple{indices, 129*129, 4};
+
+    std::size_t boundary = 0;
+    for(UnsignedInt i = 0; i != indices.size(); ++i) {
+        CORRADE_COMPARE(multiple.opposite(i), single.opposite(i));
+        if(single.isBoundary(i)) ++boundary;
+    }
+
+    /* Only the grid border is boundary */
+    CORRADE_COMPARE(boundary, 4*128);
+}
+
+void MeshAdjacencyTest::memoryUsage() {
+    const std::vector<UnsignedInt> indices = grid(4);
+    MeshAdjacency adjacency{indices, 25};
+
+    /* 4 bytes per vertex, 24 bytes per triangle, one extra offset */
+    CORRADE_COMPARE(adjacency.memoryUsage(), 4*26 + 24*32);
+}
+
+void MeshAdjacencyTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshAdjacency{{0, 1}, 2};
+    CORRADE_COMPARE(out.str(), "MeshTools::MeshAdjacency: index count is not divisible by 3!\n");
+}
+
+void MeshAdjacencyTest::indexOutOfBounds() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshAdjacency{{0, 1, 3}, 3};
+    CORRADE_COMPARE(out.str(), "MeshTools::MeshAdjacency: index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshAdjacencyTest)
@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/MeshCodec.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+/* All benchmarks process one byte of decoded data per operation, so op/s
+   gives the throughput in bytes per second */
+struct MeshCodecBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit MeshCodecBenchmark();
+
+    void copy();
+    void encodeIndices();
+    void decodeIndices();
+    void encodeVertices();
+    void decodeVertices();
+    void decodeVerticesQuantized();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        std::vector<char> _vertices, _quantizedVertices;
+        Containers::Array<char> _encodedIndices, _encodedVertices, _encodedQuantizedVertices;
+};
+
+namespace {
+    enum: UnsignedInt { Size = 512 };
+
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    };
+
+    struct QuantizedVertex {
+        UnsignedShort position[3];
+        Byte normal[4];
+        UnsignedShort padding;
+    };
+}
+
+/* Wavy surface with vertices and faces ordered along rows */
+MeshCodecBenchmark::MeshCodecBenchmark(): AbstractBenchmarkTester{10} {
+    addTests({&MeshCodecBenchmark::copy,
+              &MeshCodecBenchmark::encodeIndices,
+              &MeshCodecBenchmark::decodeIndices,
+              &MeshCodecBenchmark::encodeVertices,
+              &MeshCodecBenchmark::decodeVertices,
+              &MeshCodecBenchmark::decodeVerticesQuantized});
+
+    std::vector<Vertex> vertices;
+    std::vector<QuantizedVertex> quantizedVertices;
+    for(UnsignedInt y = 0; y <= Size; ++y) for(UnsignedInt x = 0; x <= Size; ++x) {
+        const Float fx = Float(x)/Size, fy = Float(y)/Size;
+        const Vector3 position{fx, fy, 0.1f*Math::sin(Rad(fx*20.0f))*Math::cos(Rad(fy*20.0f))};
+        const Vector3 normal = Vector3{-2.0f*Math::cos(Rad(fx*20.0f))*Math::cos(Rad(fy*20.0f)), 2.0f*Math::sin(Rad(fx*20.0f))*Math::sin(Rad(fy*20.0f)), 1.0f}.normalized();
+        vertices.push_back({position, normal});
+
+        QuantizedVertex quantized{};
+        for(std::size_t i = 0; i != 3; ++i) {
+            quantized.position[i] = UnsignedShort((position[i] + 0.5f)*32767.0f);
+            quantized.normal[i] = Byte(normal[i]*127.0f);
+        }
+        quantizedVertices.push_back(quantized);
+    }
+    _vertices.assign(reinterpret_cast<const char*>(vertices.data()), reinterpret_cast<const char*>(vertices.data() + vertices.size()));
+    _quantizedVertices.assign(reinterpret_cast<const char*>(quantizedVertices.data()), reinterpret_cast<const char*>(quantizedVertices.data() + quantizedVertices.size()));
+
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt a = y*(Size + 1) + x;
+        const UnsignedInt c = a + Size + 1;
+        _indices.insert(_indices.end(), {a, a + 1, c + 1, a, c + 1, c});
+    }
+
+    _encodedIndices = MeshTools::encodeIndices(_indices);
+    _encodedVertices = MeshTools::encodeVertices({_vertices.data(), _vertices.size()}, sizeof(Vertex));
+    _encodedQuantizedVertices = MeshTools::encodeVertices({_quantizedVertices.data(), _quantizedVertices.size()}, sizeof(QuantizedVertex));
+    Debug() << "Encoded indices to" << Float(_encodedIndices.size())/(_indices.size()*4)*100.0f << "%, vertices to" << Float(_encodedVertices.size())/_vertices.size()*100.0f << "%, quantized vertices to" << Float(_encodedQuantizedVertices.size())/_quantizedVertices.size()*100.0f << "%";
+}
+
+void MeshCodecBenchmark::copy() {
+    MAGNUM_BENCHMARK("memcpy", _vertices.size()) {
+        Containers::Array<char> out{_vertices.size()};
+        std::memcpy(out.data(), _vertices.data(), _vertices.size());
+        escape(out.data());
+    }
+}
+
+void MeshCodecBenchmark::encodeIndices() {
+    MAGNUM_BENCHMARK("encodeIndices", _indices.size()*4) {
+        Containers::Array<char> out = MeshTools::encodeIndices(_indices);
+        escape(out.data());
+    }
+}
+
+void MeshCodecBenchmark::decodeIndices() {
+    MAGNUM_BENCHMARK("decodeIndices", _indices.size()*4) {
+        Containers::Array<char> out;
+        std::tie(out, std::ignore, std::ignore, std::ignore) = MeshTools::decodeIndices({_encodedIndices.data(), _encodedIndices.size()});
+        escape(out.data());
+    }
+}
+
+void MeshCodecBenchmark::encodeVertices() {
+    MAGNUM_BENCHMARK("encodeVertices", _vertices.size()) {
+        Containers::Array<char> out = MeshTools::encodeVertices({_vertices.data(), _vertices.size()}, sizeof(Vertex));
+        escape(out.data());
+    }
+}
+
+void MeshCodecBenchmark::decodeVertices() {
+    MAGNUM_BENCHMARK("decodeVertices", _vertices.size()) {
+        Containers::Array<char> out = MeshTools::decodeVertices({_encodedVertices.data(), _encodedVertices.size()});
+        escape(out.data());
+    }
+}
+
+void MeshCodecBenchmark::decodeVerticesQuantized() {
+    MAGNUM_BENCHMARK("decodeVertices, quantized", _quantizedVertices.size()) {
+        Containers::Array<char> out = MeshTools::decodeVertices({_encodedQuantizedVertices.data(), _encodedQuantizedVertices.size()});
+        escape(out.data());
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshCodecBenchmark)
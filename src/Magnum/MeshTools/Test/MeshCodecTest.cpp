@@ -0,0 +1,262 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/MeshCodec.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct MeshCodecTest: TestSuite::Tester {
+    explicit MeshCodecTest();
+
+    void indices();
+    void indicesType();
+    void indicesEmpty();
+    void indicesRatio();
+    void indicesInvalid();
+
+    void vertices();
+    void verticesEmpty();
+    void verticesRatio();
+    void verticesInvalid();
+    void verticesWrongStride();
+};
+
+MeshCodecTest::MeshCodecTest() {
+    addTests({&MeshCodecTest::indices,
+              &MeshCodecTest::indicesType,
+              &MeshCodecTest::indicesEmpty,
+              &MeshCodecTest::indicesRatio,
+              &MeshCodecTest::indicesInvalid,
+
+              &MeshCodecTest::vertices,
+              &MeshCodecTest::verticesEmpty,
+              &MeshCodecTest::verticesRatio,
+              &MeshCodecTest::verticesInvalid,
+              &MeshCodecTest::verticesWrongStride});
+}
+
+namespace {
+
+std::vector<UnsignedInt> decodedIndices(const Containers::ArrayView<const char> data) {
+    Containers::Array<char> indexData;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices(data);
+
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i < indexData.size(); ) switch(type) {
+        case Mesh::IndexType::UnsignedByte:
+            out.push_back(reinterpret_cast<const UnsignedByte&>(indexData[i]));
+            i += 1;
+            break;
+        case Mesh::IndexType::UnsignedShort:
+            out.push_back(reinterpret_cast<const UnsignedShort&>(indexData[i]));
+            i += 2;
+            break;
+        case Mesh::IndexType::UnsignedInt:
+            out.push_back(reinterpret_cast<const UnsignedInt&>(indexData[i]));
+            i += 4;
+            break;
+    }
+    return out;
+}
+
+/* Tipsified grid, triangles sharing edges are next to each other */
+std::vector<UnsignedInt> gridIndices(const UnsignedInt size) {
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt a = y*(size + 1) + x;
+        const UnsignedInt c = a + size + 1;
+        indices.insert(indices.end(), {a, a + 1, c + 1, a, c + 1, c});
+    }
+    return indices;
+}
+
+}
+
+void MeshCodecTest::indices() {
+    const std::vector<UnsignedInt> indices{
+        /* Fan */
+        0, 1, 2, 0, 2, 3, 0, 3, 4,
+        /* Large jumps in both directions */
+        100000, 5, 4000000000u, 0, 4294967295u, 17,
+        /* Trailing non-triangle */
+        3};
+
+    const Containers::Array<char> data = MeshTools::encodeIndices(indices);
+    CORRADE_COMPARE(decodedIndices({data.data(), data.size()}), indices);
+}
+
+void MeshCodecTest::indicesType() {
+    Containers::Array<char> indexData;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+
+    Containers::Array<char> data = MeshTools::encodeIndices({3, 255, 4});
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({data.data(), data.size()});
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(indexData.size(), 3);
+    CORRADE_COMPARE(start, 3);
+    CORRADE_COMPARE(end, 255);
+
+    data = MeshTools::encodeIndices({256, 70, 65535});
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({data.data(), data.size()});
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(indexData.size(), 6);
+    CORRADE_COMPARE(start, 70);
+    CORRADE_COMPARE(end, 65535);
+
+    data = MeshTools::encodeIndices({65536, 0, 1});
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({data.data(), data.size()});
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(indexData.size(), 12);
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 65536);
+}
+
+void MeshCodecTest::indicesEmpty() {
+    const Containers::Array<char> data = MeshTools::encodeIndices({});
+    CORRADE_COMPARE(data.size(), 5);
+    CORRADE_VERIFY(decodedIndices({data.data(), data.size()}).empty());
+}
+
+void MeshCodecTest::indicesRatio() {
+    const std::vector<UnsignedInt> indices = gridIndices(256);
+    const Containers::Array<char> data = MeshTools::encodeIndices(indices);
+    CORRADE_COMPARE(decodedIndices({data.data(), data.size()}), indices);
+
+    /* Most indices take a single byte, compared to two with
+       compressIndices() */
+    CORRADE_VERIFY(data.size() < indices.size()*11/10);
+}
+
+void MeshCodecTest::indicesInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const Containers::Array<char> data = MeshTools::encodeIndices({0, 1, 300, 2});
+    Containers::Array<char> indexData;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({data.data(), data.size() - 1});
+    CORRADE_VERIFY(!indexData);
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({data.data() + 1, data.size() - 1});
+    CORRADE_VERIFY(!indexData);
+
+    /* Index larger than the maximum from header */
+    std::string corrupted{data.data(), data.size()};
+    corrupted[corrupted.size() - 1] = 0x7e;
+    std::tie(indexData, type, start, end) = MeshTools::decodeIndices({corrupted.data(), corrupted.size()});
+    CORRADE_VERIFY(!indexData);
+
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::decodeIndices(): invalid index data\n"
+        "MeshTools::decodeIndices(): invalid header\n"
+        "MeshTools::decodeIndices(): invalid index data\n");
+}
+
+void MeshCodecTest::vertices() {
+    /* Exercise partial groups, blocks and column chunks, with data smooth in
+       some bytes and random in others */
+    UnsignedInt seed = 1;
+    for(const std::size_t stride: {1, 3, 12, 16, 20, 33, 256})
+    for(const std::size_t count: {1, 15, 16, 17, 255, 256, 257, 1000}) {
+        std::vector<char> vertices(stride*count);
+        for(std::size_t i = 0; i != count; ++i) for(std::size_t k = 0; k != stride; ++k) {
+            seed = seed*1664525u + 1013904223u;
+            vertices[i*stride + k] = char(k%3 == 0 ? i*k/7 : k%3 == 1 ? seed >> 24 : (i/16)*5 + ((seed >> 24) & 0x03));
+        }
+
+        const Containers::Array<char> data = MeshTools::encodeVertices({vertices.data(), vertices.size()}, stride);
+        const Containers::Array<char> decoded = MeshTools::decodeVertices({data.data(), data.size()});
+        CORRADE_COMPARE(decoded.size(), vertices.size());
+        CORRADE_VERIFY(std::memcmp(decoded.data(), vertices.data(), vertices.size()) == 0);
+    }
+}
+
+void MeshCodecTest::verticesEmpty() {
+    const Containers::Array<char> data = MeshTools::encodeVertices(std::vector<Vector3>{});
+    CORRADE_COMPARE(data.size(), 4);
+    CORRADE_VERIFY(MeshTools::decodeVertices({data.data(), data.size()}).empty());
+}
+
+void MeshCodecTest::verticesRatio() {
+    /* Quantized sloped grid, stored as x, y, z shorts and padded */
+    struct Vertex {
+        UnsignedShort position[3];
+        UnsignedShort padding;
+    };
+    std::vector<Vertex> vertices;
+    for(UnsignedShort y = 0; y != 256; ++y) for(UnsignedShort x = 0; x != 256; ++x)
+        vertices.push_back({{x, y, UnsignedShort((x + y)/2)}, 0});
+
+    const Containers::Array<char> data = MeshTools::encodeVertices(vertices);
+    const Containers::Array<char> decoded = MeshTools::decodeVertices({data.data(), data.size()});
+    CORRADE_COMPARE(decoded.size(), vertices.size()*sizeof(Vertex));
+    CORRADE_VERIFY(std::memcmp(decoded.data(), vertices.data(), decoded.size()) == 0);
+
+    /* Smooth data compress to less than a tenth */
+    CORRADE_VERIFY(data.size()*10 < decoded.size());
+}
+
+void MeshCodecTest::verticesInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const std::vector<Vector3> vertices(100, Vector3{1.0f, 2.0f, 3.0f});
+    const Containers::Array<char> data = MeshTools::encodeVertices(vertices);
+    CORRADE_VERIFY(!MeshTools::decodeVertices({data.data(), data.size() - 1}));
+    CORRADE_VERIFY(!MeshTools::decodeVertices({data.data(), 3}));
+
+    std::string appended{data.data(), data.size()};
+    appended += '\0';
+    CORRADE_VERIFY(!MeshTools::decodeVertices({appended.data(), appended.size()}));
+
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::decodeVertices(): invalid vertex data\n"
+        "MeshTools::decodeVertices(): invalid header\n"
+        "MeshTools::decodeVertices(): invalid vertex data\n");
+}
+
+void MeshCodecTest::verticesWrongStride() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const char data[12]{};
+    CORRADE_VERIFY(!MeshTools::encodeVertices(data, 5));
+    CORRADE_VERIFY(!MeshTools::encodeVertices(data, 0));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::encodeVertices(): expected stride between 1 and 256 and data size divisible by it but got 5 and 12\n"
+        "MeshTools::encodeVertices(): expected stride between 1 and 256 and data size divisible by it but got 0 and 12\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshCodecTest)
@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/MeshTools/Quantize.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void positions();
+    void positionsFlat();
+    void positionsEmpty();
+    void positionsErrorBound();
+    void normalsErrorBound();
+    void textureCoordinatesErrorBound();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::positions,
+              &QuantizeTest::positionsFlat,
+              &QuantizeTest::positionsEmpty,
+              &QuantizeTest::positionsErrorBound,
+              &QuantizeTest::normalsErrorBound,
+              &QuantizeTest::textureCoordinatesErrorBound});
+}
+
+namespace {
+
+Vector3 dequantize(const Matrix4& matrix, const Math::Vector3<UnsignedShort>& value) {
+    return matrix.transformPoint(Vector3{Float(value.x()), Float(value.y()), Float(value.z())}/65535.0f);
+}
+
+Double angle(const Vector3& a, const Vector3& b) {
+    const Math::Vector3<Double> ad{a.x(), a.y(), a.z()};
+    const Math::Vector3<Double> bd{b.x(), b.y(), b.z()};
+    return std::atan2(Math::cross(ad, bd).length(), Math::dot(ad, bd));
+}
+
+/* Deterministic pseudo-random numbers in [0, 1) */
+struct Random {
+    Float operator()() {
+        seed = seed*1664525u + 1013904223u;
+        return Float(seed >> 8)/Float(1 << 24);
+    }
+
+    UnsignedInt seed{7};
+};
+
+}
+
+void QuantizeTest::positions() {
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    Matrix4 dequantization;
+    std::tie(quantized, dequantization) = MeshTools::quantizePositions({
+        {-1.0f, 2.0f, 10.0f},
+        {3.0f, 4.0f, 12.0f},
+        {1.0f, 3.0f, 10.5f}});
+
+    CORRADE_COMPARE(quantized, (std::vector<Math::Vector3<UnsignedShort>>{
+        {0, 0, 0},
+        {65535, 65535, 65535},
+        {32768, 32768, 16384}}));
+    CORRADE_COMPARE(dequantization, Matrix4::translation({-1.0f, 2.0f, 10.0f})*Matrix4::scaling({4.0f, 2.0f, 2.0f}));
+    CORRADE_COMPARE(dequantize(dequantization, quantized[1]), (Vector3{3.0f, 4.0f, 12.0f}));
+}
+
+void QuantizeTest::positionsFlat() {
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    Matrix4 dequantization;
+    std::tie(quantized, dequantization) = MeshTools::quantizePositions({
+        {-1.0f, 2.0f, 5.0f},
+        {3.0f, 2.0f, 5.0f}});
+
+    /* Flat axes are quantized to zero and map back to the original value */
+    CORRADE_COMPARE(quantized, (std::vector<Math::Vector3<UnsignedShort>>{
+        {0, 0, 0},
+        {65535, 0, 0}}));
+    CORRADE_COMPARE(dequantize(dequantization, quantized[0]), (Vector3{-1.0f, 2.0f, 5.0f}));
+    CORRADE_COMPARE(dequantize(dequantization, quantized[1]), (Vector3{3.0f, 2.0f, 5.0f}));
+}
+
+void QuantizeTest::positionsEmpty() {
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    Matrix4 dequantization;
+    std::tie(quantized, dequantization) = MeshTools::quantizePositions({});
+    CORRADE_VERIFY(quantized.empty());
+    CORRADE_COMPARE(dequantization, Matrix4{});
+}
+
+void QuantizeTest::positionsErrorBound() {
+    Random random;
+    const Vector3 size{100.0f, 1.0f, 20.0f};
+    std::vector<Vector3> positions;
+    for(std::size_t i = 0; i != 10000; ++i)
+        positions.push_back(Vector3{random(), random(), random()}*size - Vector3{50.0f});
+    positions.push_back(Vector3{-50.0f});
+    positions.push_back(size - Vector3{50.0f});
+
+    std::vector<Math::Vector3<UnsignedShort>> quantized;
+    Matrix4 dequantization;
+    std::tie(quantized, dequantization) = MeshTools::quantizePositions(positions);
+
+    /* Half of the quantization step, with some slack for float precision */
+    Vector3 maxError;
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        maxError = Math::max(maxError, Math::abs(dequantize(dequantization, quantized[i]) - positions[i])/size);
+    Debug() << "Maximal relative position error:" << maxError;
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_VERIFY(maxError[i] < 0.5f/65535.0f + 1.0e-6f);
+}
+
+void QuantizeTest::normalsErrorBound() {
+    /* Fibonacci sphere */
+    std::vector<Vector3> normals;
+    for(std::size_t i = 0; i != 100000; ++i) {
+        const Float z = 1.0f - 2.0f*(i + 0.5f)/100000.0f;
+        const Float r = std::sqrt(1.0f - z*z);
+        const Rad phi(i*2.39996323f);
+        normals.push_back({r*Math::cos(phi), r*Math::sin(phi), z});
+    }
+
+    std::vector<Math::Vector2<Byte>> packed8(normals.size());
+    std::vector<Math::Vector2<Short>> packed16(normals.size());
+    std::vector<Vector3> unpacked8(normals.size()), unpacked16(normals.size());
+    Math::Batch::packOctahedral<Byte>({normals.data(), normals.size()}, {packed8.data(), packed8.size()});
+    Math::Batch::packOctahedral<Short>({normals.data(), normals.size()}, {packed16.data(), packed16.size()});
+    Math::Batch::unpackOctahedral<Byte>({packed8.data(), packed8.size()}, {unpacked8.data(), unpacked8.size()});
+    Math::Batch::unpackOctahedral<Short>({packed16.data(), packed16.size()}, {unpacked16.data(), unpacked16.size()});
+
+    /* Angle from cross and dot product in doubles, acos() of a float dot
+       product is too imprecise for small angles */
+    Double maxAngle8{}, maxAngle16{};
+    for(std::size_t i = 0; i != normals.size(); ++i) {
+        maxAngle8 = Math::max(maxAngle8, angle(normals[i], unpacked8[i]));
+        maxAngle16 = Math::max(maxAngle16, angle(normals[i], unpacked16[i]));
+    }
+    const Deg maxError8{Rad{Float(maxAngle8)}};
+    const Deg maxError16{Rad{Float(maxAngle16)}};
+    Debug() << "Maximal octahedral normal error:" << Float(maxError8) << "degrees with 8 bits," << Float(maxError16) << "degrees with 16 bits";
+    CORRADE_VERIFY(maxError8 < Deg(1.0f));
+    CORRADE_VERIFY(maxError16 < Deg(0.01f));
+}
+
+void QuantizeTest::textureCoordinatesErrorBound() {
+    Random random;
+    std::vector<Float> coords;
+    for(std::size_t i = 0; i != 100000; ++i)
+        coords.push_back(random()*4.0f - 2.0f);
+
+    std::vector<Half> packed(coords.size());
+    std::vector<Float> unpacked(coords.size());
+    Math::Batch::packHalf({coords.data(), coords.size()}, {packed.data(), packed.size()});
+    Math::Batch::unpackHalf({packed.data(), packed.size()}, {unpacked.data(), unpacked.size()});
+
+    /* Half of the mantissa step relative to the value, absolute in [0, 1)
+       range is at most half of the step below one */
+    Float maxRelativeError{}, maxUnitError{};
+    for(std::size_t i = 0; i != coords.size(); ++i) {
+        const Float error = std::abs(unpacked[i] - coords[i]);
+        if(std::abs(coords[i]) >= 1.0e-4f)
+            maxRelativeError = Math::max(maxRelativeError, error/std::abs(coords[i]));
+        if(std::abs(coords[i]) < 1.0f)
+            maxUnitError = Math::max(maxUnitError, error);
+    }
+    Debug() << "Maximal half-float texture coordinate error:" << maxRelativeError << "relative," << maxUnitError << "in [-1, 1] range";
+    CORRADE_VERIFY(maxRelativeError <= 1.0f/2048.0f);
+    CORRADE_VERIFY(maxUnitError <= 1.0f/4096.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
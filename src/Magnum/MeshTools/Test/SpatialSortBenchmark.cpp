@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <numeric>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/SpatialSort.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SpatialSortBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit SpatialSortBenchmark();
+
+    void removeDuplicates();
+    void sortTrianglesRemoveDuplicates();
+    void generateSmoothNormals();
+    void generateSmoothNormalsSorted();
+    void sortVertices();
+    void sortVerticesHilbert();
+
+    private:
+        std::vector<UnsignedInt> _indices, _sortedIndices;
+        std::vector<Vector3> _positions, _sortedPositions;
+};
+
+namespace {
+    enum: UnsignedInt { Size = 512 };
+}
+
+/* Grid with vertices and faces in pseudo-random order, similar to what
+   comes out of some exporters */
+SpatialSortBenchmark::SpatialSortBenchmark(): AbstractBenchmarkTester{10} {
+    addTests({&SpatialSortBenchmark::removeDuplicates,
+              &SpatialSortBenchmark::sortTrianglesRemoveDuplicates,
+              &SpatialSortBenchmark::generateSmoothNormals,
+              &SpatialSortBenchmark::generateSmoothNormalsSorted,
+              &SpatialSortBenchmark::sortVertices,
+              &SpatialSortBenchmark::sortVerticesHilbert});
+
+    const UnsignedInt count = (Size + 1)*(Size + 1);
+    std::vector<UnsignedInt> shuffled(count);
+    for(UnsignedInt i = 0; i != count; ++i) shuffled[i] = (std::uint64_t(i)*104729) % count;
+
+    _positions.resize(count);
+    for(UnsignedInt y = 0; y <= Size; ++y) for(UnsignedInt x = 0; x <= Size; ++x)
+        _positions[shuffled[y*(Size + 1) + x]] = {Float(x), Float(y), Float((x*y) % 7)};
+
+    const UnsignedInt faceCount = Size*Size;
+    _indices.resize(faceCount*6);
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt a = shuffled[y*(Size + 1) + x];
+        const UnsignedInt b = shuffled[y*(Size + 1) + x + 1];
+        const UnsignedInt c = shuffled[(y + 1)*(Size + 1) + x];
+        const UnsignedInt d = shuffled[(y + 1)*(Size + 1) + x + 1];
+        UnsignedInt* const quad = _indices.data() + (std::uint64_t(y*Size + x)*7919 % faceCount)*6;
+        quad[0] = a; quad[1] = b; quad[2] = d;
+        quad[3] = a; quad[4] = d; quad[5] = c;
+    }
+
+    _sortedIndices = _indices;
+    _sortedPositions = _positions;
+    MeshTools::sortTrianglesSpatially(_sortedIndices, _sortedPositions, SpaceFillingCurve::Hilbert);
+    MeshTools::sortVerticesSpatially(_sortedIndices, _sortedPositions, SpaceFillingCurve::Hilbert);
+}
+
+void SpatialSortBenchmark::removeDuplicates() {
+    const std::vector<Vector3> duplicated = MeshTools::duplicate(_indices, _positions);
+
+    MAGNUM_BENCHMARK("removeDuplicates", duplicated.size()) {
+        std::vector<Vector3> positions = duplicated;
+        std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(positions);
+        escape(indices.data());
+    }
+}
+
+void SpatialSortBenchmark::sortTrianglesRemoveDuplicates() {
+    const std::vector<Vector3> duplicated = MeshTools::duplicate(_indices, _positions);
+
+    MAGNUM_BENCHMARK("sortTrianglesSpatially, removeDuplicates", duplicated.size()) {
+        std::vector<UnsignedInt> indices(duplicated.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        MeshTools::sortTrianglesSpatially(indices, duplicated);
+        std::vector<Vector3> positions = MeshTools::duplicate(indices, duplicated);
+        indices = MeshTools::removeDuplicates(positions);
+        escape(indices.data());
+    }
+}
+
+void SpatialSortBenchmark::generateSmoothNormals() {
+    MAGNUM_BENCHMARK("generateSmoothNormals", _indices.size()/3) {
+        const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(_indices, _positions, NormalWeighting::Area, 1);
+        escape(normals.data());
+    }
+}
+
+void SpatialSortBenchmark::generateSmoothNormalsSorted() {
+    MAGNUM_BENCHMARK("generateSmoothNormals, sorted mesh", _sortedIndices.size()/3) {
+        const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(_sortedIndices, _sortedPositions, NormalWeighting::Area, 1);
+        escape(normals.data());
+    }
+}
+
+void SpatialSortBenchmark::sortVertices() {
+    MAGNUM_BENCHMARK("sortVerticesSpatially, Morton", _positions.size()) {
+        std::vector<UnsignedInt> indices = _indices;
+        std::vector<Vector3> positions = _positions;
+        MeshTools::sortVerticesSpatially(indices, positions, SpaceFillingCurve::Morton);
+        escape(positions.data());
+    }
+}
+
+void SpatialSortBenchmark::sortVerticesHilbert() {
+    MAGNUM_BENCHMARK("sortVerticesSpatially, Hilbert", _positions.size()) {
+        std::vector<UnsignedInt> indices = _indices;
+        std::vector<Vector3> positions = _positions;
+        MeshTools::sortVerticesSpatially(indices, positions, SpaceFillingCurve::Hilbert);
+        escape(positions.data());
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SpatialSortBenchmark)
@@ -0,0 +1,241 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/SpatialSort.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SpatialSortTest: TestSuite::Tester {
+    explicit SpatialSortTest();
+
+    void mortonCodes();
+    void hilbertCodes();
+    void codesEmpty();
+    void codesDegenerate();
+    void sortVertices();
+    void sortTriangles();
+    void reorder();
+    void reorderWrongSize();
+    void wrongIndexCount();
+    void debugCurve();
+};
+
+SpatialSortTest::SpatialSortTest() {
+    addTests({&SpatialSortTest::mortonCodes,
+              &SpatialSortTest::hilbertCodes,
+              &SpatialSortTest::codesEmpty,
+              &SpatialSortTest::codesDegenerate,
+              &SpatialSortTest::sortVertices,
+              &SpatialSortTest::sortTriangles,
+              &SpatialSortTest::reorder,
+              &SpatialSortTest::reorderWrongSize,
+              &SpatialSortTest::wrongIndexCount,
+              &SpatialSortTest::debugCurve});
+}
+
+namespace {
+
+/* Grid of quads, vertices are listed in shuffled order */
+void shuffledGrid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    const UnsignedInt count = (size + 1)*(size + 1);
+    std::vector<UnsignedInt> shuffled(count);
+    for(UnsignedInt i = 0; i != count; ++i) shuffled[i] = (i*7919) % count;
+
+    positions.resize(count);
+    for(UnsignedInt y = 0; y <= size; ++y) for(UnsignedInt x = 0; x <= size; ++x)
+        positions[shuffled[y*(size + 1) + x]] = {Float(x), Float(y), 0.0f};
+
+    indices.clear();
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt a = shuffled[y*(size + 1) + x];
+        const UnsignedInt b = shuffled[y*(size + 1) + x + 1];
+        const UnsignedInt c = shuffled[(y + 1)*(size + 1) + x];
+        const UnsignedInt d = shuffled[(y + 1)*(size + 1) + x + 1];
+        indices.insert(indices.end(), {a, b, d, a, d, c});
+    }
+}
+
+}
+
+void SpatialSortTest::mortonCodes() {
+    const std::vector<UnsignedInt> codes = MeshTools::spaceFillingCurveCodes({
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, 2.0f},
+        {2.0f, 0.0f, 2.0f},
+        {2.0f, 2.0f, 2.0f}}, SpaceFillingCurve::Morton);
+
+    CORRADE_COMPARE(codes, (std::vector<UnsignedInt>{
+        0x00000000, 0x24924924, 0x12492492, 0x09249249, 0x2db6db6d,
+        0x3fffffff}));
+}
+
+void SpatialSortTest::hilbertCodes() {
+    /* The first 512 points along the curve fill the 8x8x8 cube at origin,
+       the last point is there only to have the quantization scale 1 */
+    std::vector<Vector3> positions;
+    for(Int z = 0; z != 8; ++z) for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 8; ++x)
+        positions.emplace_back(x, y, z);
+    positions.emplace_back(1023.0f);
+
+    std::vector<UnsignedInt> codes = MeshTools::spaceFillingCurveCodes(positions, SpaceFillingCurve::Hilbert);
+    CORRADE_COMPARE(codes.size(), 513);
+
+    /* Each code is there exactly once */
+    std::vector<Int> points(512, -1);
+    for(std::size_t i = 0; i != 512; ++i) {
+        CORRADE_VERIFY(codes[i] < 512);
+        CORRADE_COMPARE(points[codes[i]], -1);
+        points[codes[i]] = i;
+    }
+
+    /* Consecutive points on the curve are neighbors */
+    CORRADE_COMPARE(positions[points[0]], Vector3{});
+    for(std::size_t i = 1; i != 512; ++i)
+        CORRADE_COMPARE(Math::abs(positions[points[i]] - positions[points[i - 1]]).sum(), 1.0f);
+}
+
+void SpatialSortTest::codesEmpty() {
+    CORRADE_VERIFY(MeshTools::spaceFillingCurveCodes({}).empty());
+    CORRADE_VERIFY(MeshTools::spatialVertexOrder({}, SpaceFillingCurve::Hilbert).empty());
+}
+
+void SpatialSortTest::codesDegenerate() {
+    /* All points are the same, the order shouldn't change */
+    const std::vector<Vector3> positions(5, Vector3{3.0f, -1.0f, 2.0f});
+    CORRADE_COMPARE(MeshTools::spaceFillingCurveCodes(positions), (std::vector<UnsignedInt>(5, 0)));
+    CORRADE_COMPARE(MeshTools::spatialVertexOrder(positions), (std::vector<UnsignedInt>{0, 1, 2, 3, 4}));
+}
+
+void SpatialSortTest::sortVertices() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    shuffledGrid(16, indices, positions);
+    const std::vector<UnsignedInt> originalIndices = indices;
+    const std::vector<Vector3> originalPositions = positions;
+
+    for(const SpaceFillingCurve curve: {SpaceFillingCurve::Morton, SpaceFillingCurve::Hilbert}) {
+        std::vector<UnsignedInt> sortedIndices = originalIndices;
+        std::vector<Vector3> sortedPositions = originalPositions;
+        const std::vector<UnsignedInt> order = MeshTools::sortVerticesSpatially(sortedIndices, sortedPositions, curve);
+
+        /* Faces reference the same positions as before */
+        CORRADE_COMPARE(sortedIndices.size(), originalIndices.size());
+        for(std::size_t i = 0; i != sortedIndices.size(); ++i)
+            CORRADE_COMPARE(sortedPositions[sortedIndices[i]], originalPositions[originalIndices[i]]);
+        for(std::size_t i = 0; i != order.size(); ++i)
+            CORRADE_COMPARE(sortedPositions[i], originalPositions[order[i]]);
+
+        /* Codes are in ascending order */
+        const std::vector<UnsignedInt> codes = MeshTools::spaceFillingCurveCodes(sortedPositions, curve);
+        for(std::size_t i = 1; i != codes.size(); ++i)
+            CORRADE_VERIFY(codes[i - 1] <= codes[i]);
+    }
+
+    /* With Hilbert curve on the 17x17 grid the neighboring vertices are far
+       closer than in the shuffled order */
+    std::vector<Vector3> sortedPositions = originalPositions;
+    MeshTools::sortVerticesSpatially(indices, sortedPositions, SpaceFillingCurve::Hilbert);
+    Float distance{}, originalDistance{};
+    for(std::size_t i = 1; i != positions.size(); ++i) {
+        distance += (sortedPositions[i] - sortedPositions[i - 1]).length();
+        originalDistance += (originalPositions[i] - originalPositions[i - 1]).length();
+    }
+    CORRADE_VERIFY(distance*4.0f < originalDistance);
+}
+
+void SpatialSortTest::sortTriangles() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    shuffledGrid(16, indices, positions);
+
+    std::vector<UnsignedInt> sorted = indices;
+    MeshTools::sortTrianglesSpatially(sorted, positions, SpaceFillingCurve::Hilbert);
+
+    /* The same triangles with the same winding, just in different order */
+    CORRADE_COMPARE(sorted.size(), indices.size());
+    std::vector<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt>> original, result;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        original.emplace_back(indices[i], indices[i + 1], indices[i + 2]);
+        result.emplace_back(sorted[i], sorted[i + 1], sorted[i + 2]);
+    }
+    CORRADE_VERIFY(original != result);
+    std::sort(original.begin(), original.end());
+    std::sort(result.begin(), result.end());
+    CORRADE_VERIFY(original == result);
+
+    /* Centroid codes are in ascending order */
+    std::vector<Vector3> centroids;
+    for(std::size_t i = 0; i != sorted.size(); i += 3)
+        centroids.push_back((positions[sorted[i]] + positions[sorted[i + 1]] + positions[sorted[i + 2]])/3.0f);
+    const std::vector<UnsignedInt> codes = MeshTools::spaceFillingCurveCodes(centroids, SpaceFillingCurve::Hilbert);
+    for(std::size_t i = 1; i != codes.size(); ++i)
+        CORRADE_VERIFY(codes[i - 1] <= codes[i]);
+}
+
+void SpatialSortTest::reorder() {
+    std::vector<Int> data{10, 11, 12, 13};
+    MeshTools::reorderVertices(data, {2, 0, 3, 1});
+    CORRADE_COMPARE(data, (std::vector<Int>{12, 10, 13, 11}));
+}
+
+void SpatialSortTest::reorderWrongSize() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<Int> data{10, 11, 12};
+    MeshTools::reorderVertices(data, {2, 0, 3, 1});
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(ss.str(), "MeshTools::reorderVertices(): expected 4 items but got 3\n");
+}
+
+void SpatialSortTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::sortTrianglesSpatially(indices, {{}, {}});
+    CORRADE_COMPARE(indices.size(), 2);
+    CORRADE_COMPARE(ss.str(), "MeshTools::sortTrianglesSpatially(): index count is not divisible by 3!\n");
+}
+
+void SpatialSortTest::debugCurve() {
+    std::ostringstream out;
+
+    Debug(&out) << SpaceFillingCurve::Hilbert << SpaceFillingCurve(0xde);
+    CORRADE_COMPARE(out.str(), "MeshTools::SpaceFillingCurve::Hilbert MeshTools::SpaceFillingCurve::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SpatialSortTest)
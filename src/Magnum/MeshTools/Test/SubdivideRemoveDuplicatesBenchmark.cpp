@@ -23,62 +23,99 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include "SubdivideRemoveDuplicatesBenchmark.h"
-
-#include <QtTest/QTest>
-
-#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
-
-QTEST_APPLESS_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
+struct SubdivideRemoveDuplicatesBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit SubdivideRemoveDuplicatesBenchmark();
+
+    void subdivide();
+    void subdivideAndRemoveDuplicatesMeshAfter();
+    void subdivideAndRemoveDuplicatesMeshBetween();
+    void subdivideWelded();
+
+    private:
+        Trade::MeshData3D _icosahedron;
+};
+
+namespace {
+    enum: UnsignedInt { Subdivisions = 5 };
+
+    Vector3 interpolator(const Vector3& a, const Vector3& b) {
+        return (a+b).normalized();
+    }
+}
+
+SubdivideRemoveDuplicatesBenchmark::SubdivideRemoveDuplicatesBenchmark(): AbstractBenchmarkTester{10}, _icosahedron{Primitives::Icosphere::solid(0)} {
+    addTests({&SubdivideRemoveDuplicatesBenchmark::subdivide,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideWelded});
+}
+
 void SubdivideRemoveDuplicatesBenchmark::subdivide() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
+    MAGNUM_BENCHMARK("subdivide", 1) {
+        std::vector<UnsignedInt> indices = _icosahedron.indices();
+        std::vector<Vector3> positions = _icosahedron.positions(0);
+
+        for(UnsignedInt i = 0; i != Subdivisions; ++i)
+            MeshTools::subdivide(indices, positions, interpolator);
+
+        escape(positions.data());
+        escape(indices.data());
     }
 }
 
 void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
+    MAGNUM_BENCHMARK("subdivide, removeDuplicates after", 1) {
+        std::vector<UnsignedInt> indices = _icosahedron.indices();
+        std::vector<Vector3> positions = _icosahedron.positions(0);
 
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
+        for(UnsignedInt i = 0; i != Subdivisions; ++i)
+            MeshTools::subdivide(indices, positions, interpolator);
 
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
+        indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+
+        escape(positions.data());
+        escape(indices.data());
     }
 }
 
 void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
+    MAGNUM_BENCHMARK("subdivide, removeDuplicates between", 1) {
+        std::vector<UnsignedInt> indices = _icosahedron.indices();
+        std::vector<Vector3> positions = _icosahedron.positions(0);
+
+        for(UnsignedInt i = 0; i != Subdivisions; ++i) {
+            MeshTools::subdivide(indices, positions, interpolator);
+            indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+        }
+
+        escape(positions.data());
+        escape(indices.data());
+    }
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivideWelded() {
+    MAGNUM_BENCHMARK("subdivideWelded", 1) {
+        std::vector<UnsignedInt> indices = _icosahedron.indices();
+        std::vector<Vector3> positions = _icosahedron.positions(0);
+
+        for(UnsignedInt i = 0; i != Subdivisions; ++i)
+            MeshTools::subdivideWelded(indices, positions, interpolator);
+
+        escape(positions.data());
+        escape(indices.data());
     }
 }
 
 }}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
@@ -24,6 +24,7 @@
 */
 
 #include <array>
+#include <list>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
@@ -40,6 +41,8 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+
+    void transformNonContiguous();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +50,9 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformNonContiguous});
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -116,6 +121,16 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+void TransformTest::transformNonContiguous() {
+    /* Containers without contiguous storage are transformed item by item */
+    std::list<Vector3> points{points3D[0], points3D[1]};
+    MeshTools::transformPointsInPlace(
+        Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationZ(Deg(90.0f)), points);
+
+    CORRADE_COMPARE(points.front(), points3DRotatedTranslated[0]);
+    CORRADE_COMPARE(points.back(), points3DRotatedTranslated[1]);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
@@ -27,6 +27,8 @@
 
 #include <stack>
 
+#include "Magnum/MeshTools/Implementation/Adjacency.h"
+
 namespace Magnum { namespace MeshTools { namespace Implementation {
 
 void Tipsify::operator()(std::size_t cacheSize) {
@@ -130,32 +132,16 @@ void Tipsify::operator()(std::size_t cacheSize) {
 }
 
 void Tipsify::buildAdjacency(std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) const {
-    /* How many times is each vertex referenced == count of neighboring
-       triangles for each vertex */
-    liveTriangleCount.clear();
-    liveTriangleCount.resize(vertexCount);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        ++liveTriangleCount[indices[i]];
-
-    /* Building offset array from counts. Neighbors for i-th vertex will at
-       the end be in interval neighbors[neighborOffset[i]] ;
-       neighbors[neighborOffset[i+1]]. Currently the values are shifted to
-       right, because the next loop will shift them back left. */
-    neighborOffset.clear();
-    neighborOffset.reserve(vertexCount+1);
-    neighborOffset.push_back(0);
-    UnsignedInt sum = 0;
-    for(std::size_t i = 0; i != vertexCount; ++i) {
-        neighborOffset.push_back(sum);
-        sum += liveTriangleCount[i];
-    }
+    /* Neighbors for i-th vertex are in interval neighbors[neighborOffset[i]] ;
+       neighbors[neighborOffset[i+1]], converted from the shared corner
+       adjacency */
+    Implementation::buildVertexCorners(indices, vertexCount, neighborOffset, neighbors);
+    for(UnsignedInt& neighbor: neighbors) neighbor /= 3;
 
-    /* Array of neighbors, using (and changing) neighborOffset array for
-       positioning */
-    neighbors.clear();
-    neighbors.resize(sum);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        neighbors[neighborOffset[indices[i]+1]++] = i/3;
+    /* Count of neighboring triangles for each vertex */
+    liveTriangleCount.resize(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        liveTriangleCount[i] = neighborOffset[i + 1] - neighborOffset[i];
 }
 
 }}}
@@ -29,11 +29,38 @@
  * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints()
  */
 
-#include "Magnum/Math/DualQuaternion.h"
-#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Batch.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace Implementation {
+    /* Contiguous containers are transformed in a single batch */
+    template<class T, class U> auto transformVectorsInPlace(const T& transformation, U& vectors, int) -> decltype(vectors.data(), void()) {
+        const Containers::ArrayView<typename std::remove_pointer<decltype(vectors.data())>::type> view{vectors.data(), vectors.size()};
+        Math::Batch::transformVectors(transformation, view, view);
+    }
+
+    template<class T, class U> void transformVectorsInPlace(const T& transformation, U& vectors, ...) {
+        for(auto& vector: vectors) {
+            const Containers::ArrayView<typename std::remove_reference<decltype(vector)>::type> view{&vector, 1};
+            Math::Batch::transformVectors(transformation, view, view);
+        }
+    }
+
+    template<class T, class U> auto transformPointsInPlace(const T& transformation, U& points, int) -> decltype(points.data(), void()) {
+        const Containers::ArrayView<typename std::remove_pointer<decltype(points.data())>::type> view{points.data(), points.size()};
+        Math::Batch::transformPoints(transformation, view, view);
+    }
+
+    template<class T, class U> void transformPointsInPlace(const T& transformation, U& points, ...) {
+        for(auto& point: points) {
+            const Containers::ArrayView<typename std::remove_reference<decltype(point)>::type> view{&point, 1};
+            Math::Batch::transformPoints(transformation, view, view);
+        }
+    }
+}
+
 /**
 @brief Transform vectors in-place using given transformation
 
@@ -44,7 +71,10 @@ is normalized, no further requirements are for other transformation
 representations.
 
 Unlike in @ref transformPointsInPlace(), the transformation does not involve
-translation.
+translation. Containers with contiguous storage (i.e. having `data()` and
+`size()` members) are transformed in a single batch using
+@ref Math::Batch::transformVectors(), other containers are transformed item by
+item.
 
 Example usage:
 @code
@@ -59,22 +89,22 @@ MeshTools::transformVectorsInPlace(rotation, vectors);
 @todo GPU transform feedback implementation (otherwise this is only bad joke)
 */
 template<class T, class U> void transformVectorsInPlace(const Math::Quaternion<T>& normalizedQuaternion, U& vectors) {
-    for(auto& vector: vectors) vector = normalizedQuaternion.transformVectorNormalized(vector);
+    Implementation::transformVectorsInPlace(normalizedQuaternion, vectors, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformVectorsInPlace(const Math::Complex<T>& complex, U& vectors) {
-    for(auto& vector: vectors) vector = complex.transformVector(vector);
+    Implementation::transformVectorsInPlace(complex, vectors, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformVectorsInPlace(const Math::Matrix3<T>& matrix, U& vectors) {
-    for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    Implementation::transformVectorsInPlace(matrix, vectors, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U& vectors) {
-    for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    Implementation::transformVectorsInPlace(matrix, vectors, 0);
 }
 
 /**
@@ -99,7 +129,10 @@ with compatible vector type as @p vectors. Expects that
 requirements are for other transformation representations.
 
 Unlike in @ref transformVectorsInPlace(), the transformation also involves
-translation.
+translation. Containers with contiguous storage (i.e. having `data()` and
+`size()` members) are transformed in a single batch using
+@ref Math::Batch::transformPoints(), other containers are transformed item by
+item.
 
 Example usage:
 @code
@@ -114,22 +147,22 @@ MeshTools::transformPointsInPlace(rotation, points);
     @ref DualQuaternion::transformPointNormalized()
 */
 template<class T, class U> void transformPointsInPlace(const Math::DualQuaternion<T>& normalizedDualQuaternion, U& points) {
-    for(auto& point: points) point = normalizedDualQuaternion.transformPointNormalized(point);
+    Implementation::transformPointsInPlace(normalizedDualQuaternion, points, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformPointsInPlace(const Math::DualComplex<T>& dualComplex, U& points) {
-    for(auto& point: points) point = dualComplex.transformPoint(point);
+    Implementation::transformPointsInPlace(dualComplex, points, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformPointsInPlace(const Math::Matrix3<T>& matrix, U& points) {
-    for(auto& point: points) point = matrix.transformPoint(point);
+    Implementation::transformPointsInPlace(matrix, points, 0);
 }
 
 /** @overload */
 template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& matrix, U& points) {
-    for(auto& point: points) point = matrix.transformPoint(point);
+    Implementation::transformPointsInPlace(matrix, points, 0);
 }
 
 /**
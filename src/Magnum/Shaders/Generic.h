@@ -40,6 +40,10 @@ Definitions common for majority of shaders in @ref Shaders namespace, allowing
 mesh configured for the generic shader to be used with any of them. See
 @ref shaders-generic for more information.
 
+Location `3` is reserved for shader-specific attributes, such as
+@ref VertexColor::Color or @ref MeshVisualizer::VertexIndex, so generic
+attributes don't occupy it.
+
 @see @ref shaders, @ref Generic2D, @ref Generic3D
 */
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -66,6 +70,25 @@ template<UnsignedInt dimensions> struct Generic {
      * @ref Vector3, defined only in 3D.
      */
     typedef Attribute<2, Vector3> Normal;
+
+    /**
+     * @brief Octahedral-encoded vertex normal
+     *
+     * @ref Vector2, defined only in 3D. Alternative to @ref Normal occupying
+     * the same location, see @ref Math::packOctahedral() for the encoding.
+     * Used only by shaders explicitly supporting it, such as @ref Phong with
+     * @ref Phong::Flag::OctahedralNormals.
+     */
+    typedef Attribute<2, Vector2> OctahedralNormal;
+
+    /**
+     * @brief Vertex tangent
+     *
+     * @ref Vector4, defined only in 3D. The fourth component is handedness
+     * of the tangent space, see @ref MeshTools::generateTangents() for more
+     * information.
+     */
+    typedef Attribute<4, Vector4> Tangent;
 };
 #endif
 
@@ -87,6 +110,8 @@ template<> struct Generic<2>: BaseGeneric {
 template<> struct Generic<3>: BaseGeneric {
     typedef Attribute<0, Vector3> Position;
     typedef Attribute<2, Vector3> Normal;
+    typedef Attribute<2, Vector2> OctahedralNormal;
+    typedef Attribute<4, Vector4> Tangent;
 };
 #endif
 
@@ -58,10 +58,13 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     const Version version = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    const bool textured = !!(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture));
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    vert.addSource(flags ? "#define TEXTURED\n" : "")
+    vert.addSource(textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::OctahedralNormals ? "#define OCTAHEDRAL_NORMALS\n" : "")
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get("Phong.vert"));
     frag.addSource(flags & Flag::AmbientTexture ? "#define AMBIENT_TEXTURE\n" : "")
@@ -81,7 +84,7 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     {
         bindAttributeLocation(Position::Location, "position");
         bindAttributeLocation(Normal::Location, "normal");
-        if(flags) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        if(textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
@@ -102,7 +105,7 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    if(textured && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
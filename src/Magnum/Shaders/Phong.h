@@ -144,6 +144,14 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Generic3D::Normal Normal;
 
+        /**
+         * @brief Octahedral-encoded normal direction
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector2, used
+         * instead of @ref Normal if @ref Flag::OctahedralNormals is set.
+         */
+        typedef Generic3D::OctahedralNormal OctahedralNormal;
+
         /**
          * @brief 2D texture coordinates
          *
@@ -161,7 +169,14 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         enum class Flag: UnsignedByte {
             AmbientTexture = 1 << 0,    /**< The shader uses ambient texture instead of color */
             DiffuseTexture = 1 << 1,    /**< The shader uses diffuse texture instead of color */
-            SpecularTexture = 1 << 2    /**< The shader uses specular texture instead of color */
+            SpecularTexture = 1 << 2,   /**< The shader uses specular texture instead of color */
+
+            /**
+             * The shader expects normals in @ref OctahedralNormal attribute
+             * instead of @ref Normal. Useful together with quantized meshes,
+             * see @ref MeshTools::compile(const Trade::MeshData3D&, BufferUsage, PositionQuantization, NormalQuantization, TextureCoordinateQuantization).
+             */
+            OctahedralNormals = 1 << 3
         };
 
         /**
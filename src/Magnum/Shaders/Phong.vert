@@ -40,12 +40,18 @@ uniform mediump mat3 normalMatrix;
 uniform highp vec3 light;
 #endif
 
+#ifndef OCTAHEDRAL_NORMALS
+#define normalType vec3
+#else
+#define normalType vec2
+#endif
+
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec4 position;
-layout(location = NORMAL_ATTRIBUTE_LOCATION) in mediump vec3 normal;
+layout(location = NORMAL_ATTRIBUTE_LOCATION) in mediump normalType normal;
 #else
 in highp vec4 position;
-in mediump vec3 normal;
+in mediump normalType normal;
 #endif
 
 #ifdef TEXTURED
@@ -57,6 +63,16 @@ in mediump vec2 textureCoords;
 out mediump vec2 interpolatedTextureCoords;
 #endif
 
+#ifdef OCTAHEDRAL_NORMALS
+/* Inverse to Math::packOctahedral(), the result is not normalized */
+mediump vec3 unpackOctahedral(mediump vec2 packed) {
+    mediump vec3 unpacked = vec3(packed, 1.0 - abs(packed.x) - abs(packed.y));
+    if(unpacked.z < 0.0) unpacked.xy = (1.0 - abs(unpacked.yx))*
+        vec2(unpacked.x >= 0.0 ? 1.0 : -1.0, unpacked.y >= 0.0 ? 1.0 : -1.0);
+    return unpacked;
+}
+#endif
+
 out mediump vec3 transformedNormal;
 out highp vec3 lightDirection;
 out highp vec3 cameraDirection;
@@ -67,7 +83,11 @@ void main() {
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
     /* Transformed normal vector */
+    #ifndef OCTAHEDRAL_NORMALS
     transformedNormal = normalMatrix*normal;
+    #else
+    transformedNormal = normalMatrix*unpackOctahedral(normal);
+    #endif
 
     /* Direction to the light */
     lightDirection = normalize(light - transformedPosition);
@@ -39,6 +39,8 @@ struct PhongGLTest: Magnum::Test::AbstractOpenGLTester {
     void compileAmbientSpecularTexture();
     void compileDiffuseSpecularTexture();
     void compileAmbientDiffuseSpecularTexture();
+    void compileOctahedralNormals();
+    void compileOctahedralNormalsDiffuseTexture();
 };
 
 PhongGLTest::PhongGLTest() {
@@ -49,7 +51,9 @@ PhongGLTest::PhongGLTest() {
               &PhongGLTest::compileAmbientDiffuseTexture,
               &PhongGLTest::compileAmbientSpecularTexture,
               &PhongGLTest::compileDiffuseSpecularTexture,
-              &PhongGLTest::compileAmbientDiffuseSpecularTexture});
+              &PhongGLTest::compileAmbientDiffuseSpecularTexture,
+              &PhongGLTest::compileOctahedralNormals,
+              &PhongGLTest::compileOctahedralNormalsDiffuseTexture});
 }
 
 void PhongGLTest::compile() {
@@ -92,6 +96,16 @@ void PhongGLTest::compileAmbientDiffuseSpecularTexture() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void PhongGLTest::compileOctahedralNormals() {
+    Shaders::Phong shader(Shaders::Phong::Flag::OctahedralNormals);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileOctahedralNormalsDiffuseTexture() {
+    Shaders::Phong shader(Shaders::Phong::Flag::OctahedralNormals|Shaders::Phong::Flag::DiffuseTexture);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongGLTest)
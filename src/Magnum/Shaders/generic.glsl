@@ -26,3 +26,4 @@
 #define POSITION_ATTRIBUTE_LOCATION 0
 #define TEXTURECOORDINATES_ATTRIBUTE_LOCATION 1
 #define NORMAL_ATTRIBUTE_LOCATION 2
+#define TANGENT_ATTRIBUTE_LOCATION 4
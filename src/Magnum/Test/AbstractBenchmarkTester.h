@@ -0,0 +1,142 @@
+#ifndef Magnum_Test_AbstractBenchmarkTester_h
+#define Magnum_Test_AbstractBenchmarkTester_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Test {
+
+/*
+    Corrade's test suite has no benchmarking facilities, so this provides a
+    minimal one on top of it. Benchmarked code is put into a MAGNUM_BENCHMARK()
+    block, which is executed repeatedly and the fastest run is reported in
+    nanoseconds per single operation (i.e. run time divided by batch size)
+    together with corresponding throughput in operations per second.
+    The code should pass its results to escape() so the compiler doesn't
+    optimize the measured operations out.
+
+    If the MAGNUM_BENCHMARK_CSV environment variable is set, the results are
+    also appended to a file of given name as comma-separated values with
+    benchmark name, batch size, minimal and mean time in nanoseconds per
+    operation and repeat count, so they can be collected and compared across
+    versions. A header line is written if the file is empty.
+*/
+class AbstractBenchmarkTester: public TestSuite::Tester {
+    public:
+        class Runner;
+
+        explicit AbstractBenchmarkTester(UnsignedInt repeats = 25): _repeats{repeats} {}
+
+        /* Number of times each benchmark is run */
+        UnsignedInt repeats() const { return _repeats; }
+
+        /* Type name to be used in benchmark names of templated benchmarks */
+        template<class T> static std::string typeName();
+
+        /* Prevent the compiler from optimizing out computation of given value */
+        template<class T> static void escape(const T& value) {
+            #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "g"(&value) : "memory");
+            #else
+            static const T* volatile sink;
+            sink = &value;
+            #endif
+        }
+
+    private:
+        UnsignedInt _repeats;
+};
+
+template<> inline std::string AbstractBenchmarkTester::typeName<Float>() { return "Float"; }
+template<> inline std::string AbstractBenchmarkTester::typeName<Double>() { return "Double"; }
+
+class AbstractBenchmarkTester::Runner {
+    public:
+        explicit Runner(const AbstractBenchmarkTester& tester, std::string name, std::size_t batchSize): _name{std::move(name)}, _batchSize{batchSize}, _repeats{tester.repeats()}, _i{}, _min{std::numeric_limits<double>::max()}, _sum{} {}
+
+        Runner(const Runner&) = delete;
+        Runner& operator=(const Runner&) = delete;
+
+        /* Returns false and prints the results after last run */
+        bool next();
+
+    private:
+        std::string _name;
+        std::size_t _batchSize;
+        UnsignedInt _repeats, _i;
+        double _min, _sum;
+        std::chrono::high_resolution_clock::time_point _start;
+};
+
+inline bool AbstractBenchmarkTester::Runner::next() {
+    /* Record time of previous run */
+    if(_i) {
+        const double time = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - _start).count()/_batchSize;
+        if(time < _min) _min = time;
+        _sum += time;
+    }
+
+    if(_i++ == _repeats) {
+        std::ostringstream out;
+        out << "  BENCHMARK " << _name << ": " << _min << " ns/op, " << 1.0e9/_min << " op/s (mean " << _sum/_repeats << " ns/op, batch size " << _batchSize << ")";
+        Debug() << out.str();
+
+        /* Machine-readable output, name is quoted as it may contain commas */
+        if(const char* const csv = std::getenv("MAGNUM_BENCHMARK_CSV")) {
+            std::ofstream file{csv, std::ios::app};
+            if(!file) {
+                Error() << "MAGNUM_BENCHMARK(): can't open" << csv << "for writing";
+                return false;
+            }
+
+            file.seekp(0, std::ios::end);
+            if(file.tellp() == 0)
+                file << "name,batch size,min ns/op,mean ns/op,repeats\n";
+            file << '"' << _name << "\"," << _batchSize << ',' << _min << ',' << _sum/_repeats << ',' << _repeats << '\n';
+        }
+
+        return false;
+    }
+
+    _start = std::chrono::high_resolution_clock::now();
+    return true;
+}
+
+/* Repeatedly executes the following block, name is printed with the results */
+#define MAGNUM_BENCHMARK(name, batchSize)                                   \
+    for(Magnum::Test::AbstractBenchmarkTester::Runner _magnumBenchmarkRunner{*this, name, batchSize}; _magnumBenchmarkRunner.next(); )
+
+}}
+
+#endif
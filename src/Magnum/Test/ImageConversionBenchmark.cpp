@@ -0,0 +1,265 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageConversion.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+
+namespace Magnum { namespace Test {
+
+struct ImageConversionBenchmark: AbstractBenchmarkTester {
+    explicit ImageConversionBenchmark();
+
+    void swapRedBlueNaive();
+    void swapRedBlue3();
+    void swapRedBlue4();
+    void rgbToRgba();
+    void rgbaToRgb();
+    void normalize();
+    void normalizeHalf();
+    void denormalize();
+    void denormalizeHalf();
+    void srgbToLinearNaive();
+    void srgbToLinear();
+    void linearToSrgbNaive();
+    void linearToSrgb();
+    void premultiplyAlpha();
+    void premultiplyAlphaFloat();
+    void unpremultiplyAlpha();
+    void convert();
+    void convertSingleThread();
+
+    private:
+        void benchmarkConvert(const std::string& name, std::size_t threadCount);
+
+        std::vector<UnsignedByte> _bytes;
+        std::vector<Float> _floats;
+};
+
+namespace {
+
+typedef Math::Vector3<UnsignedByte> Vector3ub;
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+
+/* 2048x2048 RGBA image */
+constexpr std::size_t PixelCount = 2048*2048;
+
+}
+
+ImageConversionBenchmark::ImageConversionBenchmark(): AbstractBenchmarkTester{10}, _bytes(PixelCount*4), _floats(PixelCount*4) {
+    addTests({&ImageConversionBenchmark::swapRedBlueNaive,
+              &ImageConversionBenchmark::swapRedBlue3,
+              &ImageConversionBenchmark::swapRedBlue4,
+              &ImageConversionBenchmark::rgbToRgba,
+              &ImageConversionBenchmark::rgbaToRgb,
+              &ImageConversionBenchmark::normalize,
+              &ImageConversionBenchmark::normalizeHalf,
+              &ImageConversionBenchmark::denormalize,
+              &ImageConversionBenchmark::denormalizeHalf,
+              &ImageConversionBenchmark::srgbToLinearNaive,
+              &ImageConversionBenchmark::srgbToLinear,
+              &ImageConversionBenchmark::linearToSrgbNaive,
+              &ImageConversionBenchmark::linearToSrgb,
+              &ImageConversionBenchmark::premultiplyAlpha,
+              &ImageConversionBenchmark::premultiplyAlphaFloat,
+              &ImageConversionBenchmark::unpremultiplyAlpha,
+              &ImageConversionBenchmark::convert,
+              &ImageConversionBenchmark::convertSingleThread});
+
+    for(std::size_t i = 0; i != _bytes.size(); ++i) {
+        _bytes[i] = UnsignedByte(i*7 + i/1024);
+        _floats[i] = _bytes[i]/255.0f;
+    }
+}
+
+/* Per-pixel byte swap, for comparison */
+void ImageConversionBenchmark::swapRedBlueNaive() {
+    std::vector<UnsignedByte> out(PixelCount*3);
+    MAGNUM_BENCHMARK("naive, RGB to BGR", PixelCount) {
+        for(std::size_t i = 0; i != PixelCount*3; i += 3) {
+            out[i + 0] = _bytes[i + 2];
+            out[i + 1] = _bytes[i + 1];
+            out[i + 2] = _bytes[i + 0];
+        }
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::swapRedBlue3() {
+    std::vector<Vector3ub> out(PixelCount);
+    MAGNUM_BENCHMARK("swapRedBlue(), RGB", PixelCount) {
+        ImageConversion::swapRedBlue({reinterpret_cast<const Vector3ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::swapRedBlue4() {
+    std::vector<Vector4ub> out(PixelCount);
+    MAGNUM_BENCHMARK("swapRedBlue(), RGBA", PixelCount) {
+        ImageConversion::swapRedBlue({reinterpret_cast<const Vector4ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::rgbToRgba() {
+    std::vector<Vector4ub> out(PixelCount);
+    MAGNUM_BENCHMARK("rgbToRgba()", PixelCount) {
+        ImageConversion::rgbToRgba({reinterpret_cast<const Vector3ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::rgbaToRgb() {
+    std::vector<Vector3ub> out(PixelCount);
+    MAGNUM_BENCHMARK("rgbaToRgb()", PixelCount) {
+        ImageConversion::rgbaToRgb({reinterpret_cast<const Vector4ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::normalize() {
+    std::vector<Float> out(_bytes.size());
+    MAGNUM_BENCHMARK("normalize(), 8-bit to float", _bytes.size()) {
+        ImageConversion::normalize({_bytes.data(), _bytes.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::normalizeHalf() {
+    std::vector<Math::Half> out(_bytes.size());
+    MAGNUM_BENCHMARK("normalize(), 8-bit to half-float", _bytes.size()) {
+        ImageConversion::normalize({_bytes.data(), _bytes.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::denormalize() {
+    std::vector<UnsignedByte> out(_floats.size());
+    MAGNUM_BENCHMARK("denormalize(), float to 8-bit", _floats.size()) {
+        ImageConversion::denormalize({_floats.data(), _floats.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::denormalizeHalf() {
+    std::vector<Math::Half> in(_floats.size());
+    for(std::size_t i = 0; i != in.size(); ++i) in[i] = Math::Half{_floats[i]};
+    std::vector<UnsignedByte> out(in.size());
+    MAGNUM_BENCHMARK("denormalize(), half-float to 8-bit", in.size()) {
+        ImageConversion::denormalize({in.data(), in.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+/* Evaluating the sRGB curve for each value, for comparison */
+void ImageConversionBenchmark::srgbToLinearNaive() {
+    std::vector<Float> out(_bytes.size());
+    MAGNUM_BENCHMARK("naive, sRGB to linear", _bytes.size()) {
+        for(std::size_t i = 0; i != _bytes.size(); ++i) {
+            const Float value = _bytes[i]/255.0f;
+            out[i] = value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+        }
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::srgbToLinear() {
+    std::vector<Float> out(_bytes.size());
+    MAGNUM_BENCHMARK("srgbToLinear()", _bytes.size()) {
+        ImageConversion::srgbToLinear({_bytes.data(), _bytes.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::linearToSrgbNaive() {
+    std::vector<UnsignedByte> out(_floats.size());
+    MAGNUM_BENCHMARK("naive, linear to sRGB", _floats.size()) {
+        for(std::size_t i = 0; i != _floats.size(); ++i) {
+            const Float value = _floats[i];
+            out[i] = UnsignedByte((value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f)*255.0f + 0.5f);
+        }
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::linearToSrgb() {
+    std::vector<UnsignedByte> out(_floats.size());
+    MAGNUM_BENCHMARK("linearToSrgb()", _floats.size()) {
+        ImageConversion::linearToSrgb({_floats.data(), _floats.size()}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::premultiplyAlpha() {
+    std::vector<Vector4ub> out(PixelCount);
+    MAGNUM_BENCHMARK("premultiplyAlpha(), 8-bit", PixelCount) {
+        ImageConversion::premultiplyAlpha({reinterpret_cast<const Vector4ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::premultiplyAlphaFloat() {
+    std::vector<Math::Vector4<Float>> out(PixelCount);
+    MAGNUM_BENCHMARK("premultiplyAlpha(), float", PixelCount) {
+        ImageConversion::premultiplyAlpha({reinterpret_cast<const Math::Vector4<Float>*>(_floats.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::unpremultiplyAlpha() {
+    std::vector<Vector4ub> out(PixelCount);
+    MAGNUM_BENCHMARK("unpremultiplyAlpha(), 8-bit", PixelCount) {
+        ImageConversion::unpremultiplyAlpha({reinterpret_cast<const Vector4ub*>(_bytes.data()), PixelCount}, {out.data(), out.size()});
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::benchmarkConvert(const std::string& name, const std::size_t threadCount) {
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {2048, 2048}, _bytes.data()};
+    MAGNUM_BENCHMARK(name, PixelCount) {
+        Image2D out = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float, ImageConversion::ConversionFlag::Srgb, threadCount);
+        escape(out.data());
+    }
+}
+
+void ImageConversionBenchmark::convert() {
+    benchmarkConvert("convert(), sRGB RGB8 to linear RGBA32F", 0);
+}
+
+void ImageConversionBenchmark::convertSingleThread() {
+    benchmarkConvert("convert(), sRGB RGB8 to linear RGBA32F, single thread", 1);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ImageConversionBenchmark)
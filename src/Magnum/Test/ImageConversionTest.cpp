@@ -0,0 +1,546 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageConversion.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Test {
+
+struct ImageConversionTest: TestSuite::Tester {
+    explicit ImageConversionTest();
+
+    void swapRedBlue3();
+    void swapRedBlue4();
+    void swapRedBlueInPlace();
+    void rgbToRgba();
+    void rgbaToRgb();
+    void rgbToRgbaInPlace();
+
+    void normalize();
+    void normalizeHalf();
+    void denormalize();
+    void denormalizeClamp();
+    void denormalizeHalf();
+
+    void srgbToLinear();
+    void srgbRoundTrip();
+    void srgbAlpha();
+
+    void premultiplyAlpha();
+    void unpremultiplyAlpha();
+    void premultiplyAlphaFloat();
+
+    void convertChannels();
+    void convertType();
+    void convertChannelsType();
+    void convertHalf();
+    void convertSrgb();
+    void convertThreads();
+    void convert3D();
+    void convertInPlace();
+
+    void premultiplyAlphaImage();
+};
+
+ImageConversionTest::ImageConversionTest() {
+    addTests({&ImageConversionTest::swapRedBlue3,
+              &ImageConversionTest::swapRedBlue4,
+              &ImageConversionTest::swapRedBlueInPlace,
+              &ImageConversionTest::rgbToRgba,
+              &ImageConversionTest::rgbaToRgb,
+              &ImageConversionTest::rgbToRgbaInPlace,
+
+              &ImageConversionTest::normalize,
+              &ImageConversionTest::normalizeHalf,
+              &ImageConversionTest::denormalize,
+              &ImageConversionTest::denormalizeClamp,
+              &ImageConversionTest::denormalizeHalf,
+
+              &ImageConversionTest::srgbToLinear,
+              &ImageConversionTest::srgbRoundTrip,
+              &ImageConversionTest::srgbAlpha,
+
+              &ImageConversionTest::premultiplyAlpha,
+              &ImageConversionTest::unpremultiplyAlpha,
+              &ImageConversionTest::premultiplyAlphaFloat,
+
+              &ImageConversionTest::convertChannels,
+              &ImageConversionTest::convertType,
+              &ImageConversionTest::convertChannelsType,
+              &ImageConversionTest::convertHalf,
+              &ImageConversionTest::convertSrgb,
+              &ImageConversionTest::convertThreads,
+              &ImageConversionTest::convert3D,
+              &ImageConversionTest::convertInPlace,
+
+              &ImageConversionTest::premultiplyAlphaImage});
+}
+
+namespace {
+
+typedef Math::Vector3<UnsignedByte> Vector3ub;
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+
+/* Enough pixels to go through both the vectorized and the remainder paths */
+constexpr std::size_t Count = 67;
+
+template<class T> std::vector<T> sequence(const std::size_t count, const std::size_t components) {
+    std::vector<T> out(count);
+    for(std::size_t i = 0; i != count; ++i) for(std::size_t j = 0; j != components; ++j)
+        out[i][j] = UnsignedByte(i*components*7 + j*13);
+    return out;
+}
+
+template<class T> Containers::ArrayView<const T> view(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Containers::ArrayView<T> view(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T, std::size_t size> Containers::ArrayView<T> view(T(&data)[size]) {
+    return {data, size};
+}
+
+}
+
+void ImageConversionTest::swapRedBlue3() {
+    const std::vector<Vector3ub> in = sequence<Vector3ub>(Count, 3);
+    std::vector<Vector3ub> out(Count);
+    ImageConversion::swapRedBlue(view(in), view(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], (Vector3ub{in[i][2], in[i][1], in[i][0]}));
+}
+
+void ImageConversionTest::swapRedBlue4() {
+    const std::vector<Vector4ub> in = sequence<Vector4ub>(Count, 4);
+    std::vector<Vector4ub> out(Count);
+    ImageConversion::swapRedBlue(view(in), view(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], (Vector4ub{in[i][2], in[i][1], in[i][0], in[i][3]}));
+}
+
+void ImageConversionTest::swapRedBlueInPlace() {
+    const std::vector<Vector3ub> original = sequence<Vector3ub>(Count, 3);
+    std::vector<Vector3ub> data = original;
+    ImageConversion::swapRedBlue(view(data), view(data));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(data[i], (Vector3ub{original[i][2], original[i][1], original[i][0]}));
+}
+
+void ImageConversionTest::rgbToRgba() {
+    const std::vector<Vector3ub> in = sequence<Vector3ub>(Count, 3);
+    std::vector<Vector4ub> out(Count);
+    ImageConversion::rgbToRgba(view(in), view(out), 0x7f);
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], (Vector4ub{in[i][0], in[i][1], in[i][2], 0x7f}));
+}
+
+void ImageConversionTest::rgbaToRgb() {
+    const std::vector<Vector4ub> in = sequence<Vector4ub>(Count, 4);
+    std::vector<Vector3ub> out(Count);
+    ImageConversion::rgbaToRgb(view(in), view(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], in[i].xyz());
+}
+
+void ImageConversionTest::rgbToRgbaInPlace() {
+    /* RGB data at the beginning of RGBA-sized buffer, expanded back to
+       front */
+    const std::vector<Vector3ub> original = sequence<Vector3ub>(Count, 3);
+    std::vector<Vector4ub> data(Count);
+    std::memcpy(static_cast<void*>(data.data()), original.data(), Count*3);
+    ImageConversion::rgbToRgba({reinterpret_cast<const Vector3ub*>(data.data()), Count}, view(data));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(data[i], (Vector4ub{original[i], 255}));
+
+    /* And back, front to back */
+    ImageConversion::rgbaToRgb(view(data), {reinterpret_cast<Vector3ub*>(data.data()), Count});
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(reinterpret_cast<const Vector3ub*>(data.data())[i], original[i]);
+}
+
+void ImageConversionTest::normalize() {
+    std::vector<UnsignedByte> in(Count);
+    for(std::size_t i = 0; i != Count; ++i) in[i] = UnsignedByte(i*255/(Count - 1));
+    std::vector<Float> out(Count);
+    ImageConversion::normalize(view(in), view(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], in[i]/255.0f);
+    CORRADE_COMPARE(out.front(), 0.0f);
+    CORRADE_COMPARE(out.back(), 1.0f);
+}
+
+void ImageConversionTest::normalizeHalf() {
+    const UnsignedByte in[]{0, 51, 255};
+    Math::Half out[3];
+    ImageConversion::normalize(view(in), view(out));
+
+    CORRADE_COMPARE(Float(out[0]), 0.0f);
+    CORRADE_COMPARE(Float(out[1]), Float(Math::Half{0.2f}));
+    CORRADE_COMPARE(Float(out[2]), 1.0f);
+}
+
+void ImageConversionTest::denormalize() {
+    /* Round trip has to be exact */
+    std::vector<UnsignedByte> in(256);
+    for(std::size_t i = 0; i != 256; ++i) in[i] = UnsignedByte(i);
+    std::vector<Float> normalized(256);
+    ImageConversion::normalize(view(in), view(normalized));
+    std::vector<UnsignedByte> out(256);
+    ImageConversion::denormalize(view(normalized), view(out));
+
+    CORRADE_VERIFY(out == in);
+}
+
+void ImageConversionTest::denormalizeClamp() {
+    /* Repeated to go through both the vectorized and the remainder paths */
+    std::vector<Float> in;
+    for(std::size_t i = 0; i != 5; ++i) in.insert(in.end(), {-1.0f, 0.5f, 2.0f, 0.0f/0.0f});
+    std::vector<UnsignedByte> out(in.size());
+    ImageConversion::denormalize(view(in), view(out));
+
+    for(std::size_t i = 0; i != out.size(); i += 4) {
+        CORRADE_COMPARE(out[i + 0], 0);
+        CORRADE_COMPARE(out[i + 1], 128);
+        CORRADE_COMPARE(out[i + 2], 255);
+        CORRADE_COMPARE(out[i + 3], 0);
+    }
+}
+
+void ImageConversionTest::denormalizeHalf() {
+    std::vector<Math::Half> in(300);
+    for(std::size_t i = 0; i != in.size(); ++i) in[i] = Math::Half{(i % 256)/255.0f};
+    std::vector<UnsignedByte> out(300);
+    ImageConversion::denormalize(view(in), view(out));
+
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], i % 256);
+}
+
+void ImageConversionTest::srgbToLinear() {
+    const UnsignedByte in[]{0, 10, 128, 255};
+    Float out[4];
+    ImageConversion::srgbToLinear(view(in), view(out));
+
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 0.003035270f);
+    CORRADE_COMPARE(out[2], 0.215860500f);
+    CORRADE_COMPARE(out[3], 1.0f);
+}
+
+void ImageConversionTest::srgbRoundTrip() {
+    std::vector<UnsignedByte> in(256);
+    for(std::size_t i = 0; i != 256; ++i) in[i] = UnsignedByte(i);
+    std::vector<Float> linear(256);
+    ImageConversion::srgbToLinear(view(in), view(linear));
+    std::vector<UnsignedByte> out(256);
+    ImageConversion::linearToSrgb(view(linear), view(out));
+
+    CORRADE_VERIFY(out == in);
+
+    /* Values outside of the range are clamped */
+    const Float outside[]{-0.5f, 1.5f, 0.0f/0.0f};
+    UnsignedByte clamped[3];
+    ImageConversion::linearToSrgb(view(outside), view(clamped));
+    CORRADE_COMPARE(clamped[0], 0);
+    CORRADE_COMPARE(clamped[1], 255);
+    CORRADE_COMPARE(clamped[2], 0);
+}
+
+void ImageConversionTest::srgbAlpha() {
+    /* Alpha is linear */
+    const Vector4ub in[]{{128, 128, 128, 128}};
+    Math::Vector4<Float> linear[1];
+    ImageConversion::srgbToLinear(view(in), view(linear));
+    CORRADE_COMPARE(linear[0], (Math::Vector4<Float>{0.2158605f, 0.2158605f, 0.2158605f, 128/255.0f}));
+
+    Vector4ub out[1];
+    ImageConversion::linearToSrgb(view(linear), view(out));
+    CORRADE_COMPARE(out[0], in[0]);
+}
+
+void ImageConversionTest::premultiplyAlpha() {
+    std::vector<Vector4ub> in(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in[i] = {UnsignedByte(i*3), 255, UnsignedByte(255 - i), UnsignedByte(i*255/(Count - 1))};
+    std::vector<Vector4ub> out(Count);
+    ImageConversion::premultiplyAlpha(view(in), view(out));
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        const UnsignedInt a = in[i][3];
+        CORRADE_COMPARE(out[i], (Vector4ub{
+            UnsignedByte((in[i][0]*a + 127)/255),
+            UnsignedByte((in[i][1]*a + 127)/255),
+            UnsignedByte((in[i][2]*a + 127)/255), in[i][3]}));
+    }
+}
+
+void ImageConversionTest::unpremultiplyAlpha() {
+    const Vector4ub in[]{{64, 32, 0, 128}, {10, 20, 30, 0}, {200, 255, 100, 255}, {100, 50, 0, 50}};
+    Vector4ub out[4];
+    ImageConversion::unpremultiplyAlpha(view(in), view(out));
+
+    CORRADE_COMPARE(out[0], (Vector4ub{128, 64, 0, 128}));
+    CORRADE_COMPARE(out[1], (Vector4ub{0, 0, 0, 0}));
+    CORRADE_COMPARE(out[2], (Vector4ub{200, 255, 100, 255}));
+    /* Invalid premultiplied values are clamped */
+    CORRADE_COMPARE(out[3], (Vector4ub{255, 255, 0, 50}));
+
+    /* All combinations are rounded to nearest */
+    std::vector<Vector4ub> all(256*256);
+    for(std::size_t i = 0; i != all.size(); ++i)
+        all[i] = {UnsignedByte(i % 256), 0, 0, UnsignedByte(i/256)};
+    std::vector<Vector4ub> allOut(all.size());
+    ImageConversion::unpremultiplyAlpha(view(all), view(allOut));
+    for(std::size_t i = 0; i != all.size(); ++i) {
+        const UnsignedInt a = all[i][3];
+        const UnsignedInt expected = a ? std::min((all[i][0]*255u + a/2)/a, 255u) : 0;
+        CORRADE_COMPARE(allOut[i][0], expected);
+    }
+}
+
+void ImageConversionTest::premultiplyAlphaFloat() {
+    const Math::Vector4<Float> in[]{{1.0f, 0.5f, 0.25f, 0.5f}, {0.5f, 1.0f, 1.0f, 0.0f}};
+    Math::Vector4<Float> premultiplied[2];
+    ImageConversion::premultiplyAlpha(view(in), view(premultiplied));
+    CORRADE_COMPARE(premultiplied[0], (Math::Vector4<Float>{0.5f, 0.25f, 0.125f, 0.5f}));
+    CORRADE_COMPARE(premultiplied[1], (Math::Vector4<Float>{0.0f, 0.0f, 0.0f, 0.0f}));
+
+    Math::Vector4<Float> out[2];
+    ImageConversion::unpremultiplyAlpha(view(premultiplied), view(out));
+    CORRADE_COMPARE(out[0], in[0]);
+    CORRADE_COMPARE(out[1], (Math::Vector4<Float>{0.0f, 0.0f, 0.0f, 0.0f}));
+}
+
+void ImageConversionTest::convertChannels() {
+    /* Three pixels per row, the rows are padded to four bytes */
+    const char data[]{
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0,
+        10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 0, 0
+    };
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {3, 2}, data};
+
+    Image2D rgba = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::UnsignedByte);
+    CORRADE_COMPARE(rgba.format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(rgba.type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(rgba.size(), Vector2i(3, 2));
+    CORRADE_COMPARE((std::vector<char>{rgba.data(), rgba.data() + 24}), (std::vector<char>{
+        1, 2, 3, -1, 4, 5, 6, -1, 7, 8, 9, -1,
+        10, 11, 12, -1, 13, 14, 15, -1, 16, 17, 18, -1}));
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D bgr = ImageConversion::convert(rgba, ColorFormat::BGR, ColorType::UnsignedByte);
+    CORRADE_COMPARE(bgr.format(), ColorFormat::BGR);
+    CORRADE_COMPARE((std::vector<char>{bgr.data(), bgr.data() + 9}), (std::vector<char>{3, 2, 1, 6, 5, 4, 9, 8, 7}));
+    CORRADE_COMPARE((std::vector<char>{bgr.data() + 12, bgr.data() + 21}), (std::vector<char>{12, 11, 10, 15, 14, 13, 18, 17, 16}));
+    #endif
+}
+
+void ImageConversionTest::convertType() {
+    const UnsignedByte data[]{0, 51, 255, 102, 255, 0, 51, 0};
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 2}, data};
+
+    Image2D floats = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float);
+    CORRADE_COMPARE(floats.type(), ColorType::Float);
+    const Float* out = reinterpret_cast<const Float*>(floats.data());
+    const Float expected[]{0.0f, 0.2f, 1.0f, 0.4f, 1.0f, 0.0f, 0.2f, 0.0f};
+    for(std::size_t i = 0; i != 8; ++i)
+        CORRADE_COMPARE(out[i], expected[i]);
+
+    Image2D back = ImageConversion::convert(floats, ColorFormat::RGBA, ColorType::UnsignedByte);
+    CORRADE_COMPARE((std::vector<UnsignedByte>{reinterpret_cast<const UnsignedByte*>(back.data()), reinterpret_cast<const UnsignedByte*>(back.data()) + 8}), (std::vector<UnsignedByte>{data, data + 8}));
+}
+
+void ImageConversionTest::convertChannelsType() {
+    /* RGB with padded rows to RGBA float */
+    const UnsignedByte data[]{
+        0, 51, 255, 102, 255, 0, 0, 0,
+        51, 0, 102, 0, 51, 255, 0, 0
+    };
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {2, 2}, data};
+
+    Image2D rgba = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float);
+    const Float* out = reinterpret_cast<const Float*>(rgba.data());
+    const Float expected[]{
+        0.0f, 0.2f, 1.0f, 1.0f, 0.4f, 1.0f, 0.0f, 1.0f,
+        0.2f, 0.0f, 0.4f, 1.0f, 0.0f, 0.2f, 1.0f, 1.0f};
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(out[i], expected[i]);
+
+    /* And back, float RGBA to 8-bit RGB with padding */
+    Image2D rgb = ImageConversion::convert(rgba, ColorFormat::RGB, ColorType::UnsignedByte);
+    const UnsignedByte* rgbData = reinterpret_cast<const UnsignedByte*>(rgb.data());
+    CORRADE_COMPARE((std::vector<UnsignedByte>{rgbData, rgbData + 6}), (std::vector<UnsignedByte>{data, data + 6}));
+    CORRADE_COMPARE((std::vector<UnsignedByte>{rgbData + 8, rgbData + 14}), (std::vector<UnsignedByte>{data + 8, data + 14}));
+}
+
+void ImageConversionTest::convertHalf() {
+    std::vector<UnsignedByte> data(300*4);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*7);
+    const ImageReference1D image{ColorFormat::RGBA, ColorType::UnsignedByte, 300, data.data()};
+
+    Image1D half = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::HalfFloat);
+    CORRADE_COMPARE(half.type(), ColorType::HalfFloat);
+    CORRADE_COMPARE(Float(reinterpret_cast<const Math::Half*>(half.data())[1]), Float(Math::Half{7/255.0f}));
+
+    /* Half to RGB float drops the alpha, half to 8-bit gives the original */
+    Image1D floats = ImageConversion::convert(half, ColorFormat::RGB, ColorType::Float);
+    CORRADE_COMPARE(reinterpret_cast<const Float*>(floats.data())[3], Float(Math::Half{28/255.0f}));
+    Image1D back = ImageConversion::convert(half, ColorFormat::RGBA, ColorType::UnsignedByte);
+    CORRADE_VERIFY(std::equal(data.begin(), data.end(), reinterpret_cast<const UnsignedByte*>(back.data())));
+}
+
+void ImageConversionTest::convertSrgb() {
+    std::vector<UnsignedByte> data(256*4);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i/4);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {16, 16}, data.data()};
+
+    Image2D linear = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float, ImageConversion::ConversionFlag::Srgb);
+    const Math::Vector4<Float>* pixels = reinterpret_cast<const Math::Vector4<Float>*>(linear.data());
+    CORRADE_COMPARE(pixels[128], (Math::Vector4<Float>{0.2158605f, 0.2158605f, 0.2158605f, 128/255.0f}));
+
+    /* Half float output, alpha converted back without the curve */
+    Image2D half = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::HalfFloat, ImageConversion::ConversionFlag::Srgb);
+    const Math::Half* halfs = reinterpret_cast<const Math::Half*>(half.data());
+    CORRADE_COMPARE(Float(halfs[128*4]), Float(Math::Half{0.2158605f}));
+    CORRADE_COMPARE(Float(halfs[128*4 + 3]), Float(Math::Half{128/255.0f}));
+
+    Image2D back = ImageConversion::convert(linear, ColorFormat::RGBA, ColorType::UnsignedByte, ImageConversion::ConversionFlag::Srgb);
+    CORRADE_VERIFY(std::equal(data.begin(), data.end(), reinterpret_cast<const UnsignedByte*>(back.data())));
+    Image2D backFromHalf = ImageConversion::convert(half, ColorFormat::RGBA, ColorType::UnsignedByte, ImageConversion::ConversionFlag::Srgb);
+    CORRADE_VERIFY(std::equal(data.begin(), data.end(), reinterpret_cast<const UnsignedByte*>(backFromHalf.data())));
+}
+
+void ImageConversionTest::convertThreads() {
+    /* Odd width to have padded rows, large enough to be split */
+    const Vector2i size{333, 517};
+    std::vector<UnsignedByte> data(1000*size.y());
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*31 + i/7);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, size, data.data()};
+
+    Image2D single = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float, ImageConversion::ConversionFlag::Srgb, 1);
+    Image2D multiple = ImageConversion::convert(image, ColorFormat::RGBA, ColorType::Float, ImageConversion::ConversionFlag::Srgb, 4);
+    CORRADE_VERIFY(std::equal(single.data(), single.data() + single.dataSize(size), multiple.data()));
+
+    Image2D back = ImageConversion::convert(multiple, ColorFormat::RGB, ColorType::UnsignedByte, ImageConversion::ConversionFlag::Srgb, 3);
+    for(Int y = 0; y != size.y(); ++y)
+        CORRADE_VERIFY(std::equal(data.begin() + y*1000, data.begin() + y*1000 + 999, reinterpret_cast<const UnsignedByte*>(back.data()) + y*1000));
+}
+
+void ImageConversionTest::convert3D() {
+    const UnsignedByte data[]{
+        255, 0, 0, 255, 0, 255, 0, 128,
+        0, 0, 255, 0, 10, 20, 30, 40
+    };
+    const ImageReference3D image{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 2, 2}, data};
+
+    Image3D rgb = ImageConversion::convert(image, ColorFormat::RGB, ColorType::UnsignedByte);
+    CORRADE_COMPARE(rgb.size(), Vector3i(1, 2, 2));
+    const UnsignedByte* out = reinterpret_cast<const UnsignedByte*>(rgb.data());
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE((Vector3ub{out[i*4], out[i*4 + 1], out[i*4 + 2]}), (Vector3ub{data[i*4], data[i*4 + 1], data[i*4 + 2]}));
+}
+
+void ImageConversionTest::convertInPlace() {
+    /* Odd width to have padded rows, large enough to be split */
+    const Vector2i size{67, 300};
+    std::vector<UnsignedByte> data(size.product()*4);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*31 + i/7);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, size, data.data()};
+
+    const struct {
+        ColorFormat sourceFormat;
+        ColorType sourceType;
+        ColorFormat format;
+        ColorType type;
+        ImageConversion::ConversionFlags flags;
+    } conversions[]{
+        {ColorFormat::RGBA, ColorType::UnsignedByte, ColorFormat::RGBA, ColorType::UnsignedByte, {}},
+        {ColorFormat::RGBA, ColorType::UnsignedByte, ColorFormat::RGB, ColorType::UnsignedByte, {}},
+        #ifndef MAGNUM_TARGET_WEBGL
+        {ColorFormat::RGBA, ColorType::UnsignedByte, ColorFormat::BGRA, ColorType::UnsignedByte, {}},
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        {ColorFormat::RGB, ColorType::UnsignedByte, ColorFormat::BGR, ColorType::UnsignedByte, {}},
+        {ColorFormat::RGBA, ColorType::HalfFloat, ColorFormat::BGR, ColorType::HalfFloat, {}},
+        #endif
+        {ColorFormat::RGBA, ColorType::Float, ColorFormat::RGB, ColorType::Float, {}},
+        {ColorFormat::RGBA, ColorType::Float, ColorFormat::RGBA, ColorType::HalfFloat, {}},
+        {ColorFormat::RGBA, ColorType::Float, ColorFormat::RGB, ColorType::UnsignedByte, ImageConversion::ConversionFlag::Srgb},
+        {ColorFormat::RGBA, ColorType::HalfFloat, ColorFormat::RGBA, ColorType::UnsignedByte, ImageConversion::ConversionFlag::Srgb},
+        {ColorFormat::RGB, ColorType::Float, ColorFormat::RGBA, ColorType::HalfFloat, {}}
+    };
+
+    for(const auto& conversion: conversions) {
+        const Image2D source = ImageConversion::convert(image, conversion.sourceFormat, conversion.sourceType);
+        const Image2D expected = ImageConversion::convert(source, conversion.format, conversion.type, conversion.flags, 1);
+
+        Image2D converted = ImageConversion::convert(source, conversion.sourceFormat, conversion.sourceType);
+        ImageConversion::convertInPlace(converted, conversion.format, conversion.type, conversion.flags, 4);
+        CORRADE_COMPARE(converted.format(), conversion.format);
+        CORRADE_COMPARE(converted.type(), conversion.type);
+        CORRADE_COMPARE(converted.size(), size);
+
+        /* Padding at the end of rows is not initialized */
+        const std::size_t rowSize = size.x()*expected.pixelSize();
+        const std::size_t stride = ((rowSize + 3)/4)*4;
+        for(Int y = 0; y != size.y(); ++y)
+            CORRADE_VERIFY(std::equal(expected.data() + y*stride, expected.data() + y*stride + rowSize, converted.data() + y*stride));
+    }
+}
+
+void ImageConversionTest::premultiplyAlphaImage() {
+    UnsignedByte* data = new UnsignedByte[8]{255, 128, 0, 128, 100, 200, 50, 0};
+    Image2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 2}, data};
+
+    ImageConversion::premultiplyAlpha(image);
+    CORRADE_COMPARE((std::vector<UnsignedByte>{data, data + 8}), (std::vector<UnsignedByte>{128, 64, 0, 128, 0, 0, 0, 0}));
+
+    ImageConversion::unpremultiplyAlpha(image);
+    CORRADE_COMPARE((std::vector<UnsignedByte>{data, data + 8}), (std::vector<UnsignedByte>{255, 128, 0, 128, 0, 0, 0, 0}));
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ImageConversionTest)
@@ -92,6 +92,7 @@ struct MeshGLTest: AbstractOpenGLTester {
     void addVertexBufferVector3WithUnsignedInt10f11f11fRev();
     #endif
     #ifndef MAGNUM_TARGET_GLES2
+    void addVertexBufferVector3WithInt2101010Rev();
     void addVertexBufferVector4WithUnsignedInt2101010Rev();
     void addVertexBufferVector4WithInt2101010Rev();
     #endif
@@ -183,6 +184,7 @@ MeshGLTest::MeshGLTest() {
               &MeshGLTest::addVertexBufferVector3WithUnsignedInt10f11f11fRev,
               #endif
               #ifndef MAGNUM_TARGET_GLES2
+              &MeshGLTest::addVertexBufferVector3WithInt2101010Rev,
               &MeshGLTest::addVertexBufferVector4WithUnsignedInt2101010Rev,
               &MeshGLTest::addVertexBufferVector4WithInt2101010Rev,
               #endif
@@ -989,6 +991,25 @@ void MeshGLTest::addVertexBufferVector3WithUnsignedInt10f11f11fRev() {
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
+void MeshGLTest::addVertexBufferVector3WithInt2101010Rev() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::vertex_type_2_10_10_10_rev>())
+        CORRADE_SKIP(Extensions::GL::ARB::vertex_type_2_10_10_10_rev::string() + std::string(" is not available."));
+    #endif
+
+    typedef Attribute<0, Vector3> Attribute;
+
+    Buffer buffer;
+    buffer.setData({nullptr, 12}, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setBaseVertex(1)
+        .addVertexBuffer(buffer, 4, Attribute(Attribute::DataType::Int2101010Rev));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    /* Won't test the actual values */
+}
+
 void MeshGLTest::addVertexBufferVector4WithUnsignedInt2101010Rev() {
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::vertex_type_2_10_10_10_rev>())
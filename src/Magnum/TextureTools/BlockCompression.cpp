@@ -0,0 +1,964 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Don't bother spawning threads for less blocks than this */
+constexpr std::size_t MinParallelBlockCount = 1024;
+
+typedef Math::Vector4<UnsignedByte> Pixel;
+
+/* Pixels of one block in row-major order */
+typedef Pixel Block[16];
+
+bool isSwapped(const ColorFormat format) {
+    #ifndef MAGNUM_TARGET_GLES
+    if(format == ColorFormat::BGR) return true;
+    #endif
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(format == ColorFormat::BGRA) return true;
+    #endif
+    static_cast<void>(format);
+    return false;
+}
+
+bool isColor(const ColorFormat format) {
+    return format == ColorFormat::RGB || format == ColorFormat::RGBA || isSwapped(format);
+}
+
+/* Fetches RGBA pixels of a block, missing color channels are zero, missing
+   alpha is 255. Pixels outside of the image are replaced with the nearest
+   edge pixel. */
+void fetchBlock(const char* const data, const std::size_t rowStride, const std::size_t pixelSize, const bool swapped, const Vector2i& size, const Vector2i& position, Block& block) {
+    for(Int y = 0; y != 4; ++y) {
+        const char* const row = data + std::min(position.y() + y, size.y() - 1)*rowStride;
+        for(Int x = 0; x != 4; ++x) {
+            const UnsignedByte* const in = reinterpret_cast<const UnsignedByte*>(row + std::min(position.x() + x, size.x() - 1)*pixelSize);
+            Pixel& out = block[y*4 + x];
+            out = {0, 0, 0, 255};
+            for(std::size_t c = 0; c != pixelSize; ++c) out[c] = in[c];
+            if(swapped) std::swap(out[0], out[2]);
+        }
+    }
+}
+
+/* Stores pixels of a block, skipping those outside of the image */
+void storeBlock(const Block& block, const std::size_t channelCount, const Vector2i& size, const Vector2i& position, const std::size_t rowStride, char* const data) {
+    const Int width = std::min(size.x() - position.x(), 4);
+    const Int height = std::min(size.y() - position.y(), 4);
+    for(Int y = 0; y != height; ++y) {
+        UnsignedByte* out = reinterpret_cast<UnsignedByte*>(data + (position.y() + y)*rowStride + position.x()*channelCount);
+        for(Int x = 0; x != width; ++x, out += channelCount)
+            for(std::size_t c = 0; c != channelCount; ++c) out[c] = block[y*4 + x][c];
+    }
+}
+
+/* Least squares fitting */
+
+/* Endpoints of a line going through mean of the points along their
+   principal axis, clipped to the extent of the points */
+template<std::size_t size> void fitPrincipalAxis(const Math::Vector<size, Float>* const points, const std::size_t count, Math::Vector<size, Float>& a, Math::Vector<size, Float>& b) {
+    typedef Math::Vector<size, Float> VectorType;
+
+    VectorType mean;
+    for(std::size_t i = 0; i != count; ++i) mean += points[i];
+    mean /= Float(count);
+
+    Float covariance[size][size]{};
+    for(std::size_t i = 0; i != count; ++i) {
+        const VectorType d = points[i] - mean;
+        for(std::size_t r = 0; r != size; ++r)
+            for(std::size_t c = 0; c != size; ++c) covariance[r][c] += d[r]*d[c];
+    }
+
+    /* Power iteration, starting from the covariance row with the largest
+       variance, which is guaranteed to not be orthogonal to the axis */
+    std::size_t largest = 0;
+    for(std::size_t i = 1; i != size; ++i)
+        if(covariance[i][i] > covariance[largest][largest]) largest = i;
+    if(covariance[largest][largest] <= 0.0f) {
+        a = b = mean;
+        return;
+    }
+
+    VectorType axis;
+    for(std::size_t i = 0; i != size; ++i) axis[i] = covariance[largest][i];
+    for(Int iteration = 0; iteration != 8; ++iteration) {
+        VectorType next;
+        for(std::size_t r = 0; r != size; ++r)
+            for(std::size_t c = 0; c != size; ++c) next[r] += covariance[r][c]*axis[c];
+        const Float length = std::sqrt(Math::dot(next, next));
+        if(length == 0.0f) break;
+        axis = next/length;
+    }
+
+    Float min = 0.0f, max = 0.0f;
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float t = Math::dot(points[i] - mean, axis);
+        min = std::min(min, t);
+        max = std::max(max, t);
+    }
+
+    a = mean + axis*min;
+    b = mean + axis*max;
+}
+
+/* Endpoints minimizing squared distance of the points to interpolated
+   values with given weights of the second endpoint. Returns false if the
+   system is singular, e.g. if all weights are the same. */
+template<std::size_t size> bool fitLeastSquares(const Math::Vector<size, Float>* const points, const Float* const weights, const std::size_t count, Math::Vector<size, Float>& a, Math::Vector<size, Float>& b) {
+    typedef Math::Vector<size, Float> VectorType;
+
+    Float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    VectorType ax, bx;
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float w = weights[i], v = 1.0f - w;
+        aa += v*v;
+        ab += v*w;
+        bb += w*w;
+        ax += points[i]*v;
+        bx += points[i]*w;
+    }
+
+    const Float determinant = aa*bb - ab*ab;
+    if(std::abs(determinant) < 1.0e-4f) return false;
+
+    a = Math::clamp((ax*bb - bx*ab)/determinant, 0.0f, 255.0f);
+    b = Math::clamp((bx*aa - ax*ab)/determinant, 0.0f, 255.0f);
+    return true;
+}
+
+Int roundClamped(const Float value, const Int max) {
+    return Math::clamp(Int(value + 0.5f), 0, max);
+}
+
+/* BC4 and BC3 alpha block: two 8-bit endpoints followed by sixteen 3-bit
+   indices. If the first endpoint is larger, there are six interpolated
+   values between them, otherwise four and the values 0 and 255. */
+
+void alphaPalette(const Int e0, const Int e1, Int(&palette)[8]) {
+    palette[0] = e0;
+    palette[1] = e1;
+    if(e0 > e1) {
+        for(Int i = 1; i != 7; ++i) palette[i + 1] = ((7 - i)*e0 + i*e1 + 3)/7;
+    } else {
+        for(Int i = 1; i != 5; ++i) palette[i + 1] = ((5 - i)*e0 + i*e1 + 2)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+/* Nearest palette entries for all values, returns total squared error */
+Int alphaIndices(const Int(&values)[16], const Int e0, const Int e1, UnsignedByte(&indices)[16]) {
+    Int palette[8];
+    alphaPalette(e0, e1, palette);
+
+    Int error = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        Int best = 0x7fffffff;
+        for(UnsignedByte j = 0; j != 8; ++j) {
+            const Int d = (palette[j] - values[i])*(palette[j] - values[i]);
+            if(d < best) {
+                best = d;
+                indices[i] = j;
+            }
+        }
+        error += best;
+    }
+
+    return error;
+}
+
+struct AlphaBlock {
+    Int error, e0, e1;
+    UnsignedByte indices[16];
+};
+
+void tryAlphaEndpoints(const Int(&values)[16], const Int e0, const Int e1, AlphaBlock& best) {
+    AlphaBlock candidate;
+    candidate.e0 = e0;
+    candidate.e1 = e1;
+    candidate.error = alphaIndices(values, e0, e1, candidate.indices);
+    if(candidate.error < best.error) best = candidate;
+}
+
+void encodeAlphaBlock(const Block& block, const std::size_t channel, const BlockCompressionQuality quality, char* const out) {
+    Int values[16];
+    Int min = 255, max = 0, innerMin = 255, innerMax = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        const Int value = values[i] = block[i][channel];
+        min = std::min(min, value);
+        max = std::max(max, value);
+        if(value != 0 && value != 255) {
+            innerMin = std::min(innerMin, value);
+            innerMax = std::max(innerMax, value);
+        }
+    }
+
+    /* Six interpolated values between the extremes */
+    AlphaBlock best;
+    best.error = 0x7fffffff;
+    tryAlphaEndpoints(values, max, min, best);
+
+    if(quality != BlockCompressionQuality::Fast) {
+        /* Four interpolated values between the extremes excluding 0 and 255,
+           which are then represented exactly */
+        if(min == 0 || max == 255) {
+            if(innerMin > innerMax) innerMin = innerMax = 0;
+            tryAlphaEndpoints(values, innerMin, innerMax, best);
+        }
+
+        /* Refit the endpoints to the values assigned to interpolated ones */
+        if(best.error && best.e0 > best.e1) {
+            Math::Vector<1, Float> points[16];
+            Float weights[16];
+            for(std::size_t i = 0; i != 16; ++i) {
+                points[i][0] = Float(values[i]);
+                weights[i] = best.indices[i] == 0 ? 0.0f : best.indices[i] == 1 ? 1.0f : (best.indices[i] - 1)/7.0f;
+            }
+            Math::Vector<1, Float> a, b;
+            if(fitLeastSquares(points, weights, 16, a, b))
+                tryAlphaEndpoints(values, roundClamped(a[0], 255), roundClamped(b[0], 255), best);
+        }
+    }
+
+    /* Search neighboring endpoint values until there's no improvement */
+    if(quality == BlockCompressionQuality::Best) {
+        for(Int iteration = 0; iteration != 8 && best.error; ++iteration) {
+            const Int previousError = best.error;
+            const Int e0 = best.e0, e1 = best.e1;
+            for(Int d0 = -2; d0 <= 2; ++d0) for(Int d1 = -2; d1 <= 2; ++d1)
+                tryAlphaEndpoints(values, Math::clamp(e0 + d0, 0, 255), Math::clamp(e1 + d1, 0, 255), best);
+            if(best.error == previousError) break;
+        }
+    }
+
+    UnsignedLong indices = 0;
+    for(std::size_t i = 0; i != 16; ++i) indices |= UnsignedLong(best.indices[i]) << (i*3);
+    out[0] = char(best.e0);
+    out[1] = char(best.e1);
+    for(std::size_t i = 0; i != 6; ++i) out[i + 2] = char(indices >> (i*8));
+}
+
+void decodeAlphaBlock(const char* const in, Block& block, const std::size_t channel) {
+    Int palette[8];
+    alphaPalette(UnsignedByte(in[0]), UnsignedByte(in[1]), palette);
+
+    UnsignedLong indices = 0;
+    for(std::size_t i = 0; i != 6; ++i) indices |= UnsignedLong(UnsignedByte(in[i + 2])) << (i*8);
+    for(std::size_t i = 0; i != 16; ++i)
+        block[i][channel] = UnsignedByte(palette[(indices >> (i*3)) & 7]);
+}
+
+/* BC1 and BC3 color block: two RGB565 endpoints followed by sixteen 2-bit
+   indices. If the first endpoint is larger, there are two interpolated
+   colors between them, otherwise one and transparent black. BC3 always uses
+   the former. */
+
+Math::Vector3<Int> unpackRgb565(const UnsignedShort color) {
+    const Int r = color >> 11, g = (color >> 5) & 0x3f, b = color & 0x1f;
+    return {(r << 3)|(r >> 2), (g << 2)|(g >> 4), (b << 3)|(b >> 2)};
+}
+
+UnsignedShort packRgb565(const Vector3& color) {
+    return UnsignedShort((roundClamped(color[0]*31.0f/255.0f, 31) << 11)|
+                         (roundClamped(color[1]*63.0f/255.0f, 63) << 5)|
+                          roundClamped(color[2]*31.0f/255.0f, 31));
+}
+
+void colorPalette(const UnsignedShort c0, const UnsignedShort c1, const bool fourColor, Math::Vector3<Int>(&palette)[4]) {
+    palette[0] = unpackRgb565(c0);
+    palette[1] = unpackRgb565(c1);
+    if(fourColor) {
+        palette[2] = (palette[0]*2 + palette[1] + Math::Vector3<Int>{1})/3;
+        palette[3] = (palette[0] + palette[1]*2 + Math::Vector3<Int>{1})/3;
+    } else {
+        palette[2] = (palette[0] + palette[1] + Math::Vector3<Int>{1})/2;
+        palette[3] = {};
+    }
+}
+
+struct ColorBlock {
+    Int error;
+    UnsignedShort c0, c1;
+    bool fourColor;
+    UnsignedByte indices[16];
+};
+
+/* Evaluates given endpoints, swapping them to get the desired mode. If
+   transparent pixels are present, three-color mode is forced and the
+   pixels get the fourth index. */
+void tryColorEndpoints(const Math::Vector3<Int>(&pixels)[16], const UnsignedShort transparent, UnsignedShort c0, UnsignedShort c1, bool fourColor, const bool bc3, ColorBlock& best) {
+    if(bc3) fourColor = true;
+    else if(transparent || c0 == c1) fourColor = false;
+    if(fourColor == (c0 < c1)) std::swap(c0, c1);
+
+    Math::Vector3<Int> palette[4];
+    colorPalette(c0, c1, fourColor, palette);
+
+    ColorBlock candidate;
+    candidate.c0 = c0;
+    candidate.c1 = c1;
+    candidate.fourColor = fourColor;
+    candidate.error = 0;
+    const UnsignedByte opaqueCount = fourColor ? 4 : 3;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(transparent & (1 << i)) {
+            candidate.indices[i] = 3;
+            continue;
+        }
+
+        Int error = 0x7fffffff;
+        for(UnsignedByte j = 0; j != opaqueCount; ++j) {
+            const Math::Vector3<Int> d = palette[j] - pixels[i];
+            const Int e = Math::dot(d, d);
+            if(e < error) {
+                error = e;
+                candidate.indices[i] = j;
+            }
+        }
+        candidate.error += error;
+    }
+
+    if(candidate.error < best.error) best = candidate;
+}
+
+void encodeColorBlock(const Block& block, const bool bc3, const BlockCompressionQuality quality, char* const out) {
+    Math::Vector3<Int> pixels[16];
+    Vector3 points[16];
+    UnsignedShort transparent = 0;
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        pixels[i] = Math::Vector3<Int>{block[i].xyz()};
+        if(!bc3 && block[i][3] < 128) transparent |= 1 << i;
+        else points[count++] = Vector3{block[i].xyz()};
+    }
+
+    ColorBlock best;
+    best.error = 0x7fffffff;
+
+    /* All pixels transparent */
+    if(!count) {
+        best.c0 = best.c1 = 0;
+        std::fill_n(best.indices, 16, 3);
+
+    } else {
+        Vector3 a, b;
+        fitPrincipalAxis(points, count, a, b);
+        tryColorEndpoints(pixels, transparent, packRgb565(a), packRgb565(b), true, bc3, best);
+        if(quality != BlockCompressionQuality::Fast && !bc3)
+            tryColorEndpoints(pixels, transparent, packRgb565(a), packRgb565(b), false, bc3, best);
+
+        /* Refit the endpoints to the pixels assigned to interpolated
+           colors */
+        const Int iterationCount = quality == BlockCompressionQuality::Fast ? 0 :
+            quality == BlockCompressionQuality::Normal ? 2 : 4;
+        for(Int iteration = 0; iteration != iterationCount && best.error; ++iteration) {
+            const Int previousError = best.error;
+            Float weights[16];
+            for(std::size_t i = 0, j = 0; i != 16; ++i) {
+                if(transparent & (1 << i)) continue;
+                const UnsignedByte index = best.indices[i];
+                weights[j++] = best.fourColor ?
+                    (index == 0 ? 0.0f : index == 1 ? 1.0f : index == 2 ? 1.0f/3.0f : 2.0f/3.0f) :
+                    (index == 0 ? 0.0f : index == 1 ? 1.0f : 0.5f);
+            }
+            if(!fitLeastSquares(points, weights, count, a, b)) break;
+            tryColorEndpoints(pixels, transparent, packRgb565(a), packRgb565(b), best.fourColor, bc3, best);
+            if(best.error == previousError) break;
+        }
+
+        /* Search neighboring values of each endpoint component until there's
+           no improvement */
+        if(quality == BlockCompressionQuality::Best) {
+            constexpr UnsignedShort steps[]{1 << 11, 1 << 5, 1};
+            constexpr UnsignedShort masks[]{0x1f << 11, 0x3f << 5, 0x1f};
+            for(Int iteration = 0; iteration != 8 && best.error; ++iteration) {
+                const Int previousError = best.error;
+                for(std::size_t endpoint = 0; endpoint != 2; ++endpoint) for(std::size_t c = 0; c != 3; ++c) {
+                    const UnsignedShort c0 = best.c0, c1 = best.c1;
+                    const UnsignedShort color = endpoint ? c1 : c0;
+                    const UnsignedShort field = color & masks[c];
+                    if(field != masks[c]) {
+                        const UnsignedShort up = color + steps[c];
+                        tryColorEndpoints(pixels, transparent, endpoint ? c0 : up, endpoint ? up : c1, best.fourColor, bc3, best);
+                    }
+                    if(field != 0) {
+                        const UnsignedShort down = color - steps[c];
+                        tryColorEndpoints(pixels, transparent, endpoint ? c0 : down, endpoint ? down : c1, best.fourColor, bc3, best);
+                    }
+                }
+                if(best.error == previousError) break;
+            }
+        }
+    }
+
+    UnsignedInt indices = 0;
+    for(std::size_t i = 0; i != 16; ++i) indices |= UnsignedInt(best.indices[i]) << (i*2);
+    out[0] = char(best.c0);
+    out[1] = char(best.c0 >> 8);
+    out[2] = char(best.c1);
+    out[3] = char(best.c1 >> 8);
+    for(std::size_t i = 0; i != 4; ++i) out[i + 4] = char(indices >> (i*8));
+}
+
+void decodeColorBlock(const char* const in, const bool bc3, Block& block) {
+    const UnsignedShort c0 = UnsignedByte(in[0])|(UnsignedByte(in[1]) << 8);
+    const UnsignedShort c1 = UnsignedByte(in[2])|(UnsignedByte(in[3]) << 8);
+    const bool fourColor = bc3 || c0 > c1;
+    Math::Vector3<Int> palette[4];
+    colorPalette(c0, c1, fourColor, palette);
+
+    UnsignedInt indices = 0;
+    for(std::size_t i = 0; i != 4; ++i) indices |= UnsignedInt(UnsignedByte(in[i + 4])) << (i*8);
+    for(std::size_t i = 0; i != 16; ++i) {
+        const UnsignedInt index = (indices >> (i*2)) & 3;
+        block[i].xyz() = Math::Vector3<UnsignedByte>{palette[index]};
+        block[i][3] = fourColor || index != 3 ? 255 : 0;
+    }
+}
+
+/* BC7 block, a variable-length mode prefix followed by mode-specific
+   fields, all packed LSB first */
+
+struct BitWriter {
+    explicit BitWriter(char* const data): data{reinterpret_cast<UnsignedByte*>(data)}, offset{} {
+        std::fill_n(this->data, 16, 0);
+    }
+
+    void write(const UnsignedInt value, const std::size_t bits) {
+        for(std::size_t i = 0; i != bits; ++i, ++offset)
+            data[offset >> 3] |= ((value >> i) & 1) << (offset & 7);
+    }
+
+    UnsignedByte* data;
+    std::size_t offset;
+};
+
+struct BitReader {
+    explicit BitReader(const char* const data): data{reinterpret_cast<const UnsignedByte*>(data)}, offset{} {}
+
+    UnsignedInt read(const std::size_t bits) {
+        UnsignedInt value = 0;
+        for(std::size_t i = 0; i != bits; ++i, ++offset)
+            value |= ((data[offset >> 3] >> (offset & 7)) & 1) << i;
+        return value;
+    }
+
+    const UnsignedByte* data;
+    std::size_t offset;
+};
+
+constexpr UnsignedByte Weights2[]{0, 21, 43, 64};
+constexpr UnsignedByte Weights4[]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+Int interpolate(const Int e0, const Int e1, const Int weight) {
+    return ((64 - weight)*e0 + weight*e1 + 32) >> 6;
+}
+
+/* Nearest interpolated values for channels [first, first + channelCount),
+   returns total squared error. The palette entries lie on a line (up to
+   rounding) and the weights are almost uniformly distributed, so the nearest
+   entry is estimated from projection of the pixel onto the line and only
+   entries around it are checked. */
+template<std::size_t channelCount> Int bc7Indices(const Vector4i(&pixels)[16], const std::size_t first, const Vector4i& e0, const Vector4i& e1, const UnsignedByte* const weights, const Int weightCount, UnsignedByte(&indices)[16]) {
+    Int palette[16][channelCount];
+    for(Int i = 0; i != weightCount; ++i)
+        for(std::size_t c = 0; c != channelCount; ++c)
+            palette[i][c] = interpolate(e0[first + c], e1[first + c], weights[i]);
+
+    Int direction[channelCount];
+    Int lengthSquared = 0;
+    for(std::size_t c = 0; c != channelCount; ++c) {
+        direction[c] = e1[first + c] - e0[first + c];
+        lengthSquared += direction[c]*direction[c];
+    }
+    const Float scale = lengthSquared ? Float(weightCount - 1)/lengthSquared : 0.0f;
+
+    Int error = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        Int projection = 0;
+        for(std::size_t c = 0; c != channelCount; ++c)
+            projection += (pixels[i][first + c] - e0[first + c])*direction[c];
+        /* Truncation instead of floor is fine, negative values are clamped
+           to zero anyway */
+        const Int estimate = Math::clamp(Int(projection*scale + 0.5f), 0, weightCount - 1);
+
+        Int best = 0x7fffffff;
+        for(Int j = std::max(estimate - 2, 0), end = std::min(estimate + 2, weightCount - 1); j <= end; ++j) {
+            Int e = 0;
+            for(std::size_t c = 0; c != channelCount; ++c)
+                e += (palette[j][c] - pixels[i][first + c])*(palette[j][c] - pixels[i][first + c]);
+            if(e < best) {
+                best = e;
+                indices[i] = UnsignedByte(j);
+            }
+        }
+        error += best;
+    }
+
+    return error;
+}
+
+/* Mode 6: RGBA endpoints with 7 bits per channel and a p-bit for each
+   endpoint, sixteen 4-bit indices */
+struct Bc7Mode6 {
+    Int error;
+    Vector4i q0, q1;
+    Int p0, p1;
+    UnsignedByte indices[16];
+};
+
+Vector4i quantizeMode6(const Vector4& endpoint, const Int p) {
+    Vector4i q;
+    for(std::size_t c = 0; c != 4; ++c) q[c] = roundClamped((endpoint[c] - p)*0.5f, 127);
+    return q;
+}
+
+void tryMode6(const Vector4i(&pixels)[16], const Vector4& a, const Vector4& b, const Int p0, const Int p1, Bc7Mode6& best) {
+    Bc7Mode6 candidate;
+    candidate.q0 = quantizeMode6(a, p0);
+    candidate.q1 = quantizeMode6(b, p1);
+    candidate.p0 = p0;
+    candidate.p1 = p1;
+    candidate.error = bc7Indices<4>(pixels, 0, candidate.q0*2 + Vector4i{p0}, candidate.q1*2 + Vector4i{p1}, Weights4, 16, candidate.indices);
+    if(candidate.error < best.error) best = candidate;
+}
+
+/* Picks the p-bit with the smallest quantization error of given endpoint */
+Int mode6PBit(const Vector4& endpoint) {
+    Int errors[2]{};
+    for(Int p = 0; p != 2; ++p) {
+        const Vector4 d = Vector4{quantizeMode6(endpoint, p)*2 + Vector4i{p}} - endpoint;
+        errors[p] = Int(Math::dot(d, d));
+    }
+    return errors[1] < errors[0] ? 1 : 0;
+}
+
+Bc7Mode6 encodeMode6(const Vector4i(&pixels)[16], const BlockCompressionQuality quality) {
+    Vector4 points[16];
+    for(std::size_t i = 0; i != 16; ++i) points[i] = Vector4{pixels[i]};
+
+    Vector4 a, b;
+    fitPrincipalAxis(points, 16, a, b);
+
+    Bc7Mode6 best;
+    best.error = 0x7fffffff;
+    const Int iterationCount = quality == BlockCompressionQuality::Fast ? 0 :
+        quality == BlockCompressionQuality::Normal ? 2 : 4;
+    for(Int iteration = 0; ; ++iteration) {
+        /* P-bits with the smallest quantization error are usually the best
+           choice, all combinations are tried only for the final endpoints
+           or always for the best quality */
+        const Int p0 = mode6PBit(a), p1 = mode6PBit(b);
+        tryMode6(pixels, a, b, p0, p1, best);
+        if(quality == BlockCompressionQuality::Best || (quality == BlockCompressionQuality::Normal && iteration == iterationCount)) {
+            for(Int p = 0; p != 4; ++p) if((p & 1) != p0 || (p >> 1) != p1)
+                tryMode6(pixels, a, b, p & 1, p >> 1, best);
+        }
+
+        if(iteration == iterationCount || !best.error) break;
+
+        Float weights[16];
+        for(std::size_t i = 0; i != 16; ++i) weights[i] = Weights4[best.indices[i]]/64.0f;
+        if(!fitLeastSquares(points, weights, 16, a, b)) break;
+    }
+
+    return best;
+}
+
+void writeMode6(Bc7Mode6 block, char* const out) {
+    /* The most significant bit of the first index is implicitly zero */
+    if(block.indices[0] & 8) {
+        std::swap(block.q0, block.q1);
+        std::swap(block.p0, block.p1);
+        for(UnsignedByte& index: block.indices) index = 15 - index;
+    }
+
+    BitWriter writer{out};
+    writer.write(1 << 6, 7);
+    for(std::size_t c = 0; c != 4; ++c) {
+        writer.write(block.q0[c], 7);
+        writer.write(block.q1[c], 7);
+    }
+    writer.write(block.p0, 1);
+    writer.write(block.p1, 1);
+    writer.write(block.indices[0], 3);
+    for(std::size_t i = 1; i != 16; ++i) writer.write(block.indices[i], 4);
+}
+
+/* Mode 5: RGB endpoints with 7 bits per channel, alpha endpoints with 8
+   bits, separate 2-bit indices for color and alpha. Alpha can be swapped
+   with one of the color channels (rotation). */
+struct Bc7Mode5 {
+    Int error;
+    Int rotation;
+    Vector4i q0, q1;
+    UnsignedByte colorIndices[16];
+    UnsignedByte alphaIndices[16];
+};
+
+Vector4i expandMode5(const Vector4i& q) {
+    return {(q[0] << 1)|(q[0] >> 6), (q[1] << 1)|(q[1] >> 6), (q[2] << 1)|(q[2] >> 6), q[3]};
+}
+
+Vector4i quantizeMode5(const Vector4& endpoint) {
+    return {roundClamped(endpoint[0]*127.0f/255.0f, 127),
+            roundClamped(endpoint[1]*127.0f/255.0f, 127),
+            roundClamped(endpoint[2]*127.0f/255.0f, 127),
+            roundClamped(endpoint[3], 255)};
+}
+
+Bc7Mode5 encodeMode5(Vector4i(&pixels)[16], const Int rotation, const BlockCompressionQuality quality) {
+    if(rotation) for(Vector4i& pixel: pixels) std::swap(pixel[rotation - 1], pixel[3]);
+
+    Vector3 colors[16];
+    Math::Vector<1, Float> alphas[16];
+    Float min = 255.0f, max = 0.0f;
+    for(std::size_t i = 0; i != 16; ++i) {
+        colors[i] = Vector3{pixels[i].xyz()};
+        alphas[i][0] = Float(pixels[i][3]);
+        min = std::min(min, alphas[i][0]);
+        max = std::max(max, alphas[i][0]);
+    }
+
+    Vector3 a, b;
+    fitPrincipalAxis(colors, 16, a, b);
+
+    Bc7Mode5 best;
+    best.rotation = rotation;
+    best.q0 = quantizeMode5({a, min});
+    best.q1 = quantizeMode5({b, max});
+    Int colorError = bc7Indices<3>(pixels, 0, expandMode5(best.q0), expandMode5(best.q1), Weights2, 4, best.colorIndices);
+    Int alphaError = bc7Indices<1>(pixels, 3, expandMode5(best.q0), expandMode5(best.q1), Weights2, 4, best.alphaIndices);
+
+    /* Color and alpha are independent, refine each separately */
+    const Int iterationCount = quality == BlockCompressionQuality::Best ? 4 : 1;
+    Float weights[16];
+    for(Int iteration = 0; iteration != iterationCount && colorError; ++iteration) {
+        for(std::size_t i = 0; i != 16; ++i) weights[i] = Weights2[best.colorIndices[i]]/64.0f;
+        if(!fitLeastSquares(colors, weights, 16, a, b)) break;
+
+        const Vector4i q0 = quantizeMode5({a, 0.0f}), q1 = quantizeMode5({b, 0.0f});
+        UnsignedByte indices[16];
+        const Int error = bc7Indices<3>(pixels, 0, expandMode5(q0), expandMode5(q1), Weights2, 4, indices);
+        if(error >= colorError) break;
+
+        colorError = error;
+        best.q0.xyz() = q0.xyz();
+        best.q1.xyz() = q1.xyz();
+        std::copy(indices, indices + 16, best.colorIndices);
+    }
+    for(Int iteration = 0; iteration != iterationCount && alphaError; ++iteration) {
+        for(std::size_t i = 0; i != 16; ++i) weights[i] = Weights2[best.alphaIndices[i]]/64.0f;
+        Math::Vector<1, Float> alphaA, alphaB;
+        if(!fitLeastSquares(alphas, weights, 16, alphaA, alphaB)) break;
+
+        Vector4i q0 = best.q0, q1 = best.q1;
+        q0[3] = roundClamped(alphaA[0], 255);
+        q1[3] = roundClamped(alphaB[0], 255);
+        UnsignedByte indices[16];
+        const Int error = bc7Indices<1>(pixels, 3, q0, q1, Weights2, 4, indices);
+        if(error >= alphaError) break;
+
+        alphaError = error;
+        best.q0[3] = q0[3];
+        best.q1[3] = q1[3];
+        std::copy(indices, indices + 16, best.alphaIndices);
+    }
+
+    if(rotation) for(Vector4i& pixel: pixels) std::swap(pixel[rotation - 1], pixel[3]);
+
+    best.error = colorError + alphaError;
+    return best;
+}
+
+void writeMode5(Bc7Mode5 block, char* const out) {
+    /* The most significant bit of the first index of both index sets is
+       implicitly zero */
+    if(block.colorIndices[0] & 2) {
+        std::swap(block.q0.xyz(), block.q1.xyz());
+        for(UnsignedByte& index: block.colorIndices) index = 3 - index;
+    }
+    if(block.alphaIndices[0] & 2) {
+        std::swap(block.q0[3], block.q1[3]);
+        for(UnsignedByte& index: block.alphaIndices) index = 3 - index;
+    }
+
+    BitWriter writer{out};
+    writer.write(1 << 5, 6);
+    writer.write(block.rotation, 2);
+    for(std::size_t c = 0; c != 3; ++c) {
+        writer.write(block.q0[c], 7);
+        writer.write(block.q1[c], 7);
+    }
+    writer.write(block.q0[3], 8);
+    writer.write(block.q1[3], 8);
+    writer.write(block.colorIndices[0], 1);
+    for(std::size_t i = 1; i != 16; ++i) writer.write(block.colorIndices[i], 2);
+    writer.write(block.alphaIndices[0], 1);
+    for(std::size_t i = 1; i != 16; ++i) writer.write(block.alphaIndices[i], 2);
+}
+
+void encodeBc7Block(const Block& block, const BlockCompressionQuality quality, char* const out) {
+    Vector4i pixels[16];
+    bool opaque = true;
+    for(std::size_t i = 0; i != 16; ++i) {
+        pixels[i] = Vector4i{block[i]};
+        opaque = opaque && block[i][3] == 255;
+    }
+
+    const Bc7Mode6 mode6 = encodeMode6(pixels, quality);
+
+    /* Mode 5 helps mainly if alpha is not correlated with color, try it only
+       for blocks with alpha unless the best quality is requested. Rotations
+       swap alpha with one of color channels, which then gets its own
+       indices. */
+    Bc7Mode5 mode5;
+    mode5.error = 0x7fffffff;
+    if(mode6.error && quality != BlockCompressionQuality::Fast) {
+        const Int rotationCount = quality == BlockCompressionQuality::Best ? 4 : opaque ? 0 : 1;
+        for(Int rotation = 0; rotation != rotationCount; ++rotation) {
+            const Bc7Mode5 candidate = encodeMode5(pixels, rotation, quality);
+            if(candidate.error < mode5.error) mode5 = candidate;
+        }
+    }
+
+    if(mode5.error < mode6.error) writeMode5(mode5, out);
+    else writeMode6(mode6, out);
+}
+
+void decodeBc7Block(const char* const in, Block& block) {
+    BitReader reader{in};
+    Int mode = 0;
+    while(mode != 8 && !reader.read(1)) ++mode;
+
+    if(mode == 6) {
+        Vector4i e0, e1;
+        for(std::size_t c = 0; c != 4; ++c) {
+            e0[c] = reader.read(7) << 1;
+            e1[c] = reader.read(7) << 1;
+        }
+        e0 += Vector4i{Int(reader.read(1))};
+        e1 += Vector4i{Int(reader.read(1))};
+
+        for(std::size_t i = 0; i != 16; ++i) {
+            const Int weight = Weights4[reader.read(i ? 4 : 3)];
+            for(std::size_t c = 0; c != 4; ++c)
+                block[i][c] = UnsignedByte(interpolate(e0[c], e1[c], weight));
+        }
+
+    } else if(mode == 5) {
+        const Int rotation = reader.read(2);
+        Vector4i q0, q1;
+        for(std::size_t c = 0; c != 3; ++c) {
+            q0[c] = reader.read(7);
+            q1[c] = reader.read(7);
+        }
+        q0[3] = reader.read(8);
+        q1[3] = reader.read(8);
+        const Vector4i e0 = expandMode5(q0), e1 = expandMode5(q1);
+
+        for(std::size_t i = 0; i != 16; ++i) {
+            const Int weight = Weights2[reader.read(i ? 2 : 1)];
+            for(std::size_t c = 0; c != 3; ++c)
+                block[i][c] = UnsignedByte(interpolate(e0[c], e1[c], weight));
+        }
+        for(std::size_t i = 0; i != 16; ++i)
+            block[i][3] = UnsignedByte(interpolate(e0[3], e1[3], Weights2[reader.read(i ? 2 : 1)]));
+
+        if(rotation) for(Pixel& pixel: block) std::swap(pixel[rotation - 1], pixel[3]);
+
+    /* Unsupported or reserved mode */
+    } else std::fill_n(block, 16, Pixel{});
+}
+
+}
+
+Debug operator<<(Debug debug, const BlockCompression value) {
+    switch(value) {
+        #define _c(value) case BlockCompression::value: return debug << "TextureTools::BlockCompression::" #value;
+        _c(Bc1)
+        _c(Bc3)
+        _c(Bc4)
+        _c(Bc5)
+        _c(Bc7)
+        #undef _c
+    }
+
+    return debug << "TextureTools::BlockCompression::(invalid)";
+}
+
+Debug operator<<(Debug debug, const BlockCompressionQuality value) {
+    switch(value) {
+        #define _c(value) case BlockCompressionQuality::value: return debug << "TextureTools::BlockCompressionQuality::" #value;
+        _c(Fast)
+        _c(Normal)
+        _c(Best)
+        #undef _c
+    }
+
+    return debug << "TextureTools::BlockCompressionQuality::(invalid)";
+}
+
+std::size_t compressedBlockSize(const BlockCompression format) {
+    return format == BlockCompression::Bc1 || format == BlockCompression::Bc4 ? 8 : 16;
+}
+
+std::size_t compressedDataSize(const BlockCompression format, const Vector2i& size) {
+    return std::size_t((size.x() + 3)/4)*((size.y() + 3)/4)*compressedBlockSize(format);
+}
+
+Containers::Array<char> compressBlocks(const ImageReference2D& image, const BlockCompression format, const BlockCompressionQuality quality, const std::size_t threadCount) {
+    CORRADE_ASSERT(image.type() == ColorType::UnsignedByte,
+        "TextureTools::compressBlocks(): unsupported type" << image.type(), nullptr);
+    const std::size_t pixelSize = image.pixelSize();
+    CORRADE_ASSERT((format != BlockCompression::Bc5 || pixelSize >= 2) &&
+                   (format == BlockCompression::Bc4 || format == BlockCompression::Bc5 || isColor(image.format())),
+        "TextureTools::compressBlocks(): unsupported format" << image.format() << "for" << format, nullptr);
+
+    const std::size_t blockSize = compressedBlockSize(format);
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    Containers::Array<char> out{compressedDataSize(format, image.size())};
+    const std::size_t rowStride = image.dataSize({image.size().x(), 1});
+    const bool swapped = isSwapped(image.format());
+
+    Magnum::Implementation::parallelFor(blockCount.y(), threadCount, Magnum::Implementation::minRangeSize(MinParallelBlockCount, blockCount.x()), [&](const std::size_t begin, const std::size_t end) {
+        Block block;
+        for(std::size_t y = begin; y != end; ++y) {
+            char* output = out + y*blockCount.x()*blockSize;
+            for(Int x = 0; x != blockCount.x(); ++x, output += blockSize) {
+                fetchBlock(image.data(), rowStride, pixelSize, swapped, image.size(), {x*4, Int(y)*4}, block);
+                switch(format) {
+                    case BlockCompression::Bc1:
+                        encodeColorBlock(block, false, quality, output);
+                        break;
+                    case BlockCompression::Bc3:
+                        encodeAlphaBlock(block, 3, quality, output);
+                        encodeColorBlock(block, true, quality, output + 8);
+                        break;
+                    case BlockCompression::Bc4:
+                        encodeAlphaBlock(block, 0, quality, output);
+                        break;
+                    case BlockCompression::Bc5:
+                        encodeAlphaBlock(block, 0, quality, output);
+                        encodeAlphaBlock(block, 1, quality, output + 8);
+                        break;
+                    case BlockCompression::Bc7:
+                        encodeBc7Block(block, quality, output);
+                        break;
+                }
+            }
+        }
+    });
+
+    return out;
+}
+
+Image2D decompressBlocks(const Containers::ArrayView<const char> data, const BlockCompression format, const Vector2i& size, const std::size_t threadCount) {
+    CORRADE_ASSERT(data.size() >= compressedDataSize(format, size),
+        "TextureTools::decompressBlocks(): expected at least" << compressedDataSize(format, size) << "bytes but got" << data.size(), (Image2D{ColorFormat::RGBA, ColorType::UnsignedByte}));
+
+    ColorFormat colorFormat;
+    std::size_t channelCount;
+    switch(format) {
+        case BlockCompression::Bc4:
+            #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+            colorFormat = ColorFormat::Red;
+            #else
+            colorFormat = ColorFormat::Luminance;
+            #endif
+            channelCount = 1;
+            break;
+        case BlockCompression::Bc5:
+            #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+            colorFormat = ColorFormat::RG;
+            #else
+            colorFormat = ColorFormat::LuminanceAlpha;
+            #endif
+            channelCount = 2;
+            break;
+        default:
+            colorFormat = ColorFormat::RGBA;
+            channelCount = 4;
+    }
+
+    /* Rows are aligned to four bytes, the padding is zeroed */
+    const std::size_t rowStride = (size.x()*channelCount + 3)/4*4;
+    char* const out = new char[rowStride*size.y()]();
+
+    const std::size_t blockSize = compressedBlockSize(format);
+    const Vector2i blockCount = (size + Vector2i{3})/4;
+    Magnum::Implementation::parallelFor(blockCount.y(), threadCount, Magnum::Implementation::minRangeSize(MinParallelBlockCount, blockCount.x()), [&](const std::size_t begin, const std::size_t end) {
+        Block block;
+        for(std::size_t y = begin; y != end; ++y) {
+            const char* input = data + y*blockCount.x()*blockSize;
+            for(Int x = 0; x != blockCount.x(); ++x, input += blockSize) {
+                switch(format) {
+                    case BlockCompression::Bc1:
+                        decodeColorBlock(input, false, block);
+                        break;
+                    case BlockCompression::Bc3:
+                        decodeColorBlock(input + 8, true, block);
+                        decodeAlphaBlock(input, block, 3);
+                        break;
+                    case BlockCompression::Bc4:
+                        decodeAlphaBlock(input, block, 0);
+                        break;
+                    case BlockCompression::Bc5:
+                        decodeAlphaBlock(input, block, 0);
+                        decodeAlphaBlock(input + 8, block, 1);
+                        break;
+                    case BlockCompression::Bc7:
+                        decodeBc7Block(input, block);
+                        break;
+                }
+
+                storeBlock(block, channelCount, size, {x*4, Int(y)*4}, rowStride, out);
+            }
+        }
+    });
+
+    return Image2D{colorFormat, ColorType::UnsignedByte, size, out};
+}
+
+}}
@@ -0,0 +1,187 @@
+#ifndef Magnum_TextureTools_BlockCompression_h
+#define Magnum_TextureTools_BlockCompression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::compressBlocks(), @ref Magnum::TextureTools::decompressBlocks(), @ref Magnum::TextureTools::compressedBlockSize(), @ref Magnum::TextureTools::compressedDataSize(), enum @ref Magnum::TextureTools::BlockCompression, @ref Magnum::TextureTools::BlockCompressionQuality
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Block compression format
+
+All formats compress blocks of @f$ 4 \times 4 @f$ pixels into fixed amount of
+bytes, see @ref compressedBlockSize().
+@see @ref compressBlocks(), @ref decompressBlocks()
+*/
+enum class BlockCompression: UnsignedByte {
+    /**
+     * BC1 (also known as DXT1 or S3TC). RGB with optional 1-bit alpha, 8
+     * bytes per block. Pixels with alpha less than `128` are encoded as
+     * transparent black.
+     */
+    Bc1,
+
+    /**
+     * BC3 (also known as DXT5). RGB compressed the same way as
+     * @ref BlockCompression::Bc1 and interpolated alpha compressed the
+     * same way as @ref BlockCompression::Bc4, 16 bytes per block.
+     */
+    Bc3,
+
+    /**
+     * BC4, single channel, 8 bytes per block. Corresponds to
+     * @ref TextureFormat::CompressedRedRgtc1.
+     */
+    Bc4,
+
+    /**
+     * BC5, two channels compressed separately, 16 bytes per block.
+     * Corresponds to @ref TextureFormat::CompressedRGRgtc2.
+     */
+    Bc5,
+
+    /**
+     * BC7, RGBA, 16 bytes per block. Corresponds to
+     * @ref TextureFormat::CompressedRGBABptcUnorm. The encoder uses only
+     * block modes 5 and 6, see @ref compressBlocks() for more information.
+     */
+    Bc7
+};
+
+/** @debugoperatorenum{Magnum::TextureTools::BlockCompression} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug operator<<(Debug debug, BlockCompression value);
+
+/**
+@brief Block compression quality
+
+@see @ref compressBlocks()
+*/
+enum class BlockCompressionQuality: UnsignedByte {
+    /**
+     * Endpoints are fitted along principal axis of the block colors without
+     * any further refinement. Suitable for textures generated at runtime.
+     */
+    Fast,
+
+    /**
+     * Endpoints are refined using least squares fit and alternative block
+     * modes are tried. Good tradeoff for offline processing.
+     */
+    Normal,
+
+    /**
+     * More refinement iterations, exhaustive search of neighboring
+     * endpoint values and all BC7 mode 5 rotations. Several times slower
+     * than @ref BlockCompressionQuality::Normal.
+     */
+    Best
+};
+
+/** @debugoperatorenum{Magnum::TextureTools::BlockCompressionQuality} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug operator<<(Debug debug, BlockCompressionQuality value);
+
+/**
+@brief Size of one compressed block
+
+Returns `8` for @ref BlockCompression::Bc1 and @ref BlockCompression::Bc4,
+`16` otherwise.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT std::size_t compressedBlockSize(BlockCompression format);
+
+/**
+@brief Size of compressed image data
+
+Size of the image is rounded up to whole blocks.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT std::size_t compressedDataSize(BlockCompression format, const Vector2i& size);
+
+/**
+@brief Compress image into blocks
+@param image        Source image
+@param format       Block compression format
+@param quality      Compression quality
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Expects image with @ref ColorType::UnsignedByte type. @ref BlockCompression::Bc4
+compresses the first channel of any format, @ref BlockCompression::Bc5 the
+first two channels of any format with at least two channels, other formats
+expect @ref ColorFormat::RGB, @ref ColorFormat::RGBA, @ref ColorFormat::BGR
+or @ref ColorFormat::BGRA, images without alpha channel are treated as fully
+opaque. Image sizes which are not multiples of four are supported, the
+missing pixels in edge blocks are replaced with the nearest edge pixel. The
+blocks are ordered in the same way as image rows, i.e. the returned data can
+be directly uploaded to a texture with corresponding compressed format:
+@code
+Image2D image = ...;
+Containers::Array<char> data = TextureTools::compressBlocks(image,
+    TextureTools::BlockCompression::Bc7, TextureTools::BlockCompressionQuality::Fast);
+@endcode
+
+All encoders fit the block endpoints along principal axis of the pixel values
+and then choose the nearest palette entry for each pixel, the error is
+measured as sum of squared differences of all channels. The BC7 encoder
+supports only block modes 6 (single RGBA endpoint pair with 16 levels) and 5
+(RGB and separate alpha endpoints, optionally with alpha swapped with one of
+the color channels), which cover most of the practical quality of the format
+without the cost of searching through the partitioned modes. Rows of blocks
+are compressed in parallel on @p threadCount threads, small images are
+compressed on the calling thread. The result is deterministic, independent on
+thread count.
+@see @ref decompressBlocks(), @ref compressedDataSize()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<char> compressBlocks(const ImageReference2D& image, BlockCompression format, BlockCompressionQuality quality = BlockCompressionQuality::Normal, std::size_t threadCount = 0);
+
+/**
+@brief Decompress blocks into an image
+@param data         Compressed data
+@param format       Block compression format
+@param size         Image size
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+
+Inverse to @ref compressBlocks(), expects that @p data are at least
+@ref compressedDataSize() bytes large. Returns @ref ColorFormat::Red (or
+@ref ColorFormat::Luminance in WebGL 1.0) image for
+@ref BlockCompression::Bc4, @ref ColorFormat::RG (or
+@ref ColorFormat::LuminanceAlpha in WebGL 1.0) image for
+@ref BlockCompression::Bc5 and @ref ColorFormat::RGBA image otherwise, all
+with @ref ColorType::UnsignedByte type. Palette entries are calculated with
+integer arithmetic, the result may thus differ by one from what particular
+GPU produces for BC1 and BC3. Only BC7 block modes 5 and 6 are supported,
+blocks in other modes are decoded as transparent black.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D decompressBlocks(Containers::ArrayView<const char> data, BlockCompression format, const Vector2i& size, std::size_t threadCount = 0);
+
+}}
+
+#endif
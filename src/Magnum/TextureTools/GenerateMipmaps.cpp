@@ -0,0 +1,212 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMipmaps.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageConversion.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/Implementation/Resample.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+constexpr std::size_t NoAlpha = ~std::size_t{};
+
+std::size_t alphaIndex(const ColorFormat format) {
+    switch(format) {
+        case ColorFormat::RGBA:
+        #ifndef MAGNUM_TARGET_WEBGL
+        case ColorFormat::BGRA:
+        #endif
+            return 3;
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::LuminanceAlpha:
+            return 1;
+        #endif
+        default: return NoAlpha;
+    }
+}
+
+/* Modified Bessel function of the first kind of order zero */
+Float besselI0(const Float x) {
+    Float sum = 1.0f, term = 1.0f;
+    const Float halfSquared = x*x*0.25f;
+    for(Int k = 1; term > sum*1.0e-8f; ++k) {
+        term *= halfSquared/Float(k*k);
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr Float KaiserAlpha = 4.0f;
+
+Float boxWeight(const Float x) {
+    return std::abs(x) < 0.5f ? 1.0f : 0.0f;
+}
+
+/* Sinc windowed with Kaiser window of radius 3 */
+Float kaiserWeight(const Float x) {
+    if(std::abs(x) >= 3.0f) return 0.0f;
+    const Float t = x/3.0f;
+    return Implementation::sinc(x)*besselI0(KaiserAlpha*std::sqrt(1.0f - t*t))/besselI0(KaiserAlpha);
+}
+
+Implementation::Kernel kernel(const MipmapFilter filter) {
+    switch(filter) {
+        case MipmapFilter::Box: return {0.5f, boxWeight};
+        case MipmapFilter::Kaiser: return {3.0f, kaiserWeight};
+        case MipmapFilter::Lanczos: return {3.0f, Implementation::lanczos3};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+/* Downsamples tightly packed float image to given size */
+std::vector<Float> downsample(const Float* const source, const Vector2i& sourceSize, const Vector2i& size, const std::size_t channelCount, const MipmapFilter filter, const std::size_t threadCount) {
+    const Implementation::Contributions horizontal{kernel(filter), sourceSize.x(), size.x()};
+    const Implementation::Contributions vertical{kernel(filter), sourceSize.y(), size.y()};
+    const std::size_t sourceRowSize = sourceSize.x()*channelCount;
+    const std::size_t rowSize = size.x()*channelCount;
+    std::vector<Float> out(rowSize*size.y());
+
+    /* Each output row is filtered vertically into a temporary row which is
+       then filtered horizontally, so the rows are independent */
+    Magnum::Implementation::parallelFor(size.y(), threadCount, Magnum::Implementation::minRangeSize(Implementation::MinParallelRangeSize, sourceRowSize*sizeof(Float)*vertical.tapCount), [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Float> row(sourceRowSize);
+        for(std::size_t y = begin; y != end; ++y) {
+            Implementation::filterVertical(source, sourceRowSize, vertical.indices.data() + y*vertical.tapCount, vertical.weights.data() + y*vertical.tapCount, vertical.tapCount, row.data());
+
+            Implementation::filterHorizontal(row.data(), horizontal, size.x(), channelCount, out.data() + y*rowSize);
+        }
+    });
+
+    return out;
+}
+
+std::size_t alphaCoverage(const Float* const data, const std::size_t size, const std::size_t channelCount, const std::size_t alpha, const Float reference) {
+    std::size_t count = 0;
+    for(std::size_t i = alpha; i < size; i += channelCount)
+        if(data[i] > reference) ++count;
+    return count;
+}
+
+/* Scales alpha so approximately given fraction of pixels has alpha larger
+   than the reference. The scale is chosen halfway between alpha of the
+   k-th and (k + 1)-th largest value, where k is the desired pixel count. */
+void preserveAlphaCoverage(std::vector<Float>& data, const std::size_t channelCount, const std::size_t alpha, const Float reference, const Float coverage) {
+    const std::size_t pixelCount = data.size()/channelCount;
+    const std::size_t k = std::size_t(coverage*pixelCount + 0.5f);
+    if(!k) return;
+
+    std::vector<Float> alphas(pixelCount);
+    for(std::size_t i = 0; i != pixelCount; ++i) alphas[i] = data[i*channelCount + alpha];
+    std::nth_element(alphas.begin(), alphas.begin() + (k - 1), alphas.end(), std::greater<Float>());
+    const Float kth = alphas[k - 1];
+    const Float next = k < pixelCount ? *std::max_element(alphas.begin() + k, alphas.end()) : 0.0f;
+    if(kth + next <= 0.0f) return;
+
+    const Float scale = 2.0f*reference/(kth + next);
+    for(std::size_t i = alpha; i < data.size(); i += channelCount)
+        data[i] = std::min(data[i]*scale, 1.0f);
+}
+
+}
+
+Debug operator<<(Debug debug, const MipmapFilter value) {
+    switch(value) {
+        #define _c(value) case MipmapFilter::value: return debug << "TextureTools::MipmapFilter::" #value;
+        _c(Box)
+        _c(Kaiser)
+        _c(Lanczos)
+        #undef _c
+    }
+
+    return debug << "TextureTools::MipmapFilter::(invalid)";
+}
+
+std::vector<Trade::ImageData2D> generateMipmaps(const ImageReference2D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaReference, const std::size_t threadCount) {
+    CORRADE_ASSERT(image.type() == ColorType::UnsignedByte || image.type() == ColorType::HalfFloat || image.type() == ColorType::Float,
+        "TextureTools::generateMipmaps(): unsupported type" << image.type(), {});
+    const std::size_t alpha = alphaIndex(image.format());
+    CORRADE_ASSERT(!(flags & MipmapFlag::PreserveAlphaCoverage) || alpha != NoAlpha,
+        "TextureTools::generateMipmaps(): alpha coverage can't be preserved for format" << image.format(), {});
+
+    std::vector<Trade::ImageData2D> levels;
+    const std::size_t dataSize = image.dataSize(image.size());
+    char* const data = new char[dataSize];
+    std::copy(image.data(), image.data() + dataSize, data);
+    levels.emplace_back(image.format(), image.type(), image.size(), data);
+
+    const ImageConversion::ConversionFlags conversionFlags = flags & MipmapFlag::Srgb ? ImageConversion::ConversionFlag::Srgb : ImageConversion::ConversionFlags{};
+    const std::size_t channelCount = image.pixelSize(image.format(), ColorType::Float)/sizeof(Float);
+
+    /* Tightly packed float data, rows of float images don't need padding.
+       The first level is filtered directly from the converted image. */
+    Vector2i size = image.size();
+    Image2D converted = ImageConversion::convert(image, image.format(), ColorType::Float, conversionFlags, threadCount);
+    const std::size_t componentCount = std::size_t(size.product())*channelCount;
+
+    const bool preserveCoverage = !!(flags & MipmapFlag::PreserveAlphaCoverage);
+    const Float coverage = preserveCoverage && componentCount ?
+        Float(alphaCoverage(reinterpret_cast<const Float*>(converted.data()), componentCount, channelCount, alpha, alphaReference))/(componentCount/channelCount) : 0.0f;
+
+    std::vector<Float> level;
+    while(size.x() > 1 || size.y() > 1) {
+        const Vector2i nextSize = Math::max(size/2, Vector2i{1});
+        level = downsample(converted.data() ? reinterpret_cast<const Float*>(converted.data()) : level.data(), size, nextSize, channelCount, filter, threadCount);
+        size = nextSize;
+        converted = Image2D{image.format(), ColorType::Float};
+
+        if(preserveCoverage)
+            preserveAlphaCoverage(level, channelCount, alpha, alphaReference, coverage);
+
+        /* Convert back to the original type, float data can be used
+           directly */
+        if(image.type() == ColorType::Float) {
+            char* const levelData = new char[level.size()*sizeof(Float)];
+            std::memcpy(levelData, level.data(), level.size()*sizeof(Float));
+            levels.emplace_back(image.format(), image.type(), size, levelData);
+        } else {
+            Image2D converted = ImageConversion::convert(ImageReference2D{image.format(), ColorType::Float, size, level.data()}, image.format(), image.type(), conversionFlags, threadCount);
+            levels.emplace_back(image.format(), image.type(), size, converted.release());
+        }
+    }
+
+    return levels;
+}
+
+}}
@@ -0,0 +1,143 @@
+#ifndef Magnum_TextureTools_GenerateMipmaps_h
+#define Magnum_TextureTools_GenerateMipmaps_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::generateMipmaps(), enum @ref Magnum::TextureTools::MipmapFilter, @ref Magnum::TextureTools::MipmapFlag, enum set @ref Magnum::TextureTools::MipmapFlags
+ */
+
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Mipmap downsampling filter
+
+@see @ref generateMipmaps()
+*/
+enum class MipmapFilter: UnsignedByte {
+    /**
+     * Average of source pixels covered by each destination pixel. Cheapest,
+     * equivalent to what @ref AbstractTexture::generateMipmap() commonly
+     * does, but prone to aliasing and blurring.
+     */
+    Box,
+
+    /**
+     * Sinc windowed with Kaiser window (@f$ \alpha = 4 @f$) of radius 3.
+     * Sharper than @ref MipmapFilter::Box with almost no ringing.
+     */
+    Kaiser,
+
+    /**
+     * Three-lobed Lanczos filter. Sharpest, but may produce slight ringing
+     * around high-contrast edges.
+     */
+    Lanczos
+};
+
+/** @debugoperatorenum{Magnum::TextureTools::MipmapFilter} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug operator<<(Debug debug, MipmapFilter value);
+
+/**
+@brief Mipmap generation flag
+
+@see @ref MipmapFlags, @ref generateMipmaps()
+*/
+enum class MipmapFlag: UnsignedByte {
+    /**
+     * @ref ColorType::UnsignedByte data are sRGB-encoded. Color channels
+     * are converted to linear space before filtering and back after, alpha
+     * channel is filtered as-is. Floating-point data are always expected to
+     * be linear.
+     */
+    Srgb = 1 << 0,
+
+    /**
+     * Scale alpha of each level so the fraction of pixels with alpha larger
+     * than given reference value is the same as in the original image.
+     * Useful for alpha-tested textures such as foliage, which would
+     * otherwise get thinner with each level.
+     */
+    PreserveAlphaCoverage = 1 << 1
+};
+
+/**
+@brief Mipmap generation flags
+
+@see @ref generateMipmaps()
+*/
+typedef Containers::EnumSet<MipmapFlag> MipmapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MipmapFlags)
+
+/**
+@brief Generate mipmap chain
+@param image            Source image
+@param filter           Downsampling filter
+@param flags            Generation flags
+@param alphaReference   Reference value for
+    @ref MipmapFlag::PreserveAlphaCoverage
+@param threadCount      Thread count. If `0`, hardware concurrency is used.
+@return All mip levels, the first one being copy of @p image
+
+Generates levels down to @f$ 1 \times 1 @f$, each level has size of the
+previous one divided by two and rounded down, but at least `1`. Each level is
+calculated from the previous one using separable polyphase filter with
+clamp-to-edge addressing, non-power-of-two sizes are thus handled properly.
+All levels have the same format and type as @p image, so they can be
+uploaded directly using e.g. @ref Texture::setSubImage():
+@code
+Image2D image = ...;
+std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image,
+    TextureTools::MipmapFilter::Kaiser, TextureTools::MipmapFlag::Srgb);
+
+Texture2D texture;
+texture.setStorage(levels.size(), TextureFormat::SRGB8Alpha8, levels[0].size());
+for(std::size_t i = 0; i != levels.size(); ++i)
+    texture.setSubImage(i, {}, levels[i]);
+@endcode
+
+The filtering is done on floating-point data, the image is converted from and
+to them using @ref ImageConversion::convert(). Supported types are
+@ref ColorType::UnsignedByte, @ref ColorType::HalfFloat and
+@ref ColorType::Float with any format, @ref MipmapFlag::PreserveAlphaCoverage
+requires format with alpha channel. Rows of each level are filtered in
+parallel on @p threadCount threads and the filter uses SSE2 or NEON if the
+compiler targets given instruction set. Small levels are processed on the
+calling thread.
+@see @ref resample()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT std::vector<Trade::ImageData2D> generateMipmaps(const ImageReference2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, Float alphaReference = 0.5f, std::size_t threadCount = 0);
+
+}}
+
+#endif
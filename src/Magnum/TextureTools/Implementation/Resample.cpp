@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Implementation/Simd.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+namespace {
+
+template<std::size_t channelCount> void filterHorizontal(const Float* const row, const Contributions& contributions, const std::size_t size, Float* out) {
+    const std::size_t tapCount = contributions.tapCount;
+    const Int* indices = contributions.indices.data();
+    const Float* weights = contributions.weights.data();
+    for(std::size_t i = 0; i != size; ++i, indices += tapCount, weights += tapCount, out += channelCount) {
+        Float sum[channelCount]{};
+        for(std::size_t t = 0; t != tapCount; ++t) {
+            const Float* const pixel = row + indices[t]*channelCount;
+            for(std::size_t c = 0; c != channelCount; ++c)
+                sum[c] += weights[t]*pixel[c];
+        }
+        std::copy(sum, sum + channelCount, out);
+    }
+}
+
+#if defined(MAGNUM_MATH_SSE2) || defined(MAGNUM_MATH_NEON)
+/* Four-component pixels fit exactly into a vector register */
+template<> void filterHorizontal<4>(const Float* const row, const Contributions& contributions, const std::size_t size, Float* out) {
+    const std::size_t tapCount = contributions.tapCount;
+    const Int* indices = contributions.indices.data();
+    const Float* weights = contributions.weights.data();
+    for(std::size_t i = 0; i != size; ++i, indices += tapCount, weights += tapCount, out += 4) {
+        #if defined(MAGNUM_MATH_SSE2)
+        __m128 sum = _mm_setzero_ps();
+        for(std::size_t t = 0; t != tapCount; ++t)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[t]), _mm_loadu_ps(row + indices[t]*4)));
+        _mm_storeu_ps(out, sum);
+        #else
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for(std::size_t t = 0; t != tapCount; ++t)
+            sum = vmlaq_n_f32(sum, vld1q_f32(row + indices[t]*4), weights[t]);
+        vst1q_f32(out, sum);
+        #endif
+    }
+}
+#endif
+
+}
+
+Float sinc(const Float x) {
+    if(x == 0.0f) return 1.0f;
+    const Float pix = Constants::pi()*x;
+    return std::sin(pix)/pix;
+}
+
+Float lanczos3(const Float x) {
+    return std::abs(x) < 3.0f ? sinc(x)*sinc(x/3.0f) : 0.0f;
+}
+
+Contributions::Contributions(const Kernel& kernel, const Int sourceSize, const Int size) {
+    /* When upsampling, the kernel is not shrunk below the source pixel size */
+    const Float scale = Float(sourceSize)/size;
+    const Float filterScale = std::max(scale, 1.0f);
+    const Float radius = kernel.radius*filterScale;
+    tapCount = std::size_t(std::ceil(radius*2.0f)) + 1;
+    indices.resize(size*tapCount);
+    weights.resize(size*tapCount);
+
+    for(Int i = 0; i != size; ++i) {
+        const Float center = (i + 0.5f)*scale;
+        const Int first = Int(std::floor(center - radius));
+        Int* const tapIndices = indices.data() + i*tapCount;
+        Float* const tapWeights = weights.data() + i*tapCount;
+
+        Float sum = 0.0f;
+        for(std::size_t t = 0; t != tapCount; ++t) {
+            const Int j = first + Int(t);
+            tapIndices[t] = Math::clamp(j, 0, sourceSize - 1);
+            sum += tapWeights[t] = kernel.weight((j + 0.5f - center)/filterScale);
+        }
+        for(std::size_t t = 0; t != tapCount; ++t) tapWeights[t] /= sum;
+    }
+
+    /* Drop leading and trailing taps which are zero for all pixels, e.g.
+       box filter with even scale needs only two of the three taps */
+    std::size_t first = tapCount, last = 0;
+    for(std::size_t i = 0; i != weights.size(); ++i) if(weights[i] != 0.0f) {
+        first = std::min(first, i % tapCount);
+        last = std::max(last, i % tapCount + 1);
+    }
+    if(first == 0 && last == tapCount) return;
+
+    const std::size_t trimmedTapCount = last - first;
+    for(Int i = 0; i != size; ++i) for(std::size_t t = 0; t != trimmedTapCount; ++t) {
+        indices[i*trimmedTapCount + t] = indices[i*tapCount + first + t];
+        weights[i*trimmedTapCount + t] = weights[i*tapCount + first + t];
+    }
+    tapCount = trimmedTapCount;
+    indices.resize(size*tapCount);
+    weights.resize(size*tapCount);
+}
+
+void filterVertical(const Float* const source, const std::size_t rowSize, const Int* const indices, const Float* const weights, const std::size_t tapCount, Float* const out) {
+    std::size_t i = 0;
+
+    #if defined(MAGNUM_MATH_SSE2)
+    for(; i + 4 <= rowSize; i += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for(std::size_t t = 0; t != tapCount; ++t)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[t]), _mm_loadu_ps(source + indices[t]*rowSize + i)));
+        _mm_storeu_ps(out + i, sum);
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; i + 4 <= rowSize; i += 4) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for(std::size_t t = 0; t != tapCount; ++t)
+            sum = vmlaq_n_f32(sum, vld1q_f32(source + indices[t]*rowSize + i), weights[t]);
+        vst1q_f32(out + i, sum);
+    }
+    #endif
+
+    for(; i != rowSize; ++i) {
+        Float sum = 0.0f;
+        for(std::size_t t = 0; t != tapCount; ++t)
+            sum += weights[t]*source[indices[t]*rowSize + i];
+        out[i] = sum;
+    }
+}
+
+void filterHorizontal(const Float* const row, const Contributions& contributions, const std::size_t size, const std::size_t channelCount, Float* const out) {
+    switch(channelCount) {
+        case 1: filterHorizontal<1>(row, contributions, size, out); return;
+        case 2: filterHorizontal<2>(row, contributions, size, out); return;
+        case 3: filterHorizontal<3>(row, contributions, size, out); return;
+        case 4: filterHorizontal<4>(row, contributions, size, out); return;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}}}
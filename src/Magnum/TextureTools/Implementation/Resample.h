@@ -0,0 +1,68 @@
+#ifndef Magnum_TextureTools_Implementation_Resample_h
+#define Magnum_TextureTools_Implementation_Resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+/* Don't bother spawning threads for less filtered data than this */
+constexpr std::size_t MinParallelRangeSize = 64*1024;
+
+Float sinc(Float x);
+
+/* Three-lobed Lanczos kernel */
+Float lanczos3(Float x);
+
+/* Filter kernel, weight is a function of distance from the center and is
+   zero outside of [-radius, radius]. The distance is in destination pixels
+   when downsampling and in source pixels when upsampling. */
+struct Kernel {
+    Float radius;
+    Float(*weight)(Float);
+};
+
+/* Source indices and normalized weights of fixed count of taps for each
+   destination pixel along one axis, the indices are clamped to the edge */
+struct Contributions {
+    explicit Contributions(const Kernel& kernel, Int sourceSize, Int size);
+
+    std::size_t tapCount;
+    std::vector<Int> indices;
+    std::vector<Float> weights;
+};
+
+/* out = sum of weight*row over all taps, each row has rowSize floats */
+void filterVertical(const Float* source, std::size_t rowSize, const Int* indices, const Float* weights, std::size_t tapCount, Float* out);
+
+/* Filters a row of pixels with 1 to 4 float channels to given size */
+void filterHorizontal(const Float* row, const Contributions& contributions, std::size_t size, std::size_t channelCount, Float* out);
+
+}}}
+
+#endif
@@ -0,0 +1,284 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/TextureTools/Implementation/Resample.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+Float triangleWeight(const Float x) {
+    return std::max(1.0f - std::abs(x), 0.0f);
+}
+
+/* Mitchell-Netravali family of cubic filters with radius 2 */
+template<Int b, Int c, Int divisor> Float cubicWeight(const Float value) {
+    constexpr Float B = Float(b)/divisor;
+    constexpr Float C = Float(c)/divisor;
+    const Float x = std::abs(value);
+    if(x < 1.0f)
+        return ((12.0f - 9.0f*B - 6.0f*C)*x*x*x + (-18.0f + 12.0f*B + 6.0f*C)*x*x + (6.0f - 2.0f*B))/6.0f;
+    if(x < 2.0f)
+        return ((-B - 6.0f*C)*x*x*x + (6.0f*B + 30.0f*C)*x*x + (-12.0f*B - 48.0f*C)*x + (8.0f*B + 24.0f*C))/6.0f;
+    return 0.0f;
+}
+
+Implementation::Kernel kernel(const ResampleFilter filter) {
+    switch(filter) {
+        case ResampleFilter::Bilinear: return {1.0f, triangleWeight};
+        case ResampleFilter::Bicubic: return {2.0f, cubicWeight<0, 1, 2>};
+        case ResampleFilter::Lanczos3: return {3.0f, Implementation::lanczos3};
+        case ResampleFilter::Mitchell: return {2.0f, cubicWeight<1, 1, 3>};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+/* Float values closest to the range of given type, 32-bit integer limits
+   are not representable as floats */
+template<class T> Float minValue() { return Float(std::numeric_limits<T>::min()); }
+template<class T> Float maxValue() { return Float(std::numeric_limits<T>::max()); }
+template<> Float maxValue<UnsignedInt>() { return 4294967040.0f; }
+template<> Float maxValue<Int>() { return 2147483520.0f; }
+
+/* Rounds half up. Truncation is enough for unsigned types, as the clamped
+   value is never negative. */
+template<class T> T pack(const Float value) {
+    const Float clamped = Math::clamp(value, minValue<T>(), maxValue<T>()) + 0.5f;
+    return T(std::is_unsigned<T>::value ? clamped : std::floor(clamped));
+}
+template<> Float pack<Float>(const Float value) { return value; }
+template<> Half pack<Half>(const Float value) { return Half{value}; }
+
+/* Vectorized conversion of contiguous values, returns count of values
+   processed, the rest is converted by the caller */
+template<class T> std::size_t loadContiguous(const T*, Float*, std::size_t) { return 0; }
+template<class T> std::size_t storeContiguous(const Float*, T*, std::size_t) { return 0; }
+
+#if defined(MAGNUM_MATH_SSE2)
+template<> std::size_t loadContiguous<UnsignedByte>(const UnsignedByte* const in, Float* const out, const std::size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)));
+        _mm_storeu_ps(out + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)));
+        _mm_storeu_ps(out + i + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)));
+        _mm_storeu_ps(out + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)));
+    }
+    return i;
+}
+
+template<> std::size_t storeContiguous<UnsignedByte>(const Float* const in, UnsignedByte* const out, const std::size_t count) {
+    /* Same as pack(), the values are clamped, offset by 0.5 and truncated */
+    const __m128 min = _mm_setzero_ps();
+    const __m128 max = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const auto convert = [&](const Float* const data) {
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(data), min), max), half));
+    };
+    std::size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+        const __m128i low = _mm_packs_epi32(convert(in + i), convert(in + i + 4));
+        const __m128i high = _mm_packs_epi32(convert(in + i + 8), convert(in + i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+    }
+    return i;
+}
+#elif defined(MAGNUM_MATH_NEON)
+template<> std::size_t loadContiguous<UnsignedByte>(const UnsignedByte* const in, Float* const out, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const uint16x8_t shorts = vmovl_u8(vld1_u8(in + i));
+        vst1q_f32(out + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(shorts))));
+        vst1q_f32(out + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(shorts))));
+    }
+    return i;
+}
+
+template<> std::size_t storeContiguous<UnsignedByte>(const Float* const in, UnsignedByte* const out, const std::size_t count) {
+    /* Same as pack(), the values are clamped, offset by 0.5 and truncated */
+    const float32x4_t min = vdupq_n_f32(0.0f);
+    const float32x4_t max = vdupq_n_f32(255.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const auto convert = [&](const Float* const data) {
+        return vmovn_u32(vcvtq_u32_f32(vaddq_f32(vminq_f32(vmaxq_f32(vld1q_f32(data), min), max), half)));
+    };
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        vst1_u8(out + i, vmovn_u16(vcombine_u16(convert(in + i), convert(in + i + 4))));
+    return i;
+}
+#endif
+
+/* Converts pixels with channelCount components to floats, pixels in the
+   output are stride floats apart */
+template<class T> void loadRow(const char* const data, const std::size_t pixelCount, const std::size_t channelCount, const std::size_t stride, Float* out) {
+    const T* in = reinterpret_cast<const T*>(data);
+    if(stride == channelCount) {
+        const std::size_t count = pixelCount*channelCount;
+        for(std::size_t i = loadContiguous(in, out, count); i != count; ++i)
+            out[i] = Float(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != pixelCount; ++i, in += channelCount, out += stride)
+        for(std::size_t c = 0; c != channelCount; ++c) out[c] = Float(in[c]);
+}
+
+template<class T> void storeRow(const Float* in, const std::size_t pixelCount, const std::size_t channelCount, const std::size_t stride, char* const data) {
+    T* out = reinterpret_cast<T*>(data);
+    if(stride == channelCount) {
+        const std::size_t count = pixelCount*channelCount;
+        for(std::size_t i = storeContiguous(in, out, count); i != count; ++i)
+            out[i] = pack<T>(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != pixelCount; ++i, in += stride, out += channelCount)
+        for(std::size_t c = 0; c != channelCount; ++c) out[c] = pack<T>(in[c]);
+}
+
+bool isSupported(const ColorType type) {
+    switch(type) {
+        case ColorType::UnsignedByte:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Byte:
+        case ColorType::Short:
+        case ColorType::Int:
+        #endif
+        case ColorType::UnsignedShort:
+        case ColorType::UnsignedInt:
+        case ColorType::HalfFloat:
+        case ColorType::Float:
+            return true;
+        default: return false;
+    }
+}
+
+template<class T> void resample(const ImageReference2D& image, const Vector2i& size, const ResampleFilter filter, const std::size_t threadCount, char* const out, const std::size_t outRowStride) {
+    const Implementation::Contributions horizontal{kernel(filter), image.size().x(), size.x()};
+    const Implementation::Contributions vertical{kernel(filter), image.size().y(), size.y()};
+
+    /* Three-component pixels are padded to four so the horizontal filter can
+       process them in a single vector register */
+    const std::size_t channelCount = image.pixelSize()/sizeof(T);
+    #if defined(MAGNUM_MATH_SSE2) || defined(MAGNUM_MATH_NEON)
+    const std::size_t stride = channelCount == 3 ? 4 : channelCount;
+    #else
+    const std::size_t stride = channelCount;
+    #endif
+    const std::size_t inRowStride = image.dataSize({image.size().x(), 1});
+    const std::size_t rowSize = size.x()*stride;
+
+    /* Filter source rows horizontally. Each source row is converted to
+       floats just once and the intermediate data are smaller than the whole
+       converted source image when downsampling. */
+    std::vector<Float> filtered(rowSize*image.size().y());
+    Magnum::Implementation::parallelFor(image.size().y(), threadCount, Magnum::Implementation::minRangeSize(Implementation::MinParallelRangeSize, rowSize*sizeof(Float)*horizontal.tapCount), [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Float> row(image.size().x()*stride);
+        for(std::size_t y = begin; y != end; ++y) {
+            loadRow<T>(image.data() + y*inRowStride, image.size().x(), channelCount, stride, row.data());
+            Implementation::filterHorizontal(row.data(), horizontal, size.x(), stride, filtered.data() + y*rowSize);
+        }
+    });
+
+    /* Filter the result vertically, each destination row independently */
+    Magnum::Implementation::parallelFor(size.y(), threadCount, Magnum::Implementation::minRangeSize(Implementation::MinParallelRangeSize, rowSize*sizeof(Float)*vertical.tapCount), [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Float> row(rowSize);
+        for(std::size_t y = begin; y != end; ++y) {
+            Implementation::filterVertical(filtered.data(), rowSize, vertical.indices.data() + y*vertical.tapCount, vertical.weights.data() + y*vertical.tapCount, vertical.tapCount, row.data());
+            storeRow<T>(row.data(), size.x(), channelCount, stride, out + y*outRowStride);
+        }
+    });
+}
+
+}
+
+Debug operator<<(Debug debug, const ResampleFilter value) {
+    switch(value) {
+        #define _c(value) case ResampleFilter::value: return debug << "TextureTools::ResampleFilter::" #value;
+        _c(Bilinear)
+        _c(Bicubic)
+        _c(Lanczos3)
+        _c(Mitchell)
+        #undef _c
+    }
+
+    return debug << "TextureTools::ResampleFilter::(invalid)";
+}
+
+Image2D resample(const ImageReference2D& image, const Vector2i& size, const ResampleFilter filter, const std::size_t threadCount) {
+    CORRADE_ASSERT(isSupported(image.type()),
+        "TextureTools::resample(): unsupported type" << image.type(), (Image2D{image.format(), image.type()}));
+    CORRADE_ASSERT(image.size().product() || !size.product(),
+        "TextureTools::resample(): can't resample empty image to" << size, (Image2D{image.format(), image.type()}));
+
+    /* Rows of the result are padded the same way as in the source image */
+    char* const data = new char[image.dataSize(size)]();
+    if(!size.product()) return Image2D{image.format(), image.type(), size, data};
+
+    const std::size_t rowStride = image.dataSize({size.x(), 1});
+    switch(image.type()) {
+        case ColorType::UnsignedByte: resample<UnsignedByte>(image, size, filter, threadCount, data, rowStride); break;
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Byte: resample<Byte>(image, size, filter, threadCount, data, rowStride); break;
+        #endif
+        case ColorType::UnsignedShort: resample<UnsignedShort>(image, size, filter, threadCount, data, rowStride); break;
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Short: resample<Short>(image, size, filter, threadCount, data, rowStride); break;
+        #endif
+        case ColorType::UnsignedInt: resample<UnsignedInt>(image, size, filter, threadCount, data, rowStride); break;
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Int: resample<Int>(image, size, filter, threadCount, data, rowStride); break;
+        #endif
+        case ColorType::HalfFloat: resample<Half>(image, size, filter, threadCount, data, rowStride); break;
+        case ColorType::Float: resample<Float>(image, size, filter, threadCount, data, rowStride); break;
+        default: CORRADE_ASSERT_UNREACHABLE();
+    }
+
+    return Image2D{image.format(), image.type(), size, data};
+}
+
+}}
@@ -0,0 +1,113 @@
+#ifndef Magnum_TextureTools_Resample_h
+#define Magnum_TextureTools_Resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::resample(), enum @ref Magnum::TextureTools::ResampleFilter
+ */
+
+#include "Magnum/Image.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Resampling filter
+
+@see @ref resample()
+*/
+enum class ResampleFilter: UnsignedByte {
+    /**
+     * Triangle filter of radius 1. Equivalent to bilinear interpolation when
+     * upsampling, cheapest but blurry.
+     */
+    Bilinear,
+
+    /**
+     * Catmull-Rom cubic spline (Keys cubic with @f$ a = -0.5 @f$) of
+     * radius 2. Sharper than @ref ResampleFilter::Bilinear with mild
+     * ringing.
+     */
+    Bicubic,
+
+    /**
+     * Three-lobed Lanczos filter. Sharpest, but may produce slight ringing
+     * around high-contrast edges.
+     */
+    Lanczos3,
+
+    /**
+     * Mitchell-Netravali cubic filter (@f$ B = C = \frac{1}{3} @f$) of
+     * radius 2. Compromise between blurring and ringing, good for
+     * upsampling.
+     */
+    Mitchell
+};
+
+/** @debugoperatorenum{Magnum::TextureTools::ResampleFilter} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug operator<<(Debug debug, ResampleFilter value);
+
+/**
+@brief Resample an image
+@param image        Source image
+@param size         Size of the resulting image
+@param filter       Resampling filter
+@param threadCount  Thread count. If `0`, hardware concurrency is used.
+@return Image of given size with the same format and type as @p image
+
+Works for both downsampling and upsampling, the two axes are scaled
+independently. The image is filtered first horizontally and then vertically
+with clamp-to-edge addressing, the filter weights for each destination column
+and row are calculated upfront. When downsampling, the filter is stretched to
+cover all source pixels contributing to given destination pixel, which
+prevents aliasing.
+@code
+Image2D thumbnail = TextureTools::resample(image, {256, 256},
+    TextureTools::ResampleFilter::Lanczos3);
+@endcode
+
+Supported types are @ref ColorType::UnsignedByte, @ref ColorType::Byte,
+@ref ColorType::UnsignedShort, @ref ColorType::Short,
+@ref ColorType::UnsignedInt, @ref ColorType::Int, @ref ColorType::HalfFloat
+and @ref ColorType::Float with any format, packed types are not supported.
+Filtering is done on floating-point values, integer results are rounded and
+clamped to the range of given type. Values of 32-bit integer types are thus
+filtered with only 24 bits of precision. Note that sRGB-encoded data should
+be converted to linear space using @ref ImageConversion::convert() before
+resampling to get correct results.
+
+Blocks of rows are filtered in parallel on @p threadCount threads and the
+filter uses SSE2 or NEON if the compiler targets given instruction set, in
+that case three-component pixels are filtered as four-component ones. Small
+images are processed on the calling thread.
+@see @ref generateMipmaps()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D resample(const ImageReference2D& image, const Vector2i& size, ResampleFilter filter = ResampleFilter::Lanczos3, std::size_t threadCount = 0);
+
+}}
+
+#endif
@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct BlockCompressionBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit BlockCompressionBenchmark();
+
+    void bc1Fast();
+    void bc1Normal();
+    void bc1Best();
+    void bc3Normal();
+    void bc4Normal();
+    void bc5Normal();
+    void bc7Fast();
+    void bc7Normal();
+    void bc7NormalSingleThread();
+    void bc7Best();
+
+    void decompressBc1();
+    void decompressBc7();
+
+    private:
+        void benchmark(const std::string& name, BlockCompression compression, BlockCompressionQuality quality, std::size_t threadCount);
+        void benchmarkDecompression(const std::string& name, BlockCompression compression);
+
+        std::vector<Math::Vector4<UnsignedByte>> _data;
+};
+
+namespace {
+
+constexpr Int Size = 512;
+
+}
+
+BlockCompressionBenchmark::BlockCompressionBenchmark(): AbstractBenchmarkTester{3}, _data(Size*Size) {
+    addTests({&BlockCompressionBenchmark::bc1Fast,
+              &BlockCompressionBenchmark::bc1Normal,
+              &BlockCompressionBenchmark::bc1Best,
+              &BlockCompressionBenchmark::bc3Normal,
+              &BlockCompressionBenchmark::bc4Normal,
+              &BlockCompressionBenchmark::bc5Normal,
+              &BlockCompressionBenchmark::bc7Fast,
+              &BlockCompressionBenchmark::bc7Normal,
+              &BlockCompressionBenchmark::bc7NormalSingleThread,
+              &BlockCompressionBenchmark::bc7Best,
+
+              &BlockCompressionBenchmark::decompressBc1,
+              &BlockCompressionBenchmark::decompressBc7});
+
+    /* Gradients with some noise, resembling photographic content more than
+       random data would */
+    UnsignedInt seed = 1;
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x) {
+        seed = seed*1103515245 + 12345;
+        const UnsignedByte noise = UnsignedByte((seed >> 16) & 15);
+        _data[y*Size + x] = {UnsignedByte(x/2 + noise), UnsignedByte(y/2), UnsignedByte((x + y)/4 + noise), UnsignedByte(255 - x/2)};
+    }
+}
+
+void BlockCompressionBenchmark::benchmark(const std::string& name, const BlockCompression compression, const BlockCompressionQuality quality, const std::size_t threadCount) {
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {Size, Size}, _data.data()};
+    MAGNUM_BENCHMARK(name, Size*Size) {
+        Containers::Array<char> data = compressBlocks(image, compression, quality, threadCount);
+        escape(data.data());
+    }
+}
+
+void BlockCompressionBenchmark::benchmarkDecompression(const std::string& name, const BlockCompression compression) {
+    const Containers::Array<char> data = compressBlocks(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Size, Size}, _data.data()}, compression, BlockCompressionQuality::Fast);
+    MAGNUM_BENCHMARK(name, Size*Size) {
+        Image2D image = decompressBlocks(data, compression, {Size, Size});
+        escape(image.data());
+    }
+}
+
+void BlockCompressionBenchmark::bc1Fast() {
+    benchmark("compressBlocks(), BC1, fast", BlockCompression::Bc1, BlockCompressionQuality::Fast, 0);
+}
+
+void BlockCompressionBenchmark::bc1Normal() {
+    benchmark("compressBlocks(), BC1, normal", BlockCompression::Bc1, BlockCompressionQuality::Normal, 0);
+}
+
+void BlockCompressionBenchmark::bc1Best() {
+    benchmark("compressBlocks(), BC1, best", BlockCompression::Bc1, BlockCompressionQuality::Best, 0);
+}
+
+void BlockCompressionBenchmark::bc3Normal() {
+    benchmark("compressBlocks(), BC3, normal", BlockCompression::Bc3, BlockCompressionQuality::Normal, 0);
+}
+
+void BlockCompressionBenchmark::bc4Normal() {
+    benchmark("compressBlocks(), BC4, normal", BlockCompression::Bc4, BlockCompressionQuality::Normal, 0);
+}
+
+void BlockCompressionBenchmark::bc5Normal() {
+    benchmark("compressBlocks(), BC5, normal", BlockCompression::Bc5, BlockCompressionQuality::Normal, 0);
+}
+
+void BlockCompressionBenchmark::bc7Fast() {
+    benchmark("compressBlocks(), BC7, fast", BlockCompression::Bc7, BlockCompressionQuality::Fast, 0);
+}
+
+void BlockCompressionBenchmark::bc7Normal() {
+    benchmark("compressBlocks(), BC7, normal", BlockCompression::Bc7, BlockCompressionQuality::Normal, 0);
+}
+
+void BlockCompressionBenchmark::bc7NormalSingleThread() {
+    benchmark("compressBlocks(), BC7, normal, single thread", BlockCompression::Bc7, BlockCompressionQuality::Normal, 1);
+}
+
+void BlockCompressionBenchmark::bc7Best() {
+    benchmark("compressBlocks(), BC7, best", BlockCompression::Bc7, BlockCompressionQuality::Best, 0);
+}
+
+void BlockCompressionBenchmark::decompressBc1() {
+    benchmarkDecompression("decompressBlocks(), BC1", BlockCompression::Bc1);
+}
+
+void BlockCompressionBenchmark::decompressBc7() {
+    benchmarkDecompression("decompressBlocks(), BC7", BlockCompression::Bc7);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BlockCompressionBenchmark)
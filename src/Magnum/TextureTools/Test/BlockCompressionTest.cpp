@@ -0,0 +1,374 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct BlockCompressionTest: TestSuite::Tester {
+    explicit BlockCompressionTest();
+
+    void dataSize();
+
+    void decodeBc1();
+    void decodeBc1ThreeColor();
+    void decodeBc4();
+    void decodeBc7Mode6();
+    void decodeBc7Mode5();
+
+    void roundtripBc1();
+    void roundtripBc1Transparent();
+    void roundtripBc3();
+    void roundtripBc4();
+    void roundtripBc4Exact();
+    void roundtripBc5();
+    void roundtripBc7();
+    void roundtripBc7Alpha();
+    void constant();
+    void quality();
+    void nonMultipleOfFour();
+    void bgr();
+    void threads();
+
+    void debugCompression();
+    void debugQuality();
+};
+
+BlockCompressionTest::BlockCompressionTest() {
+    addTests({&BlockCompressionTest::dataSize,
+
+              &BlockCompressionTest::decodeBc1,
+              &BlockCompressionTest::decodeBc1ThreeColor,
+              &BlockCompressionTest::decodeBc4,
+              &BlockCompressionTest::decodeBc7Mode6,
+              &BlockCompressionTest::decodeBc7Mode5,
+
+              &BlockCompressionTest::roundtripBc1,
+              &BlockCompressionTest::roundtripBc1Transparent,
+              &BlockCompressionTest::roundtripBc3,
+              &BlockCompressionTest::roundtripBc4,
+              &BlockCompressionTest::roundtripBc4Exact,
+              &BlockCompressionTest::roundtripBc5,
+              &BlockCompressionTest::roundtripBc7,
+              &BlockCompressionTest::roundtripBc7Alpha,
+              &BlockCompressionTest::constant,
+              &BlockCompressionTest::quality,
+              &BlockCompressionTest::nonMultipleOfFour,
+              &BlockCompressionTest::bgr,
+              &BlockCompressionTest::threads,
+
+              &BlockCompressionTest::debugCompression,
+              &BlockCompressionTest::debugQuality});
+}
+
+namespace {
+
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+
+constexpr Int Size = 64;
+
+/* Smooth gradients with some high-frequency detail, alpha uncorrelated with
+   color */
+std::vector<Vector4ub> testImage() {
+    std::vector<Vector4ub> data(Size*Size);
+    UnsignedInt seed = 1;
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x) {
+        seed = seed*1103515245 + 12345;
+        const Int noise = Int((seed >> 16) & 15) - 8;
+        data[y*Size + x] = Vector4ub(UnsignedByte(x*4), UnsignedByte(Math::clamp(y*4 + noise, 0, 255)), UnsignedByte(255 - (x + y)*2), UnsignedByte((x*y) & 0xff));
+    }
+    return data;
+}
+
+/* Root mean square difference of first channelCount channels */
+Float rmse(const std::vector<Vector4ub>& expected, const Image2D& actual, const std::size_t channelCount) {
+    const UnsignedByte* const data = reinterpret_cast<const UnsignedByte*>(actual.data());
+    const std::size_t pixelSize = actual.pixelSize();
+    Float sum = 0.0f;
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        for(std::size_t c = 0; c != channelCount; ++c) {
+            const Float d = Float(data[i*pixelSize + c]) - Float(expected[i][c]);
+            sum += d*d;
+        }
+    return std::sqrt(sum/(expected.size()*channelCount));
+}
+
+Float roundtrip(const std::vector<Vector4ub>& data, const ColorFormat format, const BlockCompression compression, const BlockCompressionQuality quality, const std::size_t channelCount) {
+    /* Pack the channels tightly, the size is multiple of four so there is
+       no padding */
+    std::vector<UnsignedByte> packed(data.size()*channelCount);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        for(std::size_t c = 0; c != channelCount; ++c) packed[i*channelCount + c] = data[i][c];
+
+    const Containers::Array<char> compressed = compressBlocks(ImageReference2D{format, ColorType::UnsignedByte, {Size, Size}, packed.data()}, compression, quality);
+    const Image2D decompressed = decompressBlocks(compressed, compression, {Size, Size});
+    return rmse(data, decompressed, compression == BlockCompression::Bc4 ? 1 :
+        compression == BlockCompression::Bc5 ? 2 : channelCount);
+}
+
+const Vector4ub& pixel(const Image2D& image, const Int i) {
+    return reinterpret_cast<const Vector4ub*>(image.data())[i];
+}
+
+}
+
+void BlockCompressionTest::dataSize() {
+    CORRADE_COMPARE(compressedBlockSize(BlockCompression::Bc1), 8);
+    CORRADE_COMPARE(compressedBlockSize(BlockCompression::Bc3), 16);
+    CORRADE_COMPARE(compressedBlockSize(BlockCompression::Bc4), 8);
+    CORRADE_COMPARE(compressedBlockSize(BlockCompression::Bc5), 16);
+    CORRADE_COMPARE(compressedBlockSize(BlockCompression::Bc7), 16);
+    CORRADE_COMPARE(compressedDataSize(BlockCompression::Bc1, {5, 3}), 16);
+    CORRADE_COMPARE(compressedDataSize(BlockCompression::Bc7, {8, 8}), 64);
+    CORRADE_COMPARE(compressedDataSize(BlockCompression::Bc4, {0, 0}), 0);
+}
+
+void BlockCompressionTest::decodeBc1() {
+    /* Red and blue endpoints, indices 0, 1, 2, 3 repeated */
+    const char data[]{'\x00', '\xf8', '\x1f', '\x00', '\xe4', '\xe4', '\xe4', '\xe4'};
+    const Image2D image = decompressBlocks(data, BlockCompression::Bc1, {4, 4});
+    CORRADE_COMPARE(image.format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(image.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(pixel(image, 0), (Vector4ub{255, 0, 0, 255}));
+    CORRADE_COMPARE(pixel(image, 1), (Vector4ub{0, 0, 255, 255}));
+    CORRADE_COMPARE(pixel(image, 2), (Vector4ub{170, 0, 85, 255}));
+    CORRADE_COMPARE(pixel(image, 3), (Vector4ub{85, 0, 170, 255}));
+    CORRADE_COMPARE(pixel(image, 15), (Vector4ub{85, 0, 170, 255}));
+}
+
+void BlockCompressionTest::decodeBc1ThreeColor() {
+    /* The first endpoint is smaller, the last index is transparent black */
+    const char data[]{'\x1f', '\x00', '\x00', '\xf8', '\xe4', '\xe4', '\xe4', '\xe4'};
+    const Image2D image = decompressBlocks(data, BlockCompression::Bc1, {4, 4});
+    CORRADE_COMPARE(pixel(image, 0), (Vector4ub{0, 0, 255, 255}));
+    CORRADE_COMPARE(pixel(image, 1), (Vector4ub{255, 0, 0, 255}));
+    CORRADE_COMPARE(pixel(image, 2), (Vector4ub{128, 0, 128, 255}));
+    CORRADE_COMPARE(pixel(image, 3), (Vector4ub{0, 0, 0, 0}));
+}
+
+void BlockCompressionTest::decodeBc4() {
+    /* Six interpolated values, indices 0 to 7 in the first row and half of
+       the second, the rest zero */
+    const char data8[]{'\xff', '\x00', '\x88', '\xc6', '\xfa', '\x00', '\x00', '\x00'};
+    const Image2D image8 = decompressBlocks(data8, BlockCompression::Bc4, {4, 4});
+    CORRADE_COMPARE(image8.format(), ColorFormat::Red);
+    const UnsignedByte* pixels = reinterpret_cast<const UnsignedByte*>(image8.data());
+    CORRADE_COMPARE(pixels[0], 255);
+    CORRADE_COMPARE(pixels[1], 0);
+    CORRADE_COMPARE(pixels[2], 219);
+    CORRADE_COMPARE(pixels[3], 182);
+    CORRADE_COMPARE(pixels[7], 36);
+    CORRADE_COMPARE(pixels[8], 255);
+
+    /* Four interpolated values and explicit 0 and 255 */
+    const char data6[]{'\x00', '\xff', '\x88', '\xc6', '\xfa', '\x00', '\x00', '\x00'};
+    const Image2D image6 = decompressBlocks(data6, BlockCompression::Bc4, {4, 4});
+    pixels = reinterpret_cast<const UnsignedByte*>(image6.data());
+    CORRADE_COMPARE(pixels[2], 51);
+    CORRADE_COMPARE(pixels[5], 204);
+    CORRADE_COMPARE(pixels[6], 0);
+    CORRADE_COMPARE(pixels[7], 255);
+}
+
+void BlockCompressionTest::decodeBc7Mode6() {
+    /* Endpoints (0, 10, 127, 127) with p-bit 0 and (127, 20, 0, 127) with
+       p-bit 1, pixel i has index i */
+    const char data[]{'\x40', '\xc0', '\x5f', '\x41', '\xf9', '\x03', '\xfe', '\x7f',
+                      '\x11', '\x32', '\x54', '\x76', '\x98', '\xba', '\xdc', '\xfe'};
+    const Image2D image = decompressBlocks(data, BlockCompression::Bc7, {4, 4});
+    CORRADE_COMPARE(image.format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(pixel(image, 0), (Vector4ub{0, 20, 254, 254}));
+    CORRADE_COMPARE(pixel(image, 1), (Vector4ub{16, 21, 238, 254}));
+    CORRADE_COMPARE(pixel(image, 7), (Vector4ub{120, 30, 135, 254}));
+    CORRADE_COMPARE(pixel(image, 15), (Vector4ub{255, 41, 1, 255}));
+}
+
+void BlockCompressionTest::decodeBc7Mode5() {
+    /* Rotation 1, color endpoints (0, 64, 127) and (127, 64, 0), alpha
+       endpoints 10 and 250, color index is column, alpha index is row */
+    const char data[]{'\x60', '\x80', '\x3f', '\x10', '\xf8', '\x07', '\x28', '\xe8',
+                      '\xcb', '\xc9', '\xc9', '\xc9', '\x01', '\x55', '\xaa', '\xff'};
+    const Image2D image = decompressBlocks(data, BlockCompression::Bc7, {4, 4});
+    CORRADE_COMPARE(pixel(image, 0), (Vector4ub{10, 129, 255, 0}));
+    CORRADE_COMPARE(pixel(image, 5), (Vector4ub{89, 129, 171, 84}));
+    CORRADE_COMPARE(pixel(image, 15), (Vector4ub{250, 129, 0, 255}));
+}
+
+void BlockCompressionTest::roundtripBc1() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::RGB, BlockCompression::Bc1, BlockCompressionQuality::Normal, 3);
+    CORRADE_VERIFY(error < 4.0f);
+}
+
+void BlockCompressionTest::roundtripBc1Transparent() {
+    std::vector<Vector4ub> data = testImage();
+    for(Vector4ub& pixel: data) pixel[3] = pixel[3] < 128 ? 0 : 255;
+
+    const Containers::Array<char> compressed = compressBlocks(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Size, Size}, data.data()}, BlockCompression::Bc1);
+    const Image2D decompressed = decompressBlocks(compressed, BlockCompression::Bc1, {Size, Size});
+
+    /* Alpha is preserved exactly, transparent pixels are black */
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        CORRADE_COMPARE(pixel(decompressed, i)[3], data[i][3]);
+        if(!data[i][3]) CORRADE_COMPARE(pixel(decompressed, i), Vector4ub{});
+    }
+}
+
+void BlockCompressionTest::roundtripBc3() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::RGBA, BlockCompression::Bc3, BlockCompressionQuality::Normal, 4);
+    CORRADE_VERIFY(error < 5.5f);
+}
+
+void BlockCompressionTest::roundtripBc4() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::Red, BlockCompression::Bc4, BlockCompressionQuality::Normal, 1);
+    CORRADE_VERIFY(error < 1.0f);
+}
+
+void BlockCompressionTest::roundtripBc4Exact() {
+    /* Eight evenly spaced values in the first block and four with 0 and 255
+       in the second are represented exactly */
+    const UnsignedByte data[]{
+        10, 17, 24, 31,   0, 255, 100, 112,
+        38, 45, 52, 59, 255,   0, 148, 160,
+        10, 10, 59, 59, 100, 112, 148, 160,
+        17, 24, 31, 38,   0,   0, 255, 255
+    };
+    const Containers::Array<char> compressed = compressBlocks(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {8, 4}, data}, BlockCompression::Bc4);
+    const Image2D decompressed = decompressBlocks(compressed, BlockCompression::Bc4, {8, 4});
+    CORRADE_COMPARE((std::vector<UnsignedByte>{decompressed.data(), decompressed.data() + 32}),
+                    (std::vector<UnsignedByte>{data, data + 32}));
+}
+
+void BlockCompressionTest::roundtripBc5() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::RG, BlockCompression::Bc5, BlockCompressionQuality::Normal, 2);
+    CORRADE_VERIFY(error < 1.0f);
+}
+
+void BlockCompressionTest::roundtripBc7() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::RGB, BlockCompression::Bc7, BlockCompressionQuality::Normal, 3);
+    CORRADE_VERIFY(error < 3.5f);
+}
+
+void BlockCompressionTest::roundtripBc7Alpha() {
+    const std::vector<Vector4ub> data = testImage();
+    const Float error = roundtrip(data, ColorFormat::RGBA, BlockCompression::Bc7, BlockCompressionQuality::Normal, 4);
+    CORRADE_VERIFY(error < 5.0f);
+}
+
+void BlockCompressionTest::constant() {
+    /* Colors exactly representable in RGB565 survive BC1 and BC3 exactly,
+       BC7 mode 6 represents even values exactly */
+    const std::vector<Vector4ub> data(Size*Size, Vector4ub{66, 130, 198, 128});
+    for(BlockCompression compression: {BlockCompression::Bc3, BlockCompression::Bc7}) {
+        CORRADE_COMPARE(roundtrip(data, ColorFormat::RGBA, compression, BlockCompressionQuality::Fast, 4), 0.0f);
+    }
+    CORRADE_COMPARE(roundtrip(data, ColorFormat::RGB, BlockCompression::Bc1, BlockCompressionQuality::Fast, 3), 0.0f);
+    CORRADE_COMPARE(roundtrip(data, ColorFormat::RG, BlockCompression::Bc5, BlockCompressionQuality::Fast, 2), 0.0f);
+}
+
+void BlockCompressionTest::quality() {
+    const std::vector<Vector4ub> data = testImage();
+    for(BlockCompression compression: {BlockCompression::Bc1, BlockCompression::Bc3, BlockCompression::Bc4, BlockCompression::Bc7}) {
+        const Float fast = roundtrip(data, ColorFormat::RGBA, compression, BlockCompressionQuality::Fast, 4);
+        const Float normal = roundtrip(data, ColorFormat::RGBA, compression, BlockCompressionQuality::Normal, 4);
+        const Float best = roundtrip(data, ColorFormat::RGBA, compression, BlockCompressionQuality::Best, 4);
+        CORRADE_VERIFY(normal <= fast);
+        CORRADE_VERIFY(best <= normal);
+    }
+}
+
+void BlockCompressionTest::nonMultipleOfFour() {
+    /* Rows of three-component data are padded to four bytes, the output
+       has one-component rows padded as well */
+    std::vector<UnsignedByte> data(16*3);
+    for(std::size_t y = 0; y != 3; ++y) for(std::size_t x = 0; x != 5; ++x) data[y*16 + x*3] = 255;
+    const Containers::Array<char> compressed = compressBlocks(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {5, 3}, data.data()}, BlockCompression::Bc4);
+    CORRADE_COMPARE(compressed.size(), 16);
+
+    const Image2D decompressed = decompressBlocks(compressed, BlockCompression::Bc4, {5, 3});
+    CORRADE_COMPARE(decompressed.size(), Vector2i(5, 3));
+    CORRADE_COMPARE((std::vector<UnsignedByte>{decompressed.data(), decompressed.data() + 24}),
+                    (std::vector<UnsignedByte>{255, 255, 255, 255, 255, 0, 0, 0,
+                                               255, 255, 255, 255, 255, 0, 0, 0,
+                                               255, 255, 255, 255, 255, 0, 0, 0}));
+}
+
+void BlockCompressionTest::bgr() {
+    const std::vector<Vector4ub> data = testImage();
+    std::vector<Vector4ub> swapped = data;
+    for(Vector4ub& pixel: swapped) std::swap(pixel[0], pixel[2]);
+
+    const Containers::Array<char> a = compressBlocks(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Size, Size}, data.data()}, BlockCompression::Bc7);
+    const Containers::Array<char> b = compressBlocks(ImageReference2D{ColorFormat::BGRA, ColorType::UnsignedByte, {Size, Size}, swapped.data()}, BlockCompression::Bc7);
+    CORRADE_COMPARE((std::vector<char>{a.begin(), a.end()}), (std::vector<char>{b.begin(), b.end()}));
+}
+
+void BlockCompressionTest::threads() {
+    /* Large enough to be split into multiple ranges */
+    std::vector<Vector4ub> data(256*256);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Vector4ub(UnsignedByte(i*7), UnsignedByte(i >> 8), UnsignedByte(i*13 >> 4), UnsignedByte(i));
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {256, 256}, data.data()};
+
+    for(BlockCompression compression: {BlockCompression::Bc1, BlockCompression::Bc7}) {
+        const Containers::Array<char> single = compressBlocks(image, compression, BlockCompressionQuality::Fast, 1);
+        const Containers::Array<char> multiple = compressBlocks(image, compression, BlockCompressionQuality::Fast, 4);
+        CORRADE_COMPARE((std::vector<char>{single.begin(), single.end()}),
+                        (std::vector<char>{multiple.begin(), multiple.end()}));
+
+        const Image2D decompressedSingle = decompressBlocks(single, compression, {256, 256}, 1);
+        const Image2D decompressedMultiple = decompressBlocks(single, compression, {256, 256}, 4);
+        CORRADE_VERIFY(std::equal(decompressedSingle.data(), decompressedSingle.data() + 256*256*4, decompressedMultiple.data()));
+    }
+}
+
+void BlockCompressionTest::debugCompression() {
+    std::ostringstream out;
+    Debug(&out) << BlockCompression::Bc5 << BlockCompression(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::BlockCompression::Bc5 TextureTools::BlockCompression::(invalid)\n");
+}
+
+void BlockCompressionTest::debugQuality() {
+    std::ostringstream out;
+    Debug(&out) << BlockCompressionQuality::Best << BlockCompressionQuality(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::BlockCompressionQuality::Best TextureTools::BlockCompressionQuality::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BlockCompressionTest)
@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/TextureTools/GenerateMipmaps.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct GenerateMipmapsBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit GenerateMipmapsBenchmark();
+
+    void boxNaive();
+    void box();
+    void boxSingleThread();
+    void boxSrgb();
+    void kaiserSrgb();
+    void lanczosSrgb();
+    void kaiserAlphaCoverage();
+
+    private:
+        void benchmark(const std::string& name, MipmapFilter filter, MipmapFlags flags, std::size_t threadCount);
+
+        std::vector<Math::Vector4<UnsignedByte>> _data;
+};
+
+namespace {
+
+constexpr Int Size = 2048;
+
+}
+
+GenerateMipmapsBenchmark::GenerateMipmapsBenchmark(): AbstractBenchmarkTester{5}, _data(Size*Size) {
+    addTests({&GenerateMipmapsBenchmark::boxNaive,
+              &GenerateMipmapsBenchmark::box,
+              &GenerateMipmapsBenchmark::boxSingleThread,
+              &GenerateMipmapsBenchmark::boxSrgb,
+              &GenerateMipmapsBenchmark::kaiserSrgb,
+              &GenerateMipmapsBenchmark::lanczosSrgb,
+              &GenerateMipmapsBenchmark::kaiserAlphaCoverage});
+
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = {UnsignedByte(i*7), UnsignedByte(i/Size), UnsignedByte(i*13 + i/Size), UnsignedByte(i*3)};
+}
+
+/* Integer 2x2 averaging of power-of-two image, for comparison */
+void GenerateMipmapsBenchmark::boxNaive() {
+    MAGNUM_BENCHMARK("naive 2x2 box, RGBA8", Size*Size) {
+        std::vector<std::vector<Math::Vector4<UnsignedByte>>> levels{_data};
+        for(Int size = Size/2; size; size /= 2) {
+            const std::vector<Math::Vector4<UnsignedByte>>& previous = levels.back();
+            std::vector<Math::Vector4<UnsignedByte>> level(size*size);
+            for(Int y = 0; y != size; ++y) for(Int x = 0; x != size; ++x) {
+                const Math::Vector4<UnsignedByte>* const a = previous.data() + 2*y*2*size + 2*x;
+                const Math::Vector4<UnsignedByte>* const b = a + 2*size;
+                level[y*size + x] = Math::Vector4<UnsignedByte>((Math::Vector4<UnsignedInt>(a[0]) + Math::Vector4<UnsignedInt>(a[1]) + Math::Vector4<UnsignedInt>(b[0]) + Math::Vector4<UnsignedInt>(b[1]) + Math::Vector4<UnsignedInt>(2))/4u);
+            }
+            levels.push_back(std::move(level));
+        }
+        escape(levels.back().data());
+    }
+}
+
+void GenerateMipmapsBenchmark::benchmark(const std::string& name, const MipmapFilter filter, const MipmapFlags flags, const std::size_t threadCount) {
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {Size, Size}, _data.data()};
+    MAGNUM_BENCHMARK(name, Size*Size) {
+        std::vector<Trade::ImageData2D> levels = generateMipmaps(image, filter, flags, 0.5f, threadCount);
+        escape(levels.back().data());
+    }
+}
+
+void GenerateMipmapsBenchmark::box() {
+    benchmark("generateMipmaps(), box, RGBA8", MipmapFilter::Box, {}, 0);
+}
+
+void GenerateMipmapsBenchmark::boxSingleThread() {
+    benchmark("generateMipmaps(), box, RGBA8, single thread", MipmapFilter::Box, {}, 1);
+}
+
+void GenerateMipmapsBenchmark::boxSrgb() {
+    benchmark("generateMipmaps(), box, sRGB8A8", MipmapFilter::Box, MipmapFlag::Srgb, 0);
+}
+
+void GenerateMipmapsBenchmark::kaiserSrgb() {
+    benchmark("generateMipmaps(), Kaiser, sRGB8A8", MipmapFilter::Kaiser, MipmapFlag::Srgb, 0);
+}
+
+void GenerateMipmapsBenchmark::lanczosSrgb() {
+    benchmark("generateMipmaps(), Lanczos, sRGB8A8", MipmapFilter::Lanczos, MipmapFlag::Srgb, 0);
+}
+
+void GenerateMipmapsBenchmark::kaiserAlphaCoverage() {
+    benchmark("generateMipmaps(), Kaiser, sRGB8A8, alpha coverage", MipmapFilter::Kaiser, MipmapFlag::Srgb|MipmapFlag::PreserveAlphaCoverage, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::GenerateMipmapsBenchmark)
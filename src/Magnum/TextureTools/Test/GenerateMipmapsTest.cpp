@@ -0,0 +1,243 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/TextureTools/GenerateMipmaps.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct GenerateMipmapsTest: TestSuite::Tester {
+    explicit GenerateMipmapsTest();
+
+    void levelSizes();
+    void levelSizesNonPowerOfTwo();
+    void box();
+    void boxOdd();
+    void constant();
+    void srgb();
+    void floatType();
+    void halfFloatType();
+    void alphaCoverage();
+    void threads();
+
+    void debugFilter();
+};
+
+GenerateMipmapsTest::GenerateMipmapsTest() {
+    addTests({&GenerateMipmapsTest::levelSizes,
+              &GenerateMipmapsTest::levelSizesNonPowerOfTwo,
+              &GenerateMipmapsTest::box,
+              &GenerateMipmapsTest::boxOdd,
+              &GenerateMipmapsTest::constant,
+              &GenerateMipmapsTest::srgb,
+              &GenerateMipmapsTest::floatType,
+              &GenerateMipmapsTest::halfFloatType,
+              &GenerateMipmapsTest::alphaCoverage,
+              &GenerateMipmapsTest::threads,
+
+              &GenerateMipmapsTest::debugFilter});
+}
+
+namespace {
+
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+
+const Vector4ub& pixel(const Trade::ImageData2D& image, const Vector2i& position) {
+    return reinterpret_cast<const Vector4ub*>(image.data())[position.y()*image.size().x() + position.x()];
+}
+
+}
+
+void GenerateMipmapsTest::levelSizes() {
+    const std::vector<Vector4ub> data(16*4);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {16, 4}, data.data()};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image);
+    CORRADE_COMPARE(levels.size(), 5);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(16, 4));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(8, 2));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(4, 1));
+    CORRADE_COMPARE(levels[3].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[4].size(), Vector2i(1, 1));
+
+    for(const Trade::ImageData2D& level: levels) {
+        CORRADE_COMPARE(level.format(), ColorFormat::RGBA);
+        CORRADE_COMPARE(level.type(), ColorType::UnsignedByte);
+    }
+}
+
+void GenerateMipmapsTest::levelSizesNonPowerOfTwo() {
+    /* Rows of three-component data are padded to four bytes */
+    const std::vector<UnsignedByte> data(16*3);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {5, 3}, data.data()};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image, MipmapFilter::Lanczos);
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(5, 3));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(1, 1));
+    CORRADE_COMPARE(levels[2].format(), ColorFormat::RGB);
+}
+
+void GenerateMipmapsTest::box() {
+    const Vector4ub data[]{
+        {0, 0, 0, 255}, {200, 100, 0, 255}, {10, 20, 30, 40}, {10, 20, 30, 40},
+        {100, 0, 0, 255}, {100, 100, 100, 255}, {30, 40, 52, 62}, {30, 40, 52, 62}
+    };
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {4, 2}, data};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image);
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(pixel(levels[0], {1, 1}), (Vector4ub{100, 100, 100, 255}));
+    CORRADE_COMPARE(pixel(levels[1], {0, 0}), (Vector4ub{100, 50, 25, 255}));
+    CORRADE_COMPARE(pixel(levels[1], {1, 0}), (Vector4ub{20, 30, 41, 51}));
+    CORRADE_COMPARE(pixel(levels[2], {0, 0}), (Vector4ub{60, 40, 33, 153}));
+}
+
+void GenerateMipmapsTest::boxOdd() {
+    /* Three pixels downsampled to one are all averaged */
+    const Float data[]{0.0f, 0.3f, 0.6f};
+    const ImageReference2D image{ColorFormat::Red, ColorType::Float, {3, 1}, data};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image);
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(reinterpret_cast<const Float*>(levels[1].data())[0], 0.3f);
+}
+
+void GenerateMipmapsTest::constant() {
+    /* Normalized filters keep constant color regardless of edge handling */
+    const std::vector<Vector4ub> data(37*21, Vector4ub{25, 127, 200, 255});
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {37, 21}, data.data()};
+
+    for(MipmapFilter filter: {MipmapFilter::Box, MipmapFilter::Kaiser, MipmapFilter::Lanczos}) {
+        std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image, filter, MipmapFlag::Srgb);
+        CORRADE_COMPARE(levels.size(), 6);
+        for(const Trade::ImageData2D& level: levels) {
+            CORRADE_COMPARE(pixel(level, {0, 0}), data[0]);
+            CORRADE_COMPARE(pixel(level, level.size() - Vector2i{1}), data[0]);
+        }
+    }
+}
+
+void GenerateMipmapsTest::srgb() {
+    const Vector4ub data[]{{0, 0, 0, 0}, {255, 255, 255, 255}};
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {2, 1}, data};
+
+    /* Linear average is 0.5, which is 188 in sRGB, alpha is linear */
+    std::vector<Trade::ImageData2D> linear = TextureTools::generateMipmaps(image);
+    std::vector<Trade::ImageData2D> srgb = TextureTools::generateMipmaps(image, MipmapFilter::Box, MipmapFlag::Srgb);
+    CORRADE_COMPARE(pixel(linear[1], {0, 0}), (Vector4ub{128, 128, 128, 128}));
+    CORRADE_COMPARE(pixel(srgb[1], {0, 0}), (Vector4ub{188, 188, 188, 128}));
+}
+
+void GenerateMipmapsTest::floatType() {
+    const Float data[]{
+        1.0f, 0.0f, 0.5f, 0.5f,
+        0.0f, 1.0f, 0.5f, 0.5f
+    };
+    const ImageReference2D image{ColorFormat::RG, ColorType::Float, {2, 2}, data};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image, MipmapFilter::Box, MipmapFlag::Srgb);
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(levels[1].type(), ColorType::Float);
+    CORRADE_COMPARE(levels[1].format(), ColorFormat::RG);
+    const Float* out = reinterpret_cast<const Float*>(levels[1].data());
+    CORRADE_COMPARE(out[0], 0.5f);
+    CORRADE_COMPARE(out[1], 0.5f);
+}
+
+void GenerateMipmapsTest::halfFloatType() {
+    const Math::Half data[]{Math::Half{1.0f}, Math::Half{0.0f}, Math::Half{0.25f}, Math::Half{0.75f}};
+    const ImageReference2D image{ColorFormat::Red, ColorType::HalfFloat, {4, 1}, data};
+
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image);
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[2].type(), ColorType::HalfFloat);
+    CORRADE_COMPARE(Float(reinterpret_cast<const Math::Half*>(levels[1].data())[0]), 0.5f);
+    CORRADE_COMPARE(Float(reinterpret_cast<const Math::Half*>(levels[1].data())[1]), 0.5f);
+    CORRADE_COMPARE(Float(reinterpret_cast<const Math::Half*>(levels[2].data())[0]), 0.5f);
+}
+
+void GenerateMipmapsTest::alphaCoverage() {
+    /* Noise in alpha with a fifth of pixels above the reference */
+    std::vector<Math::Vector4<Float>> data(64*64);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {1.0f, 1.0f, 1.0f, Float((i*2654435761u) % 1000)/1000.0f};
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::Float, {64, 64}, data.data()};
+
+    const auto coverage = [](const Trade::ImageData2D& level) {
+        std::size_t count = 0;
+        const std::size_t pixelCount = level.size().product();
+        for(std::size_t i = 0; i != pixelCount; ++i)
+            if(reinterpret_cast<const Math::Vector4<Float>*>(level.data())[i].w() > 0.8f) ++count;
+        return Float(count)/pixelCount;
+    };
+    const Float original = coverage(TextureTools::generateMipmaps(image)[0]);
+    CORRADE_VERIFY(original > 0.15f && original < 0.25f);
+
+    /* Without the correction the averaged alpha is below the reference */
+    std::vector<Trade::ImageData2D> levels = TextureTools::generateMipmaps(image);
+    CORRADE_COMPARE(coverage(levels[2]), 0.0f);
+
+    levels = TextureTools::generateMipmaps(image, MipmapFilter::Kaiser, MipmapFlag::PreserveAlphaCoverage, 0.8f);
+    CORRADE_COMPARE(levels.size(), 7);
+    for(const Trade::ImageData2D& level: levels)
+        CORRADE_VERIFY(std::abs(coverage(level) - original) <= 0.5f/level.size().product() + 1.0e-5f);
+}
+
+void GenerateMipmapsTest::threads() {
+    std::vector<Vector4ub> data(301*517);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {UnsignedByte(i*7), UnsignedByte(i/5), UnsignedByte(i*13 + i/301), UnsignedByte(i*3)};
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {301, 517}, data.data()};
+
+    std::vector<Trade::ImageData2D> single = TextureTools::generateMipmaps(image, MipmapFilter::Lanczos, MipmapFlag::Srgb|MipmapFlag::PreserveAlphaCoverage, 0.5f, 1);
+    std::vector<Trade::ImageData2D> multiple = TextureTools::generateMipmaps(image, MipmapFilter::Lanczos, MipmapFlag::Srgb|MipmapFlag::PreserveAlphaCoverage, 0.5f, 4);
+    CORRADE_COMPARE(multiple.size(), single.size());
+    for(std::size_t i = 0; i != single.size(); ++i) {
+        CORRADE_COMPARE(multiple[i].size(), single[i].size());
+        const std::size_t size = single[i].dataSize(single[i].size());
+        CORRADE_VERIFY(std::equal(single[i].data(), single[i].data() + size, multiple[i].data()));
+    }
+}
+
+void GenerateMipmapsTest::debugFilter() {
+    std::ostringstream out;
+    Debug(&out) << MipmapFilter::Kaiser << MipmapFilter(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFilter::Kaiser TextureTools::MipmapFilter::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::GenerateMipmapsTest)
@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct ResampleBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit ResampleBenchmark();
+
+    void thumbnailBilinear();
+    void thumbnailBicubic();
+    void thumbnailLanczos3();
+    void thumbnailMitchell();
+    void thumbnailLanczos3SingleThread();
+    void thumbnailLanczos3Rgb();
+    void thumbnailLanczos3Float();
+    void halveLanczos3();
+    void upsampleBicubic();
+    void upsampleMitchell();
+
+    private:
+        void benchmark(const std::string& name, ColorFormat format, ColorType type, const void* data, const Vector2i& sourceSize, const Vector2i& size, ResampleFilter filter, std::size_t threadCount);
+
+        std::vector<Math::Vector4<UnsignedByte>> _data;
+        std::vector<Math::Vector4<Float>> _floatData;
+};
+
+namespace {
+
+constexpr Int Size = 2048;
+
+}
+
+ResampleBenchmark::ResampleBenchmark(): AbstractBenchmarkTester{5}, _data(Size*Size), _floatData(Size*Size) {
+    addTests({&ResampleBenchmark::thumbnailBilinear,
+              &ResampleBenchmark::thumbnailBicubic,
+              &ResampleBenchmark::thumbnailLanczos3,
+              &ResampleBenchmark::thumbnailMitchell,
+              &ResampleBenchmark::thumbnailLanczos3SingleThread,
+              &ResampleBenchmark::thumbnailLanczos3Rgb,
+              &ResampleBenchmark::thumbnailLanczos3Float,
+              &ResampleBenchmark::halveLanczos3,
+              &ResampleBenchmark::upsampleBicubic,
+              &ResampleBenchmark::upsampleMitchell});
+
+    for(std::size_t i = 0; i != _data.size(); ++i) {
+        _data[i] = {UnsignedByte(i*7), UnsignedByte(i/Size), UnsignedByte(i*13 + i/Size), UnsignedByte(i*3)};
+        _floatData[i] = Math::Vector4<Float>(_data[i])/255.0f;
+    }
+}
+
+/* Batch size is count of source pixels for downsampling and count of
+   destination pixels for upsampling */
+void ResampleBenchmark::benchmark(const std::string& name, const ColorFormat format, const ColorType type, const void* const data, const Vector2i& sourceSize, const Vector2i& size, const ResampleFilter filter, const std::size_t threadCount) {
+    const ImageReference2D image{format, type, sourceSize, data};
+    MAGNUM_BENCHMARK(name, std::size_t(std::max(sourceSize.product(), size.product()))) {
+        Image2D out = resample(image, size, filter, threadCount);
+        escape(out.data());
+    }
+}
+
+void ResampleBenchmark::thumbnailBilinear() {
+    benchmark("resample(), 2048 to 256, bilinear, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {256, 256}, ResampleFilter::Bilinear, 0);
+}
+
+void ResampleBenchmark::thumbnailBicubic() {
+    benchmark("resample(), 2048 to 256, bicubic, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {256, 256}, ResampleFilter::Bicubic, 0);
+}
+
+void ResampleBenchmark::thumbnailLanczos3() {
+    benchmark("resample(), 2048 to 256, Lanczos3, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {256, 256}, ResampleFilter::Lanczos3, 0);
+}
+
+void ResampleBenchmark::thumbnailMitchell() {
+    benchmark("resample(), 2048 to 256, Mitchell, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {256, 256}, ResampleFilter::Mitchell, 0);
+}
+
+void ResampleBenchmark::thumbnailLanczos3SingleThread() {
+    benchmark("resample(), 2048 to 256, Lanczos3, RGBA8, single thread", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {256, 256}, ResampleFilter::Lanczos3, 1);
+}
+
+void ResampleBenchmark::thumbnailLanczos3Rgb() {
+    /* Interpreting the RGBA data as RGB, only the image width matters */
+    benchmark("resample(), 2048 to 256, Lanczos3, RGB8", ColorFormat::RGB, ColorType::UnsignedByte, _data.data(), {Size*4/3, Size}, {256*4/3, 256}, ResampleFilter::Lanczos3, 0);
+}
+
+void ResampleBenchmark::thumbnailLanczos3Float() {
+    benchmark("resample(), 2048 to 256, Lanczos3, RGBA32F", ColorFormat::RGBA, ColorType::Float, _floatData.data(), {Size, Size}, {256, 256}, ResampleFilter::Lanczos3, 0);
+}
+
+void ResampleBenchmark::halveLanczos3() {
+    benchmark("resample(), 2048 to 1024, Lanczos3, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size, Size}, {Size/2, Size/2}, ResampleFilter::Lanczos3, 0);
+}
+
+void ResampleBenchmark::upsampleBicubic() {
+    benchmark("resample(), 512 to 2048, bicubic, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size/4, Size/4}, {Size, Size}, ResampleFilter::Bicubic, 0);
+}
+
+void ResampleBenchmark::upsampleMitchell() {
+    benchmark("resample(), 512 to 2048, Mitchell, RGBA8", ColorFormat::RGBA, ColorType::UnsignedByte, _data.data(), {Size/4, Size/4}, {Size, Size}, ResampleFilter::Mitchell, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleBenchmark)
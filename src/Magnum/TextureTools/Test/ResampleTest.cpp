@@ -0,0 +1,269 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct ResampleTest: TestSuite::Tester {
+    explicit ResampleTest();
+
+    void identity();
+    void bilinearUpsample();
+    void bilinearDownsample();
+    void bicubic();
+    void mitchell();
+    void lanczos3();
+    void constant();
+    void clamp();
+    void clampRounding();
+    void types();
+    void threeComponent();
+    void empty();
+    void threads();
+
+    void debugFilter();
+
+    private:
+        template<class T> void resampleType(ColorType type);
+};
+
+ResampleTest::ResampleTest() {
+    addTests({&ResampleTest::identity,
+              &ResampleTest::bilinearUpsample,
+              &ResampleTest::bilinearDownsample,
+              &ResampleTest::bicubic,
+              &ResampleTest::mitchell,
+              &ResampleTest::lanczos3,
+              &ResampleTest::constant,
+              &ResampleTest::clamp,
+              &ResampleTest::clampRounding,
+              &ResampleTest::types,
+              &ResampleTest::threeComponent,
+              &ResampleTest::empty,
+              &ResampleTest::threads,
+
+              &ResampleTest::debugFilter});
+}
+
+namespace {
+
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+
+/* Resamples a single row of floats */
+std::vector<Float> resampleRow(const std::vector<Float>& data, const Int size, const ResampleFilter filter) {
+    Image2D out = TextureTools::resample(ImageReference2D{ColorFormat::Red, ColorType::Float, {Int(data.size()), 1}, data.data()}, {size, 1}, filter);
+    const Float* const begin = reinterpret_cast<const Float*>(out.data());
+    return std::vector<Float>(begin, begin + size);
+}
+
+bool equal(const std::vector<Float>& actual, const std::vector<Float>& expected) {
+    if(actual.size() != expected.size()) return false;
+    for(std::size_t i = 0; i != actual.size(); ++i)
+        if(std::abs(actual[i] - expected[i]) > 0.001f) return false;
+    return true;
+}
+
+}
+
+void ResampleTest::identity() {
+    /* All filters except Mitchell are interpolating, so resampling to the
+       same size gives back the original. Rows are padded to four bytes. */
+    std::vector<UnsignedByte> data(8*3);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*37);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {2, 3}, data.data()};
+
+    for(ResampleFilter filter: {ResampleFilter::Bilinear, ResampleFilter::Bicubic, ResampleFilter::Lanczos3}) {
+        Image2D out = TextureTools::resample(image, {2, 3}, filter);
+        CORRADE_COMPARE(out.size(), Vector2i(2, 3));
+        CORRADE_COMPARE(out.format(), ColorFormat::RGB);
+        CORRADE_COMPARE(out.type(), ColorType::UnsignedByte);
+        for(std::size_t y = 0; y != 3; ++y)
+            CORRADE_VERIFY(std::equal(data.begin() + y*8, data.begin() + y*8 + 6, reinterpret_cast<const UnsignedByte*>(out.data()) + y*8));
+    }
+}
+
+void ResampleTest::bilinearUpsample() {
+    CORRADE_VERIFY(equal(resampleRow({0.0f, 100.0f}, 4, ResampleFilter::Bilinear),
+                         {0.0f, 25.0f, 75.0f, 100.0f}));
+}
+
+void ResampleTest::bilinearDownsample() {
+    /* The triangle is stretched to cover four source pixels */
+    CORRADE_VERIFY(equal(resampleRow({0.0f, 100.0f, 200.0f, 50.0f}, 2, ResampleFilter::Bilinear),
+                         {62.5f, 112.5f}));
+}
+
+/* Reference values for the following were calculated independently in double
+   precision */
+
+void ResampleTest::bicubic() {
+    CORRADE_VERIFY(equal(resampleRow({0.0f, 100.0f, 50.0f, 200.0f}, 7, ResampleFilter::Bicubic),
+                         {-6.6144f, 34.4843f, 97.2394f, 71.875f, 54.9107f, 149.2985f, 209.9216f}));
+}
+
+void ResampleTest::mitchell() {
+    CORRADE_VERIFY(equal(resampleRow({0.0f, 100.0f, 50.0f, 200.0f}, 7, ResampleFilter::Mitchell),
+                         {-1.7149f, 35.9906f, 89.1086f, 73.2639f, 65.7384f, 146.6341f, 202.5723f}));
+}
+
+void ResampleTest::lanczos3() {
+    CORRADE_VERIFY(equal(resampleRow({10.0f, 200.0f, 30.0f, 90.0f, 250.0f, 0.0f, 120.0f, 60.0f}, 3, ResampleFilter::Lanczos3),
+                         {82.3529f, 127.5652f, 79.1554f}));
+}
+
+void ResampleTest::constant() {
+    /* Normalized filters keep constant color regardless of edge handling */
+    const std::vector<Vector4ub> data(37*21, Vector4ub{25, 127, 200, 255});
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {37, 21}, data.data()};
+
+    for(ResampleFilter filter: {ResampleFilter::Bilinear, ResampleFilter::Bicubic, ResampleFilter::Lanczos3, ResampleFilter::Mitchell})
+        for(Vector2i size: {Vector2i{5, 3}, Vector2i{100, 7}, Vector2i{1, 64}}) {
+            Image2D out = TextureTools::resample(image, size, filter);
+            const Vector4ub* const pixels = reinterpret_cast<const Vector4ub*>(out.data());
+            CORRADE_COMPARE(pixels[0], data[0]);
+            CORRADE_COMPARE(pixels[size.product() - 1], data[0]);
+        }
+}
+
+void ResampleTest::clamp() {
+    /* Bicubic overshoots around the edge, the values are clamped */
+    CORRADE_VERIFY(equal(resampleRow({0.0f, 0.0f, 255.0f, 255.0f}, 8, ResampleFilter::Bicubic),
+                         {0.0f, -5.9766f, -17.9297f, 51.7969f, 203.2031f, 272.9297f, 260.9766f, 255.0f}));
+
+    const UnsignedByte data[]{0, 0, 255, 255};
+    Image2D out = TextureTools::resample(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, data}, {8, 1}, ResampleFilter::Bicubic);
+    const UnsignedByte expected[]{0, 0, 0, 52, 203, 255, 255, 255};
+    CORRADE_VERIFY(std::equal(expected, expected + 8, reinterpret_cast<const UnsignedByte*>(out.data())));
+
+    /* Signed types are clamped from below at the type minimum */
+    #ifndef MAGNUM_TARGET_GLES2
+    const Byte signedData[]{-128, -128, 127, 127};
+    Image2D signedOut = TextureTools::resample(ImageReference2D{ColorFormat::Red, ColorType::Byte, {4, 1}, signedData}, {8, 1}, ResampleFilter::Bicubic);
+    CORRADE_COMPARE(reinterpret_cast<const Byte*>(signedOut.data())[2], -128);
+    CORRADE_COMPARE(reinterpret_cast<const Byte*>(signedOut.data())[5], 127);
+    #endif
+}
+
+template<class T> void ResampleTest::resampleType(const ColorType type) {
+    /* The row is padded to four bytes for smaller types */
+    const T data[4]{T(0.0f), T(100.0f)};
+    Image2D out = TextureTools::resample(ImageReference2D{ColorFormat::Red, type, {2, 1}, data}, {4, 1}, ResampleFilter::Bilinear);
+    CORRADE_COMPARE(out.type(), type);
+    const T* const pixels = reinterpret_cast<const T*>(out.data());
+    CORRADE_COMPARE(Float(pixels[0]), 0.0f);
+    CORRADE_COMPARE(Float(pixels[1]), 25.0f);
+    CORRADE_COMPARE(Float(pixels[2]), 75.0f);
+    CORRADE_COMPARE(Float(pixels[3]), 100.0f);
+}
+
+void ResampleTest::clampRounding() {
+    /* Long rows of bytes may be converted in a vectorized way, the result
+       should be the same as rounding the float result */
+    std::vector<UnsignedByte> data(40);
+    std::vector<Float> floatData(40);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        floatData[i] = data[i] = i % 7 < 3 ? 0 : 255 - i;
+
+    Image2D out = TextureTools::resample(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {40, 1}, data.data()}, {37, 1}, ResampleFilter::Bicubic);
+    const std::vector<Float> expected = resampleRow(floatData, 37, ResampleFilter::Bicubic);
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        CORRADE_COMPARE(reinterpret_cast<const UnsignedByte*>(out.data())[i], UnsignedByte(Math::clamp(expected[i], 0.0f, 255.0f) + 0.5f));
+}
+
+void ResampleTest::types() {
+    resampleType<UnsignedByte>(ColorType::UnsignedByte);
+    resampleType<UnsignedShort>(ColorType::UnsignedShort);
+    resampleType<UnsignedInt>(ColorType::UnsignedInt);
+    #ifndef MAGNUM_TARGET_GLES2
+    resampleType<Byte>(ColorType::Byte);
+    resampleType<Short>(ColorType::Short);
+    resampleType<Int>(ColorType::Int);
+    #endif
+    resampleType<Math::Half>(ColorType::HalfFloat);
+    resampleType<Float>(ColorType::Float);
+}
+
+void ResampleTest::threeComponent() {
+    /* Three-component pixels may be processed padded internally, the result
+       should be the same as for four-component ones */
+    std::vector<UnsignedByte> rgb(24*13);
+    std::vector<Vector4ub> rgba(7*13);
+    for(std::size_t y = 0; y != 13; ++y) for(std::size_t x = 0; x != 7; ++x) {
+        const Vector4ub pixel{UnsignedByte(x*31 + y), UnsignedByte(y*17), UnsignedByte(x*y*5), 255};
+        std::copy(pixel.data(), pixel.data() + 3, rgb.begin() + y*24 + x*3);
+        rgba[y*7 + x] = pixel;
+    }
+
+    Image2D outRgb = TextureTools::resample(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {7, 13}, rgb.data()}, {15, 5}, ResampleFilter::Lanczos3);
+    Image2D outRgba = TextureTools::resample(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {7, 13}, rgba.data()}, {15, 5}, ResampleFilter::Lanczos3);
+    CORRADE_COMPARE(outRgb.dataSize(outRgb.size()), 48*5);
+    for(std::size_t y = 0; y != 5; ++y) for(std::size_t x = 0; x != 15; ++x) {
+        const UnsignedByte* const a = reinterpret_cast<const UnsignedByte*>(outRgb.data()) + y*48 + x*3;
+        const UnsignedByte* const b = reinterpret_cast<const UnsignedByte*>(outRgba.data()) + (y*15 + x)*4;
+        CORRADE_VERIFY(std::equal(a, a + 3, b));
+    }
+}
+
+void ResampleTest::empty() {
+    Image2D out = TextureTools::resample(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {}, nullptr}, {}, ResampleFilter::Bilinear);
+    CORRADE_COMPARE(out.size(), Vector2i{});
+    CORRADE_COMPARE(out.format(), ColorFormat::RGBA);
+}
+
+void ResampleTest::threads() {
+    std::vector<Vector4ub> data(301*517);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {UnsignedByte(i*7), UnsignedByte(i/5), UnsignedByte(i*13 + i/301), UnsignedByte(i*3)};
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {301, 517}, data.data()};
+
+    for(Vector2i size: {Vector2i{97, 211}, Vector2i{640, 800}}) {
+        Image2D single = TextureTools::resample(image, size, ResampleFilter::Lanczos3, 1);
+        Image2D multiple = TextureTools::resample(image, size, ResampleFilter::Lanczos3, 4);
+        const std::size_t dataSize = single.dataSize(size);
+        CORRADE_VERIFY(std::equal(single.data(), single.data() + dataSize, multiple.data()));
+    }
+}
+
+void ResampleTest::debugFilter() {
+    std::ostringstream out;
+    Debug(&out) << ResampleFilter::Mitchell << ResampleFilter(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::ResampleFilter::Mitchell TextureTools::ResampleFilter::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleTest)
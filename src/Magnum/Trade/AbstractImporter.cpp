@@ -25,11 +25,13 @@
 
 #include "AbstractImporter.h"
 
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/AbstractMaterialData.h"
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
@@ -424,6 +426,45 @@ std::optional<ImageData2D> AbstractImporter::image2D(const UnsignedInt id) {
 
 std::optional<ImageData2D> AbstractImporter::doImage2D(UnsignedInt) { return std::nullopt; }
 
+std::optional<Vector2i> AbstractImporter::image2DSize(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DSize(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DSize(): index out of range", {});
+    return doImage2DSize(id);
+}
+
+std::optional<Vector2i> AbstractImporter::doImage2DSize(const UnsignedInt id) {
+    std::optional<ImageData2D> image = doImage2D(id);
+    if(!image) return std::nullopt;
+    return image->size();
+}
+
+std::optional<ImageData2D> AbstractImporter::image2D(const UnsignedInt id, const Range2Di& region) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2D(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2D(): index out of range", {});
+    return doImage2DRegion(id, region);
+}
+
+std::optional<ImageData2D> AbstractImporter::doImage2DRegion(const UnsignedInt id, const Range2Di& region) {
+    std::optional<ImageData2D> image = doImage2D(id);
+    if(!image) return std::nullopt;
+
+    if(!(region.min() >= Vector2i{}).all() || !(region.min() <= region.max()).all() || !(region.max() <= image->size()).all()) {
+        Error() << "Trade::AbstractImporter::image2D(): region" << region << "is not contained in image of size" << image->size();
+        return std::nullopt;
+    }
+
+    /* Copy the region row by row, both images have rows aligned to four
+       bytes */
+    const std::size_t pixelSize = image->pixelSize();
+    const std::size_t rowSize = image->dataSize(Vector2i{image->size().x(), 1});
+    const std::size_t regionRowSize = image->dataSize(Vector2i{region.sizeX(), 1});
+    char* const data = new char[image->dataSize(region.size())];
+    for(Int y = 0; y != region.sizeY(); ++y)
+        std::memcpy(data + y*regionRowSize, image->data() + (region.bottom() + y)*rowSize + region.left()*pixelSize, region.sizeX()*pixelSize);
+
+    return ImageData2D{image->format(), image->type(), region.size(), data};
+}
+
 UnsignedInt AbstractImporter::image3DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DCount(): no file opened", {});
     return doImage3DCount();
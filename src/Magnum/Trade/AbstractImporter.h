@@ -72,12 +72,12 @@ checked by the implementation:
 -   All `do*()` implementations taking data ID as parameter are called only if
     the ID is from valid range.
 
-Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImporter/0.3"`.
+Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImporter/0.3.1"`.
 
 @todo How to handle casting from std::unique_ptr<> in more convenient way?
 */
 class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlugin<AbstractImporter> {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3.1")
 
     public:
         /**
@@ -87,7 +87,16 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using @ref openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Querying image size using @ref image2DSize() and importing
+             * image regions using @ref image2D(UnsignedInt, const Range2Di&)
+             * without importing the whole image. If not supported, these
+             * functions are still available, but import the whole image
+             * internally.
+             */
+            ImageRegion = 1 << 1
         };
 
         /** @brief Set of features supported by this importer */
@@ -439,9 +448,53 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          * @param id        Image ID, from range [0, @ref image2DCount()).
          *
          * Returns given image or `std::nullopt` if importing failed.
+         * @see @ref image2DSize(), @ref image2D(UnsignedInt, const Range2Di&)
          */
         std::optional<ImageData2D> image2D(UnsignedInt id);
 
+        /**
+         * @brief Two-dimensional image size
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         *
+         * Returns size of given image or `std::nullopt` if importing failed.
+         * If @ref Feature::ImageRegion is supported, the pixel data are not
+         * imported.
+         * @see @ref features()
+         */
+        std::optional<Vector2i> image2DSize(UnsignedInt id);
+
+        /**
+         * @brief Region of two-dimensional image
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param region    Imported region, in pixels
+         *
+         * Returns given region of the image or `std::nullopt` if importing
+         * failed or the region is not contained in the image. The imported
+         * image has size of @p region and has the same format and type as
+         * the whole image would have. If @ref Feature::ImageRegion is
+         * supported, only the data needed for given region are decoded, so
+         * images larger than available memory can be processed in tiles,
+         * e.g. uploaded using @ref Texture::setSubImage():
+         * @code
+         * const Vector2i size = *importer->image2DSize(0);
+         * Texture2D texture;
+         * texture.setStorage(1, TextureFormat::RGBA8, size);
+         *
+         * for(Int y = 0; y < size.y(); y += 4096) {
+         *     for(Int x = 0; x < size.x(); x += 4096) {
+         *         std::optional<Trade::ImageData2D> tile = importer->image2D(0,
+         *             {{x, y}, Math::min(Vector2i{x, y} + Vector2i{4096}, size)});
+         *         texture.setSubImage(0, {x, y}, *tile);
+         *     }
+         * }
+         * @endcode
+         *
+         * Peak memory usage is then bounded by tile size instead of image
+         * size.
+         * @see @ref features(), @ref image2D(UnsignedInt)
+         */
+        std::optional<ImageData2D> image2D(UnsignedInt id, const Range2Di& region);
+
         /** @brief Three-dimensional image count */
         UnsignedInt image3DCount() const;
 
@@ -767,9 +820,27 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         virtual std::string doImage2DName(UnsignedInt id);
 
-        /** @brief Implementation for @ref image2D() */
+        /** @brief Implementation for @ref image2D(UnsignedInt) */
         virtual std::optional<ImageData2D> doImage2D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref image2DSize()
+         *
+         * Default implementation imports the whole image using
+         * @ref doImage2D() and returns its size.
+         */
+        virtual std::optional<Vector2i> doImage2DSize(UnsignedInt id);
+
+        /**
+         * @brief Implementation for @ref image2D(UnsignedInt, const Range2Di&)
+         *
+         * Default implementation imports the whole image using
+         * @ref doImage2D() and copies given region out of it. The
+         * implementation is expected to check that the region is contained
+         * in the image.
+         */
+        virtual std::optional<ImageData2D> doImage2DRegion(UnsignedInt id, const Range2Di& region);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
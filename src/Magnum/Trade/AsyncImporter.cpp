@@ -0,0 +1,219 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncImporter.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+AsyncImporter::AsyncImporter(Factory factory, std::size_t threadCount): _nextId{0}, _runningCount{0}, _stopping{false} {
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* Create all importers upfront on this thread, the factory might not be
+       thread-safe */
+    _importers.reserve(threadCount);
+    for(std::size_t i = 0; i != threadCount; ++i) {
+        _importers.push_back(factory());
+        CORRADE_ASSERT(_importers.back(), "Trade::AsyncImporter: the factory returned null importer", );
+    }
+
+    _threads.reserve(threadCount);
+    for(std::unique_ptr<AbstractImporter>& importer: _importers)
+        _threads.emplace_back(&AsyncImporter::work, this, std::ref(*importer));
+}
+
+AsyncImporter::~AsyncImporter() {
+    cancelAll();
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopping = true;
+    }
+    _pendingCondition.notify_all();
+
+    for(std::thread& thread: _threads) thread.join();
+}
+
+std::size_t AsyncImporter::pendingCount() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _pending.size();
+}
+
+template<class T> auto AsyncImporter::scheduleFuture(const std::string& filename, std::optional<T>(AbstractImporter::*function)(UnsignedInt), const UnsignedInt id, const Int priority) -> Request<T> {
+    /* std::function needs copyable state */
+    auto promise = std::make_shared<std::promise<std::optional<T>>>();
+    Request<T> request;
+    request.result = promise->get_future();
+    request.id = schedule(filename, priority, [promise, function, id](AbstractImporter* importer, bool) {
+        if(importer) promise->set_value((importer->*function)(id));
+        else promise->set_value(std::nullopt);
+    });
+    return request;
+}
+
+template<class T> UnsignedLong AsyncImporter::scheduleCallback(const std::string& filename, std::optional<T>(AbstractImporter::*function)(UnsignedInt), const UnsignedInt id, std::function<void(std::optional<T>)> callback, const Int priority) {
+    return schedule(filename, priority, [callback, function, id](AbstractImporter* importer, const bool cancelled) {
+        if(importer) callback((importer->*function)(id));
+        else if(!cancelled) callback(std::nullopt);
+    });
+}
+
+UnsignedLong AsyncImporter::schedule(const std::string& filename, const Int priority, Job job) {
+    UnsignedLong id;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        id = _nextId++;
+        _pending.emplace(std::make_pair(priority, id), Pending{filename, std::move(job)});
+        _pendingPriorities.emplace(id, priority);
+    }
+    _pendingCondition.notify_one();
+    return id;
+}
+
+auto AsyncImporter::mesh2D(const std::string& filename, const UnsignedInt id, const Int priority) -> Request<MeshData2D> {
+    return scheduleFuture(filename, &AbstractImporter::mesh2D, id, priority);
+}
+
+UnsignedLong AsyncImporter::mesh2D(const std::string& filename, const UnsignedInt id, std::function<void(std::optional<MeshData2D>)> callback, const Int priority) {
+    return scheduleCallback(filename, &AbstractImporter::mesh2D, id, std::move(callback), priority);
+}
+
+auto AsyncImporter::mesh3D(const std::string& filename, const UnsignedInt id, const Int priority) -> Request<MeshData3D> {
+    return scheduleFuture(filename, &AbstractImporter::mesh3D, id, priority);
+}
+
+UnsignedLong AsyncImporter::mesh3D(const std::string& filename, const UnsignedInt id, std::function<void(std::optional<MeshData3D>)> callback, const Int priority) {
+    return scheduleCallback(filename, &AbstractImporter::mesh3D, id, std::move(callback), priority);
+}
+
+auto AsyncImporter::image1D(const std::string& filename, const UnsignedInt id, const Int priority) -> Request<ImageData1D> {
+    return scheduleFuture(filename, &AbstractImporter::image1D, id, priority);
+}
+
+UnsignedLong AsyncImporter::image1D(const std::string& filename, const UnsignedInt id, std::function<void(std::optional<ImageData1D>)> callback, const Int priority) {
+    return scheduleCallback(filename, &AbstractImporter::image1D, id, std::move(callback), priority);
+}
+
+auto AsyncImporter::image2D(const std::string& filename, const UnsignedInt id, const Int priority) -> Request<ImageData2D> {
+    return scheduleFuture(filename, &AbstractImporter::image2D, id, priority);
+}
+
+UnsignedLong AsyncImporter::image2D(const std::string& filename, const UnsignedInt id, std::function<void(std::optional<ImageData2D>)> callback, const Int priority) {
+    return scheduleCallback(filename, &AbstractImporter::image2D, id, std::move(callback), priority);
+}
+
+auto AsyncImporter::image3D(const std::string& filename, const UnsignedInt id, const Int priority) -> Request<ImageData3D> {
+    return scheduleFuture(filename, &AbstractImporter::image3D, id, priority);
+}
+
+UnsignedLong AsyncImporter::image3D(const std::string& filename, const UnsignedInt id, std::function<void(std::optional<ImageData3D>)> callback, const Int priority) {
+    return scheduleCallback(filename, &AbstractImporter::image3D, id, std::move(callback), priority);
+}
+
+bool AsyncImporter::cancel(const UnsignedLong request) {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        const auto found = _pendingPriorities.find(request);
+        if(found == _pendingPriorities.end()) return false;
+
+        const auto pending = _pending.find(std::make_pair(found->second, request));
+        job = std::move(pending->second.job);
+        _pending.erase(pending);
+        _pendingPriorities.erase(found);
+    }
+
+    /* Complete the request outside of the lock */
+    job(nullptr, true);
+    _idleCondition.notify_all();
+    return true;
+}
+
+std::size_t AsyncImporter::cancelAll() {
+    std::vector<Job> jobs;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        jobs.reserve(_pending.size());
+        for(auto& pending: _pending) jobs.push_back(std::move(pending.second.job));
+        _pending.clear();
+        _pendingPriorities.clear();
+    }
+
+    for(Job& job: jobs) job(nullptr, true);
+    _idleCondition.notify_all();
+    return jobs.size();
+}
+
+void AsyncImporter::wait() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _idleCondition.wait(lock, [this]() { return _pending.empty() && !_runningCount; });
+}
+
+void AsyncImporter::work(AbstractImporter& importer) {
+    /* Name of currently opened file, empty if none is */
+    std::string opened;
+
+    for(;;) {
+        Pending pending;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _pendingCondition.wait(lock, [this]() { return _stopping || !_pending.empty(); });
+            if(_pending.empty()) break;
+
+            const auto first = _pending.begin();
+            _pendingPriorities.erase(first->first.second);
+            pending = std::move(first->second);
+            _pending.erase(first);
+            ++_runningCount;
+        }
+
+        /* Reuse the opened file if possible. Results of previous requests
+           are already handed over to the user, so they must not depend on
+           the importer keeping the file opened. */
+        if(pending.filename != opened) {
+            opened.clear();
+            if(importer.openFile(pending.filename)) opened = pending.filename;
+        }
+
+        pending.job(opened.empty() ? nullptr : &importer, false);
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            --_runningCount;
+        }
+        _idleCondition.notify_all();
+    }
+
+    importer.close();
+}
+
+}}
@@ -0,0 +1,319 @@
+#ifndef Magnum_Trade_AsyncImporter_h
+#define Magnum_Trade_AsyncImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AsyncImporter
+ */
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Asynchronous importer
+
+Schedules data import from many files onto a pool of worker threads. Importer
+plugins keep state of the opened file and thus can't be used from more than
+one thread at once, so each worker has its own importer instance, created
+using the factory function passed to the constructor. The factory is called
+once for each worker on the thread calling the constructor, so it's safe to
+use a (non-thread-safe) plugin manager in it:
+@code
+PluginManager::Manager<Trade::AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_DIR};
+Trade::AsyncImporter importer{[&manager]() {
+    return manager.instance("TgaImporter");
+}};
+@endcode
+
+Each request returns a @ref Request with a @ref std::future, which can be
+polled from e.g. the render loop without blocking, or calls a completion
+callback on the worker thread:
+@code
+Trade::AsyncImporter::Request<Trade::ImageData2D> diffuse = importer.image2D("diffuse.tga", 0, 10);
+
+// ...
+
+if(diffuse.result.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+    std::optional<Trade::ImageData2D> image = diffuse.result.get();
+    // ...
+}
+@endcode
+
+Pending requests are processed in order of decreasing priority, requests with
+the same priority in the order in which they were scheduled. A worker keeps
+the file opened after processing a request and reuses it if the next request
+is for the same file. A request which wasn't started yet can be cancelled
+with @ref cancel(), the request then completes with `std::nullopt` and the
+completion callback, if any, is not called. If the file can't be opened or
+the import fails, the request also completes with `std::nullopt`. Errors are
+printed by the importer itself.
+
+Because the worker reopens its importer whenever the next request is for a
+different file and closes it on destruction, the returned data must not
+depend on the importer staying alive. That's the case for all importers
+shipped with Magnum, as they either copy the data or, as with
+@ref MeshCacheImporter, the returned data hold a reference to the file mapping.
+Importers returning views on their internal state can't be used with this
+class.
+
+Destructing the instance cancels all pending requests and waits for requests
+which are being processed.
+*/
+class MAGNUM_EXPORT AsyncImporter {
+    public:
+        /**
+         * @brief Importer factory
+         *
+         * Returns new importer instance.
+         */
+        typedef std::function<std::unique_ptr<AbstractImporter>()> Factory;
+
+        /**
+         * @brief Scheduled request
+         *
+         * @see @ref mesh2D(), @ref mesh3D(), @ref image1D(), @ref image2D(),
+         *      @ref image3D()
+         */
+        template<class T> struct Request {
+            /** @brief Request ID, to be passed to @ref cancel() */
+            UnsignedLong id;
+
+            /** @brief Import result */
+            std::future<std::optional<T>> result;
+        };
+
+        /**
+         * @brief Constructor
+         * @param factory       Importer factory
+         * @param threadCount   Worker thread count. If set to `0`, hardware
+         *      concurrency is used.
+         *
+         * The factory is called once for each worker thread and is expected
+         * to return non-null importer instance.
+         */
+        explicit AsyncImporter(Factory factory, std::size_t threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        AsyncImporter(const AsyncImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncImporter(AsyncImporter&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Cancels all pending requests and waits until requests which are
+         * being processed are finished.
+         */
+        ~AsyncImporter();
+
+        /** @brief Copying is not allowed */
+        AsyncImporter& operator=(const AsyncImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncImporter& operator=(AsyncImporter&&) = delete;
+
+        /** @brief Worker thread count */
+        std::size_t threadCount() const { return _threads.size(); }
+
+        /**
+         * @brief Count of requests which weren't started yet
+         *
+         * @see @ref wait()
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Import 2D mesh
+         * @param filename  File to import from
+         * @param id        Mesh ID
+         * @param priority  Request priority, requests with higher priority
+         *      are processed first
+         *
+         * @see @ref AbstractImporter::mesh2D()
+         */
+        Request<MeshData2D> mesh2D(const std::string& filename, UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Import 2D mesh with completion callback
+         *
+         * The callback is called on the worker thread. Returns ID of the
+         * request.
+         * @see @ref AbstractImporter::mesh2D()
+         */
+        UnsignedLong mesh2D(const std::string& filename, UnsignedInt id, std::function<void(std::optional<MeshData2D>)> callback, Int priority = 0);
+
+        /**
+         * @brief Import 3D mesh
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, Int) for more
+         * information.
+         * @see @ref AbstractImporter::mesh3D()
+         */
+        Request<MeshData3D> mesh3D(const std::string& filename, UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Import 3D mesh with completion callback
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, std::function<void(std::optional<MeshData2D>)>, Int)
+         * for more information.
+         * @see @ref AbstractImporter::mesh3D()
+         */
+        UnsignedLong mesh3D(const std::string& filename, UnsignedInt id, std::function<void(std::optional<MeshData3D>)> callback, Int priority = 0);
+
+        /**
+         * @brief Import 1D image
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, Int) for more
+         * information.
+         * @see @ref AbstractImporter::image1D()
+         */
+        Request<ImageData1D> image1D(const std::string& filename, UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Import 1D image with completion callback
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, std::function<void(std::optional<MeshData2D>)>, Int)
+         * for more information.
+         * @see @ref AbstractImporter::image1D()
+         */
+        UnsignedLong image1D(const std::string& filename, UnsignedInt id, std::function<void(std::optional<ImageData1D>)> callback, Int priority = 0);
+
+        /**
+         * @brief Import 2D image
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, Int) for more
+         * information.
+         * @see @ref AbstractImporter::image2D()
+         */
+        Request<ImageData2D> image2D(const std::string& filename, UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Import 2D image with completion callback
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, std::function<void(std::optional<MeshData2D>)>, Int)
+         * for more information.
+         * @see @ref AbstractImporter::image2D()
+         */
+        UnsignedLong image2D(const std::string& filename, UnsignedInt id, std::function<void(std::optional<ImageData2D>)> callback, Int priority = 0);
+
+        /**
+         * @brief Import 3D image
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, Int) for more
+         * information.
+         * @see @ref AbstractImporter::image3D()
+         */
+        Request<ImageData3D> image3D(const std::string& filename, UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Import 3D image with completion callback
+         *
+         * See @ref mesh2D(const std::string&, UnsignedInt, std::function<void(std::optional<MeshData2D>)>, Int)
+         * for more information.
+         * @see @ref AbstractImporter::image3D()
+         */
+        UnsignedLong image3D(const std::string& filename, UnsignedInt id, std::function<void(std::optional<ImageData3D>)> callback, Int priority = 0);
+
+        /**
+         * @brief Cancel a request
+         *
+         * If the request wasn't started yet, it is removed from the queue,
+         * its result is set to `std::nullopt` and `true` is returned.
+         * Returns `false` if the request is already being processed or was
+         * finished.
+         * @see @ref cancelAll()
+         */
+        bool cancel(UnsignedLong request);
+
+        /**
+         * @brief Cancel all pending requests
+         *
+         * Returns count of cancelled requests.
+         * @see @ref cancel()
+         */
+        std::size_t cancelAll();
+
+        /**
+         * @brief Wait until all requests are finished
+         *
+         * @see @ref pendingCount()
+         */
+        void wait();
+
+    private:
+        /* Called with null importer if the file can't be opened or the
+           request is cancelled, the second parameter is set in the latter
+           case */
+        typedef std::function<void(AbstractImporter*, bool)> Job;
+
+        struct Pending {
+            std::string filename;
+            Job job;
+        };
+
+        /* Ordered by descending priority, then by ascending request ID */
+        struct Order {
+            bool operator()(const std::pair<Int, UnsignedLong>& a, const std::pair<Int, UnsignedLong>& b) const {
+                return a.first != b.first ? a.first > b.first : a.second < b.second;
+            }
+        };
+
+        template<class T> Request<T> scheduleFuture(const std::string& filename, std::optional<T>(AbstractImporter::*function)(UnsignedInt), UnsignedInt id, Int priority);
+        template<class T> UnsignedLong scheduleCallback(const std::string& filename, std::optional<T>(AbstractImporter::*function)(UnsignedInt), UnsignedInt id, std::function<void(std::optional<T>)> callback, Int priority);
+        UnsignedLong schedule(const std::string& filename, Int priority, Job job);
+        void work(AbstractImporter& importer);
+
+        mutable std::mutex _mutex;
+        std::condition_variable _pendingCondition, _idleCondition;
+        std::map<std::pair<Int, UnsignedLong>, Pending, Order> _pending;
+        std::unordered_map<UnsignedLong, Int> _pendingPriorities;
+        UnsignedLong _nextId;
+        std::size_t _runningCount;
+        bool _stopping;
+
+        std::vector<std::unique_ptr<AbstractImporter>> _importers;
+        std::vector<std::thread> _threads;
+};
+
+}}
+
+#endif
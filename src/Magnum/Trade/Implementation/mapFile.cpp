@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "mapFile.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_NACL) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <Corrade/Utility/Directory.h>
+#endif
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+namespace {
+    #ifdef MAGNUM_USE_MMAP
+    void unmap(char* const data, const std::size_t size) {
+        munmap(data, size);
+    }
+    #endif
+
+    /* Array deleters are plain function pointers, so the reference counts
+       are looked up by data pointer in a global registry */
+    struct SharedData {
+        Containers::Array<char> data;
+        std::size_t references;
+    };
+
+    std::mutex& sharedMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::unordered_map<const char*, SharedData>& sharedRegistry() {
+        static std::unordered_map<const char*, SharedData> registry;
+        return registry;
+    }
+
+    void releaseShared(char* const data, std::size_t) {
+        Containers::Array<char> released;
+        {
+            std::lock_guard<std::mutex> lock{sharedMutex()};
+            auto found = sharedRegistry().find(data);
+            CORRADE_INTERNAL_ASSERT(found != sharedRegistry().end());
+            if(--found->second.references) return;
+            released = std::move(found->second.data);
+            sharedRegistry().erase(found);
+        }
+
+        /* The memory is released outside of the lock */
+    }
+}
+
+std::optional<Containers::Array<char>> mapFile(const std::string& filename, const char* const prefix) {
+    #ifdef MAGNUM_USE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd == -1) {
+        Error() << prefix << "cannot open file" << filename;
+        return std::nullopt;
+    }
+
+    /* Mapping empty file fails, return empty array and let the caller fail
+       on the contents instead */
+    struct stat info;
+    void* mapped = nullptr;
+    if(fstat(fd, &info) == 0 && info.st_size != 0)
+        mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    /* The mapping stays valid after closing the descriptor */
+    ::close(fd);
+
+    if(mapped == MAP_FAILED) {
+        Error() << prefix << "cannot map file" << filename;
+        return std::nullopt;
+    }
+
+    return Containers::Array<char>{static_cast<char*>(mapped), mapped ? std::size_t(info.st_size) : 0, mapped ? unmap : nullptr};
+    #else
+    if(!Utility::Directory::fileExists(filename)) {
+        Error() << prefix << "cannot open file" << filename;
+        return std::nullopt;
+    }
+
+    return Utility::Directory::read(filename);
+    #endif
+}
+
+Containers::Array<char> makeShared(Containers::Array<char>&& data) {
+    if(!data) return std::move(data);
+
+    char* const pointer = data.data();
+    const std::size_t size = data.size();
+    {
+        std::lock_guard<std::mutex> lock{sharedMutex()};
+        sharedRegistry().emplace(pointer, SharedData{std::move(data), 1});
+    }
+
+    return Containers::Array<char>{pointer, size, releaseShared};
+}
+
+Containers::Array<char> shareData(Containers::Array<char>& shared, const std::size_t size) {
+    CORRADE_INTERNAL_ASSERT(size <= shared.size());
+    if(!shared) return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock{sharedMutex()};
+        auto found = sharedRegistry().find(shared.data());
+        CORRADE_INTERNAL_ASSERT(found != sharedRegistry().end());
+        ++found->second.references;
+    }
+
+    return Containers::Array<char>{shared.data(), size, releaseShared};
+}
+
+}}}
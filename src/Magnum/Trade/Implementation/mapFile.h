@@ -0,0 +1,56 @@
+#ifndef Magnum_Trade_Implementation_mapFile_h
+#define Magnum_Trade_Implementation_mapFile_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Maps the file read-only into memory on Unix, the returned array unmaps it
+   on destruction. Reads the whole file into memory on other platforms. On
+   failure prints a message prefixed with given function name and returns
+   std::nullopt. */
+MAGNUM_EXPORT std::optional<Containers::Array<char>> mapFile(const std::string& filename, const char* prefix);
+
+/* Moves the data into reference-counted storage and returns an array
+   referencing them. More references can be made with shareData(), the memory
+   is released (e.g. the file unmapped) only after all arrays referencing it
+   are destroyed. Empty array is returned unchanged. Thread-safe. */
+MAGNUM_EXPORT Containers::Array<char> makeShared(Containers::Array<char>&& data);
+
+/* Returns another reference to first size bytes of data returned from
+   makeShared(). The returned array keeps the whole memory alive, independently
+   of the array passed in. Thread-safe. */
+MAGNUM_EXPORT Containers::Array<char> shareData(Containers::Array<char>& shared, std::size_t size);
+
+}}}
+
+#endif
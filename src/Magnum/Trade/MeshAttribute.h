@@ -0,0 +1,78 @@
+#ifndef Magnum_Trade_MeshAttribute_h
+#define Magnum_Trade_MeshAttribute_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshAttribute, enum @ref Magnum::Trade::MeshAttributeName
+ */
+
+#include <cstddef>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh attribute name
+
+@see @ref MeshAttribute
+*/
+enum class MeshAttributeName: UnsignedByte {
+    /**
+     * Position. @ref Vector2 in @ref MeshData2D, @ref Vector3 in
+     * @ref MeshData3D.
+     */
+    Position,
+
+    /** Normal, @ref Vector3. Available only in @ref MeshData3D. */
+    Normal,
+
+    /** Two-dimensional texture coordinates, @ref Vector2 */
+    TextureCoords2D
+};
+
+/**
+@brief Location of vertex attribute array in contiguous mesh data
+
+Describes one attribute array in data passed to
+@ref MeshData2D::MeshData2D(MeshPrimitive, Containers::Array<char>, std::size_t, UnsignedInt, UnsignedInt, std::vector<MeshAttribute>)
+or @ref MeshData3D::MeshData3D(MeshPrimitive, Containers::Array<char>, std::size_t, UnsignedInt, UnsignedInt, std::vector<MeshAttribute>).
+Attribute arrays with the same name are numbered in the order in which they
+appear.
+*/
+struct MeshAttribute {
+    MeshAttributeName name; /**< @brief Attribute name */
+    std::size_t offset;     /**< @brief Offset of first item in the data */
+    std::size_t stride;     /**< @brief Distance between two items in bytes */
+};
+
+/** @debugoperatorenum{Magnum::Trade::MeshAttributeName} */
+Debug MAGNUM_EXPORT operator<<(Debug debug, MeshAttributeName value);
+
+}}
+
+#endif
@@ -29,10 +29,15 @@
  * @brief Class @ref Magnum::Trade::MeshData2D
  */
 
+#include <atomic>
+#include <mutex>
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
+#include "Magnum/Trade/MeshAttribute.h"
+#include "Magnum/Trade/StridedArrayView.h"
 
 namespace Magnum { namespace Trade {
 
@@ -41,6 +46,27 @@ namespace Magnum { namespace Trade {
 
 Provides access to mesh data and additional information, such as primitive
 type.
+
+@section Trade-MeshData2D-storage Data storage
+
+The data can be either stored in separate arrays, one for indices and one for
+each attribute array, or in a single contiguous buffer, described by a list of
+@ref MeshAttribute entries. The latter needs just one allocation for all mesh
+data, the buffer can be also externally owned (e.g. a memory-mapped file) if
+the @ref Corrade::Containers::Array "Containers::Array" is created with a
+custom deleter.
+
+The @ref indicesView(), @ref positionsView() and @ref textureCoords2DView()
+accessors return typed strided views and work with
+both storage types without copying anything. The `std::vector` accessors
+(@ref indices(), @ref positions(), @ref textureCoords2D())
+are available also for contiguous storage, but the first call to any of them
+copies all data into separate arrays. The views returned after that point
+reference the separate arrays, views obtained earlier still reference the
+original buffer and aren't affected by any changes done through the
+`std::vector` accessors. The copy is done lazily also for `const` instances,
+it is guarded by a mutex so reading the same `const` instance from multiple
+threads is safe.
 @see @ref MeshData3D
 */
 class MAGNUM_EXPORT MeshData2D {
@@ -57,6 +83,27 @@ class MAGNUM_EXPORT MeshData2D {
          */
         explicit MeshData2D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector2>> positions, std::vector<std::vector<Vector2>> textureCoords2D);
 
+        /**
+         * @brief Construct from contiguous data
+         * @param primitive         Primitive
+         * @param data              Data containing indices and all
+         *      attribute arrays
+         * @param indexOffset       Offset of @ref UnsignedInt index array in
+         *      @p data
+         * @param indexCount        Index count or `0`, if the mesh is not
+         *      indexed
+         * @param vertexCount       Item count in each attribute array
+         * @param attributes        Location of attribute arrays in @p data.
+         *      At least one @ref MeshAttributeName::Position array should be
+         *      present, all arrays are @ref Vector2.
+         *      @ref MeshAttributeName::Normal arrays are not allowed.
+         *
+         * All arrays are expected to fit into @p data and be suitably
+         * aligned.
+         * @see @ref Trade-MeshData2D-storage
+         */
+        explicit MeshData2D(MeshPrimitive primitive, Containers::Array<char> data, std::size_t indexOffset, UnsignedInt indexCount, UnsignedInt vertexCount, std::vector<MeshAttribute> attributes);
+
         /** @brief Copying is not allowed */
         MeshData2D(const MeshData2D&) = delete;
 
@@ -74,53 +121,116 @@ class MAGNUM_EXPORT MeshData2D {
         /** @brief Primitive */
         MeshPrimitive primitive() const { return _primitive; }
 
+        /**
+         * @brief Whether the data are stored contiguously
+         *
+         * Returns `false` if the mesh was constructed from separate arrays or
+         * if any of the `std::vector` accessors was called.
+         * @see @ref Trade-MeshData2D-storage
+         */
+        bool isContiguous() const { return _contiguous; }
+
+        /**
+         * @brief Contiguous data
+         *
+         * Empty if the mesh was constructed from separate arrays.
+         * @see @ref isContiguous()
+         */
+        Containers::ArrayView<const char> data() const { return _data; }
+
         /** @brief Whether the mesh is indexed */
-        bool isIndexed() const { return !_indices.empty(); }
+        bool isIndexed() const { return _contiguous ? _indexCount != 0 : !_indices.empty(); }
 
         /**
          * @brief Indices
          *
-         * @see @ref isIndexed()
+         * @see @ref isIndexed(), @ref indicesView(),
+         *      @ref Trade-MeshData2D-storage
          */
         std::vector<UnsignedInt>& indices();
         const std::vector<UnsignedInt>& indices() const; /**< @overload */
 
+        /**
+         * @brief View on indices
+         *
+         * Doesn't copy contiguous data into separate arrays.
+         * @see @ref isIndexed(), @ref indices()
+         */
+        StridedArrayView<UnsignedInt> indicesView() const;
+
         /**
          * @brief Count of position arrays
          *
          * There is always at least one.
          */
-        UnsignedInt positionArrayCount() const { return _positions.size(); }
+        UnsignedInt positionArrayCount() const { return _positionArrayCount; }
 
         /**
          * @brief Positions
          * @param id    Position array ID
          *
-         * @see @ref positionArrayCount()
+         * @see @ref positionArrayCount(), @ref positionsView(),
+         *      @ref Trade-MeshData2D-storage
          */
         std::vector<Vector2>& positions(UnsignedInt id);
         const std::vector<Vector2>& positions(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief View on positions
+         * @param id    Position array ID
+         *
+         * Doesn't copy contiguous data into separate arrays.
+         * @see @ref positionArrayCount(), @ref positions()
+         */
+        StridedArrayView<Vector2> positionsView(UnsignedInt id) const;
+
         /** @brief Whether the data contain any 2D texture coordinates */
-        bool hasTextureCoords2D() const { return !_textureCoords2D.empty(); }
+        bool hasTextureCoords2D() const { return _textureCoords2DArrayCount != 0; }
 
         /** @brief Count of 2D texture coordinate arrays */
-        UnsignedInt textureCoords2DArrayCount() const { return _textureCoords2D.size(); }
+        UnsignedInt textureCoords2DArrayCount() const { return _textureCoords2DArrayCount; }
 
         /**
          * @brief 2D texture coordinates
          * @param id    Texture coordinate array ID
          *
-         * @see @ref textureCoords2DArrayCount()
+         * @see @ref textureCoords2DArrayCount(), @ref textureCoords2DView(),
+         *      @ref Trade-MeshData2D-storage
          */
         std::vector<Vector2>& textureCoords2D(UnsignedInt id);
         const std::vector<Vector2>& textureCoords2D(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief View on 2D texture coordinates
+         * @param id    Texture coordinate array ID
+         *
+         * Doesn't copy contiguous data into separate arrays.
+         * @see @ref textureCoords2DArrayCount(), @ref textureCoords2D()
+         */
+        StridedArrayView<Vector2> textureCoords2DView(UnsignedInt id) const;
+
     private:
+        template<class T> StridedArrayView<T> attributeView(MeshAttributeName name, UnsignedInt id) const;
+        void separate() const;
+
         MeshPrimitive _primitive;
-        std::vector<UnsignedInt> _indices;
-        std::vector<std::vector<Vector2>> _positions;
-        std::vector<std::vector<Vector2>> _textureCoords2D;
+        UnsignedInt _positionArrayCount, _textureCoords2DArrayCount;
+
+        /* Contiguous storage */
+        Containers::Array<char> _data;
+        std::vector<MeshAttribute> _attributes;
+        std::size_t _indexOffset;
+        UnsignedInt _indexCount, _vertexCount;
+
+        /* Separate arrays, filled from the contiguous storage on first access
+           through the std::vector accessors. The flag is cleared only after
+           the arrays are filled and the mutex guards the filling, so const
+           instances can be accessed from multiple threads. */
+        mutable std::atomic<bool> _contiguous;
+        mutable std::mutex _separateMutex;
+        mutable std::vector<UnsignedInt> _indices;
+        mutable std::vector<std::vector<Vector2>> _positions;
+        mutable std::vector<std::vector<Vector2>> _textureCoords2D;
 };
 
 }}
@@ -29,54 +29,176 @@
 
 namespace Magnum { namespace Trade {
 
-MeshData3D::MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D): _primitive(primitive), _indices(std::move(indices)), _positions(std::move(positions)), _normals(std::move(normals)), _textureCoords2D(std::move(textureCoords2D)) {
+MeshData3D::MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D): _primitive(primitive), _positionArrayCount(positions.size()), _normalArrayCount(normals.size()), _textureCoords2DArrayCount(textureCoords2D.size()), _indexOffset(0), _indexCount(0), _vertexCount(0), _contiguous(false), _indices(std::move(indices)), _positions(std::move(positions)), _normals(std::move(normals)), _textureCoords2D(std::move(textureCoords2D)) {
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
 }
 
-MeshData3D::MeshData3D(MeshData3D&&) = default;
+MeshData3D::MeshData3D(MeshPrimitive primitive, Containers::Array<char> data, const std::size_t indexOffset, const UnsignedInt indexCount, const UnsignedInt vertexCount, std::vector<MeshAttribute> attributes): _primitive(primitive), _positionArrayCount(0), _normalArrayCount(0), _textureCoords2DArrayCount(0), _data(std::move(data)), _attributes(std::move(attributes)), _indexOffset(indexOffset), _indexCount(indexCount), _vertexCount(vertexCount), _contiguous(true) {
+    CORRADE_ASSERT(!indexCount || indexOffset + indexCount*sizeof(UnsignedInt) <= _data.size(),
+        "Trade::MeshData3D: index array out of bounds", );
+
+    for(const MeshAttribute& attribute: _attributes) {
+        std::size_t size = 0;
+        switch(attribute.name) {
+            case MeshAttributeName::Position:
+                ++_positionArrayCount;
+                size = sizeof(Vector3);
+                break;
+            case MeshAttributeName::Normal:
+                ++_normalArrayCount;
+                size = sizeof(Vector3);
+                break;
+            case MeshAttributeName::TextureCoords2D:
+                ++_textureCoords2DArrayCount;
+                size = sizeof(Vector2);
+                break;
+        }
+
+        CORRADE_ASSERT(!vertexCount || attribute.offset + (vertexCount - 1)*attribute.stride + size <= _data.size(),
+            "Trade::MeshData3D:" << attribute.name << "array out of bounds", );
+        static_cast<void>(size);
+    }
+
+    CORRADE_ASSERT(_positionArrayCount, "Trade::MeshData3D: no position array specified", );
+}
+
+MeshData3D::MeshData3D(MeshData3D&& other): _primitive(other._primitive), _positionArrayCount(other._positionArrayCount), _normalArrayCount(other._normalArrayCount), _textureCoords2DArrayCount(other._textureCoords2DArrayCount), _data(std::move(other._data)), _attributes(std::move(other._attributes)), _indexOffset(other._indexOffset), _indexCount(other._indexCount), _vertexCount(other._vertexCount), _contiguous(other._contiguous.load()), _indices(std::move(other._indices)), _positions(std::move(other._positions)), _normals(std::move(other._normals)), _textureCoords2D(std::move(other._textureCoords2D)) {}
 
 MeshData3D::~MeshData3D() = default;
 
-MeshData3D& MeshData3D::operator=(MeshData3D&&) = default;
+MeshData3D& MeshData3D::operator=(MeshData3D&& other) {
+    using std::swap;
+    swap(_primitive, other._primitive);
+    swap(_positionArrayCount, other._positionArrayCount);
+    swap(_normalArrayCount, other._normalArrayCount);
+    swap(_textureCoords2DArrayCount, other._textureCoords2DArrayCount);
+    swap(_data, other._data);
+    swap(_attributes, other._attributes);
+    swap(_indexOffset, other._indexOffset);
+    swap(_indexCount, other._indexCount);
+    swap(_vertexCount, other._vertexCount);
+    _contiguous = other._contiguous.exchange(_contiguous);
+    swap(_indices, other._indices);
+    swap(_positions, other._positions);
+    swap(_normals, other._normals);
+    swap(_textureCoords2D, other._textureCoords2D);
+    return *this;
+}
+
+template<class T> StridedArrayView<T> MeshData3D::attributeView(const MeshAttributeName name, UnsignedInt id) const {
+    for(const MeshAttribute& attribute: _attributes)
+        if(attribute.name == name && !id--)
+            return StridedArrayView<T>{_data.data() + attribute.offset, _vertexCount, attribute.stride};
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+void MeshData3D::separate() const {
+    /* Checking the flag again under the lock, as some other thread might
+       have separated the data in the meantime */
+    if(!_contiguous.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock{_separateMutex};
+    if(!_contiguous.load(std::memory_order_relaxed)) return;
+
+    if(_indexCount) {
+        const StridedArrayView<UnsignedInt> indices = indicesView();
+        _indices.assign(indices.begin(), indices.end());
+    }
+
+    _positions.reserve(_positionArrayCount);
+    _normals.reserve(_normalArrayCount);
+    _textureCoords2D.reserve(_textureCoords2DArrayCount);
+    for(const MeshAttribute& attribute: _attributes) {
+        const char* const data = _data.data() + attribute.offset;
+        switch(attribute.name) {
+            case MeshAttributeName::Position: {
+                const StridedArrayView<Vector3> view{data, _vertexCount, attribute.stride};
+                _positions.emplace_back(view.begin(), view.end());
+            } break;
+            case MeshAttributeName::Normal: {
+                const StridedArrayView<Vector3> view{data, _vertexCount, attribute.stride};
+                _normals.emplace_back(view.begin(), view.end());
+            } break;
+            case MeshAttributeName::TextureCoords2D: {
+                const StridedArrayView<Vector2> view{data, _vertexCount, attribute.stride};
+                _textureCoords2D.emplace_back(view.begin(), view.end());
+            } break;
+        }
+    }
+
+    _contiguous.store(false, std::memory_order_release);
+}
 
 std::vector<UnsignedInt>& MeshData3D::indices() {
     CORRADE_ASSERT(isIndexed(), "Trade::MeshData3D::indices(): the mesh is not indexed", _indices);
+    separate();
     return _indices;
 }
 
 const std::vector<UnsignedInt>& MeshData3D::indices() const {
     CORRADE_ASSERT(isIndexed(), "Trade::MeshData3D::indices(): the mesh is not indexed", _indices);
+    separate();
     return _indices;
 }
 
+StridedArrayView<UnsignedInt> MeshData3D::indicesView() const {
+    CORRADE_ASSERT(isIndexed(), "Trade::MeshData3D::indicesView(): the mesh is not indexed", {});
+    if(_contiguous) return StridedArrayView<UnsignedInt>{_data.data() + _indexOffset, _indexCount, sizeof(UnsignedInt)};
+    return Containers::ArrayView<const UnsignedInt>{_indices.data(), _indices.size()};
+}
+
 std::vector<Vector3>& MeshData3D::positions(const UnsignedInt id) {
     CORRADE_ASSERT(id < positionArrayCount(), "Trade::MeshData3D::positions(): index out of range", _positions[id]);
+    separate();
     return _positions[id];
 }
 
 const std::vector<Vector3>& MeshData3D::positions(const UnsignedInt id) const {
     CORRADE_ASSERT(id < positionArrayCount(), "Trade::MeshData3D::positions(): index out of range", _positions[id]);
+    separate();
     return _positions[id];
 }
 
+StridedArrayView<Vector3> MeshData3D::positionsView(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < positionArrayCount(), "Trade::MeshData3D::positionsView(): index out of range", {});
+    if(_contiguous) return attributeView<Vector3>(MeshAttributeName::Position, id);
+    return Containers::ArrayView<const Vector3>{_positions[id].data(), _positions[id].size()};
+}
+
 std::vector<Vector3>& MeshData3D::normals(const UnsignedInt id) {
     CORRADE_ASSERT(id < normalArrayCount(), "Trade::MeshData3D::normals(): index out of range", _normals[id]);
+    separate();
     return _normals[id];
 }
 
 const std::vector<Vector3>& MeshData3D::normals(const UnsignedInt id) const {
     CORRADE_ASSERT(id < normalArrayCount(), "Trade::MeshData3D::normals(): index out of range", _normals[id]);
+    separate();
     return _normals[id];
 }
 
+StridedArrayView<Vector3> MeshData3D::normalsView(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < normalArrayCount(), "Trade::MeshData3D::normalsView(): index out of range", {});
+    if(_contiguous) return attributeView<Vector3>(MeshAttributeName::Normal, id);
+    return Containers::ArrayView<const Vector3>{_normals[id].data(), _normals[id].size()};
+}
+
 std::vector<Vector2>& MeshData3D::textureCoords2D(const UnsignedInt id) {
     CORRADE_ASSERT(id < textureCoords2DArrayCount(), "Trade::MeshData3D::textureCoords2D(): index out of range", _textureCoords2D[id]);
+    separate();
     return _textureCoords2D[id];
 }
 
 const std::vector<Vector2>& MeshData3D::textureCoords2D(const UnsignedInt id) const {
     CORRADE_ASSERT(id < textureCoords2DArrayCount(), "Trade::MeshData3D::textureCoords2D(): index out of range", _textureCoords2D[id]);
+    separate();
     return _textureCoords2D[id];
 }
 
+StridedArrayView<Vector2> MeshData3D::textureCoords2DView(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < textureCoords2DArrayCount(), "Trade::MeshData3D::textureCoords2DView(): index out of range", {});
+    if(_contiguous) return attributeView<Vector2>(MeshAttributeName::TextureCoords2D, id);
+    return Containers::ArrayView<const Vector2>{_textureCoords2D[id].data(), _textureCoords2D[id].size()};
+}
+
 }}
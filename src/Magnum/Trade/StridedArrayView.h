@@ -0,0 +1,176 @@
+#ifndef Magnum_Trade_StridedArrayView_h
+#define Magnum_Trade_StridedArrayView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::StridedArrayView
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Typed view on strided data
+@tparam T   Element type
+
+Non-owning read-only view on @p size items of type @p T placed @p stride
+bytes apart in memory, such as one vertex attribute in interleaved or
+otherwise contiguous mesh data. The data are expected to be suitably aligned
+for @p T.
+@see @ref MeshData2D, @ref MeshData3D
+*/
+template<class T> class StridedArrayView {
+    public:
+        class Iterator;
+
+        /** @brief Default constructor, creates empty view */
+        constexpr /*implicit*/ StridedArrayView() noexcept: _data{}, _size{}, _stride{sizeof(T)} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to first item
+         * @param size      Item count
+         * @param stride    Distance between two consecutive items in bytes
+         */
+        constexpr explicit StridedArrayView(const void* data, std::size_t size, std::size_t stride) noexcept: _data{static_cast<const char*>(data)}, _size{size}, _stride{stride} {}
+
+        /** @brief Construct view on tightly packed array */
+        constexpr /*implicit*/ StridedArrayView(Containers::ArrayView<const T> view) noexcept: _data{reinterpret_cast<const char*>(view.data())}, _size{view.size()}, _stride{sizeof(T)} {}
+
+        /** @brief Pointer to first item */
+        const void* data() const { return _data; }
+
+        /** @brief Item count */
+        std::size_t size() const { return _size; }
+
+        /** @brief Distance between two consecutive items in bytes */
+        std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the view is empty */
+        bool empty() const { return !_size; }
+
+        /** @brief Item access */
+        const T& operator[](std::size_t i) const {
+            CORRADE_ASSERT(i < _size, "Trade::StridedArrayView::operator[](): index" << i << "out of range for" << _size << "items", *reinterpret_cast<const T*>(_data));
+            return *reinterpret_cast<const T*>(_data + i*_stride);
+        }
+
+        /** @brief Iterator to first item */
+        Iterator begin() const { return Iterator{_data, _stride}; }
+
+        /** @brief Iterator after last item */
+        Iterator end() const { return Iterator{_data + _size*_stride, _stride}; }
+
+    private:
+        const char* _data;
+        std::size_t _size, _stride;
+};
+
+/**
+@brief Random access iterator for @ref StridedArrayView
+
+Makes it possible to use the view in range-based for loops and to construct
+standard containers from it.
+*/
+template<class T> class StridedArrayView<T>::Iterator {
+    friend StridedArrayView<T>;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;  /**< @brief Iterator category */
+        typedef T value_type;                   /**< @brief Value type */
+        typedef std::ptrdiff_t difference_type; /**< @brief Difference type */
+        typedef const T* pointer;               /**< @brief Pointer type */
+        typedef const T& reference;             /**< @brief Reference type */
+
+        /** @brief Default constructor */
+        constexpr /*implicit*/ Iterator() noexcept: _data{}, _stride{sizeof(T)} {}
+
+        /** @brief Dereference */
+        const T& operator*() const { return *reinterpret_cast<const T*>(_data); }
+
+        /** @brief Member access */
+        const T* operator->() const { return reinterpret_cast<const T*>(_data); }
+
+        /** @brief Item at given offset */
+        const T& operator[](std::ptrdiff_t i) const { return *reinterpret_cast<const T*>(_data + i*std::ptrdiff_t(_stride)); }
+
+        /** @brief Advance to next item */
+        Iterator& operator++() { _data += _stride; return *this; }
+        Iterator operator++(int) { Iterator i = *this; _data += _stride; return i; } /**< @overload */
+
+        /** @brief Go back to previous item */
+        Iterator& operator--() { _data -= _stride; return *this; }
+        Iterator operator--(int) { Iterator i = *this; _data -= _stride; return i; } /**< @overload */
+
+        /** @brief Advance by given count of items */
+        Iterator& operator+=(std::ptrdiff_t i) { _data += i*std::ptrdiff_t(_stride); return *this; }
+
+        /** @brief Go back by given count of items */
+        Iterator& operator-=(std::ptrdiff_t i) { _data -= i*std::ptrdiff_t(_stride); return *this; }
+
+        /** @brief Iterator advanced by given count of items */
+        Iterator operator+(std::ptrdiff_t i) const { return Iterator{*this} += i; }
+
+        /** @brief Iterator moved back by given count of items */
+        Iterator operator-(std::ptrdiff_t i) const { return Iterator{*this} -= i; }
+
+        /** @brief Count of items between two iterators */
+        std::ptrdiff_t operator-(const Iterator& other) const { return (_data - other._data)/std::ptrdiff_t(_stride); }
+
+        /** @brief Equality comparison */
+        bool operator==(const Iterator& other) const { return _data == other._data; }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Iterator& other) const { return _data != other._data; }
+
+        /** @brief Less than comparison */
+        bool operator<(const Iterator& other) const { return _data < other._data; }
+
+        /** @brief Greater than comparison */
+        bool operator>(const Iterator& other) const { return _data > other._data; }
+
+        /** @brief Less than or equal comparison */
+        bool operator<=(const Iterator& other) const { return _data <= other._data; }
+
+        /** @brief Greater than or equal comparison */
+        bool operator>=(const Iterator& other) const { return _data >= other._data; }
+
+    private:
+        constexpr explicit Iterator(const char* data, std::size_t stride) noexcept: _data{data}, _stride{stride} {}
+
+        const char* _data;
+        std::size_t _stride;
+};
+
+}}
+
+#endif
@@ -23,11 +23,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
 
 #include "configure.h"
 
@@ -38,10 +42,16 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void image2DSize();
+        void image2DRegion();
+        void image2DRegionOutOfBounds();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::image2DSize,
+              &AbstractImporterTest::image2DRegion,
+              &AbstractImporterTest::image2DRegionOutOfBounds});
 }
 
 void AbstractImporterTest::openFile() {
@@ -68,6 +78,58 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+namespace {
+
+class ImageImporter: public Trade::AbstractImporter {
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        std::optional<ImageData2D> doImage2D(UnsignedInt) override {
+            /* 3x2 RGB image, rows are aligned to four bytes */
+            char* const data = new char[24]{
+                1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0,
+                10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 0, 0
+            };
+            return ImageData2D{ColorFormat::RGB, ColorType::UnsignedByte, {3, 2}, data};
+        }
+};
+
+}
+
+void AbstractImporterTest::image2DSize() {
+    /* Default implementation imports the whole image */
+    ImageImporter importer;
+    std::optional<Vector2i> size = importer.image2DSize(0);
+    CORRADE_VERIFY(size);
+    CORRADE_COMPARE(*size, Vector2i(3, 2));
+}
+
+void AbstractImporterTest::image2DRegion() {
+    /* Default implementation copies the region out of whole image */
+    ImageImporter importer;
+    std::optional<ImageData2D> image = importer.image2D(0, {{1, 0}, {3, 2}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 2));
+    CORRADE_COMPARE((std::string{image->data(), 6}),
+                    (std::string{"\x04\x05\x06\x07\x08\x09", 6}));
+    CORRADE_COMPARE((std::string{image->data() + 8, 6}),
+                    (std::string{"\x0d\x0e\x0f\x10\x11\x12", 6}));
+}
+
+void AbstractImporterTest::image2DRegionOutOfBounds() {
+    ImageImporter importer;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!importer.image2D(0, {{1, 1}, {3, 3}}));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2D(): region Range({1, 1}, {3, 3}) is not contained in image of size Vector(3, 2)\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
@@ -0,0 +1,75 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/FileToString.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AbstractMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit AbstractMeshConverterTest();
+
+        void exportToFile();
+};
+
+AbstractMeshConverterTest::AbstractMeshConverterTest() {
+    addTests({&AbstractMeshConverterTest::exportToFile});
+}
+
+void AbstractMeshConverterTest::exportToFile() {
+    class DataExporter: public Trade::AbstractMeshConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData; }
+
+            Containers::Array<char> doExportToData(const MeshData3D& mesh) const override {
+                return Containers::Array<char>::from(char(mesh.indices().size()), char(mesh.positions(0).size()));
+            };
+    };
+
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh.out"));
+
+    /* doExportToFile() should call doExportToData() */
+    DataExporter exporter;
+    const MeshData3D mesh{MeshPrimitive::Points, std::vector<UnsignedInt>(0xfe), {std::vector<Vector3>(0xed)}, {}, {}};
+    CORRADE_VERIFY(exporter.exportToFile(mesh, Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh.out")));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh.out"),
+        "\xFE\xED", TestSuite::Compare::FileToString);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractMeshConverterTest)
@@ -0,0 +1,314 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AsyncImporterTest: public TestSuite::Tester {
+    public:
+        explicit AsyncImporterTest();
+
+        void construct();
+        void future();
+        void callback();
+        void openFailed();
+        void priority();
+        void cancel();
+        void cancelAll();
+        void destructPending();
+        void reuseOpenedFile();
+};
+
+AsyncImporterTest::AsyncImporterTest() {
+    addTests({&AsyncImporterTest::construct,
+              &AsyncImporterTest::future,
+              &AsyncImporterTest::callback,
+              &AsyncImporterTest::openFailed,
+              &AsyncImporterTest::priority,
+              &AsyncImporterTest::cancel,
+              &AsyncImporterTest::cancelAll,
+              &AsyncImporterTest::destructPending,
+              &AsyncImporterTest::reuseOpenedFile});
+}
+
+namespace {
+
+/* State shared by all importer instances */
+struct State {
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    /* Importing blocks while this is set */
+    bool blocked{};
+
+    /* Set once importing blocks */
+    bool started{};
+
+    std::atomic<std::size_t> openCount{};
+
+    void block() {
+        std::lock_guard<std::mutex> lock{mutex};
+        blocked = true;
+        started = false;
+    }
+
+    void waitUntilStarted() {
+        std::unique_lock<std::mutex> lock{mutex};
+        condition.wait(lock, [this]() { return started; });
+    }
+
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            blocked = false;
+        }
+        condition.notify_all();
+    }
+};
+
+/* Opens files named "a" to "z", each having 100 meshes with single position
+   encoding file name and mesh ID */
+class Importer: public AbstractImporter {
+    public:
+        explicit Importer(State& state): _state(state), _opened{} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = 0; }
+
+        void doOpenFile(const std::string& filename) override {
+            ++_state.openCount;
+            if(filename.size() == 1 && filename[0] >= 'a' && filename[0] <= 'z')
+                _opened = filename[0];
+        }
+
+        UnsignedInt doMesh3DCount() const override { return 100; }
+
+        std::optional<MeshData3D> doMesh3D(UnsignedInt id) override {
+            {
+                std::unique_lock<std::mutex> lock{_state.mutex};
+                _state.started = true;
+                _state.condition.notify_all();
+                _state.condition.wait(lock, [this]() { return !_state.blocked; });
+            }
+
+            return MeshData3D{MeshPrimitive::Points, {}, {{Vector3{Float(_opened), Float(id), 0.0f}}}, {}, {}};
+        }
+
+        State& _state;
+        char _opened;
+};
+
+}
+
+void AsyncImporterTest::construct() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 3};
+    CORRADE_COMPARE(importer.threadCount(), 3);
+    CORRADE_COMPARE(importer.pendingCount(), 0);
+}
+
+void AsyncImporterTest::future() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 4};
+
+    std::vector<AsyncImporter::Request<MeshData3D>> requests;
+    for(UnsignedInt i = 0; i != 50; ++i)
+        requests.push_back(importer.mesh3D(i % 2 ? "a" : "b", i));
+
+    for(UnsignedInt i = 0; i != 50; ++i) {
+        CORRADE_COMPARE(requests[i].id, i);
+        std::optional<MeshData3D> mesh = requests[i].result.get();
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->positions(0)[0], (Vector3{Float(i % 2 ? 'a' : 'b'), Float(i), 0.0f}));
+    }
+}
+
+void AsyncImporterTest::callback() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 4};
+
+    std::atomic<UnsignedInt> sum{0};
+    std::atomic<std::size_t> count{0};
+    for(UnsignedInt i = 0; i != 50; ++i) importer.mesh3D("c", i, [&](std::optional<MeshData3D> mesh) {
+        if(!mesh) return;
+        sum += UnsignedInt(mesh->positions(0)[0].y());
+        ++count;
+    });
+
+    importer.wait();
+    CORRADE_COMPARE(importer.pendingCount(), 0);
+    CORRADE_COMPARE(count.load(), 50);
+    CORRADE_COMPARE(sum.load(), 49*50/2);
+}
+
+void AsyncImporterTest::openFailed() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 2};
+
+    AsyncImporter::Request<MeshData3D> request = importer.mesh3D("nonexistent", 0);
+    bool called = false, hasMesh = true;
+    importer.mesh3D("nonexistent", 0, [&](std::optional<MeshData3D> mesh) {
+        called = true;
+        hasMesh = bool(mesh);
+    });
+
+    CORRADE_VERIFY(!request.result.get());
+    importer.wait();
+    CORRADE_VERIFY(called);
+    CORRADE_VERIFY(!hasMesh);
+}
+
+void AsyncImporterTest::priority() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 1};
+
+    /* Block the only worker so the requests get queued */
+    state.block();
+    importer.mesh3D("a", 99);
+    state.waitUntilStarted();
+
+    std::mutex mutex;
+    std::vector<UnsignedInt> order;
+    auto record = [&](std::optional<MeshData3D> mesh) {
+        std::lock_guard<std::mutex> lock{mutex};
+        order.push_back(UnsignedInt(mesh->positions(0)[0].y()));
+    };
+    importer.mesh3D("a", 0, record, 0);
+    importer.mesh3D("a", 1, record, 5);
+    importer.mesh3D("a", 2, record, -3);
+    importer.mesh3D("a", 3, record, 5);
+    importer.mesh3D("a", 4, record, 0);
+    CORRADE_COMPARE(importer.pendingCount(), 5);
+
+    state.release();
+    importer.wait();
+    CORRADE_COMPARE(order, (std::vector<UnsignedInt>{1, 3, 0, 4, 2}));
+}
+
+void AsyncImporterTest::cancel() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 1};
+
+    state.block();
+    AsyncImporter::Request<MeshData3D> running = importer.mesh3D("a", 0);
+    state.waitUntilStarted();
+
+    AsyncImporter::Request<MeshData3D> a = importer.mesh3D("a", 1);
+    AsyncImporter::Request<MeshData3D> b = importer.mesh3D("a", 2);
+    bool called = false;
+    const UnsignedLong c = importer.mesh3D("a", 3, [&](std::optional<MeshData3D>) { called = true; });
+
+    /* Running request can't be cancelled */
+    CORRADE_VERIFY(!importer.cancel(running.id));
+    CORRADE_VERIFY(importer.cancel(b.id));
+    CORRADE_VERIFY(importer.cancel(c));
+    CORRADE_VERIFY(!importer.cancel(c));
+    CORRADE_COMPARE(importer.pendingCount(), 1);
+
+    /* Cancelled request completes immediately */
+    CORRADE_VERIFY(!b.result.get());
+
+    state.release();
+    CORRADE_VERIFY(running.result.get());
+    CORRADE_VERIFY(a.result.get());
+    importer.wait();
+
+    /* Finished request can't be cancelled either */
+    CORRADE_VERIFY(!importer.cancel(a.id));
+    CORRADE_VERIFY(!called);
+}
+
+void AsyncImporterTest::cancelAll() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 1};
+
+    state.block();
+    AsyncImporter::Request<MeshData3D> running = importer.mesh3D("a", 0);
+    state.waitUntilStarted();
+
+    std::vector<AsyncImporter::Request<MeshData3D>> requests;
+    for(UnsignedInt i = 0; i != 10; ++i) requests.push_back(importer.mesh3D("b", i));
+
+    CORRADE_COMPARE(importer.cancelAll(), 10);
+    CORRADE_COMPARE(importer.pendingCount(), 0);
+    for(AsyncImporter::Request<MeshData3D>& request: requests)
+        CORRADE_VERIFY(!request.result.get());
+
+    state.release();
+    CORRADE_VERIFY(running.result.get());
+}
+
+void AsyncImporterTest::destructPending() {
+    State state;
+    std::vector<AsyncImporter::Request<MeshData3D>> requests;
+    AsyncImporter::Request<MeshData3D> running;
+
+    {
+        AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 1};
+
+        state.block();
+        running = importer.mesh3D("a", 0);
+        state.waitUntilStarted();
+
+        for(UnsignedInt i = 0; i != 10; ++i) requests.push_back(importer.mesh3D("b", i));
+
+        /* The running request gets finished during destruction */
+        state.release();
+    }
+
+    CORRADE_VERIFY(running.result.get());
+    for(AsyncImporter::Request<MeshData3D>& request: requests) {
+        CORRADE_VERIFY(request.result.valid());
+        request.result.get();
+    }
+}
+
+void AsyncImporterTest::reuseOpenedFile() {
+    State state;
+    AsyncImporter importer{[&state]() { return std::unique_ptr<AbstractImporter>{new Importer{state}}; }, 1};
+
+    importer.mesh3D("a", 0);
+    importer.mesh3D("a", 1);
+    importer.mesh3D("b", 0);
+    importer.mesh3D("b", 1);
+    importer.mesh3D("a", 2);
+    importer.wait();
+
+    CORRADE_COMPARE(state.openCount.load(), 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImporterTest)
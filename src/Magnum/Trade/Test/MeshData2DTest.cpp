@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Trade/MeshData2D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshData2DTest: public TestSuite::Tester {
+    public:
+        explicit MeshData2DTest();
+
+        void construct();
+        void constructContiguous();
+        void separate();
+};
+
+MeshData2DTest::MeshData2DTest() {
+    addTests({&MeshData2DTest::construct,
+              &MeshData2DTest::constructContiguous,
+              &MeshData2DTest::separate});
+}
+
+namespace {
+
+/* Positions and texture coordinates in separate blocks, followed by indices */
+struct Data {
+    Vector2 positions[3];
+    Vector2 textureCoords[3];
+    UnsignedInt indices[3];
+};
+
+MeshData2D contiguousMesh() {
+    const Data source{
+        {{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}},
+        {{0.0f, 0.5f}, {0.5f, 1.0f}, {1.0f, 0.0f}},
+        {2, 1, 0}};
+    Containers::Array<char> data{sizeof(Data)};
+    std::memcpy(data.data(), &source, sizeof(Data));
+
+    return MeshData2D{MeshPrimitive::Triangles, std::move(data), offsetof(Data, indices), 3, 3, {
+        {MeshAttributeName::Position, offsetof(Data, positions), sizeof(Vector2)},
+        {MeshAttributeName::TextureCoords2D, offsetof(Data, textureCoords), sizeof(Vector2)}}};
+}
+
+}
+
+void MeshData2DTest::construct() {
+    const MeshData2D data{MeshPrimitive::Points, {},
+        {{{1.0f, 2.0f}, {3.0f, 4.0f}}},
+        {{{0.0f, 1.0f}, {1.0f, 0.0f}}}};
+
+    CORRADE_VERIFY(!data.isContiguous());
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(data.positionsView(0).data(), data.positions(0).data());
+    CORRADE_COMPARE(data.textureCoords2DView(0)[1], (Vector2{1.0f, 0.0f}));
+}
+
+void MeshData2DTest::constructContiguous() {
+    const MeshData2D data = contiguousMesh();
+
+    CORRADE_VERIFY(data.isContiguous());
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(data.indicesView()[0], 2);
+    CORRADE_COMPARE(data.positionsView(0).data(), data.data().data());
+    CORRADE_COMPARE(data.positionsView(0)[2], (Vector2{5.0f, 6.0f}));
+    CORRADE_COMPARE(data.textureCoords2DView(0)[1], (Vector2{0.5f, 1.0f}));
+    CORRADE_VERIFY(data.isContiguous());
+}
+
+void MeshData2DTest::separate() {
+    const MeshData2D data = contiguousMesh();
+
+    CORRADE_COMPARE(data.textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.5f}, {0.5f, 1.0f}, {1.0f, 0.0f}}));
+    CORRADE_VERIFY(!data.isContiguous());
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{2, 1, 0}));
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector2>{
+        {1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}}));
+    CORRADE_COMPARE(data.positionsView(0).data(), data.positions(0).data());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshData2DTest)
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshData3DTest: public TestSuite::Tester {
+    public:
+        explicit MeshData3DTest();
+
+        void construct();
+        void constructContiguous();
+        void constructContiguousNotIndexed();
+        void constructContiguousExternal();
+        void constructMove();
+        void separate();
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void separateConcurrent();
+        #endif
+        void debugAttributeName();
+};
+
+MeshData3DTest::MeshData3DTest() {
+    addTests({&MeshData3DTest::construct,
+              &MeshData3DTest::constructContiguous,
+              &MeshData3DTest::constructContiguousNotIndexed,
+              &MeshData3DTest::constructContiguousExternal,
+              &MeshData3DTest::constructMove,
+              &MeshData3DTest::separate,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &MeshData3DTest::separateConcurrent,
+              #endif
+              &MeshData3DTest::debugAttributeName});
+}
+
+namespace {
+
+/* Indices followed by interleaved position, normal and texture coordinates */
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoords;
+};
+
+struct Data {
+    UnsignedInt indices[6];
+    Vertex vertices[3];
+};
+
+const Data ContiguousData{
+    {0, 1, 2, 2, 1, 0},
+    {{{1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.5f}},
+     {{4.0f, 5.0f, 6.0f}, {0.0f, 1.0f, 0.0f}, {0.5f, 1.0f}},
+     {{7.0f, 8.0f, 9.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 0.0f}}}};
+
+Containers::Array<char> contiguousData() {
+    Containers::Array<char> data{sizeof(Data)};
+    std::memcpy(data.data(), &ContiguousData, sizeof(Data));
+    return data;
+}
+
+MeshData3D contiguousMesh() {
+    return MeshData3D{MeshPrimitive::Triangles, contiguousData(), offsetof(Data, indices), 6, 3, {
+        {MeshAttributeName::Position, offsetof(Data, vertices) + offsetof(Vertex, position), sizeof(Vertex)},
+        {MeshAttributeName::TextureCoords2D, offsetof(Data, vertices) + offsetof(Vertex, textureCoords), sizeof(Vertex)},
+        {MeshAttributeName::Normal, offsetof(Data, vertices) + offsetof(Vertex, normal), sizeof(Vertex)}}};
+}
+
+bool externalDeleterCalled;
+void externalDeleter(char*, std::size_t) { externalDeleterCalled = true; }
+
+}
+
+void MeshData3DTest::construct() {
+    const MeshData3D data{MeshPrimitive::Lines, {0, 1, 1, 0},
+        {{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}}},
+        {{{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}}, {}},
+        {}};
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(!data.isContiguous());
+    CORRADE_VERIFY(data.data().empty());
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_VERIFY(data.hasNormals());
+    CORRADE_COMPARE(data.normalArrayCount(), 2);
+    CORRADE_VERIFY(!data.hasTextureCoords2D());
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 0);
+
+    /* Views reference the separate arrays */
+    CORRADE_COMPARE(data.indicesView().data(), data.indices().data());
+    CORRADE_COMPARE(data.indicesView().size(), 4);
+    CORRADE_COMPARE(data.positionsView(0).data(), data.positions(0).data());
+    CORRADE_COMPARE(data.positionsView(0).stride(), sizeof(Vector3));
+    CORRADE_COMPARE(data.positionsView(0)[1], (Vector3{4.0f, 5.0f, 6.0f}));
+    CORRADE_COMPARE(data.normalsView(0)[1], (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_VERIFY(data.normalsView(1).empty());
+}
+
+void MeshData3DTest::constructContiguous() {
+    const MeshData3D data = contiguousMesh();
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(data.isContiguous());
+    CORRADE_COMPARE(data.data().size(), sizeof(Data));
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.normalArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+
+    /* Views reference the contiguous data */
+    const StridedArrayView<UnsignedInt> indices = data.indicesView();
+    CORRADE_COMPARE(indices.data(), data.data().data());
+    CORRADE_COMPARE(std::vector<UnsignedInt>(indices.begin(), indices.end()),
+        (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+
+    const StridedArrayView<Vector3> positions = data.positionsView(0);
+    CORRADE_COMPARE(positions.data(), data.data().data() + offsetof(Data, vertices));
+    CORRADE_COMPARE(positions.size(), 3);
+    CORRADE_COMPARE(positions.stride(), sizeof(Vertex));
+    CORRADE_COMPARE(positions[2], (Vector3{7.0f, 8.0f, 9.0f}));
+    CORRADE_COMPARE(data.normalsView(0)[1], (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(data.textureCoords2DView(0)[0], (Vector2{0.0f, 0.5f}));
+
+    /* Nothing was copied */
+    CORRADE_VERIFY(data.isContiguous());
+}
+
+void MeshData3DTest::constructContiguousNotIndexed() {
+    const MeshData3D data{MeshPrimitive::Points, contiguousData(), 0, 0, 3, {
+        {MeshAttributeName::Position, offsetof(Data, vertices), sizeof(Vertex)}}};
+
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_VERIFY(!data.hasNormals());
+    CORRADE_VERIFY(!data.hasTextureCoords2D());
+    CORRADE_COMPARE(data.positionsView(0)[1], (Vector3{4.0f, 5.0f, 6.0f}));
+}
+
+void MeshData3DTest::constructContiguousExternal() {
+    Data external = ContiguousData;
+    externalDeleterCalled = false;
+
+    {
+        const MeshData3D data{MeshPrimitive::Triangles, Containers::Array<char>{reinterpret_cast<char*>(&external), sizeof(Data), externalDeleter}, offsetof(Data, indices), 6, 3, {
+            {MeshAttributeName::Position, offsetof(Data, vertices), sizeof(Vertex)}}};
+
+        CORRADE_COMPARE(data.positionsView(0).data(), &external.vertices[0].position);
+        CORRADE_COMPARE(data.positionsView(0)[0], (Vector3{1.0f, 2.0f, 3.0f}));
+        CORRADE_VERIFY(!externalDeleterCalled);
+    }
+
+    CORRADE_VERIFY(externalDeleterCalled);
+}
+
+void MeshData3DTest::constructMove() {
+    MeshData3D a = contiguousMesh();
+    const char* const data = a.data().data();
+
+    MeshData3D b{std::move(a)};
+    CORRADE_VERIFY(b.isContiguous());
+    CORRADE_COMPARE(b.data().data(), data);
+    CORRADE_COMPARE(b.positionsView(0).data(), data + offsetof(Data, vertices));
+
+    MeshData3D c{MeshPrimitive::Points, {}, {{}}, {}, {}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.data().data(), data);
+    CORRADE_COMPARE(c.textureCoords2DView(0)[2], (Vector2{1.0f, 0.0f}));
+}
+
+void MeshData3DTest::separate() {
+    const MeshData3D data = contiguousMesh();
+    const StridedArrayView<Vector3> positionsBefore = data.positionsView(0);
+
+    /* First access through std::vector accessor copies everything */
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_VERIFY(!data.isContiguous());
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+    CORRADE_COMPARE(data.normals(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}));
+    CORRADE_COMPARE(data.textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.5f}, {0.5f, 1.0f}, {1.0f, 0.0f}}));
+
+    /* Views obtained after reference the separate arrays, earlier views are
+       still valid */
+    CORRADE_COMPARE(data.positionsView(0).data(), data.positions(0).data());
+    CORRADE_COMPARE(data.indicesView().data(), data.indices().data());
+    CORRADE_COMPARE(positionsBefore[1], (Vector3{4.0f, 5.0f, 6.0f}));
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void MeshData3DTest::separateConcurrent() {
+    /* Reading the same const instance from more threads should be safe, all
+       of them should see the same separated arrays */
+    const MeshData3D data = contiguousMesh();
+    const std::vector<Vector3>* positions[4]{};
+    std::size_t indexCounts[4]{};
+    std::thread threads[4];
+    for(std::size_t i = 0; i != 4; ++i) threads[i] = std::thread{[&data, &positions, &indexCounts, i]() {
+        positions[i] = &data.positions(0);
+        indexCounts[i] = data.indicesView().size();
+    }};
+    for(std::thread& thread: threads) thread.join();
+
+    CORRADE_VERIFY(!data.isContiguous());
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(positions[i], &data.positions(0));
+        CORRADE_COMPARE(indexCounts[i], 6);
+    }
+    CORRADE_COMPARE(data.positions(0)[2], (Vector3{7.0f, 8.0f, 9.0f}));
+}
+#endif
+
+void MeshData3DTest::debugAttributeName() {
+    std::ostringstream out;
+    Debug(&out) << MeshAttributeName::TextureCoords2D;
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttributeName::TextureCoords2D\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshData3DTest)
@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/StridedArrayView.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class StridedArrayViewTest: public TestSuite::Tester {
+    public:
+        explicit StridedArrayViewTest();
+
+        void constructEmpty();
+        void construct();
+        void constructArrayView();
+        void access();
+        void iterate();
+        void iteratorArithmetic();
+};
+
+StridedArrayViewTest::StridedArrayViewTest() {
+    addTests({&StridedArrayViewTest::constructEmpty,
+              &StridedArrayViewTest::construct,
+              &StridedArrayViewTest::constructArrayView,
+              &StridedArrayViewTest::access,
+              &StridedArrayViewTest::iterate,
+              &StridedArrayViewTest::iteratorArithmetic});
+}
+
+namespace {
+    struct Item {
+        Int value;
+        Float other;
+    };
+
+    const Item Items[]{{3, 0.0f}, {-7, 1.0f}, {12, 2.0f}, {5, 3.0f}};
+}
+
+void StridedArrayViewTest::constructEmpty() {
+    const StridedArrayView<Int> a;
+    CORRADE_VERIFY(a.data() == nullptr);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.stride(), sizeof(Int));
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+void StridedArrayViewTest::construct() {
+    const StridedArrayView<Int> a{&Items[0].value, 4, sizeof(Item)};
+    CORRADE_VERIFY(a.data() == &Items[0].value);
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.stride(), sizeof(Item));
+}
+
+void StridedArrayViewTest::constructArrayView() {
+    const Int data[]{1, 2, 3};
+    const StridedArrayView<Int> a = Containers::ArrayView<const Int>{data};
+    CORRADE_VERIFY(a.data() == data);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(Int));
+    CORRADE_COMPARE(a[2], 3);
+}
+
+void StridedArrayViewTest::access() {
+    const StridedArrayView<Int> a{&Items[0].value, 4, sizeof(Item)};
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_COMPARE(a[1], -7);
+    CORRADE_COMPARE(a[3], 5);
+    CORRADE_VERIFY(&a[2] == &Items[2].value);
+}
+
+void StridedArrayViewTest::iterate() {
+    const StridedArrayView<Int> a{&Items[0].value, 4, sizeof(Item)};
+
+    std::vector<Int> values;
+    for(Int i: a) values.push_back(i);
+    CORRADE_COMPARE(values, (std::vector<Int>{3, -7, 12, 5}));
+
+    CORRADE_COMPARE(std::vector<Int>(a.begin(), a.end()), (std::vector<Int>{3, -7, 12, 5}));
+    CORRADE_COMPARE(*std::max_element(a.begin(), a.end()), 12);
+}
+
+void StridedArrayViewTest::iteratorArithmetic() {
+    const StridedArrayView<Int> a{&Items[0].value, 4, sizeof(Item)};
+
+    CORRADE_COMPARE(a.end() - a.begin(), 4);
+    CORRADE_COMPARE(*(a.begin() + 2), 12);
+    CORRADE_COMPARE(*(a.end() - 1), 5);
+    CORRADE_COMPARE(a.begin()[1], -7);
+
+    StridedArrayView<Int>::Iterator i = a.begin();
+    CORRADE_COMPARE(*++i, -7);
+    CORRADE_COMPARE(*i++, -7);
+    CORRADE_COMPARE(*i, 12);
+    CORRADE_COMPARE(*--i, -7);
+    i += 2;
+    CORRADE_COMPARE(*i, 5);
+    i -= 3;
+    CORRADE_VERIFY(i == a.begin());
+    CORRADE_VERIFY(i != a.end());
+    CORRADE_VERIFY(i < a.end());
+    CORRADE_VERIFY(a.end() > i);
+    CORRADE_VERIFY(i <= a.begin());
+    CORRADE_VERIFY(i >= a.begin());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::StridedArrayViewTest)
@@ -37,6 +37,8 @@ namespace Magnum { namespace Trade {
 class AbstractImageConverter;
 class AbstractImporter;
 class AbstractMaterialData;
+class AbstractMeshConverter;
+class AsyncImporter;
 class CameraData;
 
 template<UnsignedInt> class ImageData;
@@ -45,6 +47,8 @@ typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
 class LightData;
+struct MeshAttribute;
+enum class MeshAttributeName: UnsignedByte;
 class MeshData2D;
 class MeshData3D;
 class MeshObjectData2D;
@@ -54,6 +58,7 @@ class ObjectData3D;
 class PhongMaterialData;
 class TextureData;
 class SceneData;
+template<class> class StridedArrayView;
 #endif
 
 }}
@@ -30,3 +30,4 @@
 #cmakedefine MAGNUM_TARGET_GLES3
 #cmakedefine MAGNUM_TARGET_DESKTOP_GLES
 #cmakedefine MAGNUM_TARGET_WEBGL
+#cmakedefine MAGNUM_TARGET_SIMD
@@ -0,0 +1,87 @@
+#ifndef Magnum_Trade_DdsHeader_h
+#define Magnum_Trade_DdsHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::DdsPixelFormat, @ref Magnum::Trade::DdsHeader, @ref Magnum::Trade::DdsHeaderDx10
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+#pragma pack(1)
+/** @brief DDS pixel format */
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct DdsPixelFormat {
+    UnsignedInt     size;           /**< @brief Structure size (32) */
+    UnsignedInt     flags;          /**< @brief 0x4 = FourCC is valid */
+    char            fourCC[4];      /**< @brief Compression, `DXT1`, `DXT5` or `DX10` */
+    UnsignedInt     rgbBitCount;    /**< @brief Bits per pixel of uncompressed data */
+    UnsignedInt     rBitMask;       /**< @brief Red mask of uncompressed data */
+    UnsignedInt     gBitMask;       /**< @brief Green mask of uncompressed data */
+    UnsignedInt     bBitMask;       /**< @brief Blue mask of uncompressed data */
+    UnsignedInt     aBitMask;       /**< @brief Alpha mask of uncompressed data */
+};
+
+/** @brief DDS file header */
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct DdsHeader {
+    char            magic[4];       /**< @brief File magic (`DDS `) */
+    UnsignedInt     size;           /**< @brief Header size without magic (124) */
+    UnsignedInt     flags;          /**< @brief Which fields are valid */
+    UnsignedInt     height;         /**< @brief Image height */
+    UnsignedInt     width;          /**< @brief Image width */
+    UnsignedInt     pitchOrLinearSize; /**< @brief Size of compressed data */
+    UnsignedInt     depth;          /**< @brief Depth of volume textures */
+    UnsignedInt     mipMapCount;    /**< @brief Mip level count */
+    UnsignedInt     reserved1[11];  /**< @brief Unused */
+    DdsPixelFormat  pixelFormat;    /**< @brief Pixel format */
+    UnsignedInt     caps;           /**< @brief 0x1000 = texture */
+    UnsignedInt     caps2;          /**< @brief Cube map and volume flags */
+    UnsignedInt     caps3;          /**< @brief Unused */
+    UnsignedInt     caps4;          /**< @brief Unused */
+    UnsignedInt     reserved2;      /**< @brief Unused */
+};
+
+/** @brief DDS DX10 header extension, present if the FourCC is `DX10` */
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct DdsHeaderDx10 {
+    UnsignedInt     dxgiFormat;     /**< @brief DXGI_FORMAT value */
+    UnsignedInt     resourceDimension; /**< @brief 3 = 2D texture */
+    UnsignedInt     miscFlag;       /**< @brief 0x4 = cube map */
+    UnsignedInt     arraySize;      /**< @brief Array layer count */
+    UnsignedInt     miscFlags2;     /**< @brief Alpha mode */
+};
+#pragma pack()
+
+static_assert(sizeof(DdsPixelFormat) == 32, "DdsPixelFormat size is not 32 bytes");
+static_assert(sizeof(DdsHeader) == 128, "DdsHeader size is not 128 bytes");
+static_assert(sizeof(DdsHeaderDx10) == 20, "DdsHeaderDx10 size is not 20 bytes");
+
+}}
+
+#endif
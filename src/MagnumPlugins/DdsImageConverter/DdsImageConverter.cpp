@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DdsImageConverter.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "MagnumPlugins/DdsImageConverter/DdsHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* Values from the DDS and DXGI documentation */
+enum: UnsignedInt {
+    DdsdCaps = 0x1,
+    DdsdHeight = 0x2,
+    DdsdWidth = 0x4,
+    DdsdPixelFormat = 0x1000,
+    DdsdLinearSize = 0x80000,
+    DdpfFourCC = 0x4,
+    DdsCapsTexture = 0x1000,
+
+    DxgiFormatBc4Unorm = 80,
+    DxgiFormatBc5Unorm = 83,
+    DxgiFormatBc7Unorm = 98,
+    D3d10ResourceDimensionTexture2D = 3
+};
+
+bool isColor(const ColorFormat format) {
+    return format == ColorFormat::RGB || format == ColorFormat::RGBA
+        #ifndef MAGNUM_TARGET_GLES
+        || format == ColorFormat::BGR
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        || format == ColorFormat::BGRA
+        #endif
+        ;
+}
+
+}
+
+DdsImageConverter::DdsImageConverter(): _compression{TextureTools::BlockCompression::Bc7}, _quality{TextureTools::BlockCompressionQuality::Normal}, _threadCount{0} {}
+
+DdsImageConverter::DdsImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)), _compression{TextureTools::BlockCompression::Bc7}, _quality{TextureTools::BlockCompressionQuality::Normal}, _threadCount{0} {}
+
+auto DdsImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+
+Containers::Array<char> DdsImageConverter::doExportToData(const ImageReference2D& image) const {
+    if(image.type() != ColorType::UnsignedByte) {
+        Error() << "Trade::DdsImageConverter::exportToData(): unsupported color type" << image.type();
+        return nullptr;
+    }
+
+    const std::size_t pixelSize = image.pixelSize();
+    if((_compression == TextureTools::BlockCompression::Bc5 && pixelSize < 2) ||
+       (_compression != TextureTools::BlockCompression::Bc4 && _compression != TextureTools::BlockCompression::Bc5 && !isColor(image.format())))
+    {
+        Error() << "Trade::DdsImageConverter::exportToData(): unsupported color format" << image.format() << "for" << _compression;
+        return nullptr;
+    }
+
+    /* DDS stores rows top to bottom, flip the image first. Row padding is
+       the same for both. */
+    const std::size_t rowSize = image.dataSize({image.size().x(), 1});
+    const std::size_t height = image.size().y();
+    Containers::Array<char> flipped{rowSize*height};
+    for(std::size_t y = 0; y != height; ++y)
+        std::memcpy(flipped + y*rowSize, image.data() + (height - y - 1)*rowSize, rowSize);
+
+    const Containers::Array<char> compressed = TextureTools::compressBlocks(
+        ImageReference2D{image.format(), image.type(), image.size(), flipped},
+        _compression, _quality, _threadCount);
+
+    DdsHeader header{};
+    std::memcpy(header.magic, "DDS ", 4);
+    header.size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(DdsHeader) - 4));
+    header.flags = Utility::Endianness::littleEndian(UnsignedInt(DdsdCaps|DdsdHeight|DdsdWidth|DdsdPixelFormat|DdsdLinearSize));
+    header.height = Utility::Endianness::littleEndian(UnsignedInt(image.size().y()));
+    header.width = Utility::Endianness::littleEndian(UnsignedInt(image.size().x()));
+    header.pitchOrLinearSize = Utility::Endianness::littleEndian(UnsignedInt(compressed.size()));
+    header.mipMapCount = Utility::Endianness::littleEndian(UnsignedInt(1));
+    header.pixelFormat.size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(DdsPixelFormat)));
+    header.pixelFormat.flags = Utility::Endianness::littleEndian(UnsignedInt(DdpfFourCC));
+    header.caps = Utility::Endianness::littleEndian(UnsignedInt(DdsCapsTexture));
+
+    /* BC1 and BC3 have legacy FourCC, the others need the DX10 extension */
+    DdsHeaderDx10 headerDx10{};
+    switch(_compression) {
+        case TextureTools::BlockCompression::Bc1:
+            std::memcpy(header.pixelFormat.fourCC, "DXT1", 4);
+            break;
+        case TextureTools::BlockCompression::Bc3:
+            std::memcpy(header.pixelFormat.fourCC, "DXT5", 4);
+            break;
+        case TextureTools::BlockCompression::Bc4:
+            headerDx10.dxgiFormat = DxgiFormatBc4Unorm;
+            break;
+        case TextureTools::BlockCompression::Bc5:
+            headerDx10.dxgiFormat = DxgiFormatBc5Unorm;
+            break;
+        case TextureTools::BlockCompression::Bc7:
+            headerDx10.dxgiFormat = DxgiFormatBc7Unorm;
+            break;
+    }
+
+    std::size_t headerSize = sizeof(DdsHeader);
+    if(headerDx10.dxgiFormat) {
+        std::memcpy(header.pixelFormat.fourCC, "DX10", 4);
+        headerDx10.dxgiFormat = Utility::Endianness::littleEndian(headerDx10.dxgiFormat);
+        headerDx10.resourceDimension = Utility::Endianness::littleEndian(UnsignedInt(D3d10ResourceDimensionTexture2D));
+        headerDx10.arraySize = Utility::Endianness::littleEndian(UnsignedInt(1));
+        headerSize += sizeof(DdsHeaderDx10);
+    }
+
+    Containers::Array<char> out{headerSize + compressed.size()};
+    std::memcpy(out, &header, sizeof(DdsHeader));
+    if(headerSize != sizeof(DdsHeader))
+        std::memcpy(out + sizeof(DdsHeader), &headerDx10, sizeof(DdsHeaderDx10));
+    std::memcpy(out + headerSize, compressed, compressed.size());
+    return out;
+}
+
+}}
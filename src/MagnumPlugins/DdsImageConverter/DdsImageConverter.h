@@ -0,0 +1,140 @@
+#ifndef Magnum_Trade_DdsImageConverter_h
+#define Magnum_Trade_DdsImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DdsImageConverter
+ */
+
+#include "Magnum/Trade/AbstractImageConverter.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+#include "MagnumPlugins/DdsImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_DDSIMAGECONVERTER_BUILD_STATIC
+    #if defined(DdsImageConverter_EXPORTS) || defined(DdsImageConverterObjects_EXPORTS)
+        #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_DDSIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief DDS image converter plugin
+
+Compresses images into one of the block compression formats using
+@ref TextureTools::compressBlocks() and saves them as DDS files. Supports
+images with type @ref ColorType::UnsignedByte and format @ref ColorFormat::RGB,
+@ref ColorFormat::RGBA, @ref ColorFormat::BGR or @ref ColorFormat::BGRA for
+@ref TextureTools::BlockCompression::Bc1, @ref TextureTools::BlockCompression::Bc3
+and @ref TextureTools::BlockCompression::Bc7, any format for
+@ref TextureTools::BlockCompression::Bc4 and any format with at least two
+channels for @ref TextureTools::BlockCompression::Bc5.
+
+This plugin is built if `WITH_DDSIMAGECONVERTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `DdsImageConverter` plugin
+from `MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `DdsImageConverter`
+component of `Magnum` package in CMake and link to
+`${MAGNUM_DDSIMAGECONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+BC1 and BC3 data are saved with the legacy `DXT1` and `DXT5` FourCC for
+compatibility with older readers, the other formats use the `DX10` header
+extension. As DDS stores rows from top to bottom, the image is flipped
+vertically before compression. Only a single level is saved, generate the
+mip levels on load or save each level separately.
+*/
+class MAGNUM_DDSIMAGECONVERTER_EXPORT DdsImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Default constructor */
+        explicit DdsImageConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit DdsImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        /** @brief Compression */
+        TextureTools::BlockCompression compression() const { return _compression; }
+
+        /**
+         * @brief Set compression
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref TextureTools::BlockCompression::Bc7.
+         */
+        DdsImageConverter& setCompression(TextureTools::BlockCompression compression) {
+            _compression = compression;
+            return *this;
+        }
+
+        /** @brief Compression quality */
+        TextureTools::BlockCompressionQuality quality() const { return _quality; }
+
+        /**
+         * @brief Set compression quality
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref TextureTools::BlockCompressionQuality::Normal.
+         */
+        DdsImageConverter& setQuality(TextureTools::BlockCompressionQuality quality) {
+            _quality = quality;
+            return *this;
+        }
+
+        /** @brief Thread count */
+        std::size_t threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count
+         * @return Reference to self (for method chaining)
+         *
+         * Count of threads used for compressing rows of blocks. If set to
+         * `0`, hardware concurrency is used. Default is `0`.
+         */
+        DdsImageConverter& setThreadCount(std::size_t count) {
+            _threadCount = count;
+            return *this;
+        }
+
+    private:
+        Features MAGNUM_DDSIMAGECONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<char> MAGNUM_DDSIMAGECONVERTER_LOCAL doExportToData(const ImageReference2D& image) const override;
+
+        TextureTools::BlockCompression _compression;
+        TextureTools::BlockCompressionQuality _quality;
+        std::size_t _threadCount;
+};
+
+}}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+#include "MagnumPlugins/DdsImageConverter/DdsHeader.h"
+#include "MagnumPlugins/DdsImageConverter/DdsImageConverter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class DdsImageConverterTest: public TestSuite::Tester {
+    public:
+        explicit DdsImageConverterTest();
+
+        void wrongFormat();
+        void wrongType();
+
+        void bc1();
+        void bc7();
+        void flip();
+        void file();
+};
+
+namespace {
+    /* Rows differ so flipping is detectable */
+    std::vector<char> pattern(const std::size_t pixelSize, const std::size_t width, const std::size_t height) {
+        std::vector<char> data(pixelSize*width*height);
+        for(std::size_t y = 0; y != height; ++y) for(std::size_t x = 0; x != width; ++x)
+            for(std::size_t c = 0; c != pixelSize; ++c)
+                data[(y*width + x)*pixelSize + c] = char(y*40 + x*8 + c*60);
+        return data;
+    }
+
+    DdsHeader header(const Containers::ArrayView<const char> data) {
+        DdsHeader header;
+        std::memcpy(&header, data, sizeof(DdsHeader));
+        return header;
+    }
+}
+
+DdsImageConverterTest::DdsImageConverterTest() {
+    addTests({&DdsImageConverterTest::wrongFormat,
+              &DdsImageConverterTest::wrongType,
+
+              &DdsImageConverterTest::bc1,
+              &DdsImageConverterTest::bc7,
+              &DdsImageConverterTest::flip,
+              &DdsImageConverterTest::file});
+}
+
+void DdsImageConverterTest::wrongFormat() {
+    ImageReference2D image(ColorFormat::RG, ColorType::UnsignedByte, {}, nullptr);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const auto data = DdsImageConverter().exportToData(image);
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(out.str(), "Trade::DdsImageConverter::exportToData(): unsupported color format ColorFormat::RG for TextureTools::BlockCompression::Bc7\n");
+}
+
+void DdsImageConverterTest::wrongType() {
+    ImageReference2D image(ColorFormat::RGBA, ColorType::Float, {}, nullptr);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const auto data = DdsImageConverter().exportToData(image);
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(out.str(), "Trade::DdsImageConverter::exportToData(): unsupported color type ColorType::Float\n");
+}
+
+void DdsImageConverterTest::bc1() {
+    const std::vector<char> pixels = pattern(3, 8, 6);
+    const auto data = DdsImageConverter().setCompression(TextureTools::BlockCompression::Bc1)
+        .exportToData(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {8, 6}, pixels.data()});
+
+    /* Legacy header without DX10 extension, 2x2 blocks of 8 bytes */
+    CORRADE_COMPARE(data.size(), 128 + 2*2*8);
+    const DdsHeader h = header(data);
+    CORRADE_COMPARE((std::string{h.magic, 4}), "DDS ");
+    CORRADE_COMPARE(h.size, 124);
+    CORRADE_COMPARE(h.width, 8);
+    CORRADE_COMPARE(h.height, 6);
+    CORRADE_COMPARE(h.pitchOrLinearSize, 2*2*8);
+    CORRADE_COMPARE(h.pixelFormat.size, 32);
+    CORRADE_COMPARE(h.pixelFormat.flags, 0x4);
+    CORRADE_COMPARE((std::string{h.pixelFormat.fourCC, 4}), "DXT1");
+    CORRADE_COMPARE(h.caps, 0x1000);
+}
+
+void DdsImageConverterTest::bc7() {
+    const std::vector<char> pixels = pattern(4, 8, 6);
+    const auto data = DdsImageConverter().exportToData(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 6}, pixels.data()});
+
+    CORRADE_COMPARE(data.size(), 128 + 20 + 2*2*16);
+    const DdsHeader h = header(data);
+    CORRADE_COMPARE((std::string{h.pixelFormat.fourCC, 4}), "DX10");
+    CORRADE_COMPARE(h.pitchOrLinearSize, 2*2*16);
+
+    DdsHeaderDx10 dx10;
+    std::memcpy(&dx10, data + 128, sizeof(DdsHeaderDx10));
+    CORRADE_COMPARE(dx10.dxgiFormat, 98);
+    CORRADE_COMPARE(dx10.resourceDimension, 3);
+    CORRADE_COMPARE(dx10.arraySize, 1);
+}
+
+void DdsImageConverterTest::flip() {
+    /* Single channel image with BC4, padded rows */
+    const std::vector<char> pixels = pattern(1, 6, 5);
+    std::vector<char> padded(8*5), flipped(8*5);
+    for(std::size_t y = 0; y != 5; ++y) {
+        std::memcpy(padded.data() + y*8, pixels.data() + y*6, 6);
+        std::memcpy(flipped.data() + (4 - y)*8, pixels.data() + y*6, 6);
+    }
+
+    const auto data = DdsImageConverter().setCompression(TextureTools::BlockCompression::Bc4)
+        .exportToData(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {6, 5}, padded.data()});
+    const auto expected = TextureTools::compressBlocks(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {6, 5}, flipped.data()},
+        TextureTools::BlockCompression::Bc4);
+
+    CORRADE_COMPARE(data.size(), 128 + 20 + expected.size());
+    CORRADE_COMPARE((std::string{data + 128 + 20, expected.size()}),
+                    (std::string{expected, expected.size()}));
+}
+
+void DdsImageConverterTest::file() {
+    const std::vector<char> pixels = pattern(4, 8, 6);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 6}, pixels.data()};
+    const std::string filename = Utility::Directory::join(DDSIMAGECONVERTER_TEST_DIR, "file.dds");
+
+    DdsImageConverter converter;
+    converter.setCompression(TextureTools::BlockCompression::Bc3);
+    CORRADE_VERIFY(converter.exportToFile(image, filename));
+
+    const auto data = converter.exportToData(image);
+    const auto file = Utility::Directory::read(filename);
+    CORRADE_COMPARE((std::string{file, file.size()}),
+                    (std::string{data, data.size()}));
+    CORRADE_COMPARE((std::string{header(file).pixelFormat.fourCC, 4}), "DXT5");
+
+    Utility::Directory::rm(filename);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DdsImageConverterTest)
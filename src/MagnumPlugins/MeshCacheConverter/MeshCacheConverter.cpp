@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MeshCacheConverter.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* Copies strided attribute data into tightly packed array */
+template<class T> void copyPacked(const StridedArrayView<T>& view, char* const out) {
+    if(view.stride() == sizeof(T)) {
+        std::memcpy(out, view.data(), view.size()*sizeof(T));
+        return;
+    }
+
+    for(std::size_t i = 0; i != view.size(); ++i)
+        std::memcpy(out + i*sizeof(T), &view[i], sizeof(T));
+}
+
+}
+
+MeshCacheConverter::MeshCacheConverter() = default;
+
+MeshCacheConverter::MeshCacheConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractMeshConverter(manager, std::move(plugin)) {}
+
+auto MeshCacheConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+
+Containers::Array<char> MeshCacheConverter::doExportToData(const MeshData3D& mesh) const {
+    if(mesh.positionArrayCount() > 255 || mesh.normalArrayCount() > 255 || mesh.textureCoords2DArrayCount() > 255) {
+        Error() << "Trade::MeshCacheConverter::exportToData(): at most 255 arrays of each attribute are supported";
+        return nullptr;
+    }
+
+    /* Gather all arrays, which are expected to have the same size. Using the
+       views to avoid copying contiguous mesh data into separate arrays. */
+    std::vector<StridedArrayView<Vector3>> arrays3D;
+    std::vector<StridedArrayView<Vector2>> arrays2D;
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        arrays3D.push_back(mesh.positionsView(i));
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        arrays3D.push_back(mesh.normalsView(i));
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        arrays2D.push_back(mesh.textureCoords2DView(i));
+    const std::size_t vertexCount = arrays3D.front().size();
+    std::vector<std::size_t> sizes;
+    for(const auto& array: arrays3D) sizes.push_back(array.size());
+    for(const auto& array: arrays2D) sizes.push_back(array.size());
+    for(const std::size_t size: sizes) if(size != vertexCount) {
+        Error() << "Trade::MeshCacheConverter::exportToData(): expected all attribute arrays to have" << vertexCount << "items but got" << size;
+        return nullptr;
+    }
+
+    MeshCacheHeader header{};
+    std::memcpy(header.magic, "MGMC", 4);
+    header.version = MeshCacheHeader::Version;
+    header.flags = MeshCacheHeader::Checksum|(Utility::Endianness::isBigEndian() ? MeshCacheHeader::BigEndian : 0);
+    header.positionArrayCount = mesh.positionArrayCount();
+    header.normalArrayCount = mesh.normalArrayCount();
+    header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.indexCount = mesh.isIndexed() ? mesh.indicesView().size() : 0;
+    header.vertexCount = vertexCount;
+
+    std::vector<UnsignedLong> offsets(arrays3D.size() + arrays2D.size() + 2);
+    Implementation::meshCacheOffsets(header, offsets.data());
+
+    /* Zero-initialized so the padding is deterministic */
+    auto data = Containers::Array<char>::zeroInitialized(offsets.back());
+    if(mesh.isIndexed()) copyPacked(mesh.indicesView(), data.data() + offsets[0]);
+    const UnsignedLong* offset = offsets.data() + 1;
+    for(const auto& array: arrays3D) copyPacked(array, data.data() + *offset++);
+    for(const auto& array: arrays2D) copyPacked(array, data.data() + *offset++);
+
+    header.checksum = Implementation::meshCacheChecksum(data.data() + sizeof(MeshCacheHeader), data.size() - sizeof(MeshCacheHeader));
+    std::memcpy(data.data(), &header, sizeof(MeshCacheHeader));
+
+    return data;
+}
+
+}}
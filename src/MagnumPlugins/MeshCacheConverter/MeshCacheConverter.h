@@ -0,0 +1,93 @@
+#ifndef Magnum_Trade_MeshCacheConverter_h
+#define Magnum_Trade_MeshCacheConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshCacheConverter
+ */
+
+#include "Magnum/Trade/AbstractMeshConverter.h"
+
+#include "MagnumPlugins/MeshCacheConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHCACHECONVERTER_BUILD_STATIC
+    #if defined(MeshCacheConverter_EXPORTS) || defined(MeshCacheConverterObjects_EXPORTS)
+        #define MAGNUM_MESHCACHECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHCACHECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHCACHECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHCACHECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh cache converter plugin
+
+Exports meshes into binary cache files which can be imported back using
+@ref MeshCacheImporter "MeshCacheImporter" plugin, see @ref MeshCacheHeader
+for description of the format. All attribute arrays are expected to have the
+same size, i.e. the mesh should be already processed with
+@ref MeshTools::combineIndexedArrays() (which is what e.g.
+@ref ObjImporter "ObjImporter" does). The file includes CRC-32 checksum of the
+data. Example usage, caching an OBJ file:
+@code
+std::optional<Trade::MeshData3D> mesh = objImporter.mesh3D(0);
+meshCacheConverter.exportToFile(*mesh, "mesh.mgmc");
+
+// ... later
+meshCacheImporter.openFile("mesh.mgmc");
+mesh = meshCacheImporter.mesh3D(0);
+@endcode
+
+This plugin is built if `WITH_MESHCACHECONVERTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `MeshCacheConverter` plugin
+from `MAGNUM_PLUGINS_MESHCONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `MeshCacheConverter`
+component of `Magnum` package in CMake and link to
+`${MAGNUM_MESHCACHECONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+*/
+class MAGNUM_MESHCACHECONVERTER_EXPORT MeshCacheConverter: public AbstractMeshConverter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshCacheConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshCacheConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+    private:
+        Features MAGNUM_MESHCACHECONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<char> MAGNUM_MESHCACHECONVERTER_LOCAL doExportToData(const MeshData3D& mesh) const override;
+};
+
+}}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshCacheConverter/MeshCacheConverter.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshCacheConverterTest: public TestSuite::Tester {
+    public:
+        explicit MeshCacheConverterTest();
+
+        void wrongArraySize();
+
+        void data();
+        void nonIndexed();
+        void file();
+};
+
+MeshCacheConverterTest::MeshCacheConverterTest() {
+    addTests({&MeshCacheConverterTest::wrongArraySize,
+
+              &MeshCacheConverterTest::data,
+              &MeshCacheConverterTest::nonIndexed,
+              &MeshCacheConverterTest::file});
+}
+
+namespace {
+
+MeshData3D mesh() {
+    return MeshData3D{MeshPrimitive::Triangles, {0, 1, 2, 0, 2, 3}, {
+        {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}},
+        {{-2.0f, -2.0f, 0.0f}, {2.0f, -2.0f, 0.0f}, {2.0f, 2.0f, 0.0f}, {-2.0f, 2.0f, 0.0f}}
+    }, {
+        std::vector<Vector3>(4, Vector3::zAxis())
+    }, {
+        {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}}
+    }};
+}
+
+}
+
+void MeshCacheConverterTest::wrongArraySize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh{MeshPrimitive::Triangles, {0, 1, 2}, {
+        std::vector<Vector3>(3)
+    }, {
+        std::vector<Vector3>(2)
+    }, {}};
+    CORRADE_VERIFY(!MeshCacheConverter{}.exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheConverter::exportToData(): expected all attribute arrays to have 3 items but got 2\n");
+}
+
+void MeshCacheConverterTest::data() {
+    const MeshData3D original = mesh();
+    const Containers::Array<char> data = MeshCacheConverter{}.exportToData(original);
+    CORRADE_VERIFY(data);
+
+    /* 32 bytes of header, 24 of indices, 4*48 of positions and normals, 32
+       of texture coordinates */
+    CORRADE_COMPARE(data.size(), 32 + 32 + 3*48 + 32);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<MeshData3D> imported = importer.mesh3D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), original.primitive());
+    CORRADE_COMPARE(imported->indices(), original.indices());
+    CORRADE_COMPARE(imported->positionArrayCount(), 2);
+    CORRADE_COMPARE(imported->positions(0), original.positions(0));
+    CORRADE_COMPARE(imported->positions(1), original.positions(1));
+    CORRADE_COMPARE(imported->normalArrayCount(), 1);
+    CORRADE_COMPARE(imported->normals(0), original.normals(0));
+    CORRADE_COMPARE(imported->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(imported->textureCoords2D(0), original.textureCoords2D(0));
+}
+
+void MeshCacheConverterTest::nonIndexed() {
+    const MeshData3D original{MeshPrimitive::Lines, {}, {
+        {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}
+    }, {}, {}};
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(MeshCacheConverter{}.exportToData(original)));
+    std::optional<MeshData3D> imported = importer.mesh3D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(!imported->isIndexed());
+    CORRADE_COMPARE(imported->positions(0), original.positions(0));
+    CORRADE_VERIFY(!imported->hasNormals());
+    CORRADE_VERIFY(!imported->hasTextureCoords2D());
+}
+
+void MeshCacheConverterTest::file() {
+    const std::string filename = Utility::Directory::join(MESHCACHECONVERTER_TEST_DIR, "mesh.mgmc");
+    Utility::Directory::rm(filename);
+
+    const MeshData3D original = mesh();
+    CORRADE_VERIFY(MeshCacheConverter{}.exportToFile(original, filename));
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    std::optional<MeshData3D> imported = importer.mesh3D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->indices(), original.indices());
+    CORRADE_COMPARE(imported->positions(1), original.positions(1));
+    CORRADE_COMPARE(imported->textureCoords2D(0), original.textureCoords2D(0));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshCacheConverterTest)
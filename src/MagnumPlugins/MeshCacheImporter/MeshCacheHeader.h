@@ -0,0 +1,121 @@
+#ifndef Magnum_Trade_MeshCacheHeader_h
+#define Magnum_Trade_MeshCacheHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshCacheHeader
+ */
+
+#include <cstddef>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh cache file header
+
+The header is followed by index array, position arrays, normal arrays and 2D
+texture coordinate arrays, in this order. Each array is tightly packed and
+starts at an offset aligned to 16 bytes from the beginning of the file, the
+padding is filled with zeros. All values are in byte order of the machine
+which created the file.
+*/
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct MeshCacheHeader {
+    enum: UnsignedByte {
+        Version = 1,                /**< @brief Current format version */
+
+        BigEndian = 1 << 0,         /**< @brief File is big-endian */
+        Checksum = 1 << 1           /**< @brief @ref checksum is present */
+    };
+
+    char            magic[4];       /**< @brief `MGMC` */
+    UnsignedByte    version;        /**< @brief Format version */
+    UnsignedByte    flags;          /**< @brief Combination of @ref BigEndian and @ref Checksum */
+    UnsignedByte    positionArrayCount; /**< @brief Count of position arrays */
+    UnsignedByte    normalArrayCount;   /**< @brief Count of normal arrays */
+    UnsignedByte    textureCoords2DArrayCount; /**< @brief Count of 2D texture coordinate arrays */
+    UnsignedByte    reserved[3];    /**< @brief Reserved, zero */
+    UnsignedInt     primitive;      /**< @brief Mesh primitive */
+    UnsignedInt     indexCount;     /**< @brief Index count, zero if not indexed */
+    UnsignedInt     vertexCount;    /**< @brief Vertex count in each array */
+    UnsignedInt     checksum;       /**< @brief CRC-32 of all data following the header */
+};
+
+static_assert(sizeof(MeshCacheHeader) == 28, "MeshCacheHeader size is not 28 bytes");
+
+namespace Implementation {
+
+/* Offset aligned for next array */
+inline UnsignedLong meshCacheAlign(const UnsignedLong offset) {
+    return (offset + 15) & ~UnsignedLong(15);
+}
+
+/* Offsets of all arrays, expects that there is space for at least
+   2 + positionArrayCount + normalArrayCount + textureCoords2DArrayCount
+   items, the last one is size of the whole file */
+inline void meshCacheOffsets(const MeshCacheHeader& header, UnsignedLong* offsets) {
+    UnsignedLong offset = meshCacheAlign(sizeof(MeshCacheHeader));
+    *offsets++ = offset;
+    offset = meshCacheAlign(offset + UnsignedLong(header.indexCount)*sizeof(UnsignedInt));
+    for(std::size_t i = 0; i != header.positionArrayCount + header.normalArrayCount; ++i) {
+        *offsets++ = offset;
+        offset = meshCacheAlign(offset + UnsignedLong(header.vertexCount)*sizeof(Float)*3);
+    }
+    for(std::size_t i = 0; i != header.textureCoords2DArrayCount; ++i) {
+        *offsets++ = offset;
+        offset = meshCacheAlign(offset + UnsignedLong(header.vertexCount)*sizeof(Float)*2);
+    }
+    *offsets = offset;
+}
+
+/* Bytewise CRC-32 (the zlib polynomial) */
+inline UnsignedInt meshCacheChecksum(const char* data, const std::size_t size) {
+    static const struct Table {
+        Table() {
+            for(UnsignedInt i = 0; i != 256; ++i) {
+                UnsignedInt c = i;
+                for(std::size_t j = 0; j != 8; ++j)
+                    c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                values[i] = c;
+            }
+        }
+
+        UnsignedInt values[256];
+    } table;
+
+    UnsignedInt crc = ~UnsignedInt{};
+    for(std::size_t i = 0; i != size; ++i)
+        crc = table.values[(crc ^ UnsignedByte(data[i])) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+}
+
+}}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MeshCacheImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/Implementation/mapFile.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+bool checkHeader(const char* const prefix, const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(MeshCacheHeader)) {
+        Error() << prefix << "file too short";
+        return false;
+    }
+
+    const auto& header = *reinterpret_cast<const MeshCacheHeader*>(data.data());
+    if(std::strncmp(header.magic, "MGMC", 4) != 0) {
+        Error() << prefix << "invalid file signature";
+        return false;
+    }
+
+    if(header.version != MeshCacheHeader::Version) {
+        Error() << prefix << "unsupported version" << header.version;
+        return false;
+    }
+
+    if(bool(header.flags & MeshCacheHeader::BigEndian) != Utility::Endianness::isBigEndian()) {
+        Error() << prefix << "file has different endianness than the machine";
+        return false;
+    }
+
+    switch(MeshPrimitive(header.primitive)) {
+        case MeshPrimitive::Points:
+        case MeshPrimitive::LineStrip:
+        case MeshPrimitive::LineLoop:
+        case MeshPrimitive::Lines:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::LineStripAdjacency:
+        case MeshPrimitive::LinesAdjacency:
+        #endif
+        case MeshPrimitive::TriangleStrip:
+        case MeshPrimitive::TriangleFan:
+        case MeshPrimitive::Triangles:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::TriangleStripAdjacency:
+        case MeshPrimitive::TrianglesAdjacency:
+        case MeshPrimitive::Patches:
+        #endif
+            break;
+        default:
+            Error() << prefix << "invalid primitive" << header.primitive;
+            return false;
+    }
+
+    std::vector<UnsignedLong> offsets(2 + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount);
+    Implementation::meshCacheOffsets(header, offsets.data());
+    if(data.size() < offsets.back()) {
+        Error() << prefix << "file too short, expected" << offsets.back() << "bytes but got" << data.size();
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+MeshCacheImporter::MeshCacheImporter() = default;
+
+MeshCacheImporter::MeshCacheImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+
+MeshCacheImporter::~MeshCacheImporter() { close(); }
+
+auto MeshCacheImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool MeshCacheImporter::doIsOpened() const { return _data; }
+
+void MeshCacheImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    if(!checkHeader("Trade::MeshCacheImporter::openData():", data)) return;
+
+    /* The data view is not guaranteed to stay valid, copy it. The copy is
+       shared with the imported meshes. */
+    Containers::Array<char> copy{data.size()};
+    std::copy(data.begin(), data.end(), copy.begin());
+    _data = Implementation::makeShared(std::move(copy));
+}
+
+void MeshCacheImporter::doOpenFile(const std::string& filename) {
+    std::optional<Containers::Array<char>> data = Implementation::mapFile(filename, "Trade::MeshCacheImporter::openFile():");
+    if(!data) return;
+
+    if(!checkHeader("Trade::MeshCacheImporter::openFile():", *data)) return;
+
+    /* The mapping is shared with the imported meshes, so it stays alive
+       after the importer is closed or opens another file */
+    _data = Implementation::makeShared(std::move(*data));
+}
+
+void MeshCacheImporter::doClose() { _data = nullptr; }
+
+UnsignedInt MeshCacheImporter::doMesh3DCount() const { return 1; }
+
+std::optional<MeshData3D> MeshCacheImporter::doMesh3D(UnsignedInt) {
+    const auto& header = *reinterpret_cast<const MeshCacheHeader*>(_data.data());
+    std::vector<UnsignedLong> offsets(2 + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount);
+    Implementation::meshCacheOffsets(header, offsets.data());
+
+    if((header.flags & MeshCacheHeader::Checksum) && Implementation::meshCacheChecksum(_data.data() + sizeof(MeshCacheHeader), offsets.back() - sizeof(MeshCacheHeader)) != header.checksum) {
+        Error() << "Trade::MeshCacheImporter::mesh3D(): checksum mismatch";
+        return std::nullopt;
+    }
+
+    /* Indices are used for accessing the attribute arrays, check them
+       upfront so corrupted files don't cause out-of-bounds reads later */
+    const UnsignedInt* const indices = reinterpret_cast<const UnsignedInt*>(_data.data() + offsets.front());
+    for(std::size_t i = 0; i != header.indexCount; ++i) if(indices[i] >= header.vertexCount) {
+        Error() << "Trade::MeshCacheImporter::mesh3D(): index" << indices[i] << "out of bounds for" << header.vertexCount << "vertices";
+        return std::nullopt;
+    }
+
+    /* All arrays are aligned, so the mesh references them directly in the
+       opened data without copying anything. The mesh holds a reference to
+       the data, keeping them alive for as long as it needs them. */
+    Containers::Array<char> data = Implementation::shareData(_data, offsets.back());
+
+    std::vector<MeshAttribute> attributes;
+    attributes.reserve(offsets.size() - 2);
+    const UnsignedLong* offset = offsets.data() + 1;
+    for(std::size_t i = 0; i != header.positionArrayCount; ++i)
+        attributes.push_back({MeshAttributeName::Position, std::size_t(*offset++), sizeof(Vector3)});
+    for(std::size_t i = 0; i != header.normalArrayCount; ++i)
+        attributes.push_back({MeshAttributeName::Normal, std::size_t(*offset++), sizeof(Vector3)});
+    for(std::size_t i = 0; i != header.textureCoords2DArrayCount; ++i)
+        attributes.push_back({MeshAttributeName::TextureCoords2D, std::size_t(*offset++), sizeof(Vector2)});
+
+    return MeshData3D{MeshPrimitive(header.primitive), std::move(data), std::size_t(offsets.front()), header.indexCount, header.vertexCount, std::move(attributes)};
+}
+
+}}
@@ -0,0 +1,110 @@
+#ifndef Magnum_Trade_MeshCacheImporter_h
+#define Magnum_Trade_MeshCacheImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshCacheImporter
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MeshCacheImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHCACHEIMPORTER_BUILD_STATIC
+    #if defined(MeshCacheImporter_EXPORTS) || defined(MeshCacheImporterObjects_EXPORTS)
+        #define MAGNUM_MESHCACHEIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHCACHEIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHCACHEIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHCACHEIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh cache importer plugin
+
+Imports binary mesh cache files created by
+@ref MeshCacheConverter "MeshCacheConverter" plugin. The files contain single
+mesh with already combined index and attribute arrays, so there is no parsing
+or index processing involved, see @ref MeshCacheHeader for description of the
+format. Typical use is caching results of importing text formats such as OBJ,
+which are slow to parse.
+
+This plugin is built if `WITH_MESHCACHEIMPORTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `MeshCacheImporter` plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `MeshCacheImporter`
+component of `Magnum` package in CMake and link to
+`${MAGNUM_MESHCACHEIMPORTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+On Unix platforms @ref openFile() maps the file into memory instead of reading
+it, so opening is constant-time and only the pages touched by @ref mesh3D()
+are loaded from disk. Only the header is validated on opening, the checksum
+(if present) and index bounds are verified on @ref mesh3D(). Files created on
+a machine with different endianness are rejected.
+
+The data returned by @ref mesh3D() are not copied, they reference the opened
+file directly. The file mapping is reference-counted and each returned
+@ref MeshData3D holds a reference to it, so the mesh stays valid also after
+the importer is closed, destroyed or opens another file. The file is unmapped
+once the importer and all meshes imported from it are gone. Access the data
+through the views such as @ref MeshData3D::positionsView() to avoid any copy
+also later. See @ref Trade-MeshData3D-storage for more information.
+*/
+class MAGNUM_MESHCACHEIMPORTER_EXPORT MeshCacheImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshCacheImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshCacheImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~MeshCacheImporter();
+
+    private:
+        Features MAGNUM_MESHCACHEIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_MESHCACHEIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_MESHCACHEIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_MESHCACHEIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
+        void MAGNUM_MESHCACHEIMPORTER_LOCAL doClose() override;
+        UnsignedInt MAGNUM_MESHCACHEIMPORTER_LOCAL doMesh3DCount() const override;
+        std::optional<MeshData3D> MAGNUM_MESHCACHEIMPORTER_LOCAL doMesh3D(UnsignedInt id) override;
+
+        Containers::Array<char> _data;
+};
+
+}}
+
+#endif
@@ -0,0 +1,356 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheHeader.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheImporter.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Magnum/Trade/AsyncImporter.h"
+#endif
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshCacheImporterTest: public TestSuite::Tester {
+    public:
+        explicit MeshCacheImporterTest();
+
+        void openNonexistent();
+        void openShort();
+        void invalidSignature();
+        void unsupportedVersion();
+        void differentEndianness();
+        void invalidPrimitive();
+        void truncated();
+        void checksumMismatch();
+        void noChecksum();
+        void indexOutOfBounds();
+
+        void data();
+        void nonIndexed();
+        void file();
+        void meshOutlivesImporter();
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void asyncImporterReopen();
+        #endif
+};
+
+MeshCacheImporterTest::MeshCacheImporterTest() {
+    addTests({&MeshCacheImporterTest::openNonexistent,
+              &MeshCacheImporterTest::openShort,
+              &MeshCacheImporterTest::invalidSignature,
+              &MeshCacheImporterTest::unsupportedVersion,
+              &MeshCacheImporterTest::differentEndianness,
+              &MeshCacheImporterTest::invalidPrimitive,
+              &MeshCacheImporterTest::truncated,
+              &MeshCacheImporterTest::checksumMismatch,
+              &MeshCacheImporterTest::noChecksum,
+              &MeshCacheImporterTest::indexOutOfBounds,
+
+              &MeshCacheImporterTest::data,
+              &MeshCacheImporterTest::nonIndexed,
+              &MeshCacheImporterTest::file,
+              &MeshCacheImporterTest::meshOutlivesImporter,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &MeshCacheImporterTest::asyncImporterReopen
+              #endif
+              });
+}
+
+namespace {
+
+/* Triangle with one position, one normal and one texture coordinate array */
+Containers::Array<char> triangle(const UnsignedInt indexCount = 3) {
+    MeshCacheHeader header{};
+    std::memcpy(header.magic, "MGMC", 4);
+    header.version = MeshCacheHeader::Version;
+    header.flags = MeshCacheHeader::Checksum|(Utility::Endianness::isBigEndian() ? MeshCacheHeader::BigEndian : 0);
+    header.positionArrayCount = 1;
+    header.normalArrayCount = 1;
+    header.textureCoords2DArrayCount = 1;
+    header.primitive = UnsignedInt(MeshPrimitive::Triangles);
+    header.indexCount = indexCount;
+    header.vertexCount = 3;
+
+    UnsignedLong offsets[5];
+    Implementation::meshCacheOffsets(header, offsets);
+    auto data = Containers::Array<char>::zeroInitialized(offsets[4]);
+
+    const UnsignedInt indices[]{2, 0, 1};
+    const Vector3 positions[]{{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    const Vector3 normals[]{Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis()};
+    const Vector2 textureCoords2D[]{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.5f, 1.0f}};
+    std::memcpy(data + offsets[0], indices, indexCount*sizeof(UnsignedInt));
+    std::memcpy(data + offsets[1], positions, sizeof(positions));
+    std::memcpy(data + offsets[2], normals, sizeof(normals));
+    std::memcpy(data + offsets[3], textureCoords2D, sizeof(textureCoords2D));
+
+    header.checksum = Implementation::meshCacheChecksum(data + sizeof(MeshCacheHeader), data.size() - sizeof(MeshCacheHeader));
+    std::memcpy(data, &header, sizeof(MeshCacheHeader));
+    return data;
+}
+
+MeshCacheHeader& header(Containers::Array<char>& data) {
+    return *reinterpret_cast<MeshCacheHeader*>(data.data());
+}
+
+}
+
+void MeshCacheImporterTest::openNonexistent() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openFile("nonexistent.file"));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openFile(): cannot open file nonexistent.file\n");
+}
+
+void MeshCacheImporterTest::openShort() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    MeshCacheImporter importer;
+    const char data[]{'M', 'G', 'M', 'C', 1, 0};
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): file too short\n");
+}
+
+void MeshCacheImporterTest::invalidSignature() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    Containers::Array<char> data = triangle();
+    data[3] = 'X';
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): invalid file signature\n");
+}
+
+void MeshCacheImporterTest::unsupportedVersion() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    Containers::Array<char> data = triangle();
+    header(data).version = 2;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): unsupported version 2\n");
+}
+
+void MeshCacheImporterTest::differentEndianness() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    Containers::Array<char> data = triangle();
+    header(data).flags ^= MeshCacheHeader::BigEndian;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): file has different endianness than the machine\n");
+}
+
+void MeshCacheImporterTest::invalidPrimitive() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    Containers::Array<char> data = triangle();
+    header(data).primitive = 0xdead;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): invalid primitive 57005\n");
+}
+
+void MeshCacheImporterTest::truncated() {
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+
+    Containers::Array<char> data = triangle();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData({data, data.size() - 1}));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::openData(): file too short, expected 176 bytes but got 175\n");
+}
+
+void MeshCacheImporterTest::checksumMismatch() {
+    Containers::Array<char> data = triangle();
+    data[data.size() - 1] = 1;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::mesh3D(): checksum mismatch\n");
+}
+
+void MeshCacheImporterTest::noChecksum() {
+    /* The data are not verified without the checksum flag */
+    Containers::Array<char> data = triangle();
+    data[data.size() - 1] = 1;
+    header(data).flags &= ~MeshCacheHeader::Checksum;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(importer.mesh3D(0));
+}
+
+void MeshCacheImporterTest::indexOutOfBounds() {
+    /* Verified even without the checksum */
+    Containers::Array<char> data = triangle();
+    UnsignedLong offsets[5];
+    Implementation::meshCacheOffsets(header(data), offsets);
+    reinterpret_cast<UnsignedInt*>(data + offsets[0])[1] = 3;
+    header(data).flags &= ~MeshCacheHeader::Checksum;
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::MeshCacheImporter::mesh3D(): index 3 out of bounds for 3 vertices\n");
+}
+
+void MeshCacheImporterTest::data() {
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(triangle()));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+
+    /* The mesh references the opened data directly, including the header */
+    CORRADE_VERIFY(mesh->isContiguous());
+    CORRADE_COMPARE(mesh->data().size(), 28 + 4 + 3*4 + 4 + 3*12 + 12 + 3*12 + 12 + 3*8 + 8);
+    CORRADE_COMPARE(importer.mesh3D(0)->data().data(), mesh->data().data());
+    CORRADE_COMPARE(mesh->positionsView(0)[2], (Vector3{0.0f, 1.0f, 0.0f}));
+
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{2, 0, 1}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>(3, Vector3::zAxis())));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.5f, 1.0f}}));
+}
+
+void MeshCacheImporterTest::nonIndexed() {
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(triangle(0)));
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->positions(0).size(), 3);
+}
+
+void MeshCacheImporterTest::file() {
+    /* Opened via memory mapping on Unix */
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MESHCACHEIMPORTER_TEST_DIR, "triangle.mgmc")));
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{2, 0, 1}));
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.5f, 1.0f}}));
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void MeshCacheImporterTest::meshOutlivesImporter() {
+    std::optional<MeshData3D> mesh;
+    {
+        MeshCacheImporter importer;
+        CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MESHCACHEIMPORTER_TEST_DIR, "triangle.mgmc")));
+        mesh = importer.mesh3D(0);
+        CORRADE_VERIFY(mesh);
+
+        /* Opening another file drops the importer's reference to the first
+           one, the mesh still has its own */
+        CORRADE_VERIFY(importer.openData(triangle(0)));
+    }
+
+    CORRADE_COMPARE(mesh->indicesView()[0], 2);
+    CORRADE_COMPARE(mesh->positionsView(0)[2], (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(mesh->textureCoords2DView(0)[2], (Vector2{0.5f, 1.0f}));
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void MeshCacheImporterTest::asyncImporterReopen() {
+    const std::string indexedFile = Utility::Directory::join(MESHCACHEIMPORTER_TEST_OUTPUT_DIR, "indexed.mgmc");
+    const std::string nonIndexedFile = Utility::Directory::join(MESHCACHEIMPORTER_TEST_OUTPUT_DIR, "nonindexed.mgmc");
+    CORRADE_VERIFY(Utility::Directory::write(indexedFile, triangle()));
+    CORRADE_VERIFY(Utility::Directory::write(nonIndexedFile, triangle(0)));
+
+    std::optional<MeshData3D> indexed, nonIndexed;
+    {
+        /* With a single worker the second request reopens the importer,
+           closing the file the first mesh was imported from */
+        AsyncImporter importer{[]() {
+            return std::unique_ptr<AbstractImporter>{new MeshCacheImporter};
+        }, 1};
+        AsyncImporter::Request<MeshData3D> first = importer.mesh3D(indexedFile, 0);
+        AsyncImporter::Request<MeshData3D> second = importer.mesh3D(nonIndexedFile, 0);
+        importer.wait();
+
+        nonIndexed = second.result.get();
+        CORRADE_VERIFY(nonIndexed);
+        CORRADE_VERIFY(!nonIndexed->isIndexed());
+
+        indexed = first.result.get();
+        CORRADE_VERIFY(indexed);
+        CORRADE_COMPARE(indexed->indicesView()[0], 2);
+        CORRADE_COMPARE(indexed->positionsView(0)[2], (Vector3{0.0f, 1.0f, 0.0f}));
+    }
+
+    /* The meshes are still valid after the importers are destroyed */
+    CORRADE_COMPARE(indexed->indices(), (std::vector<UnsignedInt>{2, 0, 1}));
+    CORRADE_COMPARE(indexed->positions(0), (std::vector<Vector3>{
+        {-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE(nonIndexed->normalsView(0)[1], Vector3::zAxis());
+
+    Utility::Directory::rm(indexedFile);
+    Utility::Directory::rm(nonIndexedFile);
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshCacheImporterTest)
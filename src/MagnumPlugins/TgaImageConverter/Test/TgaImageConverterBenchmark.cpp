@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct TgaImageConverterBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit TgaImageConverterBenchmark();
+
+    void uncompressed();
+    void rleSingleThread();
+    void rle();
+
+    private:
+        void benchmark(const std::string& name, TgaImageConverter::Compression compression, std::size_t threadCount);
+
+        std::vector<char> _data;
+};
+
+namespace {
+
+enum: Int { Size = 2048 };
+
+/* Glyph-cache-like image, mostly empty with a grid of small filled blobs with
+   antialiased edges */
+std::vector<char> atlas() {
+    std::vector<char> data(std::size_t(Size)*Size);
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x) {
+        const Int dx = x%64 - 32, dy = y%64 - 32;
+        const Int distance = dx*dx + dy*dy;
+        data[std::size_t(y)*Size + x] = char(distance < 256 ? 255 : distance < 324 ? (324 - distance)*3 : 0);
+    }
+    return data;
+}
+
+}
+
+TgaImageConverterBenchmark::TgaImageConverterBenchmark(): AbstractBenchmarkTester{10}, _data{atlas()} {
+    addTests({&TgaImageConverterBenchmark::uncompressed,
+              &TgaImageConverterBenchmark::rleSingleThread,
+              &TgaImageConverterBenchmark::rle});
+}
+
+void TgaImageConverterBenchmark::benchmark(const std::string& name, const TgaImageConverter::Compression compression, const std::size_t threadCount) {
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    const ImageReference2D image{ColorFormat::Red, ColorType::UnsignedByte, {Size, Size}, _data.data()};
+    #else
+    const ImageReference2D image{ColorFormat::Luminance, ColorType::UnsignedByte, {Size, Size}, _data.data()};
+    #endif
+    TgaImageConverter converter;
+    converter.setCompression(compression)
+        .setThreadCount(threadCount);
+
+    std::size_t size{};
+    MAGNUM_BENCHMARK(name, std::size_t(Size)*Size) {
+        const Containers::Array<char> data = converter.exportToData(image);
+        size = data.size();
+        escape(data.data());
+    }
+
+    Debug() << "   " << name << "output size:" << size << "bytes";
+}
+
+void TgaImageConverterBenchmark::uncompressed() {
+    benchmark("exportToData(), uncompressed", TgaImageConverter::Compression::None, 1);
+}
+
+void TgaImageConverterBenchmark::rleSingleThread() {
+    benchmark("exportToData(), RLE, single thread", TgaImageConverter::Compression::Rle, 1);
+}
+
+void TgaImageConverterBenchmark::rle() {
+    benchmark("exportToData(), RLE", TgaImageConverter::Compression::Rle, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterBenchmark)
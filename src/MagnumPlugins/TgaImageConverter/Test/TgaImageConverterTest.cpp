@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <tuple>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -47,23 +48,59 @@ class TgaImageConverterTest: public TestSuite::Tester {
         void wrongType();
 
         void data();
+        void dataUncompressed();
+        void rleRuns();
+        void rleGrayscale();
+        void rleSmaller();
+        void threads();
+        void file();
+        void fileUncompressed();
 };
 
 namespace {
+    /* Rows are padded to four bytes */
     constexpr char originalData[] = {
-        1, 2, 3, 2, 3, 4,
-        3, 4, 5, 4, 5, 6,
-        5, 6, 7, 6, 7, 8
+        1, 2, 3, 2, 3, 4, 0, 0,
+        3, 4, 5, 4, 5, 6, 0, 0,
+        5, 6, 7, 6, 7, 8, 0, 0
     };
 
     const ImageReference2D original(ColorFormat::RGB, ColorType::UnsignedByte, {2, 3}, originalData);
+
+    std::optional<Trade::ImageData2D> import(const Containers::ArrayView<const char> data) {
+        TgaImporter importer;
+        if(!importer.openData(data)) return std::nullopt;
+        return importer.image2D(0);
+    }
+
+    /* Mix of long runs, short runs and noise */
+    std::vector<char> pattern(const std::size_t pixelSize, const std::size_t width, const std::size_t height) {
+        std::vector<char> data(pixelSize*width*height);
+        for(std::size_t y = 0; y != height; ++y) for(std::size_t x = 0; x != width; ++x)
+            for(std::size_t c = 0; c != pixelSize; ++c) {
+                const std::size_t i = y*width + x;
+                char value;
+                if(x < 300) value = char(y + c);
+                else if(x < 310) value = char((x/2)*3 + c);
+                else value = char(i*7 + c*13 + (i*i >> 3));
+                data[i*pixelSize + c] = value;
+            }
+        return data;
+    }
 }
 
 TgaImageConverterTest::TgaImageConverterTest() {
     addTests({&TgaImageConverterTest::wrongFormat,
               &TgaImageConverterTest::wrongType,
 
-              &TgaImageConverterTest::data});
+              &TgaImageConverterTest::data,
+              &TgaImageConverterTest::dataUncompressed,
+              &TgaImageConverterTest::rleRuns,
+              &TgaImageConverterTest::rleGrayscale,
+              &TgaImageConverterTest::rleSmaller,
+              &TgaImageConverterTest::threads,
+              &TgaImageConverterTest::file,
+              &TgaImageConverterTest::fileUncompressed});
 }
 
 void TgaImageConverterTest::wrongFormat() {
@@ -99,8 +136,122 @@ void TgaImageConverterTest::data() {
     CORRADE_COMPARE(converted->size(), Vector2i(2, 3));
     CORRADE_COMPARE(converted->format(), ColorFormat::RGB);
     CORRADE_COMPARE(converted->type(), ColorType::UnsignedByte);
-    CORRADE_COMPARE((std::string{converted->data(), 2*3*3}),
-                    (std::string{original.data(), 2*3*3}));
+    CORRADE_COMPARE((std::string{converted->data(), 8*3}),
+                    (std::string{original.data(), 8*3}));
+}
+
+void TgaImageConverterTest::dataUncompressed() {
+    const auto data = TgaImageConverter().setCompression(TgaImageConverter::Compression::None).exportToData(original);
+    CORRADE_COMPARE(data.size(), 18 + 2*3*3);
+    CORRADE_COMPARE(data[2], 2);
+
+    std::optional<Trade::ImageData2D> converted = import(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(converted->format(), ColorFormat::RGB);
+    CORRADE_COMPARE((std::string{converted->data(), 8*3}),
+                    (std::string{original.data(), 8*3}));
+}
+
+void TgaImageConverterTest::rleRuns() {
+    const std::vector<char> pixels = pattern(4, 400, 7);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {400, 7}, pixels.data()};
+
+    const auto data = TgaImageConverter().exportToData(image);
+    CORRADE_COMPARE(data[2], 10);
+
+    std::optional<Trade::ImageData2D> converted = import(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(400, 7));
+    CORRADE_COMPARE(converted->format(), ColorFormat::RGBA);
+    CORRADE_COMPARE((std::string{converted->data(), pixels.size()}),
+                    (std::string{pixels.data(), pixels.size()}));
+}
+
+void TgaImageConverterTest::rleGrayscale() {
+    const std::vector<char> pixels = pattern(1, 400, 7);
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    const ImageReference2D image{ColorFormat::Red, ColorType::UnsignedByte, {400, 7}, pixels.data()};
+    #else
+    const ImageReference2D image{ColorFormat::Luminance, ColorType::UnsignedByte, {400, 7}, pixels.data()};
+    #endif
+
+    const auto data = TgaImageConverter().exportToData(image);
+    CORRADE_COMPARE(data[2], 11);
+
+    std::optional<Trade::ImageData2D> converted = import(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(400, 7));
+    CORRADE_COMPARE((std::string{converted->data(), pixels.size()}),
+                    (std::string{pixels.data(), pixels.size()}));
+}
+
+void TgaImageConverterTest::rleSmaller() {
+    /* Uniform 256x256 RGB image is two run packets per scanline */
+    const std::vector<char> pixels(256*256*3, 17);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {256, 256}, pixels.data()};
+
+    const auto data = TgaImageConverter().exportToData(image);
+    CORRADE_COMPARE(data.size(), 18 + 256*2*4);
+
+    std::optional<Trade::ImageData2D> converted = import(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE((std::string{converted->data(), pixels.size()}),
+                    (std::string{pixels.data(), pixels.size()}));
+}
+
+void TgaImageConverterTest::threads() {
+    /* Large enough to be split into many blocks */
+    const std::vector<char> pixels = pattern(3, 1000, 700);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {1000, 700}, pixels.data()};
+
+    const auto single = TgaImageConverter().setThreadCount(1).exportToData(image);
+    const auto multiple = TgaImageConverter().setThreadCount(4).exportToData(image);
+    CORRADE_COMPARE((std::string{multiple, multiple.size()}),
+                    (std::string{single, single.size()}));
+
+    std::optional<Trade::ImageData2D> converted = import(multiple);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(1000, 700));
+    CORRADE_VERIFY(std::string(converted->data(), pixels.size()) == std::string(pixels.data(), pixels.size()));
+}
+
+void TgaImageConverterTest::file() {
+    const std::vector<char> pixels = pattern(3, 1000, 300);
+    const ImageReference2D image{ColorFormat::RGB, ColorType::UnsignedByte, {1000, 300}, pixels.data()};
+    const std::string filename = Utility::Directory::join(TGAIMAGECONVERTER_TEST_DIR, "file.tga");
+
+    TgaImageConverter converter;
+    CORRADE_VERIFY(converter.exportToFile(image, filename));
+
+    /* Streamed file is the same as in-memory output */
+    const auto data = converter.exportToData(image);
+    const auto file = Utility::Directory::read(filename);
+    CORRADE_COMPARE((std::string{file, file.size()}),
+                    (std::string{data, data.size()}));
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(1000, 300));
+    CORRADE_VERIFY(std::string(converted->data(), pixels.size()) == std::string(pixels.data(), pixels.size()));
+
+    Utility::Directory::rm(filename);
+}
+
+void TgaImageConverterTest::fileUncompressed() {
+    const std::string filename = Utility::Directory::join(TGAIMAGECONVERTER_TEST_DIR, "file-uncompressed.tga");
+
+    CORRADE_VERIFY(TgaImageConverter().setCompression(TgaImageConverter::Compression::None).exportToFile(original, filename));
+
+    const auto file = Utility::Directory::read(filename);
+    CORRADE_COMPARE(file.size(), 18 + 2*3*3);
+    CORRADE_COMPARE(file[2], 2);
+    CORRADE_COMPARE((std::string{file + 18, 2*3*3}),
+                    (std::string{"\3\2\1\4\3\2\5\4\3\6\5\4\7\6\5\10\7\6", 2*3*3}));
+
+    Utility::Directory::rm(filename);
 }
 
 }}}
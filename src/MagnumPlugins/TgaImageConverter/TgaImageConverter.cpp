@@ -26,26 +26,33 @@
 #include "TgaImageConverter.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
-#include <tuple>
+#include <functional>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/ColorFormat.h"
 #include "Magnum/Image.h"
-#include "Magnum/Math/Swizzle.h"
+#include "Magnum/ImageConversion.h"
 #include "Magnum/Math/Vector4.h"
+#include "Magnum/Math/Implementation/Simd.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
-namespace Magnum { namespace Trade {
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
 
-TgaImageConverter::TgaImageConverter() = default;
+namespace Magnum { namespace Trade {
 
-TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)) {}
+namespace {
 
-auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+/* Scanlines are compressed in blocks of roughly this size, which is also the
+   granularity of parallel processing and of writes when streaming */
+constexpr std::size_t BlockSize = 256*1024;
 
-Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D& image) const {
+bool checkImage(const ImageReference2D& image, const char* const prefix) {
     if(image.format() != ColorFormat::RGB &&
        image.format() != ColorFormat::RGBA
        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
@@ -56,25 +63,24 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D
        #endif
        )
     {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color format" << image.format();
-        return nullptr;
+        Error() << prefix << "unsupported color format" << image.format();
+        return false;
     }
 
     if(image.type() != ColorType::UnsignedByte) {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color type" << image.type();
-        return nullptr;
+        Error() << prefix << "unsupported color type" << image.type();
+        return false;
     }
 
-    /* Initialize data buffer */
-    const auto pixelSize = UnsignedByte(image.pixelSize());
-    auto data = Containers::Array<char>::zeroInitialized(sizeof(TgaHeader) + pixelSize*image.size().product());
+    return true;
+}
 
-    /* Fill header */
-    auto header = reinterpret_cast<TgaHeader*>(data.begin());
+TgaHeader header(const ImageReference2D& image, const TgaImageConverter::Compression compression) {
+    TgaHeader header{};
     switch(image.format()) {
         case ColorFormat::RGB:
         case ColorFormat::RGBA:
-            header->imageType = 2;
+            header.imageType = 2;
             break;
         #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
         case ColorFormat::Red:
@@ -82,28 +88,214 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D
         #ifdef MAGNUM_TARGET_GLES2
         case ColorFormat::Luminance:
         #endif
-            header->imageType = 3;
+            header.imageType = 3;
             break;
         default: CORRADE_ASSERT_UNREACHABLE();
     }
-    header->bpp = pixelSize*8;
-    header->width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
-    header->height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
-
-    /* Fill data */
-    std::copy(image.data(), image.data()+pixelSize*image.size().product(), data.begin()+sizeof(TgaHeader));
-
-    if(image.format() == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    if(compression == TgaImageConverter::Compression::Rle) header.imageType |= 8;
+    header.bpp = image.pixelSize()*8;
+    header.width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
+    header.height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    return header;
+}
+
+/* Converts a scanline from RGB(A) to BGR(A) */
+void swizzleScanline(const char* src, char* dst, const std::size_t pixelSize, const std::size_t width) {
+    if(pixelSize == 1) {
+        std::memcpy(dst, src, width);
+        return;
+    }
+
+    if(pixelSize == 3) ImageConversion::swapRedBlue(
+        {reinterpret_cast<const Math::Vector3<UnsignedByte>*>(src), width},
+        {reinterpret_cast<Math::Vector3<UnsignedByte>*>(dst), width});
+    else ImageConversion::swapRedBlue(
+        {reinterpret_cast<const Math::Vector4<UnsignedByte>*>(src), width},
+        {reinterpret_cast<Math::Vector4<UnsignedByte>*>(dst), width});
+}
+
+/* Count of pixels equal to the first one, at most count. A run of equal
+   pixels is a byte sequence where each byte is equal to the byte one pixel
+   before it, so the scan is done on whole vectors of bytes regardless of
+   pixel size. */
+template<std::size_t pixelSize> std::size_t runLength(const char* const data, const std::size_t count) {
+    const std::size_t end = (count - 1)*pixelSize;
+    std::size_t i = 0;
+
+    #if defined(MAGNUM_MATH_SSE2)
+    for(; i + 16 <= end; i += 16) {
+        const __m128i equal = _mm_cmpeq_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + pixelSize)));
+        if(_mm_movemask_epi8(equal) != 0xffff) break;
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; i + 16 <= end; i += 16) {
+        const uint64x2_t equal = vreinterpretq_u64_u8(vceqq_u8(
+            vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)),
+            vld1q_u8(reinterpret_cast<const uint8_t*>(data + i + pixelSize))));
+        if((vgetq_lane_u64(equal, 0) & vgetq_lane_u64(equal, 1)) != ~uint64_t{}) break;
+    }
+    #endif
+
+    for(; i != end && data[i] == data[i + pixelSize]; ++i);
+    return 1 + i/pixelSize;
+}
+
+/* Runs shorter than this are stored in raw packets, as a separate run packet
+   wouldn't save anything for single-byte pixels */
+template<std::size_t pixelSize> constexpr std::size_t minRunLength() {
+    return pixelSize == 1 ? 3 : 2;
+}
+
+/* Appends RLE packets for given scanline. Packets are at most 128 pixels
+   long, with highest bit of the header set for runs. */
+template<std::size_t pixelSize> void encodeRle(const char* const data, const std::size_t width, std::vector<char>& out) {
+    constexpr std::size_t MaxPacketLength = 128;
+    for(std::size_t i = 0; i != width; ) {
+        const std::size_t run = runLength<pixelSize>(data + i*pixelSize, std::min(width - i, MaxPacketLength));
+        if(run >= minRunLength<pixelSize>()) {
+            out.push_back(char(0x80|(run - 1)));
+            out.insert(out.end(), data + i*pixelSize, data + (i + 1)*pixelSize);
+            i += run;
+            continue;
+        }
+
+        /* Extend the raw packet until a long enough run starts */
+        std::size_t raw = run;
+        while(i + raw < width && raw < MaxPacketLength) {
+            const std::size_t next = runLength<pixelSize>(data + (i + raw)*pixelSize, std::min(width - i - raw, minRunLength<pixelSize>()));
+            if(next >= minRunLength<pixelSize>()) break;
+            raw += next;
+        }
+        raw = std::min(raw, MaxPacketLength);
+
+        out.push_back(char(raw - 1));
+        out.insert(out.end(), data + i*pixelSize, data + (i + raw)*pixelSize);
+        i += raw;
+    }
+}
+
+void encodeScanlines(const ImageReference2D& image, const TgaImageConverter::Compression compression, const Int begin, const Int end, std::vector<char>& out) {
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t width = image.size().x();
+    const std::size_t scanlineSize = pixelSize*width;
+    /* Rows of the input image are aligned to four bytes */
+    const std::size_t rowSize = ((scanlineSize + 3)/4)*4;
+
+    out.clear();
+    std::vector<char> swizzled;
+    if(compression == TgaImageConverter::Compression::None) {
+        out.resize(scanlineSize*(end - begin));
+    } else {
+        /* The worst case is a raw packet header every 128 pixels */
+        out.reserve((scanlineSize + (width + 127)/128)*(end - begin));
+        swizzled.resize(scanlineSize);
+    }
+
+    for(Int y = begin; y != end; ++y) {
+        const char* const scanline = image.data() + y*rowSize;
+        if(compression == TgaImageConverter::Compression::None) {
+            swizzleScanline(scanline, out.data() + (y - begin)*scanlineSize, pixelSize, width);
+            continue;
+        }
+
+        swizzleScanline(scanline, swizzled.data(), pixelSize, width);
+        switch(pixelSize) {
+            case 1: encodeRle<1>(swizzled.data(), width, out); break;
+            case 3: encodeRle<3>(swizzled.data(), width, out); break;
+            case 4: encodeRle<4>(swizzled.data(), width, out); break;
+            default: CORRADE_ASSERT_UNREACHABLE();
+        }
+    }
+}
+
+/* Encodes the image in blocks of scanlines and passes them to output in
+   order. Each thread processes one block at a time, so at most threadCount
+   blocks are kept in memory. */
+void encode(const ImageReference2D& image, const TgaImageConverter::Compression compression, std::size_t threadCount, const std::function<void(const std::vector<char>&)>& output) {
+    const Int height = image.size().y();
+    const Int blockHeight = std::max(Int(BlockSize/std::max(std::size_t(image.pixelSize()*image.size().x()), std::size_t(1))), 1);
+    const std::size_t blockCount = (height + blockHeight - 1)/blockHeight;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    threadCount = 1;
+    #endif
+    threadCount = std::max(std::min(threadCount, blockCount), std::size_t(1));
+
+    std::vector<std::vector<char>> blocks(threadCount);
+    for(std::size_t first = 0; first < blockCount; first += threadCount) {
+        const std::size_t count = std::min(threadCount, blockCount - first);
+        auto encodeBlock = [&](const std::size_t i) {
+            const Int begin = (first + i)*blockHeight;
+            encodeScanlines(image, compression, begin, std::min(begin + blockHeight, height), blocks[i]);
+        };
+
+        /* The last block is processed on the calling thread */
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::vector<std::thread> threads;
+        threads.reserve(count - 1);
+        for(std::size_t i = 0; i != count - 1; ++i)
+            threads.emplace_back(encodeBlock, i);
+        encodeBlock(count - 1);
+        for(std::thread& thread: threads) thread.join();
+        #else
+        encodeBlock(0);
+        #endif
+
+        for(std::size_t i = 0; i != count; ++i) output(blocks[i]);
+    }
+}
+
+}
+
+TgaImageConverter::TgaImageConverter(): _compression{Compression::Rle}, _threadCount{0} {}
+
+TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)), _compression{Compression::Rle}, _threadCount{0} {}
+
+auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+
+Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D& image) const {
+    if(!checkImage(image, "Trade::TgaImageConverter::exportToData():")) return nullptr;
+
+    const TgaHeader fileHeader = header(image, _compression);
+    std::vector<char> data{reinterpret_cast<const char*>(&fileHeader), reinterpret_cast<const char*>(&fileHeader) + sizeof(TgaHeader)};
+    if(_compression == Compression::None)
+        data.reserve(sizeof(TgaHeader) + image.pixelSize()*image.size().product());
+    encode(image, _compression, _threadCount, [&data](const std::vector<char>& block) {
+        data.insert(data.end(), block.begin(), block.end());
+    });
+
+    Containers::Array<char> out{data.size()};
+    std::copy(data.begin(), data.end(), out.begin());
+    return out;
+}
+
+bool TgaImageConverter::doExportToFile(const ImageReference2D& image, const std::string& filename) const {
+    if(!checkImage(image, "Trade::TgaImageConverter::exportToFile():")) return false;
+
+    std::ofstream out{filename, std::ofstream::binary};
+    if(!out.good()) {
+        Error() << "Trade::TgaImageConverter::exportToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    /* Write the blocks as they are encoded instead of assembling the whole
+       file in memory */
+    const TgaHeader fileHeader = header(image, _compression);
+    out.write(reinterpret_cast<const char*>(&fileHeader), sizeof(TgaHeader));
+    encode(image, _compression, _threadCount, [&out](const std::vector<char>& block) {
+        out.write(block.data(), block.size());
+    });
+
+    if(!out.good()) {
+        Error() << "Trade::TgaImageConverter::exportToFile(): cannot write to file" << filename;
+        return false;
     }
 
-    return data;
+    return true;
 }
 
 }}
@@ -62,18 +62,71 @@ dependency of another plugin, you need to request `TgaImageConverter`
 component of `Magnum` package in CMake and link to
 `${MAGNUM_TGAIMAGECONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
 @ref plugins for more information.
+
+The image data are RLE-compressed by default, which is especially efficient
+for images with large areas of the same color, such as glyph caches or
+distance field textures. Runs don't cross scanline boundaries, which allows
+the image to be compressed in blocks of scanlines in parallel, see
+@ref setThreadCount(). Use @ref setCompression() to produce uncompressed
+files instead. When exporting to a file, the header and compressed blocks are
+written to the file as they are produced instead of assembling the whole
+output in memory first.
 */
 class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageConverter {
     public:
+        /**
+         * @brief Compression
+         *
+         * @see @ref setCompression()
+         */
+        enum class Compression: UnsignedByte {
+            None,   /**< Uncompressed */
+            Rle     /**< Run-length encoding */
+        };
+
         /** @brief Default constructor */
         explicit TgaImageConverter();
 
         /** @brief Plugin manager constructor */
         explicit TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        /** @brief Compression */
+        Compression compression() const { return _compression; }
+
+        /**
+         * @brief Set compression
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Compression::Rle.
+         */
+        TgaImageConverter& setCompression(Compression compression) {
+            _compression = compression;
+            return *this;
+        }
+
+        /** @brief Thread count */
+        std::size_t threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count
+         * @return Reference to self (for method chaining)
+         *
+         * Count of threads used for compressing blocks of scanlines. If set
+         * to `0`, hardware concurrency is used. Small images are always
+         * processed on the calling thread. Default is `0`.
+         */
+        TgaImageConverter& setThreadCount(std::size_t count) {
+            _threadCount = count;
+            return *this;
+        }
+
     private:
         Features MAGNUM_TGAIMAGECONVERTER_LOCAL doFeatures() const override;
         Containers::Array<char> MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToData(const ImageReference2D& image) const override;
+        bool MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToFile(const ImageReference2D& image, const std::string& filename) const override;
+
+        Compression _compression;
+        std::size_t _threadCount;
 };
 
 }}
@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Swizzle.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Test/AbstractBenchmarkTester.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/TgaImporter/TgaImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct TgaImporterBenchmark: Magnum::Test::AbstractBenchmarkTester {
+    explicit TgaImporterBenchmark();
+
+    void naive24();
+    void naive32();
+    void uncompressed24();
+    void uncompressed32();
+    void rle24();
+    void rle32();
+
+    private:
+        void benchmark(const std::string& name, const std::string& data);
+
+        std::string _uncompressed24, _uncompressed32, _rle24, _rle32;
+};
+
+namespace {
+
+enum: UnsignedShort { Width = 1024, Height = 1024 };
+
+std::string header(const char type, const char bpp) {
+    return {'\0', '\0', type, '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0',
+        char(Width & 0xff), char(Width >> 8), char(Height & 0xff), char(Height >> 8), bpp, '\0'};
+}
+
+/* Horizontal stripes with some noise, giving a mix of runs and raw packets
+   in the RLE variant */
+char pixelValue(const std::size_t x, const std::size_t y, const std::size_t channel) {
+    return char((y/4)*16 + channel*32 + (x % 64 < 8 ? x*7 : 0));
+}
+
+std::string uncompressed(const std::size_t pixelSize) {
+    std::string data = header(2, pixelSize*8);
+    for(std::size_t y = 0; y != Height; ++y) for(std::size_t x = 0; x != Width; ++x)
+        for(std::size_t c = 0; c != pixelSize; ++c) data += pixelValue(x, y, c);
+    return data;
+}
+
+std::string rle(const std::size_t pixelSize) {
+    std::string data = header(10, pixelSize*8);
+    for(std::size_t y = 0; y != Height; ++y) for(std::size_t x = 0; x != Width; ) {
+        /* Noisy part as a raw packet, rest of the 64-pixel block as a run */
+        if(x % 64 < 8) {
+            data += char(7);
+            for(std::size_t i = 0; i != 8; ++i, ++x)
+                for(std::size_t c = 0; c != pixelSize; ++c) data += pixelValue(x, y, c);
+        } else {
+            data += char(0x80 | 55);
+            for(std::size_t c = 0; c != pixelSize; ++c) data += pixelValue(x, y, c);
+            x += 56;
+        }
+    }
+    return data;
+}
+
+}
+
+TgaImporterBenchmark::TgaImporterBenchmark(): AbstractBenchmarkTester{10},
+    _uncompressed24{uncompressed(3)}, _uncompressed32{uncompressed(4)},
+    _rle24{rle(3)}, _rle32{rle(4)}
+{
+    addTests({&TgaImporterBenchmark::naive24,
+              &TgaImporterBenchmark::naive32,
+              &TgaImporterBenchmark::uncompressed24,
+              &TgaImporterBenchmark::uncompressed32,
+              &TgaImporterBenchmark::rle24,
+              &TgaImporterBenchmark::rle32});
+}
+
+void TgaImporterBenchmark::benchmark(const std::string& name, const std::string& data) {
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    MAGNUM_BENCHMARK(name, std::size_t(Width)*Height) {
+        std::optional<ImageData2D> image = importer.image2D(0);
+        escape(image->data());
+    }
+}
+
+/* Per-pixel swizzle through Math::swizzle(), for comparison */
+void TgaImporterBenchmark::naive24() {
+    MAGNUM_BENCHMARK("naive swizzle, 24 bits", std::size_t(Width)*Height) {
+        std::string data = _uncompressed24.substr(18);
+        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(&data[0]);
+        std::transform(pixels, pixels + std::size_t(Width)*Height, pixels,
+            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
+        escape(&data[0]);
+    }
+}
+
+void TgaImporterBenchmark::naive32() {
+    MAGNUM_BENCHMARK("naive swizzle, 32 bits", std::size_t(Width)*Height) {
+        std::string data = _uncompressed32.substr(18);
+        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(&data[0]);
+        std::transform(pixels, pixels + std::size_t(Width)*Height, pixels,
+            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+        escape(&data[0]);
+    }
+}
+
+void TgaImporterBenchmark::uncompressed24() {
+    benchmark("image2D(), uncompressed, 24 bits", _uncompressed24);
+}
+
+void TgaImporterBenchmark::uncompressed32() {
+    benchmark("image2D(), uncompressed, 32 bits", _uncompressed32);
+}
+
+void TgaImporterBenchmark::rle24() {
+    benchmark("image2D(), RLE, 24 bits", _rle24);
+}
+
+void TgaImporterBenchmark::rle32() {
+    benchmark("image2D(), RLE, 32 bits", _rle32);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterBenchmark)
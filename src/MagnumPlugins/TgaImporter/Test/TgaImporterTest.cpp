@@ -24,11 +24,14 @@
 */
 
 #include <sstream>
+#include <vector>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
@@ -52,7 +55,29 @@ class TgaImporterTest: public TestSuite::Tester {
         void grayscaleBits8();
         void grayscaleBits16();
 
+        void colorBits24Large();
+        void colorBits32Large();
+        void identField();
+        void shortPixelData();
+
+        void rleColorBits24();
+        void rleColorBits32();
+        void rleGrayscaleBits8();
+        void rleTruncated();
+        void rleOverflow();
+
+        void size();
+        void sizeShort();
+        void region();
+        void regionEmpty();
+        void regionOutOfBounds();
+        void regionRle();
+        void regionRleTruncated();
+        void regionRleTiles();
+        void regionWholeImage();
+
         void file();
+        void fileRegion();
 };
 
 TgaImporterTest::TgaImporterTest() {
@@ -68,7 +93,29 @@ TgaImporterTest::TgaImporterTest() {
               &TgaImporterTest::grayscaleBits8,
               &TgaImporterTest::grayscaleBits16,
 
-              &TgaImporterTest::file});
+              &TgaImporterTest::colorBits24Large,
+              &TgaImporterTest::colorBits32Large,
+              &TgaImporterTest::identField,
+              &TgaImporterTest::shortPixelData,
+
+              &TgaImporterTest::rleColorBits24,
+              &TgaImporterTest::rleColorBits32,
+              &TgaImporterTest::rleGrayscaleBits8,
+              &TgaImporterTest::rleTruncated,
+              &TgaImporterTest::rleOverflow,
+
+              &TgaImporterTest::size,
+              &TgaImporterTest::sizeShort,
+              &TgaImporterTest::region,
+              &TgaImporterTest::regionEmpty,
+              &TgaImporterTest::regionOutOfBounds,
+              &TgaImporterTest::regionRle,
+              &TgaImporterTest::regionRleTruncated,
+              &TgaImporterTest::regionRleTiles,
+              &TgaImporterTest::regionWholeImage,
+
+              &TgaImporterTest::file,
+              &TgaImporterTest::fileRegion});
 }
 
 void TgaImporterTest::openNonexistent() {
@@ -132,10 +179,11 @@ void TgaImporterTest::colorBits24() {
         3, 4, 5, 4, 5, 6,
         5, 6, 7, 6, 7, 8
     };
+    /* Rows are padded to four bytes */
     const char pixels[] = {
-        3, 2, 1, 4, 3, 2,
-        5, 4, 3, 6, 5, 4,
-        7, 6, 5, 8, 7, 6
+        3, 2, 1, 4, 3, 2, 0, 0,
+        5, 4, 3, 6, 5, 4, 0, 0,
+        7, 6, 5, 8, 7, 6, 0, 0
     };
     CORRADE_VERIFY(importer.openData(data));
 
@@ -144,8 +192,9 @@ void TgaImporterTest::colorBits24() {
     CORRADE_COMPARE(image->format(), ColorFormat::RGB);
     CORRADE_COMPARE(image->size(), Vector2i(2, 3));
     CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
-    CORRADE_COMPARE((std::string{image->data(), 2*3*3}),
-                    (std::string{pixels, 2*3*3}));
+    CORRADE_COMPARE(image->dataSize(image->size()), 8*3);
+    CORRADE_COMPARE((std::string{image->data(), 8*3}),
+                    (std::string{pixels, 8*3}));
 }
 
 void TgaImporterTest::colorBits32() {
@@ -168,8 +217,8 @@ void TgaImporterTest::colorBits32() {
     CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
     CORRADE_COMPARE(image->size(), Vector2i(2, 3));
     CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
-    CORRADE_COMPARE((std::string{image->data(), 2*3*3}),
-                    (std::string{pixels, 2*3*3}));
+    CORRADE_COMPARE((std::string{image->data(), 2*3*4}),
+                    (std::string{pixels, 2*3*4}));
 }
 
 void TgaImporterTest::grayscaleBits8() {
@@ -191,8 +240,8 @@ void TgaImporterTest::grayscaleBits8() {
     #endif
     CORRADE_COMPARE(image->size(), Vector2i(2, 3));
     CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
-    CORRADE_COMPARE((std::string{image->data(), 2*3}),
-                    (std::string{data + 18, 2*3}));
+    CORRADE_COMPARE((std::string{image->data(), 4*3}),
+                    (std::string{"\x01\x02\0\0\x03\x04\0\0\x05\x06\0\0", 4*3}));
 }
 
 void TgaImporterTest::grayscaleBits16() {
@@ -206,6 +255,402 @@ void TgaImporterTest::grayscaleBits16() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel: 16\n");
 }
 
+namespace {
+
+/* Image large enough to go through both the vectorized and the remainder
+   code path in the BGR(A) conversion. Expected rows are padded to four
+   bytes. */
+std::string largeImage(const std::size_t pixelSize, const std::size_t width, const std::size_t height, std::string& expected) {
+    std::string data{'\0', '\0', '\2', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0',
+        char(width), '\0', char(height), '\0', char(pixelSize*8), '\0'};
+    expected.clear();
+    for(std::size_t i = 0; i != width*height; ++i) {
+        char pixel[4];
+        for(std::size_t j = 0; j != pixelSize; ++j) pixel[j] = char(i*pixelSize + j);
+        data.append(pixel, pixelSize);
+        std::swap(pixel[0], pixel[2]);
+        expected.append(pixel, pixelSize);
+        if(i % width == width - 1) expected.append((4 - width*pixelSize % 4) % 4, '\0');
+    }
+    return data;
+}
+
+}
+
+void TgaImporterTest::colorBits24Large() {
+    std::string pixels;
+    const std::string data = largeImage(3, 37, 3, pixels);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->size(), Vector2i(37, 3));
+    CORRADE_COMPARE((std::string{image->data(), pixels.size()}), pixels);
+}
+
+void TgaImporterTest::colorBits32Large() {
+    std::string pixels;
+    const std::string data = largeImage(4, 37, 3, pixels);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(image->size(), Vector2i(37, 3));
+    CORRADE_COMPARE((std::string{image->data(), pixels.size()}), pixels);
+}
+
+void TgaImporterTest::identField() {
+    TgaImporter importer;
+    const char data[] = {
+        3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        'i', 'd', '!',
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE((std::string{image->data(), 4*3}),
+                    (std::string{"\x01\x02\0\0\x03\x04\0\0\x05\x06\0\0", 4*3}));
+}
+
+void TgaImporterTest::shortPixelData() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        5, 6, 7, 6, 7
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short, expected 18 bytes of pixel data but got 17\n");
+}
+
+void TgaImporterTest::rleColorBits24() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Run of three pixels, then three raw pixels */
+        char(0x82), 1, 2, 3,
+        0x02, 3, 4, 5, 4, 5, 6, 5, 6, 7
+    };
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1, 0, 0,
+        3, 2, 1, 5, 4, 3, 0, 0,
+        6, 5, 4, 7, 6, 5, 0, 0
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE((std::string{image->data(), 8*3}),
+                    (std::string{pixels, 8*3}));
+}
+
+void TgaImporterTest::rleColorBits32() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0,
+        /* Two raw pixels, then a run of four */
+        0x01, 1, 2, 3, 1, 2, 3, 4, 1,
+        char(0x83), 3, 4, 5, 1
+    };
+    const char pixels[] = {
+        3, 2, 1, 1, 4, 3, 2, 1,
+        5, 4, 3, 1, 5, 4, 3, 1,
+        5, 4, 3, 1, 5, 4, 3, 1
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE((std::string{image->data(), 2*3*4}),
+                    (std::string{pixels, 2*3*4}));
+}
+
+void TgaImporterTest::rleGrayscaleBits8() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        char(0x81), 1,
+        0x03, 2, 3, 4, 5
+    };
+    const char pixels[] = {
+        1, 1, 0, 0,
+        2, 3, 0, 0,
+        4, 5, 0, 0
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(image->format(), ColorFormat::Red);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::Luminance);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE((std::string{image->data(), 4*3}),
+                    (std::string{pixels, 4*3}));
+}
+
+void TgaImporterTest::rleTruncated() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        char(0x82), 1, 2, 3,
+        0x02, 3, 4, 5, 4, 5, 6, 5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): invalid or truncated RLE data\n");
+}
+
+void TgaImporterTest::rleOverflow() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        /* Run of seven pixels in six-pixel image */
+        char(0x86), 1
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): invalid or truncated RLE data\n");
+}
+
+void TgaImporterTest::size() {
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::ImageRegion);
+
+    /* Pixel data are not needed for RLE files */
+    const char data[] = { 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0 };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Vector2i> size = importer.image2DSize(0);
+    CORRADE_VERIFY(size);
+    CORRADE_COMPARE(*size, Vector2i(2, 3));
+}
+
+void TgaImporterTest::sizeShort() {
+    TgaImporter importer;
+    const char data[] = { 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2DSize(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2DSize(): the file is too short: 17 bytes\n");
+}
+
+void TgaImporterTest::region() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4, 3, 4, 5,
+        4, 5, 6, 5, 6, 7, 6, 7, 8,
+        7, 8, 9, 8, 9, 10, 9, 10, 11
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0, {{1, 1}, {3, 3}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 2));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+
+    /* Rows are aligned to four bytes */
+    CORRADE_COMPARE((std::string{image->data(), 6}),
+                    (std::string{"\x07\x06\x05\x08\x07\x06", 6}));
+    CORRADE_COMPARE((std::string{image->data() + 8, 6}),
+                    (std::string{"\x0a\x09\x08\x0b\x0a\x09", 6}));
+}
+
+void TgaImporterTest::regionEmpty() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0, {{1, 2}, {1, 3}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(0, 1));
+}
+
+void TgaImporterTest::regionOutOfBounds() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0, {{1, 1}, {3, 2}}));
+    CORRADE_VERIFY(!importer.image2D(0, {{-1, 0}, {1, 1}}));
+    CORRADE_VERIFY(!importer.image2D(0, {{1, 1}, {0, 2}}));
+    CORRADE_COMPARE(debug.str(),
+        "Trade::TgaImporter::image2D(): region Range({1, 1}, {3, 2}) is not contained in image of size Vector(2, 3)\n"
+        "Trade::TgaImporter::image2D(): region Range({-1, 0}, {1, 1}) is not contained in image of size Vector(2, 3)\n"
+        "Trade::TgaImporter::image2D(): region Range({1, 1}, {0, 2}) is not contained in image of size Vector(2, 3)\n");
+}
+
+void TgaImporterTest::regionRle() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 24, 0,
+        /* Run of four pixels and five raw pixels, both spanning two rows */
+        char(0x83), 1, 2, 3,
+        0x04, 4, 5, 6, 5, 6, 7, 6, 7, 8, 7, 8, 9, 8, 9, 10
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0, {{1, 1}, {3, 3}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 2));
+    CORRADE_COMPARE((std::string{image->data(), 6}),
+                    (std::string{"\x06\x05\x04\x07\x06\x05", 6}));
+    CORRADE_COMPARE((std::string{image->data() + 8, 6}),
+                    (std::string{"\x09\x08\x07\x0a\x09\x08", 6}));
+
+    /* Region inside the run */
+    image = importer.image2D(0, {{0, 0}, {3, 1}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE((std::string{image->data(), 9}),
+                    (std::string{"\x03\x02\x01\x03\x02\x01\x03\x02\x01", 9}));
+}
+
+void TgaImporterTest::regionRleTruncated() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        char(0x82), 1,
+        0x01, 3, 4
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    /* The first rows can be imported, the last one not */
+    std::optional<Trade::ImageData2D> image = importer.image2D(0, {{0, 1}, {2, 2}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE((std::string{image->data(), 2}),
+                    (std::string{"\x01\x03", 2}));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0, {{0, 2}, {2, 3}}));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): invalid or truncated RLE data\n");
+}
+
+namespace {
+    /* RGB image with alternating runs and raw packets of varying lengths,
+       most of them spanning row boundaries */
+    std::string rleImage(const Vector2i& size, const UnsignedByte seed) {
+        std::string data{"\0\0\x0a\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\0", 18};
+        data[12] = char(size.x());
+        data[14] = char(size.y());
+        const std::size_t pixelCount = size.product();
+        for(std::size_t i = 0, packet = 0; i < pixelCount; ++packet) {
+            const bool run = packet % 2;
+            const std::size_t count = std::min(run ? packet % 5 + 2 : packet % 7 + 1, pixelCount - i);
+            data += char((run ? 0x80 : 0x00)|(count - 1));
+            for(std::size_t j = 0; j != (run ? 1 : count); ++j)
+                for(std::size_t c = 0; c != 3; ++c) data += char(seed + (i + j)*3 + c);
+            i += count;
+        }
+        return data;
+    }
+}
+
+void TgaImporterTest::regionRleTiles() {
+    const Vector2i size{13, 11};
+    const std::string first = rleImage(size, 0);
+    const std::string second = rleImage(size, 100);
+
+    TgaImporter importer;
+    for(const std::string* data: {&first, &second}) {
+        CORRADE_VERIFY(importer.openData({data->data(), data->size()}));
+        std::optional<Trade::ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+
+        /* Tiles in reverse order first, then in row-major order, so the
+           import continues both from known rows above the tile and from
+           already passed rows. Reopening discards the rows remembered for
+           the previous file. */
+        std::vector<Range2Di> tiles;
+        for(Int y = 0; y < size.y(); y += 4) for(Int x = 0; x < size.x(); x += 5)
+            tiles.push_back(Range2Di::fromSize({x, y}, Math::min(Vector2i{5, 4}, size - Vector2i{x, y})));
+        std::vector<Range2Di> order{tiles.rbegin(), tiles.rend()};
+        order.insert(order.end(), tiles.begin(), tiles.end());
+
+        for(const Range2Di& tile: order) {
+            std::optional<Trade::ImageData2D> region = importer.image2D(0, tile);
+            CORRADE_VERIFY(region);
+            const std::size_t rowSize = (tile.sizeX()*3 + 3)/4*4;
+            const std::size_t imageRowSize = (size.x()*3 + 3)/4*4;
+            for(Int y = 0; y != tile.sizeY(); ++y)
+                CORRADE_COMPARE((std::string{region->data() + y*rowSize, std::size_t(tile.sizeX()*3)}),
+                                (std::string{image->data() + (tile.bottom() + y)*imageRowSize + tile.left()*3, std::size_t(tile.sizeX()*3)}));
+        }
+    }
+}
+
+void TgaImporterTest::regionWholeImage() {
+    /* RGB images of odd width have padded rows, region covering the whole
+       image should give the same data as importing the whole image */
+    std::string pixels;
+    const std::string uncompressed = largeImage(3, 37, 3, pixels);
+    const std::string rle = rleImage({13, 11}, 0);
+
+    TgaImporter importer;
+    for(const std::string* data: {&uncompressed, &rle}) {
+        CORRADE_VERIFY(importer.openData({data->data(), data->size()}));
+        std::optional<Vector2i> size = importer.image2DSize(0);
+        CORRADE_VERIFY(size);
+
+        std::optional<Trade::ImageData2D> image = importer.image2D(0);
+        std::optional<Trade::ImageData2D> region = importer.image2D(0, {{}, *size});
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(region);
+        CORRADE_COMPARE(region->size(), image->size());
+        const std::size_t dataSize = image->dataSize(image->size());
+        CORRADE_COMPARE(dataSize, std::size_t((size->x()*3 + 1)*size->y()));
+        CORRADE_COMPARE((std::string{region->data(), dataSize}),
+                        (std::string{image->data(), dataSize}));
+    }
+}
+
 void TgaImporterTest::file() {
     TgaImporter importer;
     const char data[] = {
@@ -225,8 +670,27 @@ void TgaImporterTest::file() {
     #endif
     CORRADE_COMPARE(image->size(), Vector2i(2, 3));
     CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
-    CORRADE_COMPARE((std::string{image->data(), 2*3}),
-                    (std::string{data + 18, 2*3}));
+    CORRADE_COMPARE((std::string{image->data(), 2}),
+                    (std::string{data + 18, 2}));
+    CORRADE_COMPARE((std::string{image->data() + 4, 2}),
+                    (std::string{data + 20, 2}));
+    CORRADE_COMPARE((std::string{image->data() + 8, 2}),
+                    (std::string{data + 22, 2}));
+}
+
+void TgaImporterTest::fileRegion() {
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
+
+    std::optional<Vector2i> size = importer.image2DSize(0);
+    CORRADE_VERIFY(size);
+    CORRADE_COMPARE(*size, Vector2i(2, 3));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0, {{1, 1}, {2, 3}});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(1, 2));
+    CORRADE_COMPARE(image->data()[0], 4);
+    CORRADE_COMPARE(image->data()[4], 6);
 }
 
 }}}
@@ -26,15 +26,16 @@
 #include "TgaImporter.h"
 
 #include <algorithm>
-#include <fstream>
-#include <sstream>
-#include <Corrade/Utility/Endianness.h>
+#include <cstring>
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/ColorFormat.h"
-#include "Magnum/Math/Swizzle.h"
+#include "Magnum/ImageConversion.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/Implementation/mapFile.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
 #ifdef MAGNUM_TARGET_GLES2
@@ -44,47 +45,222 @@
 
 namespace Magnum { namespace Trade {
 
-TgaImporter::TgaImporter(): in(nullptr) {}
+namespace {
+
+/* Copies count pixels from BGR(A) to RGB(A), swapping first and third byte
+   of each pixel. The source and destination can be the same. */
+template<std::size_t pixelSize> void swizzleCopy(const char* src, char* dst, std::size_t count);
+
+template<> void swizzleCopy<3>(const char* src, char* dst, std::size_t count) {
+    ImageConversion::swapRedBlue({reinterpret_cast<const Math::Vector3<UnsignedByte>*>(src), count},
+                                 {reinterpret_cast<Math::Vector3<UnsignedByte>*>(dst), count});
+}
+
+template<> void swizzleCopy<4>(const char* src, char* dst, std::size_t count) {
+    ImageConversion::swapRedBlue({reinterpret_cast<const Math::Vector4<UnsignedByte>*>(src), count},
+                                 {reinterpret_cast<Math::Vector4<UnsignedByte>*>(dst), count});
+}
+
+template<> void swizzleCopy<1>(const char* src, char* dst, std::size_t count) {
+    std::memcpy(dst, src, count);
+}
+
+/* Decodes RLE packets into count pixels, converting them from BGR(A) to
+   RGB(A). Returns count of consumed input bytes or 0 if the input is
+   truncated or a packet doesn't fit into the image. */
+template<std::size_t pixelSize> std::size_t decodeRle(const char* const begin, const char* const end, char* out, std::size_t count) {
+    const char* in = begin;
+    while(count) {
+        if(in == end) return 0;
+
+        /* Highest bit set means a run of the same pixel, otherwise a raw
+           packet, the rest is pixel count minus one */
+        const UnsignedByte packet = *in++;
+        const std::size_t packetCount = (packet & 0x7f) + 1;
+        if(packetCount > count) return 0;
+
+        if(packet & 0x80) {
+            if(std::size_t(end - in) < pixelSize) return 0;
+            char pixel[pixelSize];
+            swizzleCopy<pixelSize>(in, pixel, 1);
+            in += pixelSize;
+            for(std::size_t i = 0; i != packetCount; ++i, out += pixelSize)
+                std::memcpy(out, pixel, pixelSize);
+        } else {
+            if(std::size_t(end - in) < packetCount*pixelSize) return 0;
+            swizzleCopy<pixelSize>(in, out, packetCount);
+            in += packetCount*pixelSize;
+            out += packetCount*pixelSize;
+        }
+
+        count -= packetCount;
+    }
+
+    return in - begin;
+}
+
+/* Incremental variant of decodeRle() for importing image regions. Packets
+   can span row boundaries, so the decoder remembers the packet it stopped
+   in. */
+template<std::size_t pixelSize> class RleDecoder {
+    public:
+        explicit RleDecoder(const char* const begin, const char* const end, const Implementation::TgaRleRow& row): _begin{begin}, _in{begin + row.offset}, _end{end}, _remaining{row.remaining}, _run{row.run} {
+            std::memcpy(_pixel, row.pixel, pixelSize);
+        }
+
+        Implementation::TgaRleRow state() const {
+            Implementation::TgaRleRow row{std::size_t(_in - _begin), _remaining, _run, {}};
+            std::memcpy(row.pixel, _pixel, pixelSize);
+            return row;
+        }
+
+        /* Decodes count pixels into out or skips them if out is nullptr.
+           Returns false if the input is truncated. */
+        bool decode(char* out, std::size_t count) {
+            while(count) {
+                if(!_remaining) {
+                    if(_in == _end) return false;
+
+                    const UnsignedByte packet = *_in++;
+                    _remaining = (packet & 0x7f) + 1;
+                    _run = packet & 0x80;
+                    if(_run) {
+                        if(std::size_t(_end - _in) < pixelSize) return false;
+                        swizzleCopy<pixelSize>(_in, _pixel, 1);
+                        _in += pixelSize;
+                    } else if(std::size_t(_end - _in) < _remaining*pixelSize) return false;
+                }
+
+                const std::size_t n = std::min(count, _remaining);
+                if(out) {
+                    if(_run) for(std::size_t i = 0; i != n; ++i, out += pixelSize)
+                        std::memcpy(out, _pixel, pixelSize);
+                    else {
+                        swizzleCopy<pixelSize>(_in, out, n);
+                        out += n*pixelSize;
+                    }
+                }
+                if(!_run) _in += n*pixelSize;
 
-TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), in(nullptr) {}
+                _remaining -= n;
+                count -= n;
+            }
+
+            return true;
+        }
+
+    private:
+        const char* const _begin;
+        const char* _in;
+        const char* const _end;
+        std::size_t _remaining;
+        bool _run;
+        char _pixel[pixelSize];
+};
+
+/* Converts given region of the image into rows of given size. Only the
+   rows covered by the region are touched for uncompressed data. RLE data
+   are decoded from the nearest known row start at or above the region and
+   decoder state at the start of each newly reached row is remembered in
+   rows, so subsequent calls don't need to decode from the beginning. */
+template<std::size_t pixelSize> bool convertRegion(const char* const in, const char* const end, const bool rle, const Int width, const Range2Di& region, char* const out, const std::size_t rowSize, std::vector<Implementation::TgaRleRow>& rows) {
+    if(!rle) {
+        for(Int y = 0; y != region.sizeY(); ++y)
+            swizzleCopy<pixelSize>(in + (std::size_t(region.bottom() + y)*width + region.left())*pixelSize, out + y*rowSize, region.sizeX());
+        return true;
+    }
+
+    if(rows.empty()) rows.push_back(Implementation::TgaRleRow{0, 0, false, {}});
+    std::size_t row = std::min(std::size_t(region.bottom()), rows.size() - 1);
+    RleDecoder<pixelSize> decoder{in, end, rows[row]};
+    for(; row != std::size_t(region.bottom()); ++row) {
+        if(!decoder.decode(nullptr, width)) return false;
+        if(row + 1 == rows.size()) rows.push_back(decoder.state());
+    }
+
+    for(Int y = 0; y != region.sizeY(); ++y, ++row) {
+        if(!decoder.decode(nullptr, region.left()) ||
+           !decoder.decode(out + y*rowSize, region.sizeX()) ||
+           !decoder.decode(nullptr, width - region.right()))
+            return false;
+        if(row + 1 == rows.size()) rows.push_back(decoder.state());
+    }
+
+    return true;
+}
+
+/* Moves rows of given length decoded tightly one after another apart to given
+   row size. Goes from the last row, so no row is overwritten before it's
+   moved. */
+void spreadRows(char* const data, const std::size_t rowLength, const std::size_t rowSize, const std::size_t rowCount) {
+    if(rowSize == rowLength) return;
+    for(std::size_t y = rowCount; y > 1; --y)
+        std::memmove(data + (y - 1)*rowSize, data + (y - 1)*rowLength, rowLength);
+}
+
+/* Zeroes padding at the end of each row, so the output doesn't contain
+   uninitialized memory */
+void zeroRowPadding(char* const data, const std::size_t rowLength, const std::size_t rowSize, const std::size_t rowCount) {
+    if(rowSize == rowLength) return;
+    for(std::size_t y = 0; y != rowCount; ++y)
+        std::memset(data + y*rowSize + rowLength, 0, rowSize - rowLength);
+}
+
+}
+
+struct TgaImporter::Properties {
+    ColorFormat format;
+    Vector2i size;
+    std::size_t pixelSize;
+    const char* data;
+    bool rle;
+};
+
+TgaImporter::TgaImporter(): _opened{false} {}
+
+TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _opened{false} {}
 
 TgaImporter::~TgaImporter() { close(); }
 
-auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ImageRegion; }
 
-bool TgaImporter::doIsOpened() const { return in; }
+bool TgaImporter::doIsOpened() const { return _opened; }
 
 void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
-    in = new std::istringstream{{data, data.size()}};
+    /* The data view is not guaranteed to stay valid, copy it */
+    _in = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _in.begin());
+    _opened = true;
 }
 
 void TgaImporter::doOpenFile(const std::string& filename) {
-    in = new std::ifstream(filename, std::ifstream::binary);
-    if(in->good()) return;
+    /* Map the file instead of reading it, the pixels are then converted
+       directly from the mapped memory. Empty file is mapped to an empty
+       array, letting the size check in image2D() fail instead. */
+    std::optional<Containers::Array<char>> data = Implementation::mapFile(filename, "Trade::TgaImporter::openFile():");
+    if(!data) return;
 
-    Error() << "Trade::TgaImporter::openFile(): cannot open file" << filename;
-    close();
+    _in = std::move(*data);
+    _opened = true;
 }
 
 void TgaImporter::doClose() {
-    delete in;
-    in = nullptr;
+    _in = nullptr;
+    _rleRows.clear();
+    _opened = false;
 }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
-std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
+std::optional<TgaImporter::Properties> TgaImporter::parseHeader(const char* const prefix) const {
     /* Check if the file is long enough */
-    in->seekg(0, std::istream::end);
-    std::streamoff filesize = in->tellg();
-    in->seekg(0, std::istream::beg);
-    if(filesize < std::streamoff(sizeof(TgaHeader))) {
-        Error() << "Trade::TgaImporter::image2D(): the file is too short:" << filesize << "bytes";
+    if(_in.size() < sizeof(TgaHeader)) {
+        Error() << prefix << "the file is too short:" << _in.size() << "bytes";
         return std::nullopt;
     }
 
     TgaHeader header;
-    in->read(reinterpret_cast<char*>(&header), sizeof(TgaHeader));
+    std::memcpy(&header, _in.data(), sizeof(TgaHeader));
 
     /* Convert to machine endian */
     header.width = Utility::Endianness::littleEndian(header.width);
@@ -93,12 +269,12 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
     /* Image format */
     ColorFormat format;
     if(header.colorMapType != 0) {
-        Error() << "Trade::TgaImporter::image2D(): paletted files are not supported";
+        Error() << prefix << "paletted files are not supported";
         return std::nullopt;
     }
 
     /* Color */
-    if(header.imageType == 2) {
+    if(header.imageType == 2 || header.imageType == 10) {
         switch(header.bpp) {
             case 24:
                 format = ColorFormat::RGB;
@@ -107,12 +283,12 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
                 format = ColorFormat::RGBA;
                 break;
             default:
-                Error() << "Trade::TgaImporter::image2D(): unsupported color bits-per-pixel:" << header.bpp;
+                Error() << prefix << "unsupported color bits-per-pixel:" << header.bpp;
                 return std::nullopt;
         }
 
     /* Grayscale */
-    } else if(header.imageType == 3) {
+    } else if(header.imageType == 3 || header.imageType == 11) {
         #if defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         format = Context::current() && Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
             ColorFormat::Red : ColorFormat::Luminance;
@@ -122,33 +298,121 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         format = ColorFormat::Luminance;
         #endif
         if(header.bpp != 8) {
-            Error() << "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel:" << header.bpp;
+            Error() << prefix << "unsupported grayscale bits-per-pixel:" << header.bpp;
             return std::nullopt;
         }
 
-    /* Compressed files */
+    /* Other types */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
+        Error() << prefix << "unsupported (compressed?) image type:" << header.imageType;
         return std::nullopt;
     }
 
-    const std::size_t dataSize = header.width*header.height*header.bpp/8;
-    char* const data = new char[dataSize];
-    in->read(data, dataSize);
+    /* Pixel data follow the header and the image ID field */
+    const std::size_t pixelSize = header.bpp/8;
+    const std::size_t dataSize = std::size_t(header.width)*header.height*pixelSize;
+    const char* const in = _in.data() + std::min(sizeof(TgaHeader) + header.identsize, _in.size());
+    const char* const end = _in.data() + _in.size();
+    const bool rle = header.imageType & 8;
+    if(!rle && std::size_t(end - in) < dataSize) {
+        Error() << prefix << "the file is too short, expected" << dataSize << "bytes of pixel data but got" << (end - in);
+        return std::nullopt;
+    }
 
-    Vector2i size(header.width, header.height);
+    return Properties{format, Vector2i(header.width, header.height), pixelSize, in, rle};
+}
+
+std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
+    const std::optional<Properties> properties = parseHeader("Trade::TgaImporter::image2D():");
+    if(!properties) return std::nullopt;
+
+    const ColorFormat format = properties->format;
+    const std::size_t pixelSize = properties->pixelSize;
+    const std::size_t pixelCount = std::size_t(properties->size.x())*properties->size.y();
+    const char* const in = properties->data;
+    const char* const end = _in.data() + _in.size();
+    const bool rle = properties->rle;
+
+    /* Rows are aligned to four bytes as expected by Image, the same as in
+       doImage2DRegion() */
+    const std::size_t rowLength = properties->size.x()*pixelSize;
+    const std::size_t rowSize = ((rowLength + 3)/4)*4;
+    char* const data = new char[rowSize*properties->size.y()];
 
-    if(format == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    if(rle) {
+        /* RLE packets can span row boundaries, so the data are decoded
+           tightly packed and the rows then moved apart */
+        std::size_t consumed;
+        switch(pixelSize) {
+            case 1: consumed = decodeRle<1>(in, end, data, pixelCount); break;
+            case 3: consumed = decodeRle<3>(in, end, data, pixelCount); break;
+            case 4: consumed = decodeRle<4>(in, end, data, pixelCount); break;
+            default: CORRADE_ASSERT_UNREACHABLE();
+        }
+
+        if(pixelCount && !consumed) {
+            Error() << "Trade::TgaImporter::image2D(): invalid or truncated RLE data";
+            delete[] data;
+            return std::nullopt;
+        }
+
+        spreadRows(data, rowLength, rowSize, properties->size.y());
+
+    } else if(pixelCount) {
+        const Range2Di region{{}, properties->size};
+        switch(pixelSize) {
+            case 1: convertRegion<1>(in, end, false, properties->size.x(), region, data, rowSize, _rleRows); break;
+            case 3: convertRegion<3>(in, end, false, properties->size.x(), region, data, rowSize, _rleRows); break;
+            case 4: convertRegion<4>(in, end, false, properties->size.x(), region, data, rowSize, _rleRows); break;
+            default: CORRADE_ASSERT_UNREACHABLE();
+        }
+    }
+
+    zeroRowPadding(data, rowLength, rowSize, properties->size.y());
+    return ImageData2D(format, ColorType::UnsignedByte, properties->size, data);
+}
+
+std::optional<Vector2i> TgaImporter::doImage2DSize(UnsignedInt) {
+    const std::optional<Properties> properties = parseHeader("Trade::TgaImporter::image2DSize():");
+    if(!properties) return std::nullopt;
+    return properties->size;
+}
+
+std::optional<ImageData2D> TgaImporter::doImage2DRegion(UnsignedInt, const Range2Di& region) {
+    const std::optional<Properties> properties = parseHeader("Trade::TgaImporter::image2D():");
+    if(!properties) return std::nullopt;
+
+    if(!(region.min() >= Vector2i{}).all() || !(region.min() <= region.max()).all() || !(region.max() <= properties->size).all()) {
+        Error() << "Trade::TgaImporter::image2D(): region" << region << "is not contained in image of size" << properties->size;
+        return std::nullopt;
+    }
+
+    /* Rows are aligned to four bytes as expected by Image, the same as in
+       doImage2D() */
+    const std::size_t pixelSize = properties->pixelSize;
+    const std::size_t rowLength = region.sizeX()*pixelSize;
+    const std::size_t rowSize = ((rowLength + 3)/4)*4;
+    char* const data = new char[rowSize*region.sizeY()];
+
+    if(region.size().product()) {
+        const char* const end = _in.data() + _in.size();
+        bool converted;
+        switch(pixelSize) {
+            case 1: converted = convertRegion<1>(properties->data, end, properties->rle, properties->size.x(), region, data, rowSize, _rleRows); break;
+            case 3: converted = convertRegion<3>(properties->data, end, properties->rle, properties->size.x(), region, data, rowSize, _rleRows); break;
+            case 4: converted = convertRegion<4>(properties->data, end, properties->rle, properties->size.x(), region, data, rowSize, _rleRows); break;
+            default: CORRADE_ASSERT_UNREACHABLE();
+        }
+
+        if(!converted) {
+            Error() << "Trade::TgaImporter::image2D(): invalid or truncated RLE data";
+            delete[] data;
+            return std::nullopt;
+        }
     }
 
-    return ImageData2D(format, ColorType::UnsignedByte, size, data);
+    zeroRowPadding(data, rowLength, rowSize, region.sizeY());
+    return ImageData2D(properties->format, ColorType::UnsignedByte, region.size(), data);
 }
 
 }}
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::TgaImporter
  */
 
+#include <vector>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/VisibilityMacros.h>
 
 #include "Magnum/Trade/AbstractImporter.h"
@@ -50,10 +52,23 @@
 
 namespace Magnum { namespace Trade {
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+namespace Implementation {
+    /* RLE decoder state at the beginning of an image row */
+    struct TgaRleRow {
+        std::size_t offset;
+        std::size_t remaining;
+        bool run;
+        char pixel[4];
+    };
+}
+#endif
+
 /**
 @brief TGA importer plugin
 
-Supports uncompressed BGR, BGRA or grayscale images with 8 bits per channel.
+Supports uncompressed and RLE-compressed BGR, BGRA or grayscale images with 8
+bits per channel.
 
 This plugin is built if `WITH_TGAIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `TgaImporter` plugin from
@@ -67,6 +82,31 @@ The images are imported with @ref ColorType::UnsignedByte and @ref ColorFormat::
 require extension @extension{ARB,texture_rg}. In OpenGL ES 2.0, if
 @es_extension{EXT,texture_rg} is not supported and in WebGL 1.0, grayscale
 images use @ref ColorFormat::Luminance instead of @ref ColorFormat::Red.
+Rows of the imported image are aligned to four bytes and the padding is
+zero-filled.
+
+On Unix the file passed to @ref openFile() is memory-mapped instead of read
+and the pixels are converted from BGR(A) to RGB(A) directly from the mapped
+memory into the output image, data passed to @ref openData() are copied.
+If Magnum is built with `MAGNUM_TARGET_SIMD`, the conversion uses SSSE3 or
+SSE2 on x86 and NEON on ARM, if the compiler targets given instruction set.
+
+The plugin supports @ref Feature::ImageRegion. Size of the image is read from
+the header only and for uncompressed files only rows covered by the imported
+region are converted. Together with the memory mapping this means only pages
+containing given region are read from the file. RLE-compressed files have to
+be decoded sequentially, but only the region itself is stored. The importer
+remembers decoder state at the beginning of each row it decoded (a few tens
+of bytes per row), so each import continues from the nearest known row at or
+above the region instead of from the beginning of the file. Importing an
+image in row-major order of tiles then decodes every row once for each tile
+column, only packets covering the tile are expanded. Rows of the imported
+region are aligned to four bytes the same way as for the whole image.
+
+On platforms without memory mapping, such as Windows, @ref openFile() reads
+the whole file into memory, so peak memory use when importing regions is not
+bounded by the region size there. The same applies to @ref openData(), which
+always copies the data.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -86,8 +126,15 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         void MAGNUM_TGAIMPORTER_LOCAL doClose() override;
         UnsignedInt MAGNUM_TGAIMPORTER_LOCAL doImage2DCount() const override;
         std::optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
+        std::optional<Vector2i> MAGNUM_TGAIMPORTER_LOCAL doImage2DSize(UnsignedInt id) override;
+        std::optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2DRegion(UnsignedInt id, const Range2Di& region) override;
+
+        struct Properties;
+        std::optional<Properties> MAGNUM_TGAIMPORTER_LOCAL parseHeader(const char* prefix) const;
 
-        std::istream* in;
+        Containers::Array<char> _in;
+        std::vector<Implementation::TgaRleRow> _rleRows;
+        bool _opened;
 };
 
 }}